@@ -1,30 +1,32 @@
 #!/usr/bin/env python
 """ROS has a parameter server, we have files.
 
-The parameter store is a persistent key value store, implemented as a directory with a writer lock.
-On Android, we store params under params_dir = /data/params. The writer lock is a file
-"<params_dir>/.lock" taken using flock(), and data is stored in a directory symlinked to by
-"<params_dir>/d".
+The parameter store is a persistent key value store, implemented as a single memory mapped file
+with a writer lock. On Android, we store params under params_dir = /data/params. The writer lock
+is a file "<params_dir>/.lock" taken using flock(), and data is stored in "<params_dir>/params.db":
 
-Each key, value pair is stored as a file with named <key> with contents <value>, located in
-  <params_dir>/d/<key>
-
-Readers of a single key can just open("<params_dir>/d/<key>") and read the file contents.
-Readers who want a consistent snapshot of multiple keys should take the lock.
+  [header, one page][slot 0][slot 1]
 
-Writers should take the lock before modifying anything. Writers should also leave the DB in a
-consistent state after a crash. The implementation below does this by copying all params to a temp
-directory <params_dir>/<tmp>, then atomically symlinking <params_dir>/<d> to <params_dir>/<tmp>
-before deleting the old <params_dir>/<d> directory.
+The header holds a sequence number, seq. Each slot holds every key and value with a checksum, and
+the low bit of seq picks the live one. Writers take the lock, write the other slot, flush it to disk
+and then bump seq, so the file always has one complete slot and seq never points at a half written
+one. Readers don't take the lock: they read seq, copy out the live slot and try again if seq moved
+in the meantime. As seq changes with every write, readers keep what they read and only parse the
+slot again when seq moved. selfdrive/common/params.cc implements the same format.
 
-Writers that only modify a single key can simply take the lock, then swap the corresponding value
-file in place without messing with <params_dir>/d.
+Every value is also mirrored into a file named <key> with contents <value>, located in
+  <params_dir>/d/<key>
+which is where the store used to keep them. A store that only has that directory is migrated into
+params.db the first time it is opened. Files put into d by anything other than the params code are
+picked up by the readers, at most about a second later.
 """
 import time
 import os
 import errno
 import sys
-import shutil
+import mmap
+import struct
+import zlib
 import fcntl
 import tempfile
 from enum import Enum
@@ -80,6 +82,31 @@ keys = {
 }
 
 
+PARAMS_DB_MAGIC = 0x534d5250  # "PRMS"
+PARAMS_DB_VERSION = 1
+PARAMS_DB_HEADER_SIZE = 4096
+PARAMS_DB_SLOT_SIZE = 256 * 1024
+
+# readers look for files put into d this often, in seconds
+MIRROR_CHECK_INTERVAL = 1.0
+# a lock free read that keeps failing while seq holds still means a corrupt slot
+READ_RETRIES = 100
+
+_HEADER = struct.Struct("<IIII")  # magic, version, seq, slot_size
+_SLOT_HEADER = struct.Struct("<IIII")  # len, crc, count, pad
+_ENTRY = struct.Struct("<II")  # key_len, value_len, then key and value padded to 4 bytes
+# native, so seq is read and written with one aligned load or store
+_SEQ = struct.Struct("=I")
+_SEQ_OFFSET = 8
+
+if sys.version_info[0] >= 3:
+  def _key_str(b):
+    return b.decode("utf8")
+else:
+  def _key_str(b):
+    return b
+
+
 def fsync_dir(path):
   fd = os.open(path, os.O_RDONLY)
   try:
@@ -104,6 +131,274 @@ class FileLock(object):
       self._fd = None
 
 
+def _crc32(data):
+  return zlib.crc32(data) & 0xffffffff
+
+
+def _pack_slot(vals):
+  parts = []
+  for k in sorted(vals.keys()):
+    kb = k.encode("utf8")
+    v = vals[k]
+    parts.append(_ENTRY.pack(len(kb), len(v)))
+    parts.append(kb)
+    parts.append(v)
+    parts.append(b"\0" * (-(len(kb) + len(v)) % 4))
+  data = b"".join(parts)
+  return _SLOT_HEADER.pack(len(data), _crc32(data), len(vals), 0) + data
+
+
+def _unpack_slot(buf, start, slot_size, check_crc=False):
+  """Parses the slot at start, raises ValueError if it is garbage."""
+  length, crc, count, _ = _SLOT_HEADER.unpack_from(buf, start)
+  if length > slot_size - _SLOT_HEADER.size:
+    raise ValueError("bad slot length")
+  data = buf[start + _SLOT_HEADER.size:start + _SLOT_HEADER.size + length]
+  if check_crc and _crc32(data) != crc:
+    raise ValueError("bad slot checksum")
+
+  vals = {}
+  pos = 0
+  for _ in range(count):
+    if length - pos < _ENTRY.size:
+      raise ValueError("bad slot entry")
+    key_len, value_len = _ENTRY.unpack_from(data, pos)
+    pos += _ENTRY.size
+    if key_len + value_len > length - pos:
+      raise ValueError("bad slot entry")
+    vals[_key_str(data[pos:pos + key_len])] = data[pos + key_len:pos + key_len + value_len]
+    pos += (key_len + value_len + 3) & ~3
+  return vals
+
+
+def _read_mirror(data_path):
+  vals = {}
+  try:
+    for key in os.listdir(data_path):
+      if not key[:1].isalnum():
+        continue
+      try:
+        with open(os.path.join(data_path, key), "rb") as f:
+          vals[key] = f.read()
+      except (OSError, IOError):
+        pass
+  except (OSError, IOError):
+    pass
+  return vals
+
+
+def _write_mirror(data_path, key, value):
+  fd, tmp_path = tempfile.mkstemp(prefix=".tmp", dir=os.path.dirname(data_path))
+  try:
+    with os.fdopen(fd, "wb") as f:
+      f.write(value)
+      f.flush()
+      os.fsync(f.fileno())
+    os.chmod(tmp_path, 0o666)
+    os.rename(tmp_path, os.path.join(data_path, key))
+  except:
+    os.remove(tmp_path)
+    raise
+
+
+def _futex_waker(mm):
+  """Wakes the C readers sleeping in params_wait_change, where we can."""
+  try:
+    import ctypes
+    import platform
+    nr = {"x86_64": 202, "aarch64": 98, "armv7l": 240, "armv8l": 240}[platform.machine()]
+    libc = ctypes.CDLL(None, use_errno=True)
+    addr = ctypes.addressof(ctypes.c_char.from_buffer(mm, _SEQ_OFFSET))
+    # FUTEX_WAKE, everybody
+    return lambda: libc.syscall(nr, ctypes.c_void_p(addr), 1, 0x7fffffff, None, None, 0)
+  except Exception:
+    return lambda: None
+
+
+class ParamsDB(object):
+  """The memory mapped store of one params directory. Use get_db."""
+  def __init__(self, path):
+    self._path = path
+    self._cache = (None, {})
+    self._mirror_checked = 0.
+    self._mirror_mtime = None
+
+    db_path = os.path.join(path, "params.db")
+    if not os.path.exists(db_path):
+      lock = self.lock()
+      try:
+        if not os.path.exists(db_path):
+          self._migrate(db_path)
+      finally:
+        lock.release()
+
+    with open(db_path, "r+b") as f:
+      magic, version, _, slot_size = _HEADER.unpack(f.read(_HEADER.size))
+      size = PARAMS_DB_HEADER_SIZE + 2 * slot_size
+      if magic != PARAMS_DB_MAGIC or version != PARAMS_DB_VERSION or \
+         os.fstat(f.fileno()).st_size < size:
+        raise IOError(errno.EINVAL, "bad params db", db_path)
+      self._slot_size = slot_size
+      self._mm = mmap.mmap(f.fileno(), size, mmap.MAP_SHARED, mmap.PROT_READ | mmap.PROT_WRITE)
+    self._wake = _futex_waker(self._mm)
+
+    self._recover()
+
+  def data_path(self):
+    return os.path.join(self._path, "d")
+
+  def lock(self):
+    lock = FileLock(os.path.join(self._path, ".lock"), True)
+    lock.acquire()
+    return lock
+
+  def seq(self):
+    return _SEQ.unpack_from(self._mm, _SEQ_OFFSET)[0]
+
+  def _slot(self, seq):
+    return PARAMS_DB_HEADER_SIZE + (seq & 1) * self._slot_size
+
+  def _unpack(self, seq, check_crc=False):
+    return _unpack_slot(self._mm, self._slot(seq), self._slot_size, check_crc)
+
+  def _migrate(self, db_path):
+    """Builds params.db out of the one file per key layout. Callers should hold the lock."""
+    slot = _pack_slot(_read_mirror(self.data_path()))
+    if len(slot) > PARAMS_DB_SLOT_SIZE:
+      raise IOError(errno.ENOSPC, "params too large", db_path)
+
+    fd, tmp_path = tempfile.mkstemp(prefix=".tmp_db_", dir=self._path)
+    try:
+      with os.fdopen(fd, "wb") as f:
+        f.write(_HEADER.pack(PARAMS_DB_MAGIC, PARAMS_DB_VERSION, 0, PARAMS_DB_SLOT_SIZE))
+        f.seek(PARAMS_DB_HEADER_SIZE)
+        f.write(slot)
+        f.truncate(PARAMS_DB_HEADER_SIZE + 2 * PARAMS_DB_SLOT_SIZE)
+        f.flush()
+        os.fsync(f.fileno())
+      os.chmod(tmp_path, 0o666)
+      os.rename(tmp_path, db_path)
+      fsync_dir(self._path)
+    except:
+      os.remove(tmp_path)
+      raise
+
+  def _slot_valid(self, seq):
+    try:
+      self._unpack(seq, check_crc=True)
+      return True
+    except ValueError:
+      return False
+
+  def _recover(self):
+    """Makes sure the live slot is intact, after a crash or a bad disk."""
+    if self._slot_valid(self.seq()):
+      return
+
+    lock = self.lock()
+    try:
+      seq = self.seq()
+      if not self._slot_valid(seq):
+        if self._slot_valid(seq + 1):
+          _SEQ.pack_into(self._mm, _SEQ_OFFSET, (seq + 1) & 0xffffffff)
+          self._mm.flush(0, PARAMS_DB_HEADER_SIZE)
+        else:
+          self.commit(_read_mirror(self.data_path()))
+    finally:
+      lock.release()
+
+  def read_all(self):
+    """Lock free snapshot of every value, a dict that must not be modified."""
+    self._check_mirror()
+
+    seq, vals = self._cache
+    if seq != self.seq():
+      seq, vals = self._read_live()
+      self._cache = (seq, vals)
+    return vals
+
+  def read_locked(self):
+    """Callers should hold the lock while calling this method."""
+    return self._unpack(self.seq())
+
+  def _read_live(self):
+    for _ in range(READ_RETRIES):
+      seq = self.seq()
+      try:
+        vals = self._unpack(seq)
+      except ValueError:
+        # rewritten while we copied it, so seq has moved
+        vals = None
+      if self.seq() == seq and vals is not None:
+        return seq, vals
+
+    # seq held still and the slot still didn't parse, it's corrupt. Put the
+    # last good values back and read under the lock, which raises if that
+    # didn't work either
+    self._recover()
+    lock = self.lock()
+    try:
+      return self.seq(), self.read_locked()
+    finally:
+      lock.release()
+
+  def commit(self, vals):
+    """Writes vals into the spare slot and makes it the live one. Callers should hold the lock."""
+    slot = _pack_slot(vals)
+    if len(slot) > self._slot_size:
+      raise IOError(errno.ENOSPC, "params too large")
+
+    seq = self.seq()
+    start = self._slot(seq + 1)
+    self._mm[start:start + len(slot)] = slot
+    # the slot has to be on disk before seq points at it
+    self._mm.flush(start, len(slot))
+    _SEQ.pack_into(self._mm, _SEQ_OFFSET, (seq + 1) & 0xffffffff)
+    self._mm.flush(0, PARAMS_DB_HEADER_SIZE)
+    self._wake()
+
+  def _check_mirror(self):
+    """Takes in files that were put into d by somebody other than the params code."""
+    now = time.time()
+    if now - self._mirror_checked < MIRROR_CHECK_INTERVAL:
+      return
+    self._mirror_checked = now
+
+    try:
+      mtime = os.stat(self.data_path()).st_mtime
+    except OSError:
+      return
+    if mtime == self._mirror_mtime:
+      return
+    self._mirror_mtime = mtime
+
+    _, vals = self._read_live()
+    mirror = _read_mirror(self.data_path())
+    if all(vals.get(k) == v for k, v in mirror.items()):
+      return
+
+    lock = self.lock()
+    try:
+      vals = self.read_locked()
+      if any(vals.get(k) != v for k, v in mirror.items()):
+        vals.update(_read_mirror(self.data_path()))
+        self.commit(vals)
+    finally:
+      lock.release()
+
+
+_dbs = {}
+
+def get_db(path):
+  """Opens the store of a params directory once per process, None if there is none."""
+  db = _dbs.get(path)
+  if db is None:
+    if not os.path.isdir(path):
+      return None
+    db = _dbs.setdefault(path, ParamsDB(path))
+  return db
+
+
 class DBAccessor(object):
   def __init__(self, path):
     self._path = path
@@ -120,31 +415,6 @@ class DBAccessor(object):
     except KeyError:
       return None
 
-  def _get_lock(self, create):
-    lock = FileLock(os.path.join(self._path, ".lock"), create)
-    lock.acquire()
-    return lock
-
-  def _read_values_locked(self):
-    """Callers should hold a lock while calling this method."""
-    vals = {}
-    try:
-      data_path = self._data_path()
-      keys = os.listdir(data_path)
-      for key in keys:
-        with open(os.path.join(data_path, key), "rb") as f:
-          vals[key] = f.read()
-    except (OSError, IOError) as e:
-      # Either the DB hasn't been created yet, or somebody wrote a bug and left the DB in an
-      # inconsistent state. Either way, return empty.
-      if e.errno == errno.ENOENT:
-        return {}
-
-    return vals
-
-  def _data_path(self):
-    return os.path.join(self._path, "d")
-
   def _check_entered(self):
     if self._vals is None:
       raise Exception("Must call __enter__ before using DB")
@@ -152,20 +422,10 @@ class DBAccessor(object):
 
 class DBReader(DBAccessor):
   def __enter__(self):
-    try:
-      lock = self._get_lock(False)
-    except OSError as e:
-      # Do not create lock if it does not exist.
-      if e.errno == errno.ENOENT:
-        self._vals = {}
-        return self
-
-    try:
-      # Read everything.
-      self._vals = self._read_values_locked()
-      return self
-    finally:
-      lock.release()
+    db = get_db(self._path)
+    # Do not create the DB if it does not exist.
+    self._vals = dict(db.read_all()) if db is not None else {}
+    return self
 
   def __exit__(self, type, value, traceback): pass
 
@@ -173,8 +433,10 @@ class DBReader(DBAccessor):
 class DBWriter(DBAccessor):
   def __init__(self, path):
     super(DBWriter, self).__init__(path)
+    self._db = None
     self._lock = None
     self._prev_umask = None
+    self._prev_vals = None
 
   def put(self, key, value):
     self._vals[key] = value
@@ -190,9 +452,15 @@ class DBWriter(DBAccessor):
 
     try:
       os.chmod(self._path, 0o777)
-      self._lock = self._get_lock(True)
-      self._vals = self._read_values_locked()
+      self._db = get_db(self._path)
+      mkdirs_exists_ok(self._db.data_path())
+      self._lock = self._db.lock()
+      self._prev_vals = self._db.read_locked()
+      self._vals = dict(self._prev_vals)
     except:
+      if self._lock is not None:
+        self._lock.release()
+        self._lock = None
       os.umask(self._prev_umask)
       self._prev_umask = None
       raise
@@ -203,59 +471,24 @@ class DBWriter(DBAccessor):
     self._check_entered()
 
     try:
-      # data_path refers to the externally used path to the params. It is a symlink.
-      # old_data_path is the path currently pointed to by data_path.
-      # tempdir_path is a path where the new params will go, which the new data path will point to.
-      # new_data_path is a temporary symlink that will atomically overwrite data_path.
-      #
-      # The current situation is:
-      #   data_path -> old_data_path
-      # We're going to write params data to tempdir_path
-      #   tempdir_path -> params data
-      # Then point new_data_path to tempdir_path
-      #   new_data_path -> tempdir_path
-      # Then atomically overwrite data_path with new_data_path
-      #   data_path -> tempdir_path
-      old_data_path = None
-      new_data_path = None
-      tempdir_path = tempfile.mkdtemp(prefix=".tmp", dir=self._path)
-
-      try:
-        # Write back all keys.
-        os.chmod(tempdir_path, 0o777)
-        for k, v in self._vals.items():
-          with open(os.path.join(tempdir_path, k), "wb") as f:
-            f.write(v)
-            f.flush()
-            os.fsync(f.fileno())
-        fsync_dir(tempdir_path)
-
-        data_path = self._data_path()
+      changed = dict((k, v) for k, v in self._vals.items() if self._prev_vals.get(k) != v)
+      deleted = [k for k in self._prev_vals if k not in self._vals]
+      if not changed and not deleted:
+        return
+
+      # Mirror first, then write back all keys in one go.
+      data_path = self._db.data_path()
+      for k, v in changed.items():
+        _write_mirror(data_path, k, v)
+      for k in deleted:
         try:
-          old_data_path = os.path.join(self._path, os.readlink(data_path))
-        except (OSError, IOError):
-          # NOTE(mgraczyk): If other DB implementations have bugs, this could cause
-          #                 copies to be left behind, but we still want to overwrite.
-          pass
-
-        new_data_path = "{}.link".format(tempdir_path)
-        os.symlink(os.path.basename(tempdir_path), new_data_path)
-        os.rename(new_data_path, data_path)
-        fsync_dir(self._path)
-      finally:
-        # If the rename worked, we can delete the old data. Otherwise delete the new one.
-        success = new_data_path is not None and os.path.exists(data_path) and (
-          os.readlink(data_path) == os.path.basename(tempdir_path))
-
-        if success:
-          if old_data_path is not None:
-            shutil.rmtree(old_data_path)
-        else:
-          shutil.rmtree(tempdir_path)
+          os.remove(os.path.join(data_path, k))
+        except OSError as e:
+          if e.errno != errno.ENOENT:
+            raise
+      fsync_dir(data_path)
 
-        # Regardless of what happened above, there should be no link at new_data_path.
-        if new_data_path is not None and os.path.islink(new_data_path):
-          os.remove(new_data_path)
+      self._db.commit(self._vals)
     finally:
       os.umask(self._prev_umask)
       self._prev_umask = None
@@ -266,38 +499,21 @@ class DBWriter(DBAccessor):
 
 
 def read_db(params_path, key):
-  path = "%s/d/%s" % (params_path, key)
-  try:
-    with open(path, "rb") as f:
-      return f.read()
-  except IOError:
+  db = get_db(params_path)
+  if db is None:
     return None
+  return db.read_all().get(key)
 
 def write_db(params_path, key, value):
-  prev_umask = os.umask(0)
-  lock = FileLock(params_path+"/.lock", True)
-  lock.acquire()
-
-  try:
-    tmp_path = tempfile.mktemp(prefix=".tmp", dir=params_path)
-    with open(tmp_path, "wb") as f:
-      f.write(value)
-      f.flush()
-      os.fsync(f.fileno())
-
-    path = "%s/d/%s" % (params_path, key)
-    os.rename(tmp_path, path)
-    fsync_dir(os.path.dirname(path))
-  finally:
-    os.umask(prev_umask)
-    lock.release()
+  with DBWriter(params_path) as txn:
+    txn.put(key, value)
 
 class Params(object):
   def __init__(self, db='/data/params'):
     self.db = db
 
     # create the database if it doesn't exist...
-    if not os.path.exists(self.db+"/d"):
+    if not os.path.exists(os.path.join(self.db, "params.db")):
       with self.transaction(write=True):
         pass
 
@@ -331,7 +547,7 @@ class Params(object):
       ret = read_db(self.db, key)
       if not block or ret is not None:
         break
-      # is polling really the best we can do?
+      # reads are cheap, they only parse the store again when it changed
       time.sleep(0.05)
     return ret
 
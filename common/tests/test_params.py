@@ -0,0 +1,152 @@
+import os
+import time
+import shutil
+import tempfile
+import threading
+import unittest
+import multiprocessing
+
+import common.params as params
+from common.params import Params, UnknownKeyName
+
+
+def _writer(path, key, n):
+  p = Params(path)
+  for i in range(n):
+    p.put(key, str(i).encode())
+
+
+class TestParams(unittest.TestCase):
+  def setUp(self):
+    self.tmpdir = tempfile.mkdtemp()
+    self.params = Params(self.tmpdir)
+
+  def tearDown(self):
+    params._dbs.clear()
+    shutil.rmtree(self.tmpdir)
+
+  def _reopen(self):
+    params._dbs.clear()
+    return Params(self.tmpdir)
+
+  def test_params_put_and_get(self):
+    self.params.put("DongleId", b"cb38263377b873ee")
+    self.assertEqual(self.params.get("DongleId"), b"cb38263377b873ee")
+    self.assertEqual(self._reopen().get("DongleId"), b"cb38263377b873ee")
+
+  def test_params_non_ascii(self):
+    st = b"".join(bytes(bytearray([i])) for i in range(256))
+    self.params.put("CarParams", st)
+    self.assertEqual(self.params.get("CarParams"), st)
+    self.params.put("CarParams", b"")
+    self.assertEqual(self.params.get("CarParams"), b"")
+
+  def test_params_unknown_key_fails(self):
+    with self.assertRaises(UnknownKeyName):
+      self.params.get("swag")
+
+  def test_delete_and_clear(self):
+    self.params.put("CarParams", b"test")
+    self.params.put("DongleId", b"cb38263377b873ee")
+    self.params.delete("DongleId")
+    self.assertEqual(self.params.get("DongleId"), None)
+    self.assertFalse(os.path.exists(os.path.join(self.tmpdir, "d", "DongleId")))
+
+    self.params.manager_start()
+    self.assertEqual(self.params.get("CarParams"), None)
+
+  def test_mirror(self):
+    self.params.put("DongleId", b"cb38263377b873ee")
+    with open(os.path.join(self.tmpdir, "d", "DongleId"), "rb") as f:
+      self.assertEqual(f.read(), b"cb38263377b873ee")
+
+  def test_migrate(self):
+    # the old layout, d links to the real directory
+    old = tempfile.mkdtemp()
+    try:
+      os.mkdir(os.path.join(old, ".tmpabc"))
+      os.symlink(".tmpabc", os.path.join(old, "d"))
+      for k, v in [("DongleId", b"abc"), ("IsMetric", b"1")]:
+        with open(os.path.join(old, "d", k), "wb") as f:
+          f.write(v)
+
+      p = Params(old)
+      self.assertTrue(os.path.exists(os.path.join(old, "params.db")))
+      self.assertEqual(p.get("DongleId"), b"abc")
+      self.assertEqual(p.get("IsMetric"), b"1")
+      p.put("IsMetric", b"0")
+      with open(os.path.join(old, ".tmpabc", "IsMetric"), "rb") as f:
+        self.assertEqual(f.read(), b"0")
+    finally:
+      shutil.rmtree(old)
+
+  def test_external_write(self):
+    self.params.put("IsMetric", b"0")
+    old_interval = params.MIRROR_CHECK_INTERVAL
+    params.MIRROR_CHECK_INTERVAL = 0
+    try:
+      # like something writing the files directly
+      tmp = os.path.join(self.tmpdir, ".tmp_external")
+      with open(tmp, "wb") as f:
+        f.write(b"1")
+      os.rename(tmp, os.path.join(self.tmpdir, "d", "IsMetric"))
+      self.assertEqual(self.params.get("IsMetric"), b"1")
+    finally:
+      params.MIRROR_CHECK_INTERVAL = old_interval
+
+  def test_recover_torn_slot(self):
+    self.params.put("DongleId", b"first")
+    self.params.put("DongleId", b"second")
+
+    # garbage in the live slot, as if the disk lost it
+    db = params.get_db(self.tmpdir)
+    start = db._slot(db.seq())
+    db._mm[start + 20:start + 24] = b"\xff\xff\xff\xff"
+    # or the mirror would bring the value back
+    os.remove(os.path.join(self.tmpdir, "d", "DongleId"))
+    self.assertEqual(self._reopen().get("DongleId"), b"first")
+
+  def test_read_corrupt_slot(self):
+    self.params.put("DongleId", b"first")
+    self.params.put("DongleId", b"second")
+
+    # corrupted under a reader that has it open, seq never moves
+    db = params.get_db(self.tmpdir)
+    start = db._slot(db.seq())
+    db._mm[start + 20:start + 24] = b"\xff\xff\xff\xff"
+    os.remove(os.path.join(self.tmpdir, "d", "DongleId"))
+    _, vals = db._read_live()
+    self.assertEqual(vals["DongleId"], b"first")
+
+  def test_readers_cache(self):
+    self.params.put("DongleId", b"abc")
+    db = params.get_db(self.tmpdir)
+    vals = db.read_all()
+    self.assertIs(db.read_all(), vals)
+    self.params.put("IsMetric", b"1")
+    self.assertIsNot(db.read_all(), vals)
+
+  def test_params_get_block(self):
+    def _delayed_writer():
+      time.sleep(0.1)
+      Params(self.tmpdir).put("CarParams", b"test")
+    threading.Thread(target=_delayed_writer).start()
+    self.assertEqual(self.params.get("CarParams"), None)
+    self.assertEqual(self.params.get("CarParams", block=True), b"test")
+
+  def test_multiprocess_writers(self):
+    writers = [multiprocessing.Process(target=_writer, args=(self.tmpdir, k, 50))
+               for k in ["DongleId", "IsMetric", "Version", "GitBranch"]]
+    for w in writers:
+      w.start()
+    for w in writers:
+      w.join()
+      self.assertEqual(w.exitcode, 0)
+
+    p = self._reopen()
+    for k in ["DongleId", "IsMetric", "Version", "GitBranch"]:
+      self.assertEqual(p.get(k), b"49")
+
+
+if __name__ == "__main__":
+  unittest.main()
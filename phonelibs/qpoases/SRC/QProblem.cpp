@@ -842,11 +842,12 @@ returnValue QProblem::solveInitialQP(	const real_t* const xOpt, const real_t* co
 
 	/* 3) Obtain linear independent working set for auxiliary QP. */
 
-	static Bounds auxiliaryBounds;
+	/* on the stack, so that QProblems can be set up on many threads */
+	Bounds auxiliaryBounds;
 
 	auxiliaryBounds.init( nV );
 
-	static Constraints auxiliaryConstraints;
+	Constraints auxiliaryConstraints;
 
 	auxiliaryConstraints.init( nC );
 
@@ -867,7 +867,8 @@ returnValue QProblemB::solveInitialQP(	const real_t* const xOpt, const real_t* c
 
 	/* 3) Obtain linear independent working set for auxiliary QP. */
 
-	static Bounds auxiliaryBounds;
+	/* on the stack, so that QProblems can be set up on many threads */
+	Bounds auxiliaryBounds;
 
 	auxiliaryBounds.init( nV );
 
@@ -4,17 +4,53 @@
 #include <assert.h>
 #include <string.h>
 #include <unistd.h>
+#include <limits.h>
+#include <sched.h>
 
 #include "common/efd.h"
+#include "common/futex.h"
 
 #include "buffering.h"
 
+// everything is sequentially consistent, the sleep/wake handshakes need it
+#define LOAD(p) __atomic_load_n((p), __ATOMIC_SEQ_CST)
+#define STORE(p, v) __atomic_store_n((p), (v), __ATOMIC_SEQ_CST)
+#define XCHG(p, v) __atomic_exchange_n((p), (v), __ATOMIC_SEQ_CST)
+#define FETCH_ADD(p, v) __atomic_fetch_add((p), (v), __ATOMIC_SEQ_CST)
+#define FETCH_SUB(p, v) __atomic_fetch_sub((p), (v), __ATOMIC_SEQ_CST)
+#define CAS(p, e, v) __atomic_compare_exchange_n((p), (e), (v), false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST)
+
+// the state of a buffer counts what holds it: its dispatches waiting in
+// pending_idx and its acquires not released yet. A writer may dispatch a
+// buffer again while it's still pending or read, like it could with the lock.
+enum {
+  TB_FREE = 0,
+  TB_PENDING = 1,
+  TB_READING = 1 << 16,
+};
+
+// the eventfd is readable while signaled is set
+static void efd_signal(int efd, bool *used, bool *signaled) {
+  if (LOAD(used) && !XCHG(signaled, true)) {
+    efd_write(efd);
+  }
+}
+
+// returns true if it cleared it
+static bool efd_unsignal(int efd, bool *used, bool *signaled) {
+  if (LOAD(used) && XCHG(signaled, false)) {
+    efd_clear(efd);
+    return true;
+  }
+  return false;
+}
+
 void tbuffer_init(TBuffer *tb, int num_bufs, const char* name) {
   assert(num_bufs >= 3);
 
   memset(tb, 0, sizeof(TBuffer));
-  tb->reading = (bool*)calloc(num_bufs, sizeof(bool));
-  assert(tb->reading);
+  tb->state = (int*)calloc(num_bufs, sizeof(int));
+  assert(tb->state);
   tb->pending_idx = -1;
   tb->num_bufs = num_bufs;
   tb->name = name;
@@ -36,108 +72,109 @@ void tbuffer_init2(TBuffer *tb, int num_bufs, const char* name,
 }
 
 int tbuffer_efd(TBuffer *tb) {
+  STORE(&tb->efd_used, true);
+  // anything dispatched before has to show up too
+  if (LOAD(&tb->pending_idx) != -1 || LOAD(&tb->stopped)) {
+    efd_signal(tb->efd, &tb->efd_used, &tb->efd_signaled);
+  }
   return tb->efd;
 }
 
 int tbuffer_select(TBuffer *tb) {
-  pthread_mutex_lock(&tb->lock);
-
   int i;
   for (i=0; i<tb->num_bufs; i++) {
-    if (!tb->reading[i] && i != tb->pending_idx) {
+    if (LOAD(&tb->state[i]) == TB_FREE) {
       break;
     }
   }
   assert(i < tb->num_bufs);
 
-  pthread_mutex_unlock(&tb->lock);
   return i;
 }
 
 void tbuffer_dispatch(TBuffer *tb, int idx) {
-  pthread_mutex_lock(&tb->lock);
+  assert(idx >= 0 && idx < tb->num_bufs);
 
-  if (tb->pending_idx != -1) {
+  // pending before it's visible, so tbuffer_select skips it from here on
+  FETCH_ADD(&tb->state[idx], TB_PENDING);
+
+  // whoever takes an index out of pending_idx owns it. Every dispatch ends
+  // in one release_cb, for a dropped one right here (even if it was idx)
+  int dropped = XCHG(&tb->pending_idx, idx);
+  if (dropped != -1) {
     //printf("tbuffer (%s) dropped!\n", tb->name ? tb->name : "?");
+    FETCH_SUB(&tb->state[dropped], TB_PENDING);
     if (tb->release_cb) {
-      tb->release_cb(tb->cb_cookie, tb->pending_idx);
+      tb->release_cb(tb->cb_cookie, dropped);
     }
-    tb->pending_idx = -1;
   }
 
-  tb->pending_idx = idx;
-
-  efd_write(tb->efd);
-  pthread_cond_signal(&tb->cv);
-
-  pthread_mutex_unlock(&tb->lock);  
+  efd_signal(tb->efd, &tb->efd_used, &tb->efd_signaled);
+  seq_wake(&tb->seq, &tb->waiters, 1, &tb->lock, &tb->cv);
 }
 
 int tbuffer_acquire(TBuffer *tb) {
-  pthread_mutex_lock(&tb->lock);
-
-  if (tb->stopped) {
-    pthread_mutex_unlock(&tb->lock);
-    return -1;
-  }
-
-  while (tb->pending_idx == -1) {
-    pthread_cond_wait(&tb->cv, &tb->lock);
-
-    if (tb->stopped) {
-      pthread_mutex_unlock(&tb->lock);
+  while (true) {
+    if (LOAD(&tb->stopped)) {
       return -1;
     }
-  }
-
-  efd_clear(tb->efd);
-
-  int ret = tb->pending_idx;
-  assert(ret < tb->num_bufs);
-
-  tb->reading[ret] = true;
-  tb->pending_idx = -1;
 
-  pthread_mutex_unlock(&tb->lock);
+    const uint32_t seq = LOAD(&tb->seq);
+    int ret = XCHG(&tb->pending_idx, -1);
+    if (ret != -1) {
+      assert(ret < tb->num_bufs);
+      FETCH_ADD(&tb->state[ret], TB_READING - TB_PENDING);
+
+      if (efd_unsignal(tb->efd, &tb->efd_used, &tb->efd_signaled)) {
+        // a dispatch in between found it still signaled
+        if (LOAD(&tb->pending_idx) != -1) {
+          efd_signal(tb->efd, &tb->efd_used, &tb->efd_signaled);
+        }
+      }
+      return ret;
+    }
 
-  return ret;
+    FETCH_ADD(&tb->waiters, 1);
+    if (LOAD(&tb->pending_idx) == -1 && !LOAD(&tb->stopped)) {
+      seq_wait(&tb->seq, seq, -1, &tb->lock, &tb->cv);
+    }
+    FETCH_SUB(&tb->waiters, 1);
+  }
 }
 
-static void tbuffer_release_locked(TBuffer *tb, int idx) {
-  assert(idx < tb->num_bufs);
-  if (!tb->reading[idx]) {
-    printf("!! releasing tbuffer we aren't reading %d\n", idx);
-  }
+static bool tbuffer_release_reading(TBuffer *tb, int idx) {
+  int state = LOAD(&tb->state[idx]);
+  do {
+    if (state < TB_READING) {
+      return false;
+    }
+  } while (!CAS(&tb->state[idx], &state, state - TB_READING));
 
+  // free first, the callback may hand the buffer straight back to the writer
   if (tb->release_cb) {
     tb->release_cb(tb->cb_cookie, idx);
   }
-
-  tb->reading[idx] = false;
+  return true;
 }
 
 void tbuffer_release(TBuffer *tb, int idx) {
-  pthread_mutex_lock(&tb->lock);
-  tbuffer_release_locked(tb, idx);
-  pthread_mutex_unlock(&tb->lock);
+  assert(idx < tb->num_bufs);
+  if (!tbuffer_release_reading(tb, idx)) {
+    printf("!! releasing tbuffer we aren't reading %d\n", idx);
+  }
 }
 
 void tbuffer_release_all(TBuffer *tb) {
-  pthread_mutex_lock(&tb->lock);
   for (int i=0; i<tb->num_bufs; i++) {
-    if (tb->reading[i]) {
-      tbuffer_release_locked(tb, i);
-    }
+    while (tbuffer_release_reading(tb, i)) {}
   }
-  pthread_mutex_unlock(&tb->lock);
 }
 
 void tbuffer_stop(TBuffer *tb) {
-  pthread_mutex_lock(&tb->lock);
-  tb->stopped = true;
+  STORE(&tb->stopped, true);
+  STORE(&tb->efd_signaled, true);
   efd_write(tb->efd);
-  pthread_cond_signal(&tb->cv);
-  pthread_mutex_unlock(&tb->lock);
+  seq_wake(&tb->seq, &tb->waiters, INT_MAX, &tb->lock, &tb->cv);
 }
 
 
@@ -175,44 +212,35 @@ void pool_init2(Pool *s, int num_bufs,
 
 
 void pool_acquire(Pool *s, int idx) {
-  pthread_mutex_lock(&s->lock);
-
   assert(idx >= 0 && idx < s->num_bufs);
 
-  s->refcnt[idx]++;
-
-  pthread_mutex_unlock(&s->lock);
+  FETCH_ADD(&s->refcnt[idx], 1);
 }
 
-static void pool_release_locked(Pool *s, int idx) {
+void pool_release(Pool *s, int idx) {
   // printf("release %d refcnt %d\n", idx, s->refcnt[idx]);
 
   assert(idx >= 0 && idx < s->num_bufs);
 
-  assert(s->refcnt[idx] > 0);
-  s->refcnt[idx]--;
+  int refcnt = FETCH_SUB(&s->refcnt[idx], 1) - 1;
+  assert(refcnt >= 0);
 
-  // printf("release %d -> %d, %p\n", idx, s->refcnt[idx], s->release_cb);
-  if (s->refcnt[idx] == 0 && s->release_cb) {
+  // printf("release %d -> %d, %p\n", idx, refcnt, s->release_cb);
+  if (refcnt == 0 && s->release_cb) {
     // printf("call %p\b", s->release_cb);
     s->release_cb(s->cb_cookie, idx);
   }
 }
 
-void pool_release(Pool *s, int idx) {
-  pthread_mutex_lock(&s->lock);
-  pool_release_locked(s, idx);
-  pthread_mutex_unlock(&s->lock);
-}
-
 TBuffer* pool_get_tbuffer(Pool *s) {
   pthread_mutex_lock(&s->lock);
 
   assert(s->num_tbufs < POOL_MAX_TBUFS);
   TBuffer* tbuf = &s->tbufs[s->num_tbufs];
-  s->num_tbufs++;
   tbuffer_init2(tbuf, s->num_bufs,
                 "pool", (void (*)(void *, int))pool_release, s);
+  // pool_push picks it up from here
+  STORE(&s->num_tbufs, s->num_tbufs + 1);
 
   bool stopped = s->stopped;
   pthread_mutex_unlock(&s->lock);
@@ -231,17 +259,19 @@ PoolQueue* pool_get_queue(Pool *s) {
 
   int i;
   for (i = 0; i < POOL_MAX_QUEUES; i++) {
-    if (!s->queues[i].inited) {
+    if (!LOAD(&s->queues[i].inited)) {
       break;
     }
   }
   assert(i < POOL_MAX_QUEUES);
 
+  // not a memset, a pool_push may be counted in pushers
   PoolQueue *c = &s->queues[i];
-  memset(c, 0, sizeof(*c));
-
   c->pool = s;
-  c->inited = true;
+  c->stopped = false;
+  c->head = c->tail = 0;
+  c->seq = c->waiters = 0;
+  c->efd_used = c->efd_signaled = false;
 
   c->efd = efd_init();
   assert(c->efd >= 0);
@@ -254,6 +284,9 @@ PoolQueue* pool_get_queue(Pool *s) {
   pthread_mutex_init(&c->lock, NULL);
   pthread_cond_init(&c->cv, NULL);
 
+  // pool_push picks it up from here
+  STORE(&c->inited, true);
+
   pthread_mutex_unlock(&s->lock);
   return c;
 }
@@ -262,21 +295,22 @@ void pool_release_queue(PoolQueue *c) {
   Pool *s = c->pool;
 
   pthread_mutex_lock(&s->lock);
-  pthread_mutex_lock(&c->lock);
+
+  STORE(&c->inited, false);
+  // a push that saw the queue still inited finishes first
+  while (LOAD(&c->pushers) > 0) {
+    sched_yield();
+  }
 
   for (int i=0; i<c->num; i++) {
     if (c->idx[i] != -1) {
-      pool_release_locked(s, c->idx[i]);
+      pool_release(s, c->idx[i]);
     }
   }
 
   close(c->efd);
   free(c->idx);
 
-  c->inited = false;
-
-  pthread_mutex_unlock(&c->lock);
-
   pthread_mutex_destroy(&c->lock);
   pthread_cond_destroy(&c->cv);
 
@@ -284,11 +318,10 @@ void pool_release_queue(PoolQueue *c) {
 }
 
 int pool_select(Pool *s) {
-  pthread_mutex_lock(&s->lock);
-
   int i;
   for (i=0; i<s->num_bufs; i++) {
-    if (s->refcnt[i] == 0) {
+    int expected = 0;
+    if (CAS(&s->refcnt[i], &expected, 1)) {
       break;
     }
   }
@@ -296,12 +329,13 @@ int pool_select(Pool *s) {
   if (i >= s->num_bufs) {
     // overwrite the oldest
     // still being using in a queue or tbuffer :/
+    pthread_mutex_lock(&s->lock);
 
     int min_k = 0;
-    int min_ts = s->ts[0];
+    int min_ts = LOAD(&s->ts[0]);
     for (int k=1; k<s->num_bufs; k++) {
-      if (s->ts[k] < min_ts) {
-        min_ts = s->ts[k];
+      if (LOAD(&s->ts[k]) < min_ts) {
+        min_ts = LOAD(&s->ts[k]);
         min_k = k;
       }
     }
@@ -312,104 +346,112 @@ int pool_select(Pool *s) {
     if (s->release_cb) {
       s->release_cb(s->cb_cookie, min_k);
     }
-  }
 
-  s->refcnt[i]++;
+    FETCH_ADD(&s->refcnt[i], 1);
 
-  s->ts[i] = s->counter;
-  s->counter++;
+    pthread_mutex_unlock(&s->lock);
+  }
 
-  pthread_mutex_unlock(&s->lock);
+  STORE(&s->ts[i], FETCH_ADD(&s->counter, 1));
 
   return i;
 }
 
 void pool_push(Pool *s, int idx) {
-  pthread_mutex_lock(&s->lock);
-
   // printf("push %d head %d tail %d\n", idx, s->head, s->tail);
 
   assert(idx >= 0 && idx < s->num_bufs);
 
-  s->ts[idx] = s->counter;
-  s->counter++;
+  STORE(&s->ts[idx], FETCH_ADD(&s->counter, 1));
 
-  assert(s->refcnt[idx] > 0);
-  s->refcnt[idx]--; //push is a implcit release
+  assert(LOAD(&s->refcnt[idx]) > 0);
 
-  int num_tbufs = s->num_tbufs;
-  s->refcnt[idx] += num_tbufs;
+  // references for the consumers go on before the push's own comes off
+  int num_tbufs = LOAD(&s->num_tbufs);
+  FETCH_ADD(&s->refcnt[idx], num_tbufs);
+  int consumers = num_tbufs;
 
   // dispatch pool queues
   for (int i=0; i<POOL_MAX_QUEUES; i++) {
     PoolQueue *c = &s->queues[i];
-    if (!c->inited) continue;
-    
-    pthread_mutex_lock(&c->lock);
-    if (((c->head+1) % c->num) == c->tail) {
-      // queue is full. skip for now
-      pthread_mutex_unlock(&c->lock);
-      continue;
-    }
-
-    s->refcnt[idx]++;
-
-    c->idx[c->head] = idx;
-    c->head = (c->head+1) % c->num;
-    assert(c->head != c->tail);
-    pthread_mutex_unlock(&c->lock);
 
-    efd_write(c->efd);
-    pthread_cond_signal(&c->cv);
+    FETCH_ADD(&c->pushers, 1);
+    if (LOAD(&c->inited)) {
+      const int head = LOAD(&c->head);
+      const int next = (head+1) % c->num;
+      if (next == LOAD(&c->tail)) {
+        // queue is full. skip for now
+      } else {
+        FETCH_ADD(&s->refcnt[idx], 1);
+        consumers++;
+
+        STORE(&c->idx[head], idx);
+        STORE(&c->head, next);
+
+        efd_signal(c->efd, &c->efd_used, &c->efd_signaled);
+        seq_wake(&c->seq, &c->waiters, 1, &c->lock, &c->cv);
+      }
+    }
+    FETCH_SUB(&c->pushers, 1);
   }
 
-  pthread_mutex_unlock(&s->lock);
-
   for (int i=0; i<num_tbufs; i++) {
     tbuffer_dispatch(&s->tbufs[i], idx);
   }
-}
-
-int poolq_pop(PoolQueue *c) {
-  pthread_mutex_lock(&c->lock);
 
-  if (c->stopped) {
-    pthread_mutex_unlock(&c->lock);
-    return -1;
+  //push is a implcit release
+  if (consumers > 0) {
+    pool_release(s, idx);
+  } else {
+    FETCH_SUB(&s->refcnt[idx], 1);
   }
+}
 
-  while (c->head == c->tail) {
-    pthread_cond_wait(&c->cv, &c->lock);
-
-    if (c->stopped) {
-      pthread_mutex_unlock(&c->lock);
+int poolq_pop(PoolQueue *c) {
+  while (true) {
+    if (LOAD(&c->stopped)) {
       return -1;
     }
-  }
 
-  // printf("pop head %d tail %d\n", s->head, s->tail);
+    const uint32_t seq = LOAD(&c->seq);
+    // the consumer owns tail
+    const int tail = LOAD(&c->tail);
+    if (tail != LOAD(&c->head)) {
+      // printf("pop head %d tail %d\n", s->head, s->tail);
+
+      int r = LOAD(&c->idx[tail]);
+      STORE(&c->idx[tail], -1);
+      const int next = (tail+1) % c->num;
+      STORE(&c->tail, next);
+
+      // queue event is level triggered
+      if (next == LOAD(&c->head) && efd_unsignal(c->efd, &c->efd_used, &c->efd_signaled)) {
+        // a push in between found it still signaled
+        if (next != LOAD(&c->head)) {
+          efd_signal(c->efd, &c->efd_used, &c->efd_signaled);
+        }
+      }
 
-  assert(c->head != c->tail);
+      // printf("pop %d head %d tail %d\n", r, s->head, s->tail);
 
-  int r = c->idx[c->tail];
-  c->idx[c->tail] = -1;
-  c->tail = (c->tail+1) % c->num;
+      assert(r >= 0 && r < c->num_bufs);
+      return r;
+    }
 
-  // queue event is level triggered
-  if (c->head == c->tail) {
-    efd_clear(c->efd);
+    FETCH_ADD(&c->waiters, 1);
+    if (LOAD(&c->head) == tail && !LOAD(&c->stopped)) {
+      seq_wait(&c->seq, seq, -1, &c->lock, &c->cv);
+    }
+    FETCH_SUB(&c->waiters, 1);
   }
-
-  // printf("pop %d head %d tail %d\n", r, s->head, s->tail);
-
-  assert(r >= 0 && r < c->num_bufs);
-
-  pthread_mutex_unlock(&c->lock);
-
-  return r;
 }
 
 int poolq_efd(PoolQueue *c) {
+  STORE(&c->efd_used, true);
+  // anything pushed before has to show up too
+  if (LOAD(&c->tail) != LOAD(&c->head) || LOAD(&c->stopped)) {
+    efd_signal(c->efd, &c->efd_used, &c->efd_signaled);
+  }
   return c->efd;
 }
 
@@ -418,7 +460,7 @@ void poolq_release(PoolQueue *c, int idx) {
 }
 
 void pool_stop(Pool *s) {
-  for (int i=0; i<s->num_tbufs; i++) {
+  for (int i=0; i<LOAD(&s->num_tbufs); i++) {
     tbuffer_stop(&s->tbufs[i]);
   }
 
@@ -426,13 +468,12 @@ void pool_stop(Pool *s) {
   s->stopped = true;
   for (int i=0; i<POOL_MAX_QUEUES; i++) {
     PoolQueue *c = &s->queues[i];
-    if (!c->inited) continue;
+    if (!LOAD(&c->inited)) continue;
 
-    pthread_mutex_lock(&c->lock);
-    c->stopped = true;
-    pthread_mutex_unlock(&c->lock);
+    STORE(&c->stopped, true);
+    STORE(&c->efd_signaled, true);
     efd_write(c->efd);
-    pthread_cond_signal(&c->cv);
+    seq_wake(&c->seq, &c->waiters, INT_MAX, &c->lock, &c->cv);
   }
   pthread_mutex_unlock(&s->lock);
 }
@@ -2,6 +2,7 @@
 #define BUFFERING_H
 
 #include <stdbool.h>
+#include <stdint.h>
 #include <pthread.h>
 
 #ifdef __cplusplus
@@ -9,13 +10,20 @@ extern "C" {
 #endif
 
 // Tripple buffering helper
+//
+// Lock free: the buffer states and the pending index are atomics, a
+// blocked reader sleeps on seq (a futex on linux) and writers only make the
+// wake syscall if somebody is waiting. The eventfd is only kept up to date
+// once tbuffer_efd has been called. lock and cv are the sleeping side where
+// there are no futexes.
 
 typedef struct TBuffer {
     pthread_mutex_t lock;
     pthread_cond_t cv;
     int efd;
 
-    bool* reading;
+    // TB_FREE or a count of TB_PENDING and TB_READING per buffer
+    int* state;
     int pending_idx;
 
     int num_bufs;
@@ -25,6 +33,12 @@ typedef struct TBuffer {
     void *cb_cookie;
 
     bool stopped;
+
+    // bumped by every dispatch and stop
+    uint32_t seq;
+    uint32_t waiters;
+    bool efd_used;
+    bool efd_signaled;
 } TBuffer;
 
 // num_bufs must be at least the number of buffers that can be acquired simultaniously plus two
@@ -66,6 +80,8 @@ void tbuffer_stop(TBuffer *tb);
 
 typedef struct Pool Pool;
 
+// A queue has one consumer, and a pool is pushed by one thread at a time:
+// the queue is a single producer single consumer ring.
 typedef struct PoolQueue {
   pthread_mutex_t lock;
   pthread_cond_t cv;
@@ -77,6 +93,13 @@ typedef struct PoolQueue {
   int num;
   int head, tail;
   int* idx;
+
+  uint32_t seq;
+  uint32_t waiters;
+  bool efd_used;
+  bool efd_signaled;
+  // pool_push calls looking at the queue, pool_release_queue waits them out
+  int pushers;
 } PoolQueue;
 
 int poolq_pop(PoolQueue *s);
@@ -84,6 +107,7 @@ int poolq_efd(PoolQueue *s);
 void poolq_release(PoolQueue *c, int idx);
 
 typedef struct Pool {
+  // setup and eviction only
   pthread_mutex_t lock;
   bool stopped;
   int num_bufs;
@@ -1,52 +1,207 @@
 #include <stdlib.h>
 #include <string.h>
 #include <assert.h>
+#include <time.h>
+
+#include "common/futex.h"
 
 #include "cqueue.h"
 
+#define LOAD(p) __atomic_load_n((p), __ATOMIC_SEQ_CST)
+#define LOAD_ACQ(p) __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define LOAD_RELAXED(p) __atomic_load_n((p), __ATOMIC_RELAXED)
+#define STORE_REL(p, v) __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#define STORE(p, v) __atomic_store_n((p), (v), __ATOMIC_SEQ_CST)
+#define XCHG(p, v) __atomic_exchange_n((p), (v), __ATOMIC_SEQ_CST)
+#define CAS_RELAXED(p, e, v) __atomic_compare_exchange_n((p), (e), (v), true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)
+
 void queue_init(Queue *q) {
+  queue_init2(q, QUEUE_DEFAULT_SIZE, QUEUE_MPMC);
+}
+
+void queue_init2(Queue *q, int size, QueueType type) {
+  assert(size > 0 && size <= (1 << 30));
+
   memset(q, 0, sizeof(*q));
-  TAILQ_INIT(&q->q);
+  q->type = type;
+  q->size = 1;
+  while (q->size < (uint32_t)size) {
+    q->size <<= 1;
+  }
+
+  q->cells = calloc(q->size, sizeof(QueueCell));
+  assert(q->cells);
+  for (uint32_t i = 0; i < q->size; i++) {
+    q->cells[i].seq = i;
+  }
+
   pthread_mutex_init(&q->lock, NULL);
   pthread_cond_init(&q->cv, NULL);
 }
 
-void* queue_pop(Queue *q) {
-  pthread_mutex_lock(&q->lock);
-  while (TAILQ_EMPTY(&q->q)) {
-    pthread_cond_wait(&q->cv, &q->lock);
+void queue_destroy(Queue *q) {
+  free(q->cells);
+  q->cells = NULL;
+  pthread_mutex_destroy(&q->lock);
+  pthread_cond_destroy(&q->cv);
+}
+
+// Dmitry Vyukov's bounded queue: a cell's seq says which position it's
+// ready to be pushed (pos) or popped (pos+1) at
+static bool mpmc_push(Queue *q, void *data) {
+  const uint32_t mask = q->size - 1;
+  uint32_t pos = LOAD_RELAXED(&q->tail);
+  while (true) {
+    QueueCell *cell = &q->cells[pos & mask];
+    const int32_t dif = (int32_t)(LOAD_ACQ(&cell->seq) - pos);
+    if (dif == 0) {
+      if (CAS_RELAXED(&q->tail, &pos, pos + 1)) {
+        cell->data = data;
+        STORE_REL(&cell->seq, pos + 1);
+        return true;
+      }
+    } else if (dif < 0) {
+      // full
+      return false;
+    } else {
+      pos = LOAD_RELAXED(&q->tail);
+    }
   }
-  QueueEntry *entry = TAILQ_FIRST(&q->q);
-  TAILQ_REMOVE(&q->q, entry, entries);
-  pthread_mutex_unlock(&q->lock);
+}
 
-  void* r = entry->data;
-  free(entry);
-  return r;
+static void* mpmc_pop(Queue *q) {
+  const uint32_t mask = q->size - 1;
+  uint32_t pos = LOAD_RELAXED(&q->head);
+  while (true) {
+    QueueCell *cell = &q->cells[pos & mask];
+    const int32_t dif = (int32_t)(LOAD_ACQ(&cell->seq) - (pos + 1));
+    if (dif == 0) {
+      if (CAS_RELAXED(&q->head, &pos, pos + 1)) {
+        void *data = cell->data;
+        STORE_REL(&cell->seq, pos + q->size);
+        return data;
+      }
+    } else if (dif < 0) {
+      // empty
+      return NULL;
+    } else {
+      pos = LOAD_RELAXED(&q->head);
+    }
+  }
 }
 
-void* queue_try_pop(Queue *q) {
-  pthread_mutex_lock(&q->lock);
+static bool spsc_push(Queue *q, void *data) {
+  const uint32_t tail = LOAD_RELAXED(&q->tail);
+  if (tail - LOAD_ACQ(&q->head) == q->size) {
+    return false;
+  }
+  q->cells[tail & (q->size - 1)].data = data;
+  STORE_REL(&q->tail, tail + 1);
+  return true;
+}
 
-  void* r = NULL;
-  if (!TAILQ_EMPTY(&q->q)) {
-    QueueEntry *entry = TAILQ_FIRST(&q->q);
-    TAILQ_REMOVE(&q->q, entry, entries);
-    r = entry->data;
-    free(entry);
+static void* spsc_pop(Queue *q) {
+  const uint32_t head = LOAD_RELAXED(&q->head);
+  if (head == LOAD_ACQ(&q->tail)) {
+    return NULL;
   }
+  void *data = q->cells[head & (q->size - 1)].data;
+  STORE_REL(&q->head, head + 1);
+  return data;
+}
+
+// wakes the sleepers on the other side, after the push or pop before
+static void wake(Queue *q, uint32_t *seq, uint32_t *sleeping) {
+  // pairs with the sleeping store in queue_wait: either the sleeper
+  // rechecks after our change, or we see the flag
+  __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  if (LOAD_RELAXED(sleeping) && XCHG(sleeping, 0)) {
+    seq_wake_all(seq, &q->lock, &q->cv);
+  }
+}
+
+static double queue_millis() {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec * 1000.0 + t.tv_nsec * 1e-6;
+}
 
-  pthread_mutex_unlock(&q->lock);
+// sleeps until seq moves from val or the deadline, while blocked() holds.
+// false once the deadline has passed.
+static bool queue_wait(Queue *q, uint32_t *seq, uint32_t *sleeping, uint32_t val,
+                       bool (*blocked)(Queue *q), int timeout_ms, double deadline) {
+  int wait_ms = -1;
+  if (timeout_ms >= 0) {
+    wait_ms = (int)(deadline - queue_millis());
+    if (wait_ms <= 0) {
+      return false;
+    }
+  }
+
+  // a waker that clears the flag before we sleep has bumped seq past val
+  STORE(sleeping, 1);
+  if (blocked(q)) {
+    seq_wait(seq, val, wait_ms, &q->lock, &q->cv);
+  }
+  return true;
+}
+
+static bool queue_empty(Queue *q) {
+  return LOAD(&q->head) == LOAD(&q->tail);
+}
+
+static bool queue_full(Queue *q) {
+  return LOAD(&q->tail) - LOAD(&q->head) >= q->size;
+}
+
+void* queue_try_pop(Queue *q) {
+  void *r = q->type == QUEUE_SPSC ? spsc_pop(q) : mpmc_pop(q);
+  if (r) {
+    wake(q, &q->pop_seq, &q->pop_sleeping);
+  }
   return r;
 }
 
+void* queue_pop_timeout(Queue *q, int timeout_ms) {
+  const double deadline = timeout_ms >= 0 ? queue_millis() + timeout_ms : 0;
+  while (true) {
+    const uint32_t seq = LOAD(&q->push_seq);
+    void *r = queue_try_pop(q);
+    if (r) {
+      return r;
+    }
+    if (!queue_wait(q, &q->push_seq, &q->push_sleeping, seq, queue_empty, timeout_ms, deadline)) {
+      return NULL;
+    }
+  }
+}
+
+void* queue_pop(Queue *q) {
+  return queue_pop_timeout(q, -1);
+}
+
+bool queue_try_push(Queue *q, void *data) {
+  assert(data);
+  bool ok = q->type == QUEUE_SPSC ? spsc_push(q, data) : mpmc_push(q, data);
+  if (ok) {
+    wake(q, &q->push_seq, &q->push_sleeping);
+  }
+  return ok;
+}
+
+bool queue_push_timeout(Queue *q, void *data, int timeout_ms) {
+  const double deadline = timeout_ms >= 0 ? queue_millis() + timeout_ms : 0;
+  while (true) {
+    const uint32_t seq = LOAD(&q->pop_seq);
+    if (queue_try_push(q, data)) {
+      return true;
+    }
+    if (!queue_wait(q, &q->pop_seq, &q->pop_sleeping, seq, queue_full, timeout_ms, deadline)) {
+      return false;
+    }
+  }
+}
+
 void queue_push(Queue *q, void *data) {
-  QueueEntry *entry = calloc(1, sizeof(QueueEntry));
-  assert(entry);
-  entry->data = data;
-
-  pthread_mutex_lock(&q->lock);
-  TAILQ_INSERT_TAIL(&q->q, entry, entries);
-  pthread_cond_signal(&q->cv);
-  pthread_mutex_unlock(&q->lock);
+  queue_push_timeout(q, data, -1);
 }
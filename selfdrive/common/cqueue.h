@@ -1,30 +1,77 @@
 #ifndef COMMON_CQUEUE_H
 #define COMMON_CQUEUE_H
 
-#include <sys/queue.h>
+#include <stdbool.h>
+#include <stdint.h>
 #include <pthread.h>
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-// a blocking queue
+// a bounded blocking queue
+//
+// The cells are allocated in queue_init, pushing and popping never
+// allocates. QUEUE_MPMC can be pushed and popped from any number of threads,
+// QUEUE_SPSC is a plain ring for one pushing and one popping thread. Neither
+// takes a lock, blocked threads sleep on a futex (common/futex.h) and the
+// other side only makes the wake syscall once per sleep. NULL can't be queued, it's what the
+// pops return when there's nothing.
 
-typedef struct QueueEntry {
-  TAILQ_ENTRY(QueueEntry) entries;
+#define QUEUE_DEFAULT_SIZE 64
+
+typedef enum QueueType {
+  QUEUE_MPMC = 0,
+  QUEUE_SPSC,
+} QueueType;
+
+typedef struct QueueCell {
+  // the position the cell is ready for, MPMC only
+  uint32_t seq;
   void *data;
-} QueueEntry;
+} QueueCell;
 
 typedef struct Queue {
-  TAILQ_HEAD(queue, QueueEntry) q;
+  QueueType type;
+  // a power of two
+  uint32_t size;
+  QueueCell *cells;
+
+  // pushing and popping side on their own cache lines
+  uint32_t tail __attribute__((aligned(64)));
+  uint32_t head __attribute__((aligned(64)));
+
+  // bumped on push for sleeping poppers, and on pop for pushers sleeping on
+  // a full queue. The sleeping flags are set by whoever is about to sleep
+  // and cleared by the one waking them.
+  uint32_t push_seq __attribute__((aligned(64)));
+  uint32_t push_sleeping;
+  uint32_t pop_seq;
+  uint32_t pop_sleeping;
+
   pthread_mutex_t lock;
   pthread_cond_t cv;
 } Queue;
 
+// QUEUE_MPMC of QUEUE_DEFAULT_SIZE
 void queue_init(Queue *q);
+// size is rounded up to a power of two
+void queue_init2(Queue *q, int size, QueueType type);
+void queue_destroy(Queue *q);
+
+// blocks while empty
 void* queue_pop(Queue *q);
+// NULL on timeout
+void* queue_pop_timeout(Queue *q, int timeout_ms);
+// NULL if empty
 void* queue_try_pop(Queue *q);
+
+// blocks while full
 void queue_push(Queue *q, void *data);
+// false on timeout
+bool queue_push_timeout(Queue *q, void *data, int timeout_ms);
+// false if full
+bool queue_try_push(Queue *q, void *data);
 
 #ifdef __cplusplus
 }  // extern "C"
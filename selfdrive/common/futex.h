@@ -0,0 +1,92 @@
+#ifndef COMMON_FUTEX_H
+#define COMMON_FUTEX_H
+
+#include <stdint.h>
+#include <limits.h>
+#include <pthread.h>
+#include <time.h>
+
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// Sleeping on a sequence number, for the lock free structures: a consumer
+// counts itself in waiters, rechecks its condition and sleeps while seq is
+// still what it loaded before. Producers make their change visible, bump seq
+// and only make the wake syscall if somebody is waiting. lock and cv are the
+// sleeping side where there are no futexes.
+
+// Sleeps while *seq is val, at most timeout_ms (-1 forever). May return early.
+static inline void seq_wait(uint32_t *seq, uint32_t val, int timeout_ms,
+                            pthread_mutex_t *lock, pthread_cond_t *cv) {
+#ifdef __linux__
+  (void)lock;
+  (void)cv;
+  struct timespec ts = {
+    .tv_sec = timeout_ms / 1000,
+    .tv_nsec = (timeout_ms % 1000) * 1000000L,
+  };
+  syscall(SYS_futex, seq, FUTEX_WAIT_PRIVATE, val, timeout_ms >= 0 ? &ts : NULL, NULL, 0);
+#else
+  struct timespec deadline;
+  clock_gettime(CLOCK_REALTIME, &deadline);
+  deadline.tv_sec += timeout_ms / 1000;
+  deadline.tv_nsec += (timeout_ms % 1000) * 1000000L;
+  if (deadline.tv_nsec >= 1000000000L) {
+    deadline.tv_sec++;
+    deadline.tv_nsec -= 1000000000L;
+  }
+
+  pthread_mutex_lock(lock);
+  while (__atomic_load_n(seq, __ATOMIC_SEQ_CST) == val) {
+    if (timeout_ms < 0) {
+      pthread_cond_wait(cv, lock);
+    } else if (pthread_cond_timedwait(cv, lock, &deadline) != 0) {
+      break;
+    }
+  }
+  pthread_mutex_unlock(lock);
+#endif
+}
+
+// Bumps seq and wakes up to n sleepers
+static inline void seq_wake(uint32_t *seq, uint32_t *waiters, int n,
+                            pthread_mutex_t *lock, pthread_cond_t *cv) {
+#ifdef __linux__
+  (void)lock;
+  (void)cv;
+  __atomic_fetch_add(seq, 1, __ATOMIC_SEQ_CST);
+  if (__atomic_load_n(waiters, __ATOMIC_SEQ_CST) > 0) {
+    syscall(SYS_futex, seq, FUTEX_WAKE_PRIVATE, n, NULL, NULL, 0);
+  }
+#else
+  (void)n;
+  if (__atomic_load_n(waiters, __ATOMIC_SEQ_CST) > 0) {
+    pthread_mutex_lock(lock);
+    __atomic_fetch_add(seq, 1, __ATOMIC_SEQ_CST);
+    pthread_cond_broadcast(cv);
+    pthread_mutex_unlock(lock);
+  } else {
+    __atomic_fetch_add(seq, 1, __ATOMIC_SEQ_CST);
+  }
+#endif
+}
+
+// Bumps seq and wakes every sleeper, for callers that track sleepers themselves
+static inline void seq_wake_all(uint32_t *seq, pthread_mutex_t *lock, pthread_cond_t *cv) {
+#ifdef __linux__
+  (void)lock;
+  (void)cv;
+  __atomic_fetch_add(seq, 1, __ATOMIC_SEQ_CST);
+  syscall(SYS_futex, seq, FUTEX_WAKE_PRIVATE, INT_MAX, NULL, NULL, 0);
+#else
+  pthread_mutex_lock(lock);
+  __atomic_fetch_add(seq, 1, __ATOMIC_SEQ_CST);
+  pthread_cond_broadcast(cv);
+  pthread_mutex_unlock(lock);
+#endif
+}
+
+#endif
@@ -3,9 +3,13 @@
 #include <zmq.h>
 
 // TODO: refactor to take in service instead of endpoint?
-void *sub_sock(void *ctx, const char *endpoint) {
+void *sub_sock_conflate(void *ctx, const char *endpoint, int conflate) {
   void* sock = zmq_socket(ctx, ZMQ_SUB);
   assert(sock);
+  // only keeps the latest message, has to be set before connecting
+  if (conflate) {
+    zmq_setsockopt(sock, ZMQ_CONFLATE, &conflate, sizeof(conflate));
+  }
   zmq_setsockopt(sock, ZMQ_SUBSCRIBE, "", 0);
   int reconnect_ivl = 500;
   zmq_setsockopt(sock, ZMQ_RECONNECT_IVL_MAX, &reconnect_ivl, sizeof(reconnect_ivl));
@@ -13,3 +17,7 @@ void *sub_sock(void *ctx, const char *endpoint) {
   return sock;
 }
 
+void *sub_sock(void *ctx, const char *endpoint) {
+  return sub_sock_conflate(ctx, endpoint, 0);
+}
+
@@ -4,17 +4,59 @@
 #define _GNU_SOURCE
 #endif  // _GNU_SOURCE
 
+#include <assert.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
 #include <unistd.h>
 #include <dirent.h>
+#include <pthread.h>
 #include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/inotify.h>
+#include <sys/syscall.h>
+#endif
 
 #include <map>
 #include <string>
 
+#include "common/timing.h"
 #include "common/util.h"
-#include "common/utilpp.h"
+
+// The whole store is one file, <params_path>/params.db, mapped shared by
+// every reader and writer:
+//
+//   [header, one page][slot 0][slot 1]
+//
+// A slot holds every key and value, with a checksum. The low bit of the
+// header's seq picks the live slot. Writers take the flock on
+// <params_path>/.lock, fill the other slot, msync it, then bump seq with a
+// single store, so the file on disk always has one complete slot and seq
+// never points at a half written one. Readers don't lock: they load seq,
+// copy out of the live slot and retry if seq moved in the meantime, which
+// is the only way the slot they read could have been rewritten. seq also
+// is the futex word change waiters sleep on.
+//
+// Every value is mirrored into <params_path>/d/<key> as before, for
+// whatever still reads the files directly. Files put there or deleted by
+// somebody else are picked up by the next read through an inotify watch on d.
+// common/params.py implements the same format.
+
+#define PARAMS_DB_MAGIC 0x534d5250  // "PRMS"
+#define PARAMS_DB_VERSION 1
+#define PARAMS_DB_HEADER_SIZE 4096
+#define PARAMS_DB_SLOT_SIZE (256 * 1024)
+
+// how often a reader looks at the inotify watch, in ns
+#define PARAMS_SYNC_INTERVAL 100000000ULL
 
 namespace {
 
@@ -26,131 +68,544 @@ T* null_coalesce(T* a, T* b) {
 static const char* default_params_path = null_coalesce(
     const_cast<const char*>(getenv("PARAMS_PATH")), "/data/params");
 
-}  // namespace
+struct DbHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t seq;
+  uint32_t slot_size;
+};
+
+// followed by count entries: u32 key_len, u32 value_len, key, value,
+// padded to 4 bytes. crc is over the len bytes of entries.
+struct SlotHeader {
+  uint32_t len;
+  uint32_t crc;
+  uint32_t count;
+  uint32_t pad;
+};
+
+struct ParamsStore {
+  std::string path;
+  int inotify_fd;
+
+  uint8_t* base;
+  size_t size;
+  uint32_t slot_size;
+
+  // flock is per open file, so threads of one process also need this
+  pthread_mutex_t write_lock;
+  int lock_fd;
+
+  pthread_mutex_t sync_lock;
+  uint64_t next_sync;
+};
+
+typedef std::map<std::string, std::string> Values;
+
+uint32_t crc32(const uint8_t* data, size_t len) {
+  static uint32_t table[256];
+  static pthread_once_t table_once = PTHREAD_ONCE_INIT;
+  pthread_once(&table_once, [] {
+    for (uint32_t i = 0; i < 256; i++) {
+      uint32_t c = i;
+      for (int k = 0; k < 8; k++) {
+        c = (c & 1) ? 0xedb88320 ^ (c >> 1) : c >> 1;
+      }
+      table[i] = c;
+    }
+  });
 
-int write_db_value(const char* params_path, const char* key, const char* value,
-                   size_t value_size) {
-  int lock_fd = -1;
-  int tmp_fd = -1;
-  int result;
-  char tmp_path[1024];
-  char path[1024];
-  ssize_t bytes_written;
+  uint32_t crc = 0xffffffff;
+  for (size_t i = 0; i < len; i++) {
+    crc = table[(crc ^ data[i]) & 0xff] ^ (crc >> 8);
+  }
+  return crc ^ 0xffffffff;
+}
 
-  if (params_path == NULL) {
-    params_path = default_params_path;
+DbHeader* store_header(ParamsStore* s) {
+  return (DbHeader*)s->base;
+}
+
+uint8_t* store_slot(ParamsStore* s, uint32_t seq) {
+  return s->base + PARAMS_DB_HEADER_SIZE + (size_t)(seq & 1) * s->slot_size;
+}
+
+// Calls f(key, key_len, value, value_len) for every entry until it returns
+// false. The slot may be rewritten under a lock free reader, so everything
+// is bounds checked and garbage only ends the walk early.
+template <typename F>
+bool slot_foreach(const uint8_t* slot, uint32_t slot_size, F f) {
+  const SlotHeader* sh = (const SlotHeader*)slot;
+  const uint32_t len = sh->len;
+  const uint32_t count = sh->count;
+  if (len > slot_size - sizeof(SlotHeader)) return false;
+
+  const uint8_t* p = slot + sizeof(SlotHeader);
+  const uint8_t* end = p + len;
+  for (uint32_t i = 0; i < count; i++) {
+    if (end - p < 8) return false;
+    uint32_t key_len, value_len;
+    memcpy(&key_len, p, 4);
+    memcpy(&value_len, p + 4, 4);
+    p += 8;
+    if (key_len > (size_t)(end - p) || value_len > (size_t)(end - p) - key_len) return false;
+    if (!f((const char*)p, key_len, (const char*)p + key_len, value_len)) return true;
+    p += (key_len + value_len + 3) & ~3u;
   }
+  return true;
+}
 
-  // Write value to temp.
-  result =
-      snprintf(tmp_path, sizeof(tmp_path), "%s/.tmp_value_XXXXXX", params_path);
-  if (result < 0) {
-    goto cleanup;
+bool slot_valid(const uint8_t* slot, uint32_t slot_size) {
+  const SlotHeader* sh = (const SlotHeader*)slot;
+  if (sh->len > slot_size - sizeof(SlotHeader)) return false;
+  if (crc32(slot + sizeof(SlotHeader), sh->len) != sh->crc) return false;
+  return slot_foreach(slot, slot_size, [](const char*, uint32_t, const char*, uint32_t) {
+    return true;
+  });
+}
+
+int slot_write(uint8_t* slot, uint32_t slot_size, const Values& values) {
+  size_t len = 0;
+  for (const auto& kv : values) {
+    len += 8 + ((kv.first.size() + kv.second.size() + 3) & ~3u);
+  }
+  if (len > slot_size - sizeof(SlotHeader)) return -ENOSPC;
+
+  uint8_t* p = slot + sizeof(SlotHeader);
+  for (const auto& kv : values) {
+    const uint32_t key_len = kv.first.size();
+    const uint32_t value_len = kv.second.size();
+    memcpy(p, &key_len, 4);
+    memcpy(p + 4, &value_len, 4);
+    memcpy(p + 8, kv.first.data(), key_len);
+    memcpy(p + 8 + key_len, kv.second.data(), value_len);
+    const size_t padded = (key_len + value_len + 3) & ~3u;
+    memset(p + 8 + key_len + value_len, 0, padded - key_len - value_len);
+    p += 8 + padded;
   }
 
-  tmp_fd = mkstemp(tmp_path);
-  bytes_written = write(tmp_fd, value, value_size);
-  if (bytes_written != value_size) {
-    result = -20;
-    goto cleanup;
+  SlotHeader* sh = (SlotHeader*)slot;
+  sh->len = len;
+  sh->crc = crc32(slot + sizeof(SlotHeader), len);
+  sh->count = values.size();
+  sh->pad = 0;
+  return 0;
+}
+
+void read_mirror(const std::string& dir, Values* values) {
+  DIR* d = opendir(dir.c_str());
+  if (!d) return;
+
+  struct dirent* de = NULL;
+  while ((de = readdir(d))) {
+    if (!isalnum(de->d_name[0])) continue;
+    size_t len = 0;
+    char* value = (char*)read_file((dir + "/" + de->d_name).c_str(), &len);
+    if (value == NULL) continue;
+    (*values)[de->d_name] = std::string(value, len - 1);
+    free(value);
   }
+  closedir(d);
+}
 
-  result = snprintf(path, sizeof(path), "%s/.lock", params_path);
-  if (result < 0) {
-    goto cleanup;
+bool read_mirror_key(const std::string& path, const char* key, std::string* value) {
+  size_t len = 0;
+  char* buf = (char*)read_file((path + "/d/" + key).c_str(), &len);
+  if (buf == NULL) return false;
+  value->assign(buf, len - 1);
+  free(buf);
+  return true;
+}
+
+void fsync_dir(const std::string& path) {
+  int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd >= 0) {
+    fsync(fd);
+    close(fd);
   }
-  lock_fd = open(path, 0);
+}
 
-  result = snprintf(path, sizeof(path), "%s/d/%s", params_path, key);
-  if (result < 0) {
-    goto cleanup;
+// Builds params.db from the old one file per key layout. Called with the
+// flock held.
+int migrate(const std::string& path) {
+  Values values;
+  read_mirror(path + "/d", &values);
+
+  std::string tmp_path = path + "/.tmp_db_XXXXXX";
+  int fd = mkstemp(&tmp_path[0]);
+  if (fd < 0) return -1;
+
+  const size_t size = PARAMS_DB_HEADER_SIZE + 2 * (size_t)PARAMS_DB_SLOT_SIZE;
+  std::string slot(PARAMS_DB_SLOT_SIZE, '\0');
+  int result = slot_write((uint8_t*)&slot[0], PARAMS_DB_SLOT_SIZE, values);
+  if (result == 0) {
+    DbHeader header = {PARAMS_DB_MAGIC, PARAMS_DB_VERSION, 0, PARAMS_DB_SLOT_SIZE};
+    const size_t used = sizeof(SlotHeader) + ((SlotHeader*)&slot[0])->len;
+    if (ftruncate(fd, size) != 0 ||
+        pwrite(fd, &header, sizeof(header), 0) != sizeof(header) ||
+        pwrite(fd, slot.data(), used, PARAMS_DB_HEADER_SIZE) != (ssize_t)used ||
+        fchmod(fd, 0666) != 0 || fsync(fd) != 0) {
+      result = -1;
+    }
   }
+  close(fd);
 
-  // Take lock.
-  result = flock(lock_fd, LOCK_EX);
-  if (result < 0) {
-    goto cleanup;
+  if (result == 0) {
+    result = rename(tmp_path.c_str(), (path + "/params.db").c_str());
+  }
+  if (result == 0) {
+    fsync_dir(path);
+  } else {
+    unlink(tmp_path.c_str());
   }
+  return result;
+}
 
-  // fsync to force persist the changes.
-  result = fsync(tmp_fd);
-  if (result < 0) {
-    goto cleanup;
+int open_lock(const std::string& path) {
+  return open((path + "/.lock").c_str(), O_RDONLY | O_CREAT | O_CLOEXEC, 0666);
+}
+
+// The lock file is opened every time, an open file shared with a forked
+// child wouldn't keep it out.
+void store_lock(ParamsStore* s) {
+  pthread_mutex_lock(&s->write_lock);
+  s->lock_fd = open_lock(s->path);
+  flock(s->lock_fd, LOCK_EX);
+}
+
+void store_unlock(ParamsStore* s) {
+  close(s->lock_fd);
+  s->lock_fd = -1;
+  pthread_mutex_unlock(&s->write_lock);
+}
+
+// Lock free snapshot of every value.
+void store_read_all(ParamsStore* s, Values* values) {
+  DbHeader* header = store_header(s);
+  while (1) {
+    values->clear();
+    const uint32_t seq = __atomic_load_n(&header->seq, __ATOMIC_ACQUIRE);
+    slot_foreach(store_slot(s, seq), s->slot_size,
+                 [&](const char* key, uint32_t key_len, const char* value, uint32_t value_len) {
+      (*values)[std::string(key, key_len)] = std::string(value, value_len);
+      return true;
+    });
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    if (__atomic_load_n(&header->seq, __ATOMIC_RELAXED) == seq) return;
   }
+}
 
-  // Move temp into place.
-  result = rename(tmp_path, path);
+// Lock free read of one value, into a malloced and NUL terminated buffer.
+// value_sz doesn't count the NUL, as with the file per key read_db_value.
+int store_read(ParamsStore* s, const char* key, char** value, size_t* value_sz) {
+  DbHeader* header = store_header(s);
+  const size_t key_len = strlen(key);
+  while (1) {
+    const uint32_t seq = __atomic_load_n(&header->seq, __ATOMIC_ACQUIRE);
+    char* found = NULL;
+    size_t found_len = 0;
+    slot_foreach(store_slot(s, seq), s->slot_size,
+                 [&](const char* k, uint32_t k_len, const char* v, uint32_t v_len) {
+      if (k_len != key_len || memcmp(k, key, key_len) != 0) return true;
+      found = (char*)malloc(v_len + 1);
+      assert(found);
+      memcpy(found, v, v_len);
+      found[v_len] = '\0';
+      found_len = v_len;
+      return false;
+    });
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    if (__atomic_load_n(&header->seq, __ATOMIC_RELAXED) != seq) {
+      free(found);
+      continue;
+    }
 
-cleanup:
-  // Release lock.
-  if (lock_fd >= 0) {
-    close(lock_fd);
+    if (found == NULL) return -22;
+    *value = found;
+    if (value_sz != NULL) {
+      *value_sz = found_len;
+    }
+    return 0;
   }
-  if (tmp_fd >= 0) {
-    if (result < 0) {
-      remove(tmp_path);
+}
+
+// Writes values into the spare slot and makes it the live one. Called with
+// the lock held.
+int store_commit(ParamsStore* s, const Values& values) {
+  DbHeader* header = store_header(s);
+  const uint32_t seq = __atomic_load_n(&header->seq, __ATOMIC_RELAXED);
+  uint8_t* slot = store_slot(s, seq + 1);
+
+  int result = slot_write(slot, s->slot_size, values);
+  if (result < 0) return result;
+
+  // the slot has to be on disk before seq points at it
+  const size_t used = sizeof(SlotHeader) + ((SlotHeader*)slot)->len;
+  result = msync(slot, used, MS_SYNC);
+  if (result < 0) return result;
+
+  __atomic_store_n(&header->seq, seq + 1, __ATOMIC_RELEASE);
+  result = msync(s->base, PARAMS_DB_HEADER_SIZE, MS_SYNC);
+
+#ifdef __linux__
+  // not private, the waiters are other processes
+  syscall(SYS_futex, &header->seq, FUTEX_WAKE, INT_MAX, NULL, NULL, 0);
+#endif
+  return result;
+}
+
+// Makes sure the live slot is intact, after a crash or a bad disk.
+int store_recover(ParamsStore* s) {
+  DbHeader* header = store_header(s);
+  if (slot_valid(store_slot(s, header->seq), s->slot_size)) return 0;
+
+  int result = 0;
+  store_lock(s);
+  const uint32_t seq = header->seq;
+  if (!slot_valid(store_slot(s, seq), s->slot_size)) {
+    if (slot_valid(store_slot(s, seq + 1), s->slot_size)) {
+      __atomic_store_n(&header->seq, seq + 1, __ATOMIC_RELEASE);
+      result = msync(s->base, PARAMS_DB_HEADER_SIZE, MS_SYNC);
+    } else {
+      Values values;
+      read_mirror(s->path + "/d", &values);
+      result = store_commit(s, values);
     }
-    close(tmp_fd);
   }
+  store_unlock(s);
   return result;
 }
 
-int read_db_value(const char* params_path, const char* key, char** value,
-                  size_t* value_sz) {
-  int lock_fd = -1;
-  int result;
-  char path[1024];
+ParamsStore* store_open(const char* params_path) {
+  std::string path = params_path;
 
-  if (params_path == NULL) {
-    params_path = default_params_path;
+  int lock_fd = open_lock(path);
+  if (lock_fd < 0) return NULL;
+
+  const std::string db_path = path + "/params.db";
+  int db_fd = open(db_path.c_str(), O_RDWR | O_CLOEXEC);
+  if (db_fd < 0 && errno == ENOENT) {
+    flock(lock_fd, LOCK_EX);
+    db_fd = open(db_path.c_str(), O_RDWR | O_CLOEXEC);
+    if (db_fd < 0 && errno == ENOENT && migrate(path) == 0) {
+      db_fd = open(db_path.c_str(), O_RDWR | O_CLOEXEC);
+    }
+  }
+  close(lock_fd);
+  if (db_fd < 0) return NULL;
+
+  struct stat st;
+  DbHeader header;
+  if (fstat(db_fd, &st) != 0 ||
+      pread(db_fd, &header, sizeof(header), 0) != sizeof(header) ||
+      header.magic != PARAMS_DB_MAGIC || header.version != PARAMS_DB_VERSION ||
+      header.slot_size % PARAMS_DB_HEADER_SIZE != 0 ||
+      header.slot_size < PARAMS_DB_HEADER_SIZE ||
+      (size_t)st.st_size < PARAMS_DB_HEADER_SIZE + 2 * (size_t)header.slot_size) {
+    close(db_fd);
+    return NULL;
   }
 
-  result = snprintf(path, sizeof(path), "%s/.lock", params_path);
-  if (result < 0) {
-    goto cleanup;
+  const size_t size = PARAMS_DB_HEADER_SIZE + 2 * (size_t)header.slot_size;
+  void* base = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, db_fd, 0);
+  close(db_fd);
+  if (base == MAP_FAILED) return NULL;
+
+  ParamsStore* s = new ParamsStore();
+  s->path = path;
+  s->lock_fd = -1;
+  s->base = (uint8_t*)base;
+  s->size = size;
+  s->slot_size = header.slot_size;
+  pthread_mutex_init(&s->write_lock, NULL);
+  pthread_mutex_init(&s->sync_lock, NULL);
+  s->next_sync = 0;
+
+  if (store_recover(s) != 0) {
+    munmap(s->base, s->size);
+    delete s;
+    return NULL;
   }
-  lock_fd = open(path, 0);
 
-  result = snprintf(path, sizeof(path), "%s/d/%s", params_path, key);
-  if (result < 0) {
-    goto cleanup;
+  mkdir((path + "/d").c_str(), 0777);
+  s->inotify_fd = -1;
+#ifdef __linux__
+  s->inotify_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+  if (s->inotify_fd >= 0 &&
+      inotify_add_watch(s->inotify_fd, (path + "/d/").c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_DELETE) < 0) {
+    close(s->inotify_fd);
+    s->inotify_fd = -1;
   }
+#endif
+  return s;
+}
 
-  // Take lock.
-  result = flock(lock_fd, LOCK_EX);
-  if (result < 0) {
-    goto cleanup;
+// Stores are opened once per path and kept for the life of the process.
+ParamsStore* store_get(const char* params_path) {
+  static pthread_mutex_t stores_lock = PTHREAD_MUTEX_INITIALIZER;
+  static std::map<std::string, ParamsStore*> stores;
+
+  if (params_path == NULL) {
+    params_path = default_params_path;
+  }
+
+  pthread_mutex_lock(&stores_lock);
+  ParamsStore* s = NULL;
+  auto it = stores.find(params_path);
+  if (it != stores.end()) {
+    s = it->second;
+  } else {
+    s = store_open(params_path);
+    if (s != NULL) {
+      stores[params_path] = s;
+    }
   }
+  pthread_mutex_unlock(&stores_lock);
+  return s;
+}
 
-  // Read value.
-  // TODO(mgraczyk): If there is a lot of contention, we can release the lock
-  //                 after opening the file, before reading.
-  *value = static_cast<char*>(read_file(path, value_sz));
-  if (*value == NULL) {
-    result = -22;
+int store_write(ParamsStore* s, const char* key, const char* value, size_t value_size) {
+  int tmp_fd = -1;
+  std::string tmp_path;
+  const std::string path = s->path + "/d/" + key;
+  int result = 0;
+
+  store_lock(s);
+
+  // mirror first, fsync to force persist the changes
+  if (value != NULL) {
+    tmp_path = s->path + "/.tmp_value_XXXXXX";
+    tmp_fd = mkstemp(&tmp_path[0]);
+    if (tmp_fd < 0) {
+      result = -1;
+      goto cleanup;
+    }
+    if (write(tmp_fd, value, value_size) != (ssize_t)value_size) {
+      result = -20;
+      goto cleanup;
+    }
+    result = fsync(tmp_fd);
+    if (result < 0) {
+      goto cleanup;
+    }
+    result = rename(tmp_path.c_str(), path.c_str());
+    if (result < 0) {
+      goto cleanup;
+    }
+  } else if (unlink(path.c_str()) < 0 && errno != ENOENT) {
+    result = -1;
     goto cleanup;
   }
 
-  // Remove one for null byte.
-  if (value_sz != NULL) {
-    *value_sz -= 1;
+  {
+    Values values;
+    store_read_all(s, &values);
+    if (value != NULL) {
+      values[key] = std::string(value, value_size);
+    } else {
+      values.erase(key);
+    }
+    result = store_commit(s, values);
   }
-  result = 0;
 
 cleanup:
-  // Release lock.
-  if (lock_fd >= 0) {
-    close(lock_fd);
+  store_unlock(s);
+  if (tmp_fd >= 0) {
+    if (result < 0) {
+      unlink(tmp_path.c_str());
+    }
+    close(tmp_fd);
   }
   return result;
 }
 
+// Takes in files that were put into d by somebody other than us.
+void store_sync_external(ParamsStore* s) {
+#ifdef __linux__
+  if (s->inotify_fd < 0) return;
+
+  const uint64_t now = nanos_since_boot();
+  if (now < __atomic_load_n(&s->next_sync, __ATOMIC_RELAXED)) return;
+  if (pthread_mutex_trylock(&s->sync_lock) != 0) return;
+  __atomic_store_n(&s->next_sync, now + PARAMS_SYNC_INTERVAL, __ATOMIC_RELAXED);
+
+  char buf[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+  while (1) {
+    const ssize_t len = read(s->inotify_fd, buf, sizeof(buf));
+    if (len <= 0) break;
+
+    for (char* p = buf; p < buf + len;) {
+      const struct inotify_event* event = (const struct inotify_event*)p;
+      p += sizeof(struct inotify_event) + event->len;
+      const char* key = event->name;
+      if (event->len == 0 || !isalnum(key[0])) continue;
+
+      // our own writes and deletes show up too, those already match. A
+      // file that's gone was deleted, whatever the event
+      std::string file_value;
+      const bool in_file = read_mirror_key(s->path, key, &file_value);
+      char* db_value = NULL;
+      size_t db_value_sz = 0;
+      const bool in_db = store_read(s, key, &db_value, &db_value_sz) == 0;
+      const bool same = in_file == in_db &&
+                        (!in_file || file_value == std::string(db_value, db_value_sz));
+      free(db_value);
+      if (same) continue;
+
+      store_lock(s);
+      Values values;
+      store_read_all(s, &values);
+      auto it = values.find(key);
+      if (read_mirror_key(s->path, key, &file_value)) {
+        if (it == values.end() || it->second != file_value) {
+          values[key] = file_value;
+          store_commit(s, values);
+        }
+      } else if (it != values.end()) {
+        values.erase(it);
+        store_commit(s, values);
+      }
+      store_unlock(s);
+    }
+  }
+
+  pthread_mutex_unlock(&s->sync_lock);
+#endif
+}
+
+}  // namespace
+
+int write_db_value(const char* params_path, const char* key, const char* value,
+                   size_t value_size) {
+  ParamsStore* s = store_get(params_path);
+  if (s == NULL) return -1;
+  return store_write(s, key, value, value_size);
+}
+
+int delete_db_value(const char* params_path, const char* key) {
+  ParamsStore* s = store_get(params_path);
+  if (s == NULL) return -1;
+  return store_write(s, key, NULL, 0);
+}
+
+int read_db_value(const char* params_path, const char* key, char** value,
+                  size_t* value_sz) {
+  ParamsStore* s = store_get(params_path);
+  if (s == NULL) return -1;
+  store_sync_external(s);
+  return store_read(s, key, value, value_sz);
+}
+
 void read_db_value_blocking(const char* params_path, const char* key,
                             char** value, size_t* value_sz) {
   while (1) {
+    uint32_t version = 0;
+    const int have_version = params_version(params_path, &version) == 0;
     const int result = read_db_value(params_path, key, value, value_sz);
     if (result == 0) {
       return;
+    } else if (have_version) {
+      params_wait_change(params_path, &version, 100);
     } else {
       // Sleep for 0.1 seconds.
       usleep(100000);
@@ -158,39 +613,56 @@ void read_db_value_blocking(const char* params_path, const char* key,
   }
 }
 
-int read_db_all(const char* params_path, std::map<std::string, std::string> *params) {
-  int err = 0;
-
-  if (params_path == NULL) {
-    params_path = default_params_path;
-  }
+int params_version(const char* params_path, uint32_t* version) {
+  ParamsStore* s = store_get(params_path);
+  if (s == NULL) return -1;
+  store_sync_external(s);
+  *version = __atomic_load_n(&store_header(s)->seq, __ATOMIC_ACQUIRE);
+  return 0;
+}
 
-  std::string lock_path = util::string_format("%s/.lock", params_path);
+int params_wait_change(const char* params_path, uint32_t* version, int timeout_ms) {
+  ParamsStore* s = store_get(params_path);
+  if (s == NULL) return -1;
 
-  int lock_fd = open(lock_path.c_str(), 0);
-  if (lock_fd < 0) return -1;
+  uint32_t* seq = &store_header(s)->seq;
+  const uint64_t deadline = nanos_since_boot() + timeout_ms * 1000000ULL;
+  while (1) {
+    store_sync_external(s);
+    const uint32_t cur = __atomic_load_n(seq, __ATOMIC_ACQUIRE);
+    if (cur != *version) {
+      *version = cur;
+      return 1;
+    }
 
-  err = flock(lock_fd, LOCK_EX);
-  if (err < 0) return err;
+    const uint64_t now = nanos_since_boot();
+    if (timeout_ms >= 0 && now >= deadline) return 0;
 
-  std::string key_path = util::string_format("%s/d", params_path);
-  DIR *d = opendir(key_path.c_str());
-  if (!d) {
-    close(lock_fd);
-    return -1;
+    // wake up for the inotify watch too
+    uint64_t sleep_ns = PARAMS_SYNC_INTERVAL;
+    if (timeout_ms >= 0 && deadline - now < sleep_ns) {
+      sleep_ns = deadline - now;
+    }
+#ifdef __linux__
+    struct timespec ts;
+    ts.tv_sec = sleep_ns / 1000000000ULL;
+    ts.tv_nsec = sleep_ns % 1000000000ULL;
+    syscall(SYS_futex, seq, FUTEX_WAIT, cur, &ts, NULL, 0);
+#else
+    usleep(sleep_ns / 1000);
+#endif
   }
+}
 
-  struct dirent *de = NULL;
-  while ((de = readdir(d))) {
-    if (!isalnum(de->d_name[0])) continue;
-    std::string key = std::string(de->d_name);
-    std::string value = util::read_file(util::string_format("%s/%s", key_path.c_str(), key.c_str()));
-
-    (*params)[key] = value;
+int read_db_all(const char* params_path, std::map<std::string, std::string> *params) {
+  ParamsStore* s = store_get(params_path);
+  if (s == NULL) return -1;
+  store_sync_external(s);
+
+  Values values;
+  store_read_all(s, &values);
+  for (const auto& kv : values) {
+    (*params)[kv.first] = kv.second;
   }
-
-  closedir(d);
-
-  close(lock_fd);
   return 0;
 }
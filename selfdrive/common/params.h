@@ -2,6 +2,7 @@
 #define _SELFDRIVE_COMMON_PARAMS_H_
 
 #include <stddef.h>
+#include <stdint.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -28,6 +29,22 @@ int read_db_value(const char* params_path, const char* key, char** value,
 void read_db_value_blocking(const char* params_path, const char* key,
                             char** value, size_t* value_sz);
 
+// Removes a key from the params database.
+int delete_db_value(const char* params_path, const char* key);
+
+// Gets the version of the params database, which changes with every write.
+// Reading is lock free, so a reader can hold on to the values it read and
+// only read them again when the version moved.
+//
+// Returns: Negative on failure, otherwise 0.
+int params_version(const char* params_path, uint32_t* version);
+
+// Sleeps until the version of the params database differs from *version,
+// at most timeout_ms (-1 forever), and stores the new version there.
+//
+// Returns: 1 if it changed, 0 on timeout, negative on failure.
+int params_wait_change(const char* params_path, uint32_t* version, int timeout_ms);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
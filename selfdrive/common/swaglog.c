@@ -4,6 +4,8 @@
 #include <stdlib.h>
 #include <stdarg.h>
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 #include <string.h>
 #include <assert.h>
 
@@ -13,9 +15,80 @@
 
 #include "common/timing.h"
 #include "common/version.h"
+#include "common/futex.h"
 
 #include "swaglog.h"
 
+// Logging calls below errors don't take a lock, format or send anything.
+// Every thread has its own ring of binary records: the format string, the
+// arguments as they were passed, the timestamp and where the call came
+// from. A background thread drains the rings, formats and JSON encodes the
+// messages and sends them to logmessaged, rate limited below errors. A
+// record that doesn't fit in its ring is dropped. Dropped and rate limited
+// messages are counted and reported in a warning.
+//
+// Errors go through the ring too but wake the drainer right away instead
+// of waiting for its next pass, and aren't dropped when the ring is full:
+// they go on an overflow list then. Messages too long for a record are
+// formatted on the heap, the ring carries the pointer. Nothing is formatted
+// into JSON or sent on the calling thread, a realtime thread never waits
+// on the socket.
+
+#define LOG_RING_SIZE (32*1024)  // per thread, a power of 2
+#define LOG_RECORD_MAX 2048      // longer messages go out from the heap
+#define LOG_MSG_MAX 4096
+#define LOG_DRAIN_INTERVAL_MS 10
+
+// messages per second and burst sent below CLOUDLOG_ERROR
+#define LOG_RATE 500
+#define LOG_BURST 1000
+
+#define LOG_SKIP -1             // levelnum of the unused end of a ring
+#define RECORD_FORMATTED 1      // fmt is the finished message
+#define RECORD_HEAP 2           // data is a pointer to a formatted heap record
+
+#define LOAD(ptr) __atomic_load_n(ptr, __ATOMIC_ACQUIRE)
+#define STORE(ptr, val) __atomic_store_n(ptr, val, __ATOMIC_RELEASE)
+#define XCHG(ptr, val) __atomic_exchange_n(ptr, val, __ATOMIC_ACQ_REL)
+#define CAS(ptr, expected, desired) \
+  __atomic_compare_exchange_n(ptr, expected, desired, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)
+
+#define PAD8(n) (((n) + 7) & ~(size_t)7)
+
+typedef struct LogRecord {
+  uint32_t size;  // of the whole record, a multiple of 8 in a ring
+  int16_t levelnum;
+  uint16_t flags;
+  int32_t lineno;
+  uint32_t fmt_len;
+  double created;
+  const char* filename;
+  const char* func;
+  // fmt padded to 8, then the arguments, 8 byte aligned
+  uint64_t data[];
+} LogRecord;
+
+typedef struct LogRing {
+  // producer side
+  uint32_t head __attribute__((aligned(64)));
+  uint32_t dropped;
+
+  // consumer side
+  uint32_t tail __attribute__((aligned(64)));
+
+  // the thread exited, the next new thread takes the ring over
+  int dead;
+  struct LogRing* next;
+  uint8_t* buf;
+  uint64_t scratch[LOG_RECORD_MAX / 8];
+} LogRing;
+
+// an error that didn't fit in its ring
+typedef struct LogOverflow {
+  struct LogOverflow* next;
+  uint64_t data[];  // the record
+} LogOverflow;
+
 typedef struct LogState {
   pthread_mutex_t lock;
   bool inited;
@@ -23,22 +96,577 @@ typedef struct LogState {
   void *zctx;
   void *sock;
   int print_level;
+
+  pthread_key_t ring_key;
+  LogRing* rings;
+
+  LogOverflow* overflow;
+
+  // started on the first log call, again in a forked child
+  bool drain_running;
+  pthread_t drain_thread;
+  pthread_mutex_t drain_lock;
+  uint32_t drain_seq;
+  uint32_t drain_waiters;
+  pthread_mutex_t drain_wait_lock;
+  pthread_cond_t drain_wait_cv;
+
+  // touched by the drainer only
+  double tokens;
+  uint64_t last_refill;
+  uint64_t last_report;
+  uint64_t dropped;
+  uint64_t limited;
+  uint64_t scratch[LOG_RECORD_MAX / 8];
+  char msg_buf[LOG_MSG_MAX];
 } LogState;
 
 static LogState s = {
   .lock = PTHREAD_MUTEX_INITIALIZER,
+  .drain_lock = PTHREAD_MUTEX_INITIALIZER,
+  .drain_wait_lock = PTHREAD_MUTEX_INITIALIZER,
+  .drain_wait_cv = PTHREAD_COND_INITIALIZER,
 };
 
+enum {
+  ARG_INT,
+  ARG_LONG,
+  ARG_LLONG,
+  ARG_INTMAX,
+  ARG_SIZE,
+  ARG_PTRDIFF,
+  ARG_DOUBLE,
+  ARG_LDOUBLE,
+  ARG_STR,
+  ARG_PTR,
+  ARG_NONE,  // %n, takes a pointer and prints nothing
+  ARG_BAD,   // anything else, the message is formatted right away
+};
+
+typedef struct FormatSpec {
+  const char* start;
+  const char* end;
+  bool width_arg;
+  bool precision_arg;
+  int type;
+} FormatSpec;
+
+// Finds the next conversion in fmt at or after p.
+static bool next_spec(const char* p, FormatSpec* spec) {
+  while ((p = strchr(p, '%')) && p[1] == '%') {
+    p += 2;
+  }
+  if (!p) return false;
+
+  spec->start = p++;
+  p += strspn(p, "-+ #0'");
+  spec->width_arg = *p == '*';
+  p += spec->width_arg ? 1 : strspn(p, "0123456789");
+  spec->precision_arg = false;
+  if (*p == '.') {
+    p++;
+    spec->precision_arg = *p == '*';
+    p += spec->precision_arg ? 1 : strspn(p, "0123456789");
+  }
+
+  char len = 0;
+  if (p[0] == 'h') {
+    len = 'h';
+    p += p[1] == 'h' ? 2 : 1;
+  } else if (p[0] == 'l') {
+    len = p[1] == 'l' ? 'q' : 'l';
+    p += p[1] == 'l' ? 2 : 1;
+  } else if (*p && strchr("qjztL", *p)) {
+    len = *p++;
+  }
+
+  const char conv = *p;
+  spec->end = conv ? p + 1 : p;
+  switch (conv) {
+  case 'd': case 'i': case 'u': case 'o': case 'x': case 'X':
+    switch (len) {
+    case 'l': spec->type = ARG_LONG; break;
+    case 'q': spec->type = ARG_LLONG; break;
+    case 'j': spec->type = ARG_INTMAX; break;
+    case 'z': spec->type = ARG_SIZE; break;
+    case 't': spec->type = ARG_PTRDIFF; break;
+    case 'L': spec->type = ARG_BAD; break;
+    default: spec->type = ARG_INT; break;
+    }
+    break;
+  case 'c':
+    spec->type = len ? ARG_BAD : ARG_INT;
+    break;
+  case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+    spec->type = len == 'L' ? ARG_LDOUBLE : len ? ARG_BAD : ARG_DOUBLE;
+    break;
+  case 's':
+    spec->type = len ? ARG_BAD : ARG_STR;
+    break;
+  case 'p':
+    spec->type = len ? ARG_BAD : ARG_PTR;
+    break;
+  case 'n':
+    spec->type = ARG_NONE;
+    break;
+  default:
+    spec->type = ARG_BAD;
+    break;
+  }
+  if (spec->end - spec->start > 32) {
+    spec->type = ARG_BAD;
+  }
+  return true;
+}
+
+static bool put_arg(uint8_t** p, const uint8_t* end, const void* v, size_t size) {
+  if ((size_t)(end - *p) < PAD8(size)) return false;
+  memcpy(*p, v, size);
+  *p += PAD8(size);
+  return true;
+}
+
+// Captures fmt and its arguments into rec, returns the record size or 0 if
+// they can't be captured.
+static size_t record_encode(LogRecord* rec, size_t max, const char* fmt, va_list args) {
+  uint8_t* p = (uint8_t*)rec->data;
+  const uint8_t* end = (const uint8_t*)rec + max;
+
+  rec->flags = 0;
+  rec->fmt_len = strlen(fmt);
+  if (!put_arg(&p, end, fmt, rec->fmt_len + 1)) return 0;
+
+  FormatSpec spec;
+  for (const char* f = fmt; next_spec(f, &spec); f = spec.end) {
+    if (spec.type == ARG_BAD) return 0;
+
+    if (spec.width_arg) {
+      const int64_t v = va_arg(args, int);
+      if (!put_arg(&p, end, &v, 8)) return 0;
+    }
+    if (spec.precision_arg) {
+      const int64_t v = va_arg(args, int);
+      if (!put_arg(&p, end, &v, 8)) return 0;
+    }
+
+    int64_t v = 0;
+    switch (spec.type) {
+    case ARG_INT: v = va_arg(args, int); break;
+    case ARG_LONG: v = va_arg(args, long); break;
+    case ARG_LLONG: v = va_arg(args, long long); break;
+    case ARG_INTMAX: v = va_arg(args, intmax_t); break;
+    case ARG_SIZE: v = va_arg(args, size_t); break;
+    case ARG_PTRDIFF: v = va_arg(args, ptrdiff_t); break;
+    case ARG_PTR: v = (intptr_t)va_arg(args, void*); break;
+    case ARG_NONE: va_arg(args, void*); continue;
+    case ARG_DOUBLE: {
+      const double d = va_arg(args, double);
+      if (!put_arg(&p, end, &d, sizeof(d))) return 0;
+      continue;
+    }
+    case ARG_LDOUBLE: {
+      const long double d = va_arg(args, long double);
+      if (!put_arg(&p, end, &d, sizeof(d))) return 0;
+      continue;
+    }
+    case ARG_STR: {
+      const char* str = va_arg(args, const char*);
+      if (!str) str = "(null)";
+      if (end - p < 16) return 0;
+      uint32_t len = strnlen(str, end - p - 8);
+      if ((ptrdiff_t)len == end - p - 8) return 0;
+      memcpy(p, &len, sizeof(len));
+      memcpy(p + 8, str, len);
+      p[8 + len] = '\0';
+      p += 8 + PAD8(len + 1);
+      continue;
+    }
+    }
+    if (!put_arg(&p, end, &v, 8)) return 0;
+  }
+  return p - (uint8_t*)rec;
+}
+
+static size_t append(char* out, size_t n, size_t out_size, const char* str, size_t len) {
+  if (n + len >= out_size) {
+    len = out_size - n - 1;
+  }
+  memcpy(out + n, str, len);
+  out[n + len] = '\0';
+  return n + len;
+}
+
+// fmt text with %% turned back into %
+static size_t append_literal(char* out, size_t n, size_t out_size, const char* p, const char* end) {
+  while (p < end) {
+    const char* pct = memchr(p, '%', end - p);
+    if (!pct) return append(out, n, out_size, p, end - p);
+    n = append(out, n, out_size, p, pct + 1 - p);
+    p = pct + 2;
+  }
+  return n;
+}
+
+static void record_format(const LogRecord* rec, char* out, size_t out_size) {
+  const char* fmt = (const char*)rec->data;
+  out[0] = '\0';
+
+  const uint8_t* arg = (const uint8_t*)rec->data + PAD8(rec->fmt_len + 1);
+  size_t n = 0;
+  FormatSpec spec;
+  const char* f = fmt;
+  for (; next_spec(f, &spec); f = spec.end) {
+    n = append_literal(out, n, out_size, f, spec.start);
+
+    // the spec with the * filled in
+    char spec_buf[64];
+    size_t spec_len = 0;
+    for (const char* c = spec.start; c < spec.end; c++) {
+      if (*c == '*') {
+        int64_t v;
+        memcpy(&v, arg, 8);
+        arg += 8;
+        spec_len += snprintf(spec_buf + spec_len, sizeof(spec_buf) - spec_len, "%d", (int)v);
+      } else {
+        spec_buf[spec_len++] = *c;
+      }
+    }
+    spec_buf[spec_len] = '\0';
+
+    int64_t v = 0;
+    int len = 0;
+    char* o = out + n;
+    const size_t left = out_size - n;
+    switch (spec.type) {
+    case ARG_NONE:
+      continue;
+    case ARG_DOUBLE: {
+      double d;
+      memcpy(&d, arg, sizeof(d));
+      arg += PAD8(sizeof(d));
+      len = snprintf(o, left, spec_buf, d);
+      break;
+    }
+    case ARG_LDOUBLE: {
+      long double d;
+      memcpy(&d, arg, sizeof(d));
+      arg += PAD8(sizeof(d));
+      len = snprintf(o, left, spec_buf, d);
+      break;
+    }
+    case ARG_STR: {
+      uint32_t str_len;
+      memcpy(&str_len, arg, sizeof(str_len));
+      len = snprintf(o, left, spec_buf, (const char*)arg + 8);
+      arg += 8 + PAD8(str_len + 1);
+      break;
+    }
+    default:
+      memcpy(&v, arg, 8);
+      arg += 8;
+      switch (spec.type) {
+      case ARG_INT: len = snprintf(o, left, spec_buf, (int)v); break;
+      case ARG_LONG: len = snprintf(o, left, spec_buf, (long)v); break;
+      case ARG_LLONG: len = snprintf(o, left, spec_buf, (long long)v); break;
+      case ARG_INTMAX: len = snprintf(o, left, spec_buf, (intmax_t)v); break;
+      case ARG_SIZE: len = snprintf(o, left, spec_buf, (size_t)v); break;
+      case ARG_PTRDIFF: len = snprintf(o, left, spec_buf, (ptrdiff_t)v); break;
+      case ARG_PTR: len = snprintf(o, left, spec_buf, (void*)(intptr_t)v); break;
+      }
+      break;
+    }
+    if (len > 0) {
+      n += (size_t)len < left ? (size_t)len : left - 1;
+    }
+  }
+  append_literal(out, n, out_size, f, f + strlen(f));
+}
+
+static bool ring_push(LogRing* ring, const LogRecord* rec) {
+  const uint32_t head = ring->head;
+  const uint32_t tail = LOAD(&ring->tail);
+  const uint32_t pos = head & (LOG_RING_SIZE - 1);
+
+  // records don't wrap, the end of the ring is skipped instead
+  const uint32_t skip = pos + rec->size > LOG_RING_SIZE ? LOG_RING_SIZE - pos : 0;
+  if (skip + rec->size > LOG_RING_SIZE - (head - tail)) return false;
+
+  if (skip) {
+    LogRecord* pad = (LogRecord*)(ring->buf + pos);
+    pad->size = skip;
+    pad->levelnum = LOG_SKIP;
+  }
+  memcpy(ring->buf + ((head + skip) & (LOG_RING_SIZE - 1)), rec, rec->size);
+  STORE(&ring->head, head + skip + rec->size);
+  return true;
+}
+
+static void overflow_push(const LogRecord* rec) {
+  LogOverflow* o = malloc(sizeof(LogOverflow) + rec->size);
+  if (!o) return;
+  memcpy(o->data, rec, rec->size);
+  LogOverflow* head = LOAD(&s.overflow);
+  do {
+    o->next = head;
+  } while (!CAS(&s.overflow, &head, o));
+}
+
+static void ring_release(void* p) {
+  LogRing* ring = p;
+  STORE(&ring->dead, 1);
+}
+
+static LogRing* get_ring() {
+  LogRing* ring = pthread_getspecific(s.ring_key);
+  if (ring) return ring;
+
+  // the only producer of a ring is its thread, so a new thread can take
+  // over the ring of one that exited as it is
+  for (LogRing* r = LOAD(&s.rings); r && !ring; r = r->next) {
+    int dead = 1;
+    if (LOAD(&r->dead) && CAS(&r->dead, &dead, 0)) {
+      ring = r;
+    }
+  }
+
+  if (!ring) {
+    ring = calloc(1, sizeof(LogRing));
+    if (!ring) return NULL;
+    ring->buf = malloc(LOG_RING_SIZE);
+    if (!ring->buf) {
+      free(ring);
+      return NULL;
+    }
+
+    LogRing* head = LOAD(&s.rings);
+    do {
+      ring->next = head;
+    } while (!CAS(&s.rings, &head, ring));
+  }
+
+  pthread_setspecific(s.ring_key, ring);
+  return ring;
+}
+
+static void ship(const LogRecord* rec) {
+  // rate limit below errors
+  if (rec->levelnum < CLOUDLOG_ERROR) {
+    const uint64_t now = nanos_since_boot();
+    s.tokens += (now - s.last_refill) * 1e-9 * LOG_RATE;
+    if (s.tokens > LOG_BURST) s.tokens = LOG_BURST;
+    s.last_refill = now;
+    if (s.tokens < 1) {
+      s.limited++;
+      return;
+    }
+    s.tokens -= 1;
+  }
+
+  // formatted ones can be longer than msg_buf
+  const char* msg = (const char*)rec->data;
+  if (!(rec->flags & RECORD_FORMATTED)) {
+    record_format(rec, s.msg_buf, sizeof(s.msg_buf));
+    msg = s.msg_buf;
+  }
+
+  if (rec->levelnum >= s.print_level) {
+    printf("%s: %s\n", rec->filename, msg);
+  }
+
+  JsonNode *log_j = json_mkobject();
+  assert(log_j);
+
+  pthread_mutex_lock(&s.lock);
+  json_append_member(log_j, "msg", json_mkstring(msg));
+  json_append_member(log_j, "ctx", s.ctx_j);
+  json_append_member(log_j, "levelnum", json_mknumber(rec->levelnum));
+  json_append_member(log_j, "filename", json_mkstring(rec->filename));
+  json_append_member(log_j, "lineno", json_mknumber(rec->lineno));
+  json_append_member(log_j, "funcname", json_mkstring(rec->func));
+  json_append_member(log_j, "created", json_mknumber(rec->created));
+
+  char* log_s = json_encode(log_j);
+  assert(log_s);
+
+  json_remove_from_parent(s.ctx_j);
+  pthread_mutex_unlock(&s.lock);
+
+  json_delete(log_j);
+
+  char levelnum_c = rec->levelnum;
+  zmq_send(s.sock, &levelnum_c, 1, ZMQ_NOBLOCK | ZMQ_SNDMORE);
+  zmq_send(s.sock, log_s, strlen(log_s), ZMQ_NOBLOCK);
+  free(log_s);
+}
+
+static void report_losses() {
+  const uint64_t now = nanos_since_boot();
+  if ((!s.dropped && !s.limited) || now - s.last_report < 1000000000ULL) return;
+  s.last_report = now;
+
+  LogRecord* rec = (LogRecord*)s.scratch;
+  rec->levelnum = CLOUDLOG_WARNING;
+  rec->lineno = __LINE__;
+  rec->created = seconds_since_epoch();
+  rec->filename = __FILE__;
+  rec->func = __func__;
+  rec->flags = RECORD_FORMATTED;
+  rec->fmt_len = snprintf((char*)rec->data, LOG_RECORD_MAX - sizeof(LogRecord),
+                          "swaglog: %llu messages dropped, %llu rate limited",
+                          (unsigned long long)s.dropped, (unsigned long long)s.limited);
+  s.dropped = 0;
+  s.limited = 0;
+  // not counted against the limit
+  s.tokens += 1;
+  ship(rec);
+}
+
+static void drain_locked() {
+  for (LogRing* ring = LOAD(&s.rings); ring; ring = ring->next) {
+    const uint32_t head = LOAD(&ring->head);
+    uint32_t tail = ring->tail;
+    while (tail != head) {
+      const LogRecord* rec = (const LogRecord*)(ring->buf + (tail & (LOG_RING_SIZE - 1)));
+      const uint32_t size = rec->size;
+      if (rec->levelnum == LOG_SKIP) {
+        tail += size;
+        STORE(&ring->tail, tail);
+      } else if (rec->flags & RECORD_HEAP) {
+        LogRecord* heap_rec;
+        memcpy(&heap_rec, rec->data, sizeof(heap_rec));
+        tail += size;
+        STORE(&ring->tail, tail);
+        ship(heap_rec);
+        free(heap_rec);
+      } else {
+        // copy it out to give the space back before the slow part
+        memcpy(s.scratch, rec, size);
+        tail += size;
+        STORE(&ring->tail, tail);
+        ship((const LogRecord*)s.scratch);
+      }
+    }
+    s.dropped += XCHG(&ring->dropped, 0);
+  }
+
+  // oldest first
+  LogOverflow* o = XCHG(&s.overflow, NULL);
+  LogOverflow* rev = NULL;
+  while (o) {
+    LogOverflow* next = o->next;
+    o->next = rev;
+    rev = o;
+    o = next;
+  }
+  while (rev) {
+    LogOverflow* next = rev->next;
+    ship((const LogRecord*)rev->data);
+    free(rev);
+    rev = next;
+  }
+  report_losses();
+}
+
+static void* drain_thread(void* arg) {
+  (void)arg;
+  while (1) {
+    const uint32_t seq = LOAD(&s.drain_seq);
+    pthread_mutex_lock(&s.drain_lock);
+    drain_locked();
+    pthread_mutex_unlock(&s.drain_lock);
+    __atomic_fetch_add(&s.drain_waiters, 1, __ATOMIC_SEQ_CST);
+    seq_wait(&s.drain_seq, seq, LOG_DRAIN_INTERVAL_MS, &s.drain_wait_lock, &s.drain_wait_cv);
+    __atomic_fetch_sub(&s.drain_waiters, 1, __ATOMIC_SEQ_CST);
+  }
+  return NULL;
+}
+
+static void start_drain_locked() {
+  s.zctx = zmq_ctx_new();
+  s.sock = zmq_socket(s.zctx, ZMQ_PUSH);
+  zmq_connect(s.sock, "ipc:///tmp/logmessage");
+
+  int err = pthread_create(&s.drain_thread, NULL, drain_thread, NULL);
+  assert(err == 0);
+  STORE(&s.drain_running, true);
+}
+
+static void start_drain() {
+  if (LOAD(&s.drain_running)) return;
+  pthread_mutex_lock(&s.lock);
+  if (!s.drain_running) {
+    start_drain_locked();
+  }
+  pthread_mutex_unlock(&s.lock);
+}
+
+// frees what a record in a ring owns
+static void record_discard(const LogRecord* rec) {
+  if (rec->levelnum != LOG_SKIP && (rec->flags & RECORD_HEAP)) {
+    LogRecord* heap_rec;
+    memcpy(&heap_rec, rec->data, sizeof(heap_rec));
+    free(heap_rec);
+  }
+}
+
+// nothing is shipping or binding while the process forks
+static void atfork_prepare() {
+  pthread_mutex_lock(&s.drain_lock);
+  pthread_mutex_lock(&s.lock);
+}
+
+static void atfork_parent() {
+  pthread_mutex_unlock(&s.lock);
+  pthread_mutex_unlock(&s.drain_lock);
+}
+
+static void atfork_child() {
+  // only the forking thread is here. What was queued is the parent's to
+  // send, and the rings of the other threads are free for new ones
+  LogRing* own = pthread_getspecific(s.ring_key);
+  for (LogRing* r = s.rings; r; r = r->next) {
+    for (uint32_t tail = r->tail; tail != r->head;) {
+      const LogRecord* rec = (const LogRecord*)(r->buf + (tail & (LOG_RING_SIZE - 1)));
+      record_discard(rec);
+      tail += rec->size;
+    }
+    r->tail = r->head;
+    r->dropped = 0;
+    r->dead = r != own;
+  }
+  for (LogOverflow* o = s.overflow; o;) {
+    LogOverflow* next = o->next;
+    free(o);
+    o = next;
+  }
+  s.overflow = NULL;
+  s.dropped = 0;
+  s.limited = 0;
+
+  // the parent's zmq context has no io thread here, and neither is there a
+  // drainer. Both are started by the child's first log call, a child that
+  // goes on to exec doesn't pay for them
+  s.zctx = NULL;
+  s.sock = NULL;
+  s.drain_running = false;
+
+  pthread_mutex_unlock(&s.lock);
+  pthread_mutex_unlock(&s.drain_lock);
+}
+
 static void cloudlog_bind_locked(const char* k, const char* v) {
   json_append_member(s.ctx_j, k, json_mkstring(v));
 }
 
 static void cloudlog_init() {
-  if (s.inited) return;
+  if (LOAD(&s.inited)) return;
+
+  pthread_mutex_lock(&s.lock);
+  if (s.inited) {
+    pthread_mutex_unlock(&s.lock);
+    return;
+  }
   s.ctx_j = json_mkobject();
-  s.zctx = zmq_ctx_new();
-  s.sock = zmq_socket(s.zctx, ZMQ_PUSH);
-  zmq_connect(s.sock, "ipc:///tmp/logmessage");
 
   s.print_level = CLOUDLOG_WARNING;
   const char* print_level = getenv("LOGPRINT");
@@ -61,59 +689,102 @@ static void cloudlog_init() {
   bool dirty = !getenv("CLEAN");
   json_append_member(s.ctx_j, "dirty", json_mkbool(dirty));
 
-  s.inited = true;
+  int err = pthread_key_create(&s.ring_key, ring_release);
+  assert(err == 0);
+
+  s.tokens = LOG_BURST;
+  s.last_refill = nanos_since_boot();
+  start_drain_locked();
+  atexit(cloudlog_flush);
+  err = pthread_atfork(atfork_prepare, atfork_parent, atfork_child);
+  assert(err == 0);
+
+  STORE(&s.inited, true);
+  pthread_mutex_unlock(&s.lock);
 }
 
 void cloudlog_e(int levelnum, const char* filename, int lineno, const char* func,
                 const char* fmt, ...) {
-  pthread_mutex_lock(&s.lock);
   cloudlog_init();
+  start_drain();
+  LogRing* ring = get_ring();
+  if (!ring) return;
 
-  char* msg_buf = NULL;
-  va_list args;
+  LogRecord* rec = (LogRecord*)ring->scratch;
+  rec->levelnum = levelnum;
+  rec->lineno = lineno;
+  rec->created = seconds_since_epoch();
+  rec->filename = filename;
+  rec->func = func;
+
+  LogRecord* heap_rec = NULL;
+  va_list args, args_copy;
   va_start(args, fmt);
-  vasprintf(&msg_buf, fmt, args);
+  va_copy(args_copy, args);
+  size_t size = record_encode(rec, sizeof(ring->scratch), fmt, args);
+  if (size == 0) {
+    // too long or a conversion we don't capture, format it here
+    rec->flags = RECORD_FORMATTED;
+    const size_t max = sizeof(ring->scratch) - sizeof(LogRecord);
+    va_list args_heap;
+    va_copy(args_heap, args_copy);
+    int len = vsnprintf((char*)rec->data, max, fmt, args_copy);
+    if (len < 0) {
+      len = 0;
+    } else if ((size_t)len >= max) {
+      heap_rec = malloc(sizeof(LogRecord) + len + 1);
+      if (heap_rec) {
+        *heap_rec = *rec;
+        vsnprintf((char*)heap_rec->data, len + 1, fmt, args_heap);
+        heap_rec->fmt_len = len;
+        heap_rec->size = sizeof(LogRecord) + len + 1;
+      } else {
+        len = max - 1;
+      }
+    }
+    va_end(args_heap);
+    rec->fmt_len = len;
+    size = sizeof(LogRecord) + rec->fmt_len + 1;
+  }
+  va_end(args_copy);
   va_end(args);
+  rec->size = PAD8(size);
 
-  if (!msg_buf) {
-    pthread_mutex_unlock(&s.lock);
-    return;
+  if (heap_rec) {
+    // the ring only carries the pointer, the drainer frees it
+    rec->flags = RECORD_HEAP;
+    memcpy(rec->data, &heap_rec, sizeof(heap_rec));
+    rec->size = PAD8(sizeof(LogRecord) + sizeof(heap_rec));
   }
 
-  if (levelnum >= s.print_level) {
-    printf("%s: %s\n", filename, msg_buf);
+  const bool error = levelnum >= CLOUDLOG_ERROR;
+  if (ring_push(ring, rec)) {
+    heap_rec = NULL;
+  } else if (error) {
+    overflow_push(heap_rec ? heap_rec : rec);
+  } else {
+    __atomic_fetch_add(&ring->dropped, 1, __ATOMIC_RELAXED);
   }
+  free(heap_rec);
 
-  JsonNode *log_j = json_mkobject();
-  assert(log_j);
-
-  json_append_member(log_j, "msg", json_mkstring(msg_buf));
-  json_append_member(log_j, "ctx", s.ctx_j);
-  json_append_member(log_j, "levelnum", json_mknumber(levelnum));
-  json_append_member(log_j, "filename", json_mkstring(filename));
-  json_append_member(log_j, "lineno", json_mknumber(lineno));
-  json_append_member(log_j, "funcname", json_mkstring(func));
-  json_append_member(log_j, "created", json_mknumber(seconds_since_epoch()));
-
-  char* log_s = json_encode(log_j);
-  assert(log_s);
-
-  json_remove_from_parent(s.ctx_j);  
-
-  json_delete(log_j);
-  free(msg_buf);
-
-  char levelnum_c = levelnum;
-  zmq_send(s.sock, &levelnum_c, 1, ZMQ_NOBLOCK | ZMQ_SNDMORE);
-  zmq_send(s.sock, log_s, strlen(log_s), ZMQ_NOBLOCK);
-  free(log_s);
+  // errors are out as soon as the drainer gets to them, in case we are about
+  // to die. A ring past half full is drained early to keep it from dropping
+  if (error || ring->head - LOAD(&ring->tail) > LOG_RING_SIZE / 2) {
+    seq_wake(&s.drain_seq, &s.drain_waiters, 1, &s.drain_wait_lock, &s.drain_wait_cv);
+  }
+}
 
-  pthread_mutex_unlock(&s.lock);
+void cloudlog_flush(void) {
+  // a forked child that never logged has nothing to send
+  if (!LOAD(&s.inited) || !LOAD(&s.drain_running)) return;
+  pthread_mutex_lock(&s.drain_lock);
+  drain_locked();
+  pthread_mutex_unlock(&s.drain_lock);
 }
 
 void cloudlog_bind(const char* k, const char* v) {
-  pthread_mutex_lock(&s.lock);
   cloudlog_init();
+  pthread_mutex_lock(&s.lock);
   cloudlog_bind_locked(k, v);
   pthread_mutex_unlock(&s.lock);
 }
@@ -13,9 +13,14 @@
 extern "C" {
 #endif
 
+// Queues a message, it is formatted and sent from a background thread.
+// filename and func have to stay around, as __FILE__ and __func__ do.
 void cloudlog_e(int levelnum, const char* filename, int lineno, const char* func,
                 const char* fmt, ...) /*__attribute__ ((format (printf, 6, 7)))*/;
 
+// Sends everything queued so far, also done at exit.
+void cloudlog_flush(void);
+
 void cloudlog_bind(const char* k, const char* v);
 
 #ifdef __cplusplus
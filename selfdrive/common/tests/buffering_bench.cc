@@ -0,0 +1,84 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cassert>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <time.h>
+
+#include "common/buffering.h"
+
+// Acquire/release pairs per second through a Pool with 1 to 8 reader
+// threads, each on its own tbuffer as the visiond clients are, with a
+// writer pushing as fast as it can.
+//
+// usage: buffering_bench [seconds per run]
+
+#define POOL_BUFS 40
+
+static double millis() {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec * 1000.0 + t.tv_nsec * 1e-6;
+}
+
+static void run(int num_readers, double seconds) {
+  Pool pool;
+  pool_init(&pool, POOL_BUFS);
+
+  std::vector<TBuffer*> tbufs;
+  for (int i = 0; i < num_readers; i++) tbufs.push_back(pool_get_tbuffer(&pool));
+
+  std::vector<uint64_t> pairs(num_readers * 16, 0);
+  std::vector<std::thread> readers;
+  for (int r = 0; r < num_readers; r++) {
+    readers.emplace_back([&, r]() {
+      TBuffer *tb = tbufs[r];
+      uint64_t n = 0;
+      while (true) {
+        int idx = tbuffer_acquire(tb);
+        if (idx < 0) break;
+        tbuffer_release(tb, idx);
+        n++;
+      }
+      // padded so the counters don't share a line
+      pairs[r * 16] = n;
+    });
+  }
+
+  std::atomic<bool> done(false);
+  uint64_t pushes = 0;
+  std::thread writer([&]() {
+    while (!done) {
+      pool_push(&pool, pool_select(&pool));
+      pushes++;
+    }
+  });
+
+  const double t1 = millis();
+  while (millis() - t1 < seconds * 1000) {
+    struct timespec ts = {0, 10 * 1000 * 1000};
+    nanosleep(&ts, NULL);
+  }
+  done = true;
+  writer.join();
+  const double elapsed = (millis() - t1) / 1000.0;
+  pool_stop(&pool);
+  for (auto &t : readers) t.join();
+
+  uint64_t total = 0;
+  for (int r = 0; r < num_readers; r++) total += pairs[r * 16];
+  printf("%d readers: %10.0f acquire/release pairs/s  %10.0f pushes/s\n",
+         num_readers, total / elapsed, pushes / elapsed);
+}
+
+int main(int argc, char** argv) {
+  const double seconds = argc > 1 ? atof(argv[1]) : 2;
+  assert(seconds > 0);
+
+  for (int readers = 1; readers <= 8; readers *= 2) {
+    run(readers, seconds);
+  }
+  return 0;
+}
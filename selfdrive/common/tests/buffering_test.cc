@@ -0,0 +1,287 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cassert>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+#include <sched.h>
+#include <poll.h>
+
+#include "common/buffering.h"
+
+// Stress test for TBuffer and Pool, meant to be run under tsan (make
+// buffering_test builds it with -fsanitize=thread). A writer stamps every
+// buffer with its frame number before handing it out, readers check that
+// the stamp holds while they have the buffer and that frames only move
+// forward.
+
+#define CHECK(cond) do { \
+    if (!(cond)) { \
+      printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+      exit(1); \
+    } \
+  } while (0)
+
+#define NUM_FRAMES 200000
+#define NUM_BUFS 8
+#define POOL_BUFS 40
+
+// read the stamp a few times while holding the buffer
+static void check_held(const int *stamps, int idx, int *last) {
+  const int stamp = stamps[idx];
+  for (int k = 0; k < 16; k++) {
+    CHECK(stamps[idx] == stamp);
+  }
+  CHECK(stamp > *last);
+  *last = stamp;
+}
+
+static void test_tbuffer(int num_readers) {
+  TBuffer tb;
+  tbuffer_init(&tb, NUM_BUFS + num_readers, "test");
+  std::vector<int> stamps(tb.num_bufs, 0);
+
+  std::atomic<int> received(0);
+  std::vector<std::thread> readers;
+  for (int r = 0; r < num_readers; r++) {
+    readers.emplace_back([&]() {
+      int last = 0;
+      while (true) {
+        int idx = tbuffer_acquire(&tb);
+        if (idx < 0) break;
+        check_held(stamps.data(), idx, &last);
+        received++;
+        tbuffer_release(&tb, idx);
+      }
+    });
+  }
+
+  for (int f = 1; f <= NUM_FRAMES; f++) {
+    int idx = tbuffer_select(&tb);
+    stamps[idx] = f;
+    tbuffer_dispatch(&tb, idx);
+  }
+
+  // let the readers catch the last one
+  usleep(100 * 1000);
+  tbuffer_stop(&tb);
+  for (auto &t : readers) t.join();
+  CHECK(tbuffer_acquire(&tb) == -1);
+
+  printf("tbuffer, %d readers: %d of %d frames read\n", num_readers, received.load(), NUM_FRAMES);
+  CHECK(received > 0);
+}
+
+struct PoolCounter {
+  std::atomic<int> released;
+};
+
+static void pool_released(void *cookie, int idx) {
+  ((PoolCounter*)cookie)->released++;
+}
+
+static bool pool_has_free(Pool *s) {
+  for (int i = 0; i < s->num_bufs; i++) {
+    if (__atomic_load_n(&s->refcnt[i], __ATOMIC_SEQ_CST) == 0) return true;
+  }
+  return false;
+}
+
+static void test_pool(int num_tbufs, int num_queues) {
+  PoolCounter counter;
+  counter.released = 0;
+
+  Pool pool;
+  pool_init2(&pool, POOL_BUFS, pool_released, &counter);
+  std::vector<int> stamps(POOL_BUFS, 0);
+
+  std::vector<TBuffer*> tbufs;
+  for (int i = 0; i < num_tbufs; i++) tbufs.push_back(pool_get_tbuffer(&pool));
+  std::vector<PoolQueue*> queues;
+  for (int i = 0; i < num_queues; i++) queues.push_back(pool_get_queue(&pool));
+
+  std::atomic<int> received(0);
+  std::vector<std::thread> readers;
+  for (TBuffer *tb : tbufs) {
+    readers.emplace_back([&, tb]() {
+      int last = 0;
+      while (true) {
+        int idx = tbuffer_acquire(tb);
+        if (idx < 0) break;
+        check_held(stamps.data(), idx, &last);
+        received++;
+        tbuffer_release(tb, idx);
+      }
+    });
+  }
+  // the first queue goes away and comes back while the writer pushes, for
+  // the first half of the frames
+  std::atomic<bool> churn(true), churn_done(false);
+  for (size_t q = 0; q < queues.size(); q++) {
+    readers.emplace_back([&, q]() {
+      PoolQueue *c = queues[q];
+      int last = 0;
+      int held = -1;
+      int pops = 0;
+      while (true) {
+        int idx = poolq_pop(c);
+        if (idx < 0) break;
+        // queues are in order, and may hold more than one
+        check_held(stamps.data(), idx, &last);
+        received++;
+        if (held >= 0) poolq_release(c, held);
+        held = idx;
+
+        if (q == 0 && !churn_done && (++pops % 1000 == 0 || !churn)) {
+          poolq_release(c, held);
+          held = -1;
+          // a queue that goes away releases what it didn't get to
+          pool_release_queue(c);
+          if (!churn) {
+            churn_done = true;
+            break;
+          }
+          c = pool_get_queue(&pool);
+        }
+      }
+      if (held >= 0) poolq_release(c, held);
+    });
+  }
+
+  for (int f = 1; f <= NUM_FRAMES; f++) {
+    // the queues can hold every buffer, don't get to evicting them
+    while (!pool_has_free(&pool)) sched_yield();
+
+    int idx = pool_select(&pool);
+    stamps[idx] = f;
+    pool_push(&pool, idx);
+
+    if (f == NUM_FRAMES / 2) churn = false;
+  }
+  while (num_queues > 0 && !churn_done) usleep(1000);
+
+  usleep(100 * 1000);
+  pool_stop(&pool);
+  for (auto &t : readers) t.join();
+
+  for (TBuffer *tb : tbufs) tbuffer_release_all(tb);
+  for (int q = 1; q < num_queues; q++) pool_release_queue(queues[q]);
+
+  for (int i = 0; i < POOL_BUFS; i++) {
+    CHECK(__atomic_load_n(&pool.refcnt[i], __ATOMIC_SEQ_CST) == 0);
+  }
+  printf("pool, %d tbuffers %d queues: %d reads, %d releases\n",
+         num_tbufs, num_queues, received.load(), counter.released.load());
+  CHECK(received > 0);
+}
+
+static bool readable(int fd) {
+  struct pollfd p = {fd, POLLIN, 0};
+  return poll(&p, 1, 0) == 1;
+}
+
+// the eventfds have to follow the buffers once somebody polls them
+static void test_efd() {
+  TBuffer tb;
+  tbuffer_init(&tb, NUM_BUFS, "efd");
+  // dispatched before anybody asked for the fd
+  tbuffer_dispatch(&tb, tbuffer_select(&tb));
+  int efd = tbuffer_efd(&tb);
+  CHECK(readable(efd));
+
+  int idx = tbuffer_acquire(&tb);
+  CHECK(idx >= 0);
+  CHECK(!readable(efd));
+  tbuffer_dispatch(&tb, tbuffer_select(&tb));
+  CHECK(readable(efd));
+  tbuffer_release(&tb, idx);
+  tbuffer_stop(&tb);
+  CHECK(readable(efd));
+
+  Pool pool;
+  pool_init(&pool, NUM_BUFS);
+  PoolQueue *c = pool_get_queue(&pool);
+  int qefd = poolq_efd(c);
+  CHECK(!readable(qefd));
+  pool_push(&pool, pool_select(&pool));
+  pool_push(&pool, pool_select(&pool));
+  CHECK(readable(qefd));
+  // level triggered, readable until the queue is empty
+  poolq_release(c, poolq_pop(c));
+  CHECK(readable(qefd));
+  poolq_release(c, poolq_pop(c));
+  CHECK(!readable(qefd));
+  pool_release_queue(c);
+
+  printf("efd OK\n");
+}
+
+static void count_release(void *cookie, int idx) {
+  ((int *)cookie)[idx]++;
+}
+
+// a writer can hand out a buffer again while it's still pending or being
+// read, every dispatch has to end in exactly one release
+static void test_redispatch() {
+  int released[NUM_BUFS] = {0};
+  TBuffer tb;
+  tbuffer_init2(&tb, NUM_BUFS, "redispatch", count_release, released);
+
+  // again while being read
+  int idx = tbuffer_select(&tb);
+  tbuffer_dispatch(&tb, idx);
+  CHECK(tbuffer_acquire(&tb) == idx);
+  tbuffer_dispatch(&tb, idx);
+  CHECK(tbuffer_select(&tb) != idx);
+  tbuffer_release(&tb, idx);
+  CHECK(released[idx] == 1);
+  CHECK(tbuffer_select(&tb) != idx);
+  CHECK(tbuffer_acquire(&tb) == idx);
+  tbuffer_release(&tb, idx);
+  CHECK(released[idx] == 2);
+  CHECK(tbuffer_select(&tb) == idx);
+
+  // again while pending, the first dispatch is dropped
+  tbuffer_dispatch(&tb, idx);
+  tbuffer_dispatch(&tb, idx);
+  CHECK(released[idx] == 3);
+  CHECK(tbuffer_select(&tb) != idx);
+  CHECK(tbuffer_acquire(&tb) == idx);
+  CHECK(tbuffer_select(&tb) != idx);
+  tbuffer_release(&tb, idx);
+  CHECK(released[idx] == 4);
+  CHECK(tbuffer_select(&tb) == idx);
+
+  // through a pool, the refcount has to come back to zero
+  Pool pool;
+  pool_init(&pool, NUM_BUFS);
+  TBuffer *ptb = pool_get_tbuffer(&pool);
+  idx = pool_select(&pool);
+  pool_push(&pool, idx);
+  CHECK(tbuffer_acquire(ptb) == idx);
+  // the writer takes its own reference again for the second push
+  pool_acquire(&pool, idx);
+  pool_push(&pool, idx);
+  tbuffer_release(ptb, idx);
+  CHECK(pool.refcnt[idx] == 1);
+  CHECK(tbuffer_acquire(ptb) == idx);
+  tbuffer_release(ptb, idx);
+  CHECK(pool.refcnt[idx] == 0);
+
+  printf("redispatch OK\n");
+}
+
+int main() {
+  test_efd();
+  test_redispatch();
+  for (int readers : {1, 2, 4}) {
+    test_tbuffer(readers);
+  }
+  test_pool(2, 2);
+  test_pool(4, 4);
+  printf("OK\n");
+  return 0;
+}
@@ -0,0 +1,104 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+#include <cassert>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <algorithm>
+
+#include <time.h>
+#include <sched.h>
+#include <unistd.h>
+
+#include "common/timing.h"
+#include "common/cqueue.h"
+
+// Ops per second with pushers and poppers going flat out, and the latency
+// from push to pop when the pushers sleep between items (every 50us or so,
+// usleep's slack), as a camera thread handing frames to an encoder does.
+//
+// usage: cqueue_bench [items]
+
+#define QUEUE_SIZE 64
+
+struct Config {
+  const char* name;
+  QueueType type;
+  int pushers, poppers;
+};
+
+static void run(const Config &cfg, int items, bool paced) {
+  Queue q;
+  queue_init2(&q, QUEUE_SIZE, cfg.type);
+
+  const int per_pusher = items / cfg.pushers;
+  const int total = per_pusher * cfg.pushers;
+  std::vector<uint64_t> pushed_at(total);
+  std::vector<float> latency(total);
+
+  std::atomic<bool> go(false);
+  std::atomic<int> popped(0);
+  std::vector<std::thread> threads;
+  for (int p = 0; p < cfg.pushers; p++) {
+    threads.emplace_back([&, p]() {
+      while (!go) sched_yield();
+      uint64_t next = nanos_since_boot();
+      for (int i = 0; i < per_pusher; i++) {
+        const int idx = p * per_pusher + i;
+        if (paced) {
+          next += 50 * 1000;
+          const uint64_t now = nanos_since_boot();
+          if (next > now) usleep((next - now) / 1000);
+        }
+        pushed_at[idx] = nanos_since_boot();
+        queue_push(&q, (void*)(uintptr_t)(idx + 1));
+      }
+    });
+  }
+  for (int c = 0; c < cfg.poppers; c++) {
+    threads.emplace_back([&]() {
+      while (!go) sched_yield();
+      while (popped < total) {
+        void *r = queue_pop_timeout(&q, 10);
+        if (!r) continue;
+        const int idx = (uintptr_t)r - 1;
+        latency[idx] = (nanos_since_boot() - pushed_at[idx]) / 1000.0f;
+        popped++;
+      }
+    });
+  }
+
+  const uint64_t t1 = nanos_since_boot();
+  go = true;
+  for (auto &t : threads) t.join();
+  const double secs = (nanos_since_boot() - t1) * 1e-9;
+  queue_destroy(&q);
+
+  if (paced) {
+    std::sort(latency.begin(), latency.end());
+    printf("%-12s paced  p50 %7.1fus  p99 %7.1fus  p99.9 %8.1fus  max %8.1fus\n",
+           cfg.name, latency[total / 2], latency[total * 99 / 100],
+           latency[total * 999 / 1000], latency[total - 1]);
+  } else {
+    printf("%-12s flat   %10.0f ops/s\n", cfg.name, total / secs);
+  }
+}
+
+int main(int argc, char** argv) {
+  const int items = argc > 1 ? atoi(argv[1]) : 1000000;
+  assert(items > 0);
+
+  const Config configs[] = {
+    {"spsc 1/1", QUEUE_SPSC, 1, 1},
+    {"mpmc 1/1", QUEUE_MPMC, 1, 1},
+    {"mpmc 2/2", QUEUE_MPMC, 2, 2},
+    {"mpmc 4/4", QUEUE_MPMC, 4, 4},
+  };
+  for (const Config &cfg : configs) {
+    run(cfg, items, false);
+    // about a second, paced
+    run(cfg, std::min(items, 20000), true);
+  }
+  return 0;
+}
@@ -0,0 +1,184 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+#include <cstring>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <time.h>
+#include <sched.h>
+
+#include "common/cqueue.h"
+
+// Queue behaviour, every item exactly once with several pushing and
+// popping threads, and no allocations once a queue is set up: malloc and
+// friends are counted while the threads go.
+
+#define CHECK(cond) do { \
+    if (!(cond)) { \
+      printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+      exit(1); \
+    } \
+  } while (0)
+
+// tsan has its own malloc, there's nothing counted under it
+#if defined(__SANITIZE_THREAD__)
+#define TSAN
+#elif defined(__has_feature)
+#if __has_feature(thread_sanitizer)
+#define TSAN
+#endif
+#endif
+
+static std::atomic<bool> counting(false);
+static std::atomic<int> allocs(0);
+
+#ifndef TSAN
+extern "C" {
+void *__libc_malloc(size_t size);
+void *__libc_calloc(size_t n, size_t size);
+void *__libc_realloc(void *p, size_t size);
+
+void *malloc(size_t size) {
+  if (counting) allocs++;
+  return __libc_malloc(size);
+}
+
+void *calloc(size_t n, size_t size) {
+  if (counting) allocs++;
+  return __libc_calloc(n, size);
+}
+
+void *realloc(void *p, size_t size) {
+  if (counting) allocs++;
+  return __libc_realloc(p, size);
+}
+}
+#endif
+
+static double millis() {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec * 1000.0 + t.tv_nsec * 1e-6;
+}
+
+static void* item(uintptr_t i) {
+  return (void*)(i + 1);
+}
+
+static uintptr_t item_idx(void *p) {
+  return (uintptr_t)p - 1;
+}
+
+static void test_basic(QueueType type) {
+  Queue q;
+  queue_init2(&q, 5, type);
+  CHECK(q.size == 8);
+
+  CHECK(queue_try_pop(&q) == NULL);
+  for (int i = 0; i < 8; i++) {
+    CHECK(queue_try_push(&q, item(i)));
+  }
+  CHECK(!queue_try_push(&q, item(8)));
+
+  double t1 = millis();
+  CHECK(!queue_push_timeout(&q, item(8), 20));
+  CHECK(millis() - t1 >= 19);
+
+  // in order, and around the ring a few times
+  for (int i = 0; i < 100; i++) {
+    CHECK(item_idx(queue_pop(&q)) == (uintptr_t)i);
+    queue_push(&q, item(i + 8));
+  }
+  for (int i = 100; i < 108; i++) {
+    CHECK(item_idx(queue_try_pop(&q)) == (uintptr_t)i);
+  }
+
+  t1 = millis();
+  CHECK(queue_pop_timeout(&q, 20) == NULL);
+  CHECK(millis() - t1 >= 19);
+
+  // a blocked pop gets the push from another thread
+  std::thread pusher([&]() {
+    struct timespec ts = {0, 10 * 1000 * 1000};
+    nanosleep(&ts, NULL);
+    queue_push(&q, item(42));
+  });
+  CHECK(item_idx(queue_pop_timeout(&q, 5000)) == 42);
+  pusher.join();
+
+  queue_destroy(&q);
+}
+
+// every item exactly once, in order per pusher
+static void test_threads(QueueType type, int num_pushers, int num_poppers, int per_pusher) {
+  Queue q;
+  queue_init2(&q, 16, type);
+
+  CHECK(num_pushers <= 8);
+  const int total = num_pushers * per_pusher;
+  std::vector<std::atomic<int>> seen(total);
+  for (auto &s : seen) s = 0;
+
+  std::atomic<bool> go(false);
+  std::atomic<int> popped(0);
+  std::vector<std::thread> threads;
+  for (int p = 0; p < num_pushers; p++) {
+    threads.emplace_back([&, p]() {
+      while (!go) sched_yield();
+      for (int i = 0; i < per_pusher; i++) {
+        queue_push(&q, item(p * per_pusher + i));
+      }
+    });
+  }
+  for (int c = 0; c < num_poppers; c++) {
+    threads.emplace_back([&]() {
+      int last[8];
+      for (int p = 0; p < num_pushers; p++) last[p] = -1;
+      while (!go) sched_yield();
+      while (true) {
+        void *r = queue_pop_timeout(&q, 100);
+        if (!r) {
+          if (popped >= total) break;
+          continue;
+        }
+        const int idx = item_idx(r);
+        seen[idx]++;
+        const int p = idx / per_pusher;
+        CHECK(idx % per_pusher > last[p]);
+        last[p] = idx % per_pusher;
+        popped++;
+      }
+    });
+  }
+
+  allocs = 0;
+  counting = true;
+  go = true;
+  for (auto &t : threads) t.join();
+  counting = false;
+
+  CHECK(popped == total);
+  for (int i = 0; i < total; i++) {
+    CHECK(seen[i] == 1);
+  }
+  CHECK(allocs == 0);
+
+  printf("%s %d pushers %d poppers: %d items, %d allocations\n",
+         type == QUEUE_SPSC ? "spsc" : "mpmc", num_pushers, num_poppers, total, allocs.load());
+  queue_destroy(&q);
+}
+
+int main() {
+  test_basic(QUEUE_MPMC);
+  test_basic(QUEUE_SPSC);
+
+  test_threads(QUEUE_SPSC, 1, 1, 200000);
+  test_threads(QUEUE_MPMC, 1, 1, 200000);
+  test_threads(QUEUE_MPMC, 4, 1, 50000);
+  test_threads(QUEUE_MPMC, 4, 4, 50000);
+
+  printf("OK\n");
+  return 0;
+}
@@ -0,0 +1,150 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cassert>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/file.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+
+#include "common/params.h"
+#include "common/timing.h"
+#include "common/util.h"
+
+// Reads per second of the params store, against a read the way it was done
+// with one file per key (flock, open, read, close), and how long a write
+// takes to be seen by a reader in another process waiting for changes.
+//
+// usage: params_bench [params dir]
+
+#define READS 200000
+#define WRITES 200
+
+// the one file per key read
+static int legacy_read(const char* params_path, const char* key, char** value, size_t* value_sz) {
+  char path[1024];
+  snprintf(path, sizeof(path), "%s/.lock", params_path);
+  int lock_fd = open(path, 0);
+  if (lock_fd < 0) return -1;
+  flock(lock_fd, LOCK_EX);
+  snprintf(path, sizeof(path), "%s/d/%s", params_path, key);
+  *value = (char*)read_file(path, value_sz);
+  close(lock_fd);
+  if (*value == NULL) return -22;
+  *value_sz -= 1;
+  return 0;
+}
+
+static void bench_reads(const char* path, const char* name,
+                        int (*read)(const char*, const char*, char**, size_t*)) {
+  const double t1 = millis_since_boot();
+  for (int i = 0; i < READS; i++) {
+    char* value = NULL;
+    size_t value_sz = 0;
+    int err = read(path, "CarParams", &value, &value_sz);
+    assert(err == 0);
+    free(value);
+  }
+  const double t2 = millis_since_boot();
+  printf("%-8s %10.0f reads/s  %6.2f us/read\n", name, READS / (t2 - t1) * 1000, (t2 - t1) * 1000 / READS);
+}
+
+static void bench_latency(const char* path) {
+  int pipefd[2];
+  int err = pipe(pipefd);
+  assert(err == 0);
+
+  fflush(stdout);
+  pid_t reader = fork();
+  assert(reader >= 0);
+  if (reader == 0) {
+    close(pipefd[0]);
+    uint32_t version = 0;
+    err = params_version(path, &version);
+    assert(err == 0);
+    for (int i = 0; i < WRITES; i++) {
+      if (i == 0) {
+        // ready
+        err = write(pipefd[1], &i, sizeof(i));
+        assert(err == sizeof(i));
+      }
+      int changed = params_wait_change(path, &version, 1000);
+      assert(changed == 1);
+      const uint64_t now = nanos_since_boot();
+
+      char* value = NULL;
+      size_t value_sz = 0;
+      err = read_db_value(path, "LiveParameters", &value, &value_sz);
+      assert(err == 0);
+      uint64_t sent = strtoull(value, NULL, 10);
+      free(value);
+      double latency_us = (now - sent) / 1000.0;
+      err = write(pipefd[1], &latency_us, sizeof(latency_us));
+      assert(err == sizeof(latency_us));
+    }
+    exit(0);
+  }
+
+  close(pipefd[1]);
+  int ready;
+  err = read(pipefd[0], &ready, sizeof(ready));
+  assert(err == sizeof(ready));
+
+  std::vector<double> latencies;
+  double write_us = 0;
+  for (int i = 0; i < WRITES; i++) {
+    usleep(5000);
+    char buf[32];
+    const uint64_t t1 = nanos_since_boot();
+    const int len = snprintf(buf, sizeof(buf), "%llu", (unsigned long long)t1);
+    err = write_db_value(path, "LiveParameters", buf, len);
+    assert(err == 0);
+    write_us += (nanos_since_boot() - t1) / 1000.0;
+
+    double latency_us;
+    err = read(pipefd[0], &latency_us, sizeof(latency_us));
+    assert(err == sizeof(latency_us));
+    latencies.push_back(latency_us);
+  }
+  waitpid(reader, NULL, 0);
+  close(pipefd[0]);
+
+  std::sort(latencies.begin(), latencies.end());
+  printf("write %.0f us avg, write to visible in another process: p50 %.0f us  p99 %.0f us  max %.0f us\n",
+         write_us / WRITES, latencies[WRITES / 2], latencies[WRITES * 99 / 100], latencies.back());
+}
+
+int main(int argc, char** argv) {
+  char tmp[] = "/tmp/params_bench_XXXXXX";
+  const char* path = argc > 1 ? argv[1] : mkdtemp(tmp);
+  assert(path);
+
+  // a store with the usual keys, CarParams is about this size
+  mkdir((std::string(path) + "/d").c_str(), 0777);
+  const char* keys[] = {"AccessToken", "CalibrationParams", "CompletedTrainingVersion", "DongleId",
+                        "GitBranch", "GitCommit", "GitRemote", "HasAcceptedTerms", "IsMetric",
+                        "IsUploadRawEnabled", "LiveParameters", "Passive", "RecordFront", "Version"};
+  for (const char* key : keys) {
+    int err = write_db_value(path, key, "0123456789abcdef", 16);
+    assert(err == 0);
+  }
+  std::string car_params(1500, 'x');
+  int err = write_db_value(path, "CarParams", car_params.data(), car_params.size());
+  assert(err == 0);
+
+  bench_reads(path, "per file", legacy_read);
+  bench_reads(path, "mmap", read_db_value);
+  bench_latency(path);
+
+  if (argc <= 1) {
+    char cmd[256];
+    snprintf(cmd, sizeof(cmd), "rm -rf %s", path);
+    system(cmd);
+  }
+  return 0;
+}
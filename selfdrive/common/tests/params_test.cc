@@ -0,0 +1,185 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cassert>
+#include <string>
+#include <map>
+
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+
+#include "common/params.h"
+#include "common/timing.h"
+
+// Checks the params store: migration from the one file per key layout,
+// reads and writes, readers in other processes never seeing a torn value
+// while a writer hammers the store, change waits and files put into d by
+// somebody else.
+
+#define READERS 3
+#define WRITES 2000
+#define VALUE_LEN 3000
+
+static void write_file(const std::string& path, const std::string& value) {
+  const std::string tmp = path + ".tmp";
+  FILE* f = fopen(tmp.c_str(), "wb");
+  assert(f);
+  fwrite(value.data(), 1, value.size(), f);
+  fclose(f);
+  int err = rename(tmp.c_str(), path.c_str());
+  assert(err == 0);
+}
+
+static std::string read_value(const char* path, const char* key) {
+  char* value = NULL;
+  size_t value_sz = 0;
+  int err = read_db_value(path, key, &value, &value_sz);
+  if (err != 0) return "<none>";
+  // the size doesn't count the NUL, as it didn't with the files
+  assert(value[value_sz] == '\0');
+  std::string ret(value, value_sz);
+  free(value);
+  return ret;
+}
+
+// a value that can be told apart when torn
+static std::string make_value(int i) {
+  std::string v(VALUE_LEN, 'a' + i % 26);
+  snprintf(&v[0], 16, "%08d", i);
+  v[8] = 'a' + i % 26;
+  return v;
+}
+
+static int check_value(const std::string& v) {
+  assert(v.size() == VALUE_LEN);
+  const int i = atoi(v.substr(0, 8).c_str());
+  for (size_t k = 8; k < v.size(); k++) {
+    assert(v[k] == 'a' + i % 26);
+  }
+  return i;
+}
+
+static void test_migrate(const char* path) {
+  mkdir((std::string(path) + "/d").c_str(), 0777);
+  write_file(std::string(path) + "/d/DongleId", "cb38263377b873ee");
+  write_file(std::string(path) + "/d/IsMetric", "1");
+
+  assert(read_value(path, "DongleId") == "cb38263377b873ee");
+  assert(read_value(path, "IsMetric") == "1");
+  assert(access((std::string(path) + "/params.db").c_str(), F_OK) == 0);
+  printf("migrate ok\n");
+}
+
+static void test_read_write(const char* path) {
+  int err = write_db_value(path, "CarParams", "\0\1\2", 3);
+  assert(err == 0);
+  assert(read_value(path, "CarParams") == std::string("\0\1\2", 3));
+
+  err = write_db_value(path, "GitBranch", "", 0);
+  assert(err == 0);
+  assert(read_value(path, "GitBranch") == "");
+
+  err = delete_db_value(path, "CarParams");
+  assert(err == 0);
+  assert(read_value(path, "CarParams") == "<none>");
+  assert(access((std::string(path) + "/d/CarParams").c_str(), F_OK) != 0);
+
+  std::map<std::string, std::string> all;
+  err = read_db_all(path, &all);
+  assert(err == 0);
+  assert(all.size() == 3 && all["DongleId"] == "cb38263377b873ee" && all["GitBranch"] == "");
+  printf("read write ok\n");
+}
+
+static void test_concurrent(const char* path) {
+  int err = write_db_value(path, "LiveParameters", make_value(0).data(), VALUE_LEN);
+  assert(err == 0);
+
+  fflush(stdout);
+  pid_t readers[READERS];
+  for (int r = 0; r < READERS; r++) {
+    readers[r] = fork();
+    assert(readers[r] >= 0);
+    if (readers[r] == 0) {
+      int last = 0, reads = 0;
+      while (last < WRITES - 1) {
+        const int i = check_value(read_value(path, "LiveParameters"));
+        assert(i >= last);
+        last = i;
+        reads++;
+      }
+      printf("reader %d: %d reads\n", r, reads);
+      exit(0);
+    }
+  }
+
+  for (int i = 1; i < WRITES; i++) {
+    const std::string v = make_value(i);
+    err = write_db_value(path, "LiveParameters", v.data(), v.size());
+    assert(err == 0);
+  }
+
+  for (int r = 0; r < READERS; r++) {
+    int status;
+    waitpid(readers[r], &status, 0);
+    assert(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+  }
+  printf("concurrent ok\n");
+}
+
+static void test_wait_change(const char* path) {
+  uint32_t version = 0;
+  int err = params_version(path, &version);
+  assert(err == 0);
+  assert(params_wait_change(path, &version, 20) == 0);
+
+  fflush(stdout);
+  pid_t writer = fork();
+  assert(writer >= 0);
+  if (writer == 0) {
+    usleep(50 * 1000);
+    err = write_db_value(path, "IsMetric", "0", 1);
+    assert(err == 0);
+    exit(0);
+  }
+
+  const double t1 = millis_since_boot();
+  assert(params_wait_change(path, &version, 5000) == 1);
+  const double t2 = millis_since_boot();
+  assert(read_value(path, "IsMetric") == "0");
+  waitpid(writer, NULL, 0);
+  printf("wait change ok, woke after %.1f ms\n", t2 - t1);
+}
+
+static void test_external(const char* path) {
+  uint32_t version = 0;
+  int err = params_version(path, &version);
+  assert(err == 0);
+
+  write_file(std::string(path) + "/d/IsMetric", "1");
+  assert(params_wait_change(path, &version, 5000) == 1);
+  assert(read_value(path, "IsMetric") == "1");
+
+  err = unlink((std::string(path) + "/d/IsMetric").c_str());
+  assert(err == 0);
+  assert(params_wait_change(path, &version, 5000) == 1);
+  assert(read_value(path, "IsMetric") == "<none>");
+  printf("external ok\n");
+}
+
+int main() {
+  char path[] = "/tmp/params_test_XXXXXX";
+  assert(mkdtemp(path));
+
+  test_migrate(path);
+  test_read_write(path);
+  test_concurrent(path);
+  test_wait_change(path);
+  test_external(path);
+
+  char cmd[256];
+  snprintf(cmd, sizeof(cmd), "rm -rf %s", path);
+  system(cmd);
+  return 0;
+}
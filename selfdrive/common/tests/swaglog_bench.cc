@@ -0,0 +1,79 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cassert>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+
+#include <unistd.h>
+#include <zmq.h>
+
+#include "common/swaglog.h"
+#include "common/timing.h"
+
+// Cost of a log call on the calling thread, from one thread and from 8
+// threads logging at once, with a receiver taking the messages like
+// logmessaged does. Calls come in bursts with pauses in between, as they do
+// from the daemons, so the background side keeps up.
+//
+// usage: swaglog_bench [bursts]
+
+#define BURST 100
+#define MAX_THREADS 8
+
+static std::vector<double> log_thread(int id, int bursts) {
+  std::vector<double> ns;
+  ns.reserve(bursts * BURST);
+  for (int b = 0; b < bursts; b++) {
+    for (int i = 0; i < BURST; i++) {
+      const uint64_t t1 = nanos_since_boot();
+      LOG("thread %d: can recv %d frames, %.2f ms, bus %s", id, i, 1.5, "pt");
+      ns.push_back(nanos_since_boot() - t1);
+    }
+    usleep(20 * 1000);
+  }
+  return ns;
+}
+
+static void run(int threads, int bursts) {
+  std::vector<std::vector<double>> results(threads);
+  std::vector<std::thread> workers;
+  for (int t = 0; t < threads; t++) {
+    workers.emplace_back([&, t] { results[t] = log_thread(t, bursts); });
+  }
+  for (auto& w : workers) w.join();
+
+  std::vector<double> all;
+  for (auto& r : results) all.insert(all.end(), r.begin(), r.end());
+  std::sort(all.begin(), all.end());
+  double sum = 0;
+  for (double v : all) sum += v;
+  printf("%d thread%s  mean %7.0f ns  p50 %7.0f ns  p99 %8.0f ns  max %9.0f ns per call\n",
+         threads, threads > 1 ? "s" : " ", sum / all.size(), all[all.size() / 2],
+         all[all.size() * 99 / 100], all.back());
+}
+
+int main(int argc, char** argv) {
+  const int bursts = argc > 1 ? atoi(argv[1]) : 50;
+  assert(bursts > 0);
+
+  void* ctx = zmq_ctx_new();
+  void* sock = zmq_socket(ctx, ZMQ_PULL);
+  int err = zmq_bind(sock, "ipc:///tmp/logmessage");
+  assert(err == 0);
+  std::atomic<bool> done(false);
+  std::thread receiver([&] {
+    int timeout = 100;
+    zmq_setsockopt(sock, ZMQ_RCVTIMEO, &timeout, sizeof(timeout));
+    char buf[4096];
+    while (!done) zmq_recv(sock, buf, sizeof(buf), 0);
+  });
+
+  run(1, bursts);
+  run(MAX_THREADS, bursts);
+
+  done = true;
+  receiver.join();
+  return 0;
+}
@@ -0,0 +1,237 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cassert>
+#include <string>
+#include <vector>
+#include <thread>
+#include <algorithm>
+
+#include <unistd.h>
+#include <signal.h>
+#include <sys/wait.h>
+
+#include <zmq.h>
+
+extern "C" {
+#include <json.h>
+}
+
+#include "common/swaglog.h"
+
+// Checks what comes out of swaglog on ipc:///tmp/logmessage: messages
+// formatted later on the drain thread match printf of the same arguments,
+// long ones arrive whole, every thread's messages arrive in order, errors
+// are out before an abort, forked children log too, and messages dropped or
+// rate limited are accounted for, and errors aren't dropped with them.
+
+#define THREADS 4
+#define THREAD_MSGS 200
+#define BURST 3000
+
+static void* sock;
+
+struct Msg {
+  int levelnum;
+  std::string msg;
+  std::string filename;
+  std::string funcname;
+};
+
+static bool recv_msg(Msg* m, int timeout_ms) {
+  zmq_setsockopt(sock, ZMQ_RCVTIMEO, &timeout_ms, sizeof(timeout_ms));
+  char level;
+  if (zmq_recv(sock, &level, 1, 0) != 1) return false;
+
+  std::vector<char> buf(16384);
+  int len = zmq_recv(sock, buf.data(), buf.size() - 1, 0);
+  assert(len > 0);
+  buf[len] = '\0';
+
+  JsonNode* log_j = json_decode(buf.data());
+  assert(log_j);
+  m->levelnum = json_find_member(log_j, "levelnum")->number_;
+  assert(m->levelnum == level);
+  m->msg = json_find_member(log_j, "msg")->string_;
+  m->filename = json_find_member(log_j, "filename")->string_;
+  m->funcname = json_find_member(log_j, "funcname")->string_;
+  assert(json_find_member(json_find_member(log_j, "ctx"), "version"));
+  json_delete(log_j);
+  return true;
+}
+
+static void check_next(const char* expected) {
+  cloudlog_flush();
+  Msg m;
+  bool ok = recv_msg(&m, 1000);
+  assert(ok);
+  if (m.msg != expected) {
+    printf("expected '%s' got '%s'\n", expected, m.msg.c_str());
+    assert(false);
+  }
+  assert(m.levelnum == CLOUDLOG_INFO && m.filename == __FILE__ && m.funcname == "test_format");
+}
+
+#define CHECK(fmt, ...) do {                                        \
+  char expected[4096];                                              \
+  snprintf(expected, sizeof(expected), fmt, ## __VA_ARGS__);        \
+  LOG(fmt, ## __VA_ARGS__);                                         \
+  check_next(expected);                                             \
+} while (0)
+
+static void test_format() {
+  CHECK("plain");
+  CHECK("%d %i %u %x %X %o", -5, 7, 4000000000u, 255, 255, 8);
+  CHECK("%5.2f|%-8s|%08.3e|%g|%+d", 3.14159, "ab", 12345.678, 1e-7, 3);
+  CHECK("%*d|%.*s|%-*.*f|", 6, 42, 3, "abcdef", 10, 2, 2.5);
+  CHECK("%lld %llu %ld %lu %zu %jd %td", -1LL << 40, 1ULL << 63, -7L, 7UL, (size_t)9, (intmax_t)-3, (ptrdiff_t)-2);
+  CHECK("%hhd %hd %hhu", 300, 70000, 300);
+  CHECK("%c%c%c", 'o', 'k', '!');
+  CHECK("%p %p", (void*)0x1234, (void*)NULL);
+  CHECK("100%% done, %d%%", 5);
+  CHECK("%Lf %.3Lg", 1.25L, 3.14159L);
+  CHECK("%s|%10s", (const char*)NULL, "null");
+
+  // not captured, formatted on the calling thread
+  CHECK("%ls %s", L"wide", "ok");
+
+  // longer than a record, formatted on the heap
+  std::string big(10000, 'x');
+  LOG("big %s end", big.c_str());
+  Msg m;
+  bool ok = recv_msg(&m, 1000);
+  assert(ok);
+  assert(m.msg == "big " + big + " end");
+  printf("format ok\n");
+}
+
+static void test_threads() {
+  std::vector<std::thread> threads;
+  for (int t = 0; t < THREADS; t++) {
+    threads.emplace_back([t] {
+      for (int i = 0; i < THREAD_MSGS; i++) {
+        LOG("thread %d msg %d", t, i);
+        if (i % 50 == 0) usleep(1000);
+      }
+    });
+  }
+  for (auto& t : threads) t.join();
+  cloudlog_flush();
+
+  int next[THREADS] = {0};
+  Msg m;
+  for (int n = 0; n < THREADS * THREAD_MSGS; n++) {
+    bool ok = recv_msg(&m, 1000);
+    assert(ok);
+    int t, i;
+    assert(sscanf(m.msg.c_str(), "thread %d msg %d", &t, &i) == 2);
+    assert(t >= 0 && t < THREADS && i == next[t]);
+    next[t]++;
+  }
+  printf("threads ok\n");
+}
+
+static void test_errors() {
+  // the process dies right after and nothing is flushed at exit. The error
+  // wakes the drainer, which the child's first log call started
+  fflush(stdout);
+  pid_t pid = fork();
+  assert(pid >= 0);
+  if (pid == 0) {
+    LOG("before the error");
+    LOGE("about to abort %d", 42);
+    // zmq writes out what was sent on its io thread
+    usleep(50 * 1000);
+    signal(SIGABRT, SIG_DFL);
+    abort();
+  }
+  int status;
+  waitpid(pid, &status, 0);
+  assert(WIFSIGNALED(status));
+
+  Msg m;
+  bool ok = recv_msg(&m, 1000);
+  assert(ok && m.msg == "before the error" && m.levelnum == CLOUDLOG_INFO);
+  ok = recv_msg(&m, 1000);
+  assert(ok && m.msg == "about to abort 42" && m.levelnum == CLOUDLOG_ERROR);
+  printf("errors ok\n");
+}
+
+static void test_fork() {
+  // queued in the parent, sent by the parent only
+  LOG("parent before fork");
+  fflush(stdout);
+  pid_t pid = fork();
+  assert(pid >= 0);
+  if (pid == 0) {
+    // the child's own drain thread sends this, _exit skips the atexit flush
+    LOG("child %d", 7);
+    usleep(200 * 1000);
+    _exit(0);
+  }
+  waitpid(pid, NULL, 0);
+  cloudlog_flush();
+
+  std::vector<std::string> msgs;
+  Msg m;
+  while (recv_msg(&m, 200)) {
+    msgs.push_back(m.msg);
+  }
+  assert(msgs.size() == 2);
+  assert(std::count(msgs.begin(), msgs.end(), "parent before fork") == 1);
+  assert(std::count(msgs.begin(), msgs.end(), "child 7") == 1);
+  printf("fork ok\n");
+}
+
+static void test_losses() {
+  // far more than the ring or the rate limit takes
+  for (int i = 0; i < BURST; i++) {
+    LOG("burst %d", i);
+  }
+  // the ring is full, errors still get through
+  LOGE("after the burst");
+
+  // losses are reported at most once a second
+  usleep(1100 * 1000);
+  cloudlog_flush();
+
+  int received = 0, dropped = 0, limited = 0;
+  bool error = false;
+  Msg m;
+  while (recv_msg(&m, 200)) {
+    if (m.msg == "after the burst") {
+      assert(m.levelnum == CLOUDLOG_ERROR && !error);
+      error = true;
+      continue;
+    }
+    unsigned long long d, l;
+    if (sscanf(m.msg.c_str(), "swaglog: %llu messages dropped, %llu rate limited", &d, &l) == 2) {
+      assert(m.levelnum == CLOUDLOG_WARNING);
+      dropped += d;
+      limited += l;
+    } else {
+      received++;
+    }
+  }
+  printf("burst of %d: %d sent, %d dropped, %d rate limited\n", BURST, received, dropped, limited);
+  assert(received + dropped + limited == BURST);
+  assert(dropped + limited > 0);
+  assert(error);
+  printf("losses ok\n");
+}
+
+int main() {
+  void* ctx = zmq_ctx_new();
+  sock = zmq_socket(ctx, ZMQ_PULL);
+  int err = zmq_bind(sock, "ipc:///tmp/logmessage");
+  assert(err == 0);
+
+  test_format();
+  test_threads();
+  test_errors();
+  test_fork();
+  test_losses();
+
+  zmq_close(sock);
+  return 0;
+}
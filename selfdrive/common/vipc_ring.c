@@ -0,0 +1,341 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <string.h>
+#include <unistd.h>
+#include <assert.h>
+#include <errno.h>
+#include <limits.h>
+#include <signal.h>
+#include <time.h>
+
+#include <sys/mman.h>
+
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif
+
+#include "vipc_ring.h"
+
+#define VIPC_RING_MAGIC 0x52504956 // "VIPR"
+
+typedef struct VIPCRingSlot {
+  // 0 while the slot doesn't hold a published frame
+  _Atomic uint64_t seq;
+  VIPCBufExtra extra;
+} VIPCRingSlot;
+
+typedef struct VIPCRingReader {
+  _Alignas(64) _Atomic int32_t pid;
+  // one bit per slot the reader has pinned
+  _Atomic uint64_t pinned;
+} VIPCRingReader;
+
+struct VIPCRing {
+  uint32_t magic;
+  int32_t num_slots;
+
+  _Atomic uint32_t stopped;
+  // readers inside a futex wait, so the publisher can skip the syscall
+  _Atomic uint32_t waiters;
+  // low bits of head, the futex word
+  _Atomic uint32_t wake_seq;
+  // bumped when a reader drops a pin, the publisher waits on it for a slot
+  _Atomic uint32_t release_seq;
+  _Atomic uint32_t release_waiters;
+
+  _Alignas(64) _Atomic uint64_t head;
+  // slot of every recent sequence number, indexed by seq % VIPC_RING_MAX_SLOTS
+  _Atomic int32_t order[VIPC_RING_MAX_SLOTS];
+  VIPCRingSlot slots[VIPC_RING_MAX_SLOTS];
+
+  VIPCRingReader readers[VIPC_RING_MAX_READERS];
+};
+
+static void ring_wait(_Atomic uint32_t *word, uint32_t val, int timeout_ms) {
+#ifdef __linux__
+  // not FUTEX_PRIVATE_FLAG, the ring is shared between processes
+  struct timespec ts = {
+    .tv_sec = timeout_ms / 1000,
+    .tv_nsec = (timeout_ms % 1000) * 1000000L,
+  };
+  syscall(SYS_futex, word, FUTEX_WAIT, val, timeout_ms >= 0 ? &ts : NULL, NULL, 0);
+#else
+  // no futex, poll
+  (void)word;
+  (void)val;
+  (void)timeout_ms;
+  usleep(1000);
+#endif
+}
+
+static void ring_wake(VIPCRing *r) {
+#ifdef __linux__
+  if (atomic_load(&r->waiters) > 0) {
+    syscall(SYS_futex, &r->wake_seq, FUTEX_WAKE, INT_MAX, NULL, NULL, 0);
+  }
+#else
+  (void)r;
+#endif
+}
+
+// after a reader cleared pin bits
+static void ring_unpinned(VIPCRing *r) {
+  atomic_fetch_add(&r->release_seq, 1);
+#ifdef __linux__
+  if (atomic_load(&r->release_waiters) > 0) {
+    syscall(SYS_futex, &r->release_seq, FUTEX_WAKE, INT_MAX, NULL, NULL, 0);
+  }
+#endif
+}
+
+static double ring_millis() {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec * 1000.0 + t.tv_nsec * 1e-6;
+}
+
+VIPCRing* vipc_ring_create(int num_slots, int *out_fd) {
+  assert(num_slots > 0 && num_slots <= VIPC_RING_MAX_SLOTS);
+
+  char path[] = "/tmp/vipc_ring_XXXXXX";
+  int fd = mkstemp(path);
+  if (fd < 0) {
+    printf("vipc_ring_create: %s\n", strerror(errno));
+    return NULL;
+  }
+  unlink(path);
+
+  int err = ftruncate(fd, sizeof(VIPCRing));
+  assert(err == 0);
+
+  VIPCRing *r = mmap(NULL, sizeof(VIPCRing), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  assert(r != MAP_FAILED);
+
+  // the file is zero filled
+  r->num_slots = num_slots;
+  for (int i = 0; i < VIPC_RING_MAX_SLOTS; i++) {
+    atomic_store(&r->order[i], 0);
+  }
+  atomic_store(&r->head, 0);
+  atomic_thread_fence(memory_order_seq_cst);
+  r->magic = VIPC_RING_MAGIC;
+
+  *out_fd = fd;
+  return r;
+}
+
+void vipc_ring_destroy(VIPCRing *r, int fd) {
+  munmap(r, sizeof(VIPCRing));
+  close(fd);
+}
+
+void vipc_ring_publish(VIPCRing *r, int idx, const VIPCBufExtra *extra) {
+  assert(idx >= 0 && idx < r->num_slots);
+  VIPCRingSlot *slot = &r->slots[idx];
+
+  // only the publisher writes slots, and only after retiring them
+  assert(atomic_load_explicit(&slot->seq, memory_order_relaxed) == 0);
+
+  const uint64_t seq = atomic_load_explicit(&r->head, memory_order_relaxed) + 1;
+  if (extra) {
+    slot->extra = *extra;
+  } else {
+    memset(&slot->extra, 0, sizeof(slot->extra));
+  }
+  atomic_store_explicit(&slot->seq, seq, memory_order_release);
+  atomic_store_explicit(&r->order[seq % VIPC_RING_MAX_SLOTS], idx, memory_order_release);
+
+  // pairs with the waiters increment in vipc_ring_acquire
+  atomic_store(&r->head, seq);
+  atomic_store(&r->wake_seq, (uint32_t)seq);
+  ring_wake(r);
+}
+
+bool vipc_ring_retire(VIPCRing *r, int idx) {
+  assert(idx >= 0 && idx < r->num_slots);
+
+  // a reader pins first and checks the sequence number after, so either it
+  // sees the slot invalidated or the pin shows up here
+  atomic_store(&r->slots[idx].seq, 0);
+
+  const uint64_t bit = 1ULL << idx;
+  for (int i = 0; i < VIPC_RING_MAX_READERS; i++) {
+    if (atomic_load(&r->readers[i].pinned) & bit) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void vipc_ring_reap(VIPCRing *r) {
+  for (int i = 0; i < VIPC_RING_MAX_READERS; i++) {
+    VIPCRingReader *rd = &r->readers[i];
+    const int32_t pid = atomic_load(&rd->pid);
+    if (pid != 0 && kill(pid, 0) != 0 && errno == ESRCH) {
+      atomic_store(&rd->pinned, 0);
+      atomic_store(&rd->pid, 0);
+      ring_unpinned(r);
+    }
+  }
+}
+
+uint32_t vipc_ring_release_seq(VIPCRing *r) {
+  return atomic_load(&r->release_seq);
+}
+
+void vipc_ring_wait_release(VIPCRing *r, uint32_t seq, int timeout_ms) {
+  // a pin dropped after seq was loaded has bumped it, the wait returns at once
+  atomic_fetch_add(&r->release_waiters, 1);
+  ring_wait(&r->release_seq, seq, timeout_ms);
+  atomic_fetch_sub(&r->release_waiters, 1);
+}
+
+void vipc_ring_stop(VIPCRing *r) {
+  atomic_store(&r->stopped, 1);
+  atomic_fetch_add(&r->wake_seq, 1);
+  ring_wake(r);
+}
+
+VIPCRing* vipc_ring_map(int fd) {
+  VIPCRing *r = mmap(NULL, sizeof(VIPCRing), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (r == MAP_FAILED) {
+    printf("vipc_ring_map: %s\n", strerror(errno));
+    return NULL;
+  }
+  if (r->magic != VIPC_RING_MAGIC) {
+    munmap(r, sizeof(VIPCRing));
+    return NULL;
+  }
+  return r;
+}
+
+void vipc_ring_unmap(VIPCRing *r) {
+  munmap(r, sizeof(VIPCRing));
+}
+
+int vipc_ring_attach(VIPCRing *r) {
+  const int32_t pid = getpid();
+  for (int i = 0; i < VIPC_RING_MAX_READERS; i++) {
+    VIPCRingReader *rd = &r->readers[i];
+    int32_t expected = 0;
+    if (atomic_compare_exchange_strong(&rd->pid, &expected, pid)) {
+      atomic_store(&rd->pinned, 0);
+      return i;
+    }
+  }
+  return -1;
+}
+
+void vipc_ring_detach(VIPCRing *r, int reader) {
+  assert(reader >= 0 && reader < VIPC_RING_MAX_READERS);
+  VIPCRingReader *rd = &r->readers[reader];
+  atomic_store(&rd->pinned, 0);
+  atomic_store(&rd->pid, 0);
+  ring_unpinned(r);
+}
+
+int vipc_ring_acquire(VIPCRing *r, int reader, bool latest, uint64_t *last_seq,
+                      int timeout_ms, VIPCBufExtra *out_extra, uint64_t *out_dropped) {
+  assert(reader >= 0 && reader < VIPC_RING_MAX_READERS);
+  VIPCRingReader *rd = &r->readers[reader];
+
+  const double deadline = timeout_ms >= 0 ? ring_millis() + timeout_ms : 0;
+  uint64_t dropped = 0;
+  int ret = VIPC_RING_TIMEOUT;
+
+  while (true) {
+    if (atomic_load(&r->stopped)) {
+      ret = VIPC_RING_STOPPED;
+      break;
+    }
+
+    const uint32_t wake_seq = atomic_load(&r->wake_seq);
+    const uint64_t head = atomic_load(&r->head);
+
+    if (head > *last_seq) {
+      uint64_t want = latest ? head : *last_seq + 1;
+      // anything older has been overwritten in the order table
+      if (head - want >= VIPC_RING_MAX_SLOTS) {
+        want = head - VIPC_RING_MAX_SLOTS + 1;
+      }
+
+      int idx = -1;
+      for (; want <= head; want++) {
+        const int i = atomic_load_explicit(&r->order[want % VIPC_RING_MAX_SLOTS], memory_order_acquire);
+        const uint64_t bit = 1ULL << i;
+        // a slot this reader still has pinned holds an older frame
+        if (atomic_load_explicit(&rd->pinned, memory_order_relaxed) & bit) continue;
+
+        atomic_fetch_or(&rd->pinned, bit);
+        if (atomic_load(&r->slots[i].seq) == want) {
+          idx = i;
+          break;
+        }
+        // retired, or reused for a newer frame
+        atomic_fetch_and(&rd->pinned, ~bit);
+        ring_unpinned(r);
+      }
+
+      if (idx >= 0) {
+        if (!latest) dropped += want - *last_seq - 1;
+        *last_seq = want;
+        if (out_extra) *out_extra = r->slots[idx].extra;
+        ret = idx;
+        break;
+      }
+
+      // the publisher moved on while we were looking, skip what it retired
+      if (!latest) dropped += head - *last_seq;
+      *last_seq = head;
+      continue;
+    }
+
+    int wait_ms = -1;
+    if (timeout_ms >= 0) {
+      wait_ms = (int)(deadline - ring_millis());
+      if (wait_ms <= 0) break;
+    }
+
+    // pairs with the head store in vipc_ring_publish
+    atomic_fetch_add(&r->waiters, 1);
+    if (atomic_load(&r->head) == head && !atomic_load(&r->stopped)) {
+      ring_wait(&r->wake_seq, wake_seq, wait_ms);
+    }
+    atomic_fetch_sub(&r->waiters, 1);
+  }
+
+  if (out_dropped) *out_dropped = dropped;
+  return ret;
+}
+
+bool vipc_ring_pin(VIPCRing *r, int reader, int idx, uint32_t frame_id) {
+  assert(reader >= 0 && reader < VIPC_RING_MAX_READERS);
+  if (idx < 0 || idx >= r->num_slots) return false;
+
+  VIPCRingReader *rd = &r->readers[reader];
+  VIPCRingSlot *slot = &r->slots[idx];
+  const uint64_t bit = 1ULL << idx;
+
+  // already pinned, the slot can't have changed
+  if (atomic_load_explicit(&rd->pinned, memory_order_relaxed) & bit) {
+    return slot->extra.frame_id == frame_id;
+  }
+
+  atomic_fetch_or(&rd->pinned, bit);
+  if (atomic_load(&slot->seq) != 0 && slot->extra.frame_id == frame_id) {
+    return true;
+  }
+  atomic_fetch_and(&rd->pinned, ~bit);
+  ring_unpinned(r);
+  return false;
+}
+
+void vipc_ring_release(VIPCRing *r, int reader, int idx) {
+  assert(reader >= 0 && reader < VIPC_RING_MAX_READERS);
+  assert(idx >= 0 && idx < r->num_slots);
+  atomic_fetch_and(&r->readers[reader].pinned, ~(1ULL << idx));
+  ring_unpinned(r);
+}
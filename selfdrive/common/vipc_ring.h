@@ -0,0 +1,80 @@
+#ifndef VIPC_RING_H
+#define VIPC_RING_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "visionipc.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Shared memory control block for one vision stream. After the buffer fds
+// have been handed over at subscribe time, frames go from the publisher to
+// any number of readers without a message on the socket: the publisher
+// writes the buffer index and a sequence number into a slot (one per
+// buffer), readers pin a slot with an atomic bit of their own and wait on a
+// futex for the next sequence number.
+//
+// The publisher owns the buffer lifecycle. A published buffer stays valid
+// until the publisher retires it, which only succeeds once no reader has it
+// pinned; until then the publisher keeps its hold on the buffer.
+//
+// Readers either follow the latest frame (like a TBuffer) or read every
+// frame in order (like a PoolQueue). A queue reader that falls behind what
+// the publisher retains skips the oldest frames.
+
+#define VIPC_RING_MAX_SLOTS 64
+#define VIPC_RING_MAX_READERS 16
+
+#define VIPC_RING_TIMEOUT -1
+#define VIPC_RING_STOPPED -2
+
+typedef struct VIPCRing VIPCRing;
+
+// publisher
+
+// returns NULL on failure, the fd goes to the readers
+VIPCRing* vipc_ring_create(int num_slots, int *out_fd);
+void vipc_ring_destroy(VIPCRing *r, int fd);
+
+void vipc_ring_publish(VIPCRing *r, int idx, const VIPCBufExtra *extra);
+// invalidates the frame in slot idx, true if the buffer can be reused. On
+// false the slot is still pinned by a reader and has to be retired again later.
+bool vipc_ring_retire(VIPCRing *r, int idx);
+// drops the pins of readers whose process is gone
+void vipc_ring_reap(VIPCRing *r);
+// bumped every time a reader drops a pin. Load it before a vipc_ring_retire
+// that fails, then vipc_ring_wait_release sleeps until a pin is dropped
+// after, or timeout_ms (-1 forever) passes.
+uint32_t vipc_ring_release_seq(VIPCRing *r);
+void vipc_ring_wait_release(VIPCRing *r, uint32_t seq, int timeout_ms);
+// wakes every reader with VIPC_RING_STOPPED
+void vipc_ring_stop(VIPCRing *r);
+
+// reader
+
+VIPCRing* vipc_ring_map(int fd);
+void vipc_ring_unmap(VIPCRing *r);
+
+// returns the reader id or -1 if there's no room
+int vipc_ring_attach(VIPCRing *r);
+void vipc_ring_detach(VIPCRing *r, int reader);
+
+// waits up to timeout_ms (-1 forever) for a frame after *last_seq and pins
+// it. Returns the buffer index, VIPC_RING_TIMEOUT or VIPC_RING_STOPPED.
+// *last_seq is updated, out_dropped (optional) gets the frames skipped.
+int vipc_ring_acquire(VIPCRing *r, int reader, bool latest, uint64_t *last_seq,
+                      int timeout_ms, VIPCBufExtra *out_extra, uint64_t *out_dropped);
+void vipc_ring_release(VIPCRing *r, int reader, int idx);
+
+// pins slot idx if it still holds frame_id, for frames referenced by buffer
+// index from elsewhere. Released with vipc_ring_release.
+bool vipc_ring_pin(VIPCRing *r, int reader, int idx, uint32_t frame_id);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
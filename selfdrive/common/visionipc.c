@@ -6,14 +6,19 @@
 #include <assert.h>
 #include <errno.h>
 
+#include <poll.h>
 #include <sys/mman.h>
 #include <sys/socket.h>
 #include <sys/un.h>
 
 #include "ipc.h"
+#include "vipc_ring.h"
 
 #include "visionipc.h"
 
+// how often a reader waiting on the ring checks that visiond is still there
+#define RING_POLL_MS 1000
+
 typedef struct VisionPacketWire {
   int type;
   VisionPacketData d;
@@ -73,6 +78,8 @@ int visionstream_init(VisionStream *s, VisionStreamType type, bool tbuffer, Visi
   memset(s, 0, sizeof(*s));
 
   s->last_idx = -1;
+  s->ring_fd = -1;
+  s->ring_reader = -1;
 
   s->ipc_fd = vipc_connect();
   if (s->ipc_fd < 0) return -1;
@@ -82,6 +89,9 @@ int visionstream_init(VisionStream *s, VisionStreamType type, bool tbuffer, Visi
     .d = { .stream_sub = {
       .type = type,
       .tbuffer = tbuffer,
+#ifdef __linux__
+      .ring = getenv("VISIONIPC_NO_RING") == NULL,
+#endif
     }, },
   };
   err = vipc_send(s->ipc_fd, &p);
@@ -102,6 +112,24 @@ int visionstream_init(VisionStream *s, VisionStreamType type, bool tbuffer, Visi
   s->bufs_info = rp.d.stream_bufs;
 
   s->num_bufs = rp.num_fds;
+  if (rp.d.stream_bufs.ring) {
+    assert(s->num_bufs > 1);
+    s->num_bufs--;
+    s->ring_fd = rp.fds[s->num_bufs];
+    s->ring = vipc_ring_map(s->ring_fd);
+    if (s->ring) {
+      s->ring_reader = vipc_ring_attach(s->ring);
+    }
+    if (s->ring_reader < 0) {
+      printf("visionstream_init: can't read the ring\n");
+      for (int i=0; i<rp.num_fds; i++) close(rp.fds[i]);
+      if (s->ring) vipc_ring_unmap(s->ring);
+      close(s->ipc_fd);
+      return -1;
+    }
+    s->ring_latest = tbuffer;
+  }
+
   s->bufs = calloc(s->num_bufs, sizeof(VIPCBuf));
   assert(s->bufs);
 
@@ -116,6 +144,13 @@ int visionstream_init(VisionStream *s, VisionStreamType type, bool tbuffer, Visi
 
 void visionstream_release(VisionStream *s) {
   int err;
+  if (s->ring) {
+    if (s->last_idx >= 0) {
+      vipc_ring_release(s->ring, s->ring_reader, s->last_idx);
+      s->last_idx = -1;
+    }
+    return;
+  }
   if (s->last_idx >= 0) {
     VisionPacket rep = {
       .type = VIPC_STREAM_RELEASE,
@@ -129,9 +164,40 @@ void visionstream_release(VisionStream *s) {
   }
 }
 
+static VIPCBuf* visionstream_get_ring(VisionStream *s, VIPCBufExtra *out_extra) {
+  while (true) {
+    uint64_t dropped = 0;
+    int idx = vipc_ring_acquire(s->ring, s->ring_reader, s->ring_latest, &s->ring_seq,
+                                RING_POLL_MS, out_extra, &dropped);
+    s->dropped += dropped;
+    if (idx == VIPC_RING_STOPPED) {
+      return NULL;
+    } else if (idx == VIPC_RING_TIMEOUT) {
+      // nothing is sent on the socket of a ring subscription, readable means visiond is gone
+      struct pollfd pfd = { .fd = s->ipc_fd, .events = POLLIN };
+      if (poll(&pfd, 1, 0) != 0) {
+        return NULL;
+      }
+      continue;
+    }
+
+    // the previous frame is held until there's a new one, like the socket protocol
+    if (s->last_idx >= 0) {
+      vipc_ring_release(s->ring, s->ring_reader, s->last_idx);
+    }
+    s->last_idx = idx;
+    assert(s->last_idx < s->num_bufs);
+    return &s->bufs[s->last_idx];
+  }
+}
+
 VIPCBuf* visionstream_get(VisionStream *s, VIPCBufExtra *out_extra) {
   int err;
 
+  if (s->ring) {
+    return visionstream_get_ring(s, out_extra);
+  }
+
   VisionPacket rp;
   err = vipc_recv(s->ipc_fd, &rp);
   if (err <= 0) {
@@ -164,9 +230,34 @@ VIPCBuf* visionstream_get(VisionStream *s, VIPCBufExtra *out_extra) {
   return &s->bufs[s->last_idx];
 }
 
+VIPCBuf* visionstream_get_ref(VisionStream *s, int idx, uint32_t frame_id) {
+  if (!s->ring || idx < 0 || idx >= s->num_bufs) {
+    return NULL;
+  }
+  if (idx == s->last_idx) {
+    return vipc_ring_pin(s->ring, s->ring_reader, idx, frame_id) ? &s->bufs[idx] : NULL;
+  }
+  if (!vipc_ring_pin(s->ring, s->ring_reader, idx, frame_id)) {
+    return NULL;
+  }
+  if (s->last_idx >= 0) {
+    vipc_ring_release(s->ring, s->ring_reader, s->last_idx);
+  }
+  s->last_idx = idx;
+  return &s->bufs[idx];
+}
+
 void visionstream_destroy(VisionStream *s) {
   int err;
 
+  if (s->ring) {
+    vipc_ring_detach(s->ring, s->ring_reader);
+    vipc_ring_unmap(s->ring);
+    close(s->ring_fd);
+    s->ring = NULL;
+    s->last_idx = -1;
+  }
+
   if (s->last_idx >= 0) {
     VisionPacket rep = {
       .type = VIPC_STREAM_RELEASE,
@@ -8,6 +8,10 @@
 #define VIPC_SOCKET_PATH "/tmp/vision_socket"
 #define VIPC_MAX_FDS 64
 
+// frames of a yuv stream visiond keeps readable on its ring behind the
+// newest, how old a FrameData.imageRef can be and still resolve
+#define VIPC_RING_RETAIN 10
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -46,6 +50,9 @@ typedef struct VisionStreamBufs {
   union {
     VisionUIInfo ui_info;
   } buf_info;
+
+  // the last fd is the shared memory control ring (see vipc_ring.h)
+  bool ring;
 } VisionStreamBufs;
 
 typedef struct VIPCBufExtra {
@@ -58,6 +65,8 @@ typedef union VisionPacketData {
   struct {
     VisionStreamType type;
     bool tbuffer;
+    // frames through a vipc_ring instead of acquire/release packets
+    bool ring;
   } stream_sub;
   VisionStreamBufs stream_bufs;
   struct {
@@ -99,11 +108,23 @@ typedef struct VisionStream {
   int num_bufs;
   VisionStreamBufs bufs_info;
   VIPCBuf *bufs;
+
+  // ring subscriptions
+  struct VIPCRing *ring;
+  int ring_fd;
+  int ring_reader;
+  bool ring_latest;
+  uint64_t ring_seq;
+  uint64_t dropped;
 } VisionStream;
 
 int visionstream_init(VisionStream *s, VisionStreamType type, bool tbuffer, VisionStreamBufs *out_bufs_info);
 void visionstream_release(VisionStream *s);
 VIPCBuf* visionstream_get(VisionStream *s, VIPCBufExtra *out_extra);
+// the buffer of a frame referenced by index (FrameData.imageRef), held like
+// the result of visionstream_get. NULL if the frame is gone or the stream
+// isn't on a ring.
+VIPCBuf* visionstream_get_ref(VisionStream *s, int idx, uint32_t frame_id);
 void visionstream_destroy(VisionStream *s);
 
 #ifdef __cplusplus
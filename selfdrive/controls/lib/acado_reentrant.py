@@ -0,0 +1,127 @@
+#!/usr/bin/env python
+"""Rewrites the code ACADO exports into lib_mpc_export so that solver state
+lives in an ACADOcontext passed to every function that touches it, instead of
+the globals acadoVariables and acadoWorkspace. Many solvers can then run in
+one process, on any thread. Run by make generate after the generator.
+
+usage: acado_reentrant.py lib_mpc_export
+"""
+import os
+import re
+import sys
+
+GLOBALS = ['acadoVariables', 'acadoWorkspace', 'acado_nWSR']
+CTX_PARAM = 'ACADOcontext* const ctx'
+
+DEF_RE = re.compile(r'^(?:EXTERNC\s+)?(?:const\s+)?(?:int|void|real_t|char)\s*\*?\s*(acado_\w+)\(([^)]*)\)\s*;?\s*$')
+CALL_RE = re.compile(r'\b(acado_\w+)\((\s*)(\))?')
+GLOBAL_RE = re.compile(r'\b(%s)\b' % '|'.join(GLOBALS))
+
+CONTEXT = """
+/** Solver state, one per solver instance. */
+struct ACADOcontext
+{
+ACADOvariables acadoVariables;
+ACADOworkspace acadoWorkspace;
+int acado_nWSR;
+};
+"""
+
+
+def function_bodies(lines):
+  """Yields name, first and last line of every function defined."""
+  i = 0
+  while i < len(lines):
+    m = DEF_RE.match(lines[i])
+    if m and not lines[i].rstrip().endswith(';') and i + 1 < len(lines) and lines[i + 1].startswith('{'):
+      # generated code isn't indented, count braces to find the end
+      depth = 0
+      j = i + 1
+      while True:
+        code = re.sub(r'"(?:[^"\\]|\\.)*"', '', lines[j])
+        depth += code.count('{') - code.count('}')
+        if depth == 0:
+          break
+        j += 1
+      yield m.group(1), i, j
+      i = j
+    i += 1
+
+
+def add_ctx(params):
+  """Puts the context first in a parameter list."""
+  if params.strip() in ('', 'void'):
+    return ' %s ' % CTX_PARAM
+  rest = params.lstrip()
+  return params[:len(params) - len(rest)] + CTX_PARAM + ', ' + rest
+
+
+def add_ctx_arg(m, stateful):
+  """Passes the context first in a call."""
+  name, space, close = m.groups()
+  if name not in stateful:
+    return m.group(0)
+  if close:
+    return '%s( ctx )' % name
+  return '%s(%sctx, ' % (name, space)
+
+
+def main(export_dir):
+  files = {}
+  for fn in sorted(os.listdir(export_dir)):
+    if fn.endswith(('.c', '.h', '.cpp', '.hpp')):
+      with open(os.path.join(export_dir, fn)) as f:
+        files[fn] = f.read().split('\n')
+
+  if any('ACADOcontext' in l for lines in files.values() for l in lines):
+    print("%s is reentrant already" % export_dir)
+    return
+
+  # functions that touch the globals, or call one that does
+  uses, calls = {}, {}
+  for lines in files.values():
+    for name, start, end in function_bodies(lines):
+      body = lines[start + 1:end + 1]
+      uses[name] = any(GLOBAL_RE.search(l) for l in body)
+      calls[name] = set(c[0] for l in body for c in CALL_RE.findall(l))
+  stateful = set(n for n in uses if uses[n])
+  changed = True
+  while changed:
+    changed = False
+    for name in calls:
+      if name not in stateful and calls[name] & stateful:
+        stateful.add(name)
+        changed = True
+
+  for fn, lines in files.items():
+    out = []
+    for l in lines:
+      # the globals go, the context has them
+      if re.match(r'^(?:extern |static )?(?:ACADOvariables|ACADOworkspace|int) (?:acadoVariables|acadoWorkspace|acado_nWSR);', l):
+        if l.startswith('extern ACADOvariables'):
+          out.extend(CONTEXT.split('\n'))
+        continue
+      if re.match(r'^ACADO(?:variables|workspace) acado(?:Variables|Workspace);', l):
+        continue
+
+      m = DEF_RE.match(l)
+      if m and m.group(1) in stateful:
+        start, end = m.span(2)
+        l = l[:start] + add_ctx(m.group(2)) + l[end:]
+      else:
+        l = CALL_RE.sub(lambda m: add_ctx_arg(m, stateful), l)
+      l = GLOBAL_RE.sub(r'ctx->\1', l)
+      out.append(l)
+
+    # the context type is needed by the prototypes of the qp solver interface,
+    # which come before it
+    if fn == 'acado_qpoases_interface.hpp':
+      i = out.index('#define QPOASES_HEADER')
+      out[i + 1:i + 1] = ['', 'typedef struct ACADOcontext ACADOcontext;']
+
+    with open(os.path.join(export_dir, fn), 'w') as f:
+      f.write('\n'.join(out))
+
+
+if __name__ == "__main__":
+  main(sys.argv[1])
@@ -0,0 +1,496 @@
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include <algorithm>
+
+extern "C" {
+#include "fastcluster.h"
+#include "radar_cluster.h"
+}
+
+namespace {
+
+const double INF = std::numeric_limits<double>::infinity();
+
+// open addressing hash of ints, for track and cluster ids. Slots are used
+// if they carry the generation of the last reset, so emptying the table
+// doesn't touch it.
+class IdTable {
+public:
+  IdTable() : generation(0) {}
+
+  void reset(int n) {
+    size_t size = 16;
+    while (size < 2 * (size_t)n) {
+      size *= 2;
+    }
+    if (size > keys.size()) {
+      keys.resize(size);
+      values.resize(size);
+      stamp.assign(size, 0);
+      generation = 0;
+    }
+    if (++generation == 0) {
+      std::fill(stamp.begin(), stamp.end(), 0);
+      generation = 1;
+    }
+  }
+
+  const int* find(int key) const {
+    for (size_t slot = hash(key); stamp[slot] == generation; slot = (slot + 1) & (keys.size() - 1)) {
+      if (keys[slot] == key) {
+        return &values[slot];
+      }
+    }
+    return NULL;
+  }
+
+  // the value of key, set to value if key is new
+  int& insert(int key, int value) {
+    size_t slot = hash(key);
+    for (; stamp[slot] == generation; slot = (slot + 1) & (keys.size() - 1)) {
+      if (keys[slot] == key) {
+        return values[slot];
+      }
+    }
+    stamp[slot] = generation;
+    keys[slot] = key;
+    values[slot] = value;
+    return values[slot];
+  }
+
+private:
+  size_t hash(int key) const {
+    return ((uint32_t)key * 2654435761u >> 16) & (keys.size() - 1);
+  }
+
+  std::vector<int> keys, values;
+  std::vector<uint32_t> stamp;
+  uint32_t generation;
+};
+
+class RadarCluster {
+public:
+  RadarCluster(const RadarClusterConfig &config) : config(config), next_id(0) {
+    assert(config.threshold > 0.);
+    last_ids.reset(0);
+  }
+
+  int update(int n, const int *track_ids, const double *pts, int *labels, int *cluster_ids) {
+    int n_clusters = 0;
+    if (n <= config.dense_max) {
+      n_clusters = cluster_dense(n, pts, labels);
+    } else {
+      cluster(n, pts);
+
+      // number the clusters by their first track, roots are the first track
+      for (int i = 0; i < n; i++) {
+        const int r = find(i);
+        if (r == i) {
+          root_label[i] = n_clusters++;
+        }
+        labels[i] = root_label[r];
+      }
+    }
+
+    assign_ids(n, track_ids, labels, n_clusters, cluster_ids);
+    return n_clusters;
+  }
+
+private:
+  // What cluster_points_centroid does, into buffers that are kept. Below a
+  // few dozen tracks the n^2 distances are cheaper than the grid and heap,
+  // whose branches depend on where the tracks are.
+  int cluster_dense(int n, const double *pts, int *labels) {
+    if (n < 2) {
+      std::fill(labels, labels + n, 0);
+      return n;
+    }
+    centroid.resize(n * RADAR_CLUSTER_DIMS);
+    for (int i = 0; i < n; i++) {
+      for (int k = 0; k < RADAR_CLUSTER_DIMS; k++) {
+        centroid[i * RADAR_CLUSTER_DIMS + k] = pts[i * RADAR_CLUSTER_DIMS + k] * config.weights[k];
+      }
+    }
+    pdist.resize(n * (n - 1) / 2);
+    merge.resize(2 * (n - 1));
+    height.resize(n - 1);
+    hclust_pdist(n, RADAR_CLUSTER_DIMS, centroid.data(), pdist.data());
+    hclust_fast(n, pdist.data(), HCLUST_METHOD_CENTROID, merge.data(), height.data());
+    cutree_cdist(n, merge.data(), height.data(), config.threshold * config.threshold, labels);
+    return *std::max_element(labels, labels + n) + 1;
+  }
+
+  // Centroid linkage, the closest pair of clusters is merged until the
+  // closest pair is at the threshold, as the generic algorithm of fastcluster.
+  void cluster(int n, const double *pts) {
+    reset(n);
+    const double threshold2 = config.threshold * config.threshold;
+
+    for (int i = 0; i < n; i++) {
+      for (int k = 0; k < RADAR_CLUSTER_DIMS; k++) {
+        centroid[i * RADAR_CLUSTER_DIMS + k] = pts[i * RADAR_CLUSTER_DIMS + k] * config.weights[k];
+      }
+    }
+    grid_reset(n);
+    for (int i = 0; i < n; i++) {
+      grid_add(i);
+    }
+    for (int i = 0; i < n; i++) {
+      for_neighbours(i, [&](int j, double d) {
+        if (i < j) {
+          nearer(i, j, d);
+          nearer(j, i, d);
+        }
+      });
+    }
+
+    heap.resize(n);
+    for (int i = 0; i < n; i++) {
+      heap[i] = i;
+      heap_pos[i] = i;
+    }
+    for (int k = n / 2 - 1; k >= 0; k--) {
+      sift_down(k);
+    }
+    while (!heap.empty() && nn_dist[heap[0]] < threshold2) {
+      const int best = heap[0];
+      const int a = std::min(best, nn[best]), b = std::max(best, nn[best]);
+
+      // what had a or b as its closest is in the cells around them
+      stale.clear();
+      for_cells(std::min(cell_x[a], cell_x[b]) - 1, std::max(cell_x[a], cell_x[b]) + 1,
+                std::min(cell_y[a], cell_y[b]) - 1, std::max(cell_y[a], cell_y[b]) + 1, [&](int i) {
+        if (i != a && i != b && (nn[i] == a || nn[i] == b)) {
+          stale.push_back(i);
+        }
+      });
+
+      heap_remove(b);
+      grid_remove(a);
+      grid_remove(b);
+      const double sa = size[a], sb = size[b];
+      for (int k = 0; k < RADAR_CLUSTER_DIMS; k++) {
+        double &ca = centroid[a * RADAR_CLUSTER_DIMS + k];
+        ca = (sa * ca + sb * centroid[b * RADAR_CLUSTER_DIMS + k]) / (sa + sb);
+      }
+      size[a] += size[b];
+      parent[b] = a;
+      nn_dist[b] = INF;
+      grid_add(a);
+
+      // the merged centroid moved, so anything may have it as its closest
+      for (int i : stale) {
+        nearest(i);
+        heap_update(i);
+      }
+      nn[a] = -1;
+      nn_dist[a] = INF;
+      for_neighbours(a, [&](int i, double d) {
+        nearer(a, i, d);
+        if (nearer(i, a, d)) {
+          heap_update(i);
+        }
+      });
+      heap_update(a);
+    }
+  }
+
+  // The clusters left are in a binary heap on nn_dist, ties to the lowest
+  // index as the scan of fastcluster, and heap_pos has where each one is.
+  bool heap_less(int i, int j) const {
+    return nn_dist[i] < nn_dist[j] || (nn_dist[i] == nn_dist[j] && i < j);
+  }
+
+  void heap_set(int k, int i) {
+    heap[k] = i;
+    heap_pos[i] = k;
+  }
+
+  void sift_up(int k) {
+    const int i = heap[k];
+    while (k > 0 && heap_less(i, heap[(k - 1) / 2])) {
+      heap_set(k, heap[(k - 1) / 2]);
+      k = (k - 1) / 2;
+    }
+    heap_set(k, i);
+  }
+
+  void sift_down(int k) {
+    const int i = heap[k], n = heap.size();
+    while (2 * k + 1 < n) {
+      int c = 2 * k + 1;
+      if (c + 1 < n && heap_less(heap[c + 1], heap[c])) {
+        c++;
+      }
+      if (!heap_less(heap[c], i)) {
+        break;
+      }
+      heap_set(k, heap[c]);
+      k = c;
+    }
+    heap_set(k, i);
+  }
+
+  void heap_update(int i) {
+    sift_up(heap_pos[i]);
+    sift_down(heap_pos[i]);
+  }
+
+  void heap_remove(int i) {
+    const int k = heap_pos[i], last = heap.back();
+    heap.pop_back();
+    if (last != i) {
+      heap_set(k, last);
+      heap_update(last);
+    }
+  }
+
+  void reset(int n) {
+    centroid.resize(n * RADAR_CLUSTER_DIMS);
+    size.assign(n, 1);
+    parent.resize(n);
+    for (int i = 0; i < n; i++) {
+      parent[i] = i;
+    }
+    cell.resize(n);
+    cell_x.resize(n);
+    cell_y.resize(n);
+    prev.resize(n);
+    next.resize(n);
+    nn.assign(n, -1);
+    nn_dist.assign(n, INF);
+    heap_pos.resize(n);
+    root_label.resize(n);
+  }
+
+  // The grid is over dRel and yRel, where tracks are spread out, and covers
+  // the tracks of the frame, which holds the centroids too. Cells are at
+  // least as big as the threshold, bigger if there would be many more cells
+  // than tracks.
+  void grid_reset(int n) {
+    double lo[2] = {INF, INF}, hi[2] = {-INF, -INF};
+    for (int i = 0; i < n; i++) {
+      for (int k = 0; k < 2; k++) {
+        lo[k] = std::min(lo[k], centroid[i * RADAR_CLUSTER_DIMS + k]);
+        hi[k] = std::max(hi[k], centroid[i * RADAR_CLUSTER_DIMS + k]);
+      }
+    }
+    const int max_cells = 4 * n + 16;
+    int dims[2];
+    for (int k = 0; k < 2; k++) {
+      const double range = n > 0 ? hi[k] - lo[k] : 0.;
+      const int max_dim = k == 0 ? max_cells : std::max(max_cells / dims[0], 1);
+      cell_size[k] = std::max(config.threshold, range / (max_dim - 0.5));
+      dims[k] = (int)(range / cell_size[k]) + 1;
+      origin[k] = lo[k];
+    }
+    grid_w = dims[0];
+    grid_h = dims[1];
+    cells.assign(grid_w * grid_h, -1);
+  }
+
+  int find(int i) {
+    while (parent[i] != i) {
+      parent[i] = parent[parent[i]];
+      i = parent[i];
+    }
+    return i;
+  }
+
+  double dist2(int i, int j) const {
+    double d = 0.;
+    for (int k = 0; k < RADAR_CLUSTER_DIMS; k++) {
+      const double e = centroid[i * RADAR_CLUSTER_DIMS + k] - centroid[j * RADAR_CLUSTER_DIMS + k];
+      d += e * e;
+    }
+    return d;
+  }
+
+  // merged centroids are between the tracks, up to rounding
+  void grid_add(int i) {
+    const int x = (centroid[i * RADAR_CLUSTER_DIMS] - origin[0]) / cell_size[0];
+    const int y = (centroid[i * RADAR_CLUSTER_DIMS + 1] - origin[1]) / cell_size[1];
+    cell_x[i] = std::min(std::max(x, 0), grid_w - 1);
+    cell_y[i] = std::min(std::max(y, 0), grid_h - 1);
+    const int c = cell_y[i] * grid_w + cell_x[i];
+    cell[i] = c;
+    prev[i] = -1;
+    next[i] = cells[c];
+    if (next[i] >= 0) {
+      prev[next[i]] = i;
+    }
+    cells[c] = i;
+  }
+
+  void grid_remove(int i) {
+    if (prev[i] >= 0) {
+      next[prev[i]] = next[i];
+    } else {
+      cells[cell[i]] = next[i];
+    }
+    if (next[i] >= 0) {
+      prev[next[i]] = prev[i];
+    }
+  }
+
+  // calls f(j) for the clusters in the cells from x0, y0 to x1, y1
+  template <typename F>
+  void for_cells(int x0, int x1, int y0, int y1, F f) {
+    for (int cy = std::max(y0, 0); cy <= std::min(y1, grid_h - 1); cy++) {
+      for (int cx = std::max(x0, 0); cx <= std::min(x1, grid_w - 1); cx++) {
+        for (int j = cells[cy * grid_w + cx]; j >= 0; j = next[j]) {
+          f(j);
+        }
+      }
+    }
+  }
+
+  // calls f(j, distance) for the clusters in the cells around i, which holds
+  // all that are closer than the threshold
+  template <typename F>
+  void for_neighbours(int i, F f) {
+    for_cells(cell_x[i] - 1, cell_x[i] + 1, cell_y[i] - 1, cell_y[i] + 1, [&](int j) {
+      if (j != i) {
+        f(j, dist2(i, j));
+      }
+    });
+  }
+
+  // j at distance d becomes the closest of i if it is closer, or as close
+  // with a lower index
+  bool nearer(int i, int j, double d) {
+    if (d < nn_dist[i] || (d == nn_dist[i] && j < nn[i])) {
+      nn_dist[i] = d;
+      nn[i] = j;
+      return true;
+    }
+    return false;
+  }
+
+  void nearest(int i) {
+    nn[i] = -1;
+    nn_dist[i] = INF;
+    for_neighbours(i, [&](int j, double d) {
+      nearer(i, j, d);
+    });
+  }
+
+  // A cluster keeps the id that most of its tracks had, and when a cluster
+  // splits the part with the most of them keeps it. Clusters of new tracks,
+  // or that lost their id, get a new one.
+  void assign_ids(int n, const int *track_ids, const int *labels, int n_clusters, int *cluster_ids) {
+    last_id.resize(n);
+    next_member.resize(n);
+    first_member.assign(n_clusters, -1);
+    for (int i = n - 1; i >= 0; i--) {
+      const int *id = last_ids.find(track_ids[i]);
+      last_id[i] = id != NULL ? *id : -1;
+      next_member[i] = first_member[labels[i]];
+      first_member[labels[i]] = i;
+    }
+
+    claims.reset(n);
+    claim_votes.resize(n_clusters);
+    for (int c = 0; c < n_clusters; c++) {
+      int best = -1, best_votes = 0;
+      for (int i = first_member[c]; i >= 0; i = next_member[i]) {
+        if (last_id[i] < 0) {
+          continue;
+        }
+        int votes = 0;
+        for (int j = first_member[c]; j >= 0; j = next_member[j]) {
+          votes += last_id[j] == last_id[i];
+        }
+        if (votes > best_votes || (votes == best_votes && last_id[i] < best)) {
+          best = last_id[i];
+          best_votes = votes;
+        }
+      }
+
+      cluster_ids[c] = -1;
+      if (best < 0) {
+        continue;
+      }
+      int &claim = claims.insert(best, -1);
+      if (claim < 0 || claim_votes[claim] < best_votes) {
+        if (claim >= 0) {
+          cluster_ids[claim] = -1;
+        }
+        claim = c;
+        claim_votes[c] = best_votes;
+        cluster_ids[c] = best;
+      }
+    }
+
+    for (int c = 0; c < n_clusters; c++) {
+      if (cluster_ids[c] < 0) {
+        cluster_ids[c] = next_id;
+        next_id = next_id == INT32_MAX ? 0 : next_id + 1;
+      }
+    }
+
+    last_ids.reset(n);
+    for (int i = 0; i < n; i++) {
+      last_ids.insert(track_ids[i], cluster_ids[labels[i]]);
+    }
+  }
+
+  const RadarClusterConfig config;
+
+  // per track, a cluster is kept at the index of its first track
+  std::vector<double> centroid;
+  std::vector<int> size, parent, nn, root_label;
+  std::vector<double> nn_dist;
+  // the clusters left, and those whose closest is merged away
+  std::vector<int> heap, heap_pos, stale;
+  // distance matrix and dendrogram of cluster_dense
+  std::vector<double> pdist, height;
+  std::vector<int> merge;
+
+  // the grid, the first cluster of every cell and a list of the clusters
+  // in the same cell for each
+  double origin[2], cell_size[2];
+  int grid_w, grid_h;
+  std::vector<int> cells;
+  std::vector<int> cell, cell_x, cell_y, prev, next;
+
+  // cluster id of every track in the last frame
+  IdTable last_ids;
+  std::vector<int> last_id, first_member, next_member;
+  // cluster that took an id in this frame
+  IdTable claims;
+  std::vector<int> claim_votes;
+  int next_id;
+};
+
+}  // namespace
+
+extern "C" {
+
+void radar_cluster_default_config(RadarClusterConfig *config) {
+  config->weights[0] = 1.;
+  // Weigh y higher since radar is inaccurate in this dimension
+  config->weights[1] = 2.;
+  config->weights[2] = 1.;
+  config->threshold = 2.5;
+  // where the grid gets faster in radar_cluster_bench
+  config->dense_max = 64;
+}
+
+void* radar_cluster_init(const RadarClusterConfig *config) {
+  return new RadarCluster(*config);
+}
+
+void radar_cluster_free(void* clusterer) {
+  delete (RadarCluster*)clusterer;
+}
+
+int radar_cluster_update(void* clusterer, int n, const int *track_ids, const double *pts,
+                         int *labels, int *cluster_ids) {
+  return ((RadarCluster*)clusterer)->update(n, track_ids, pts, labels, cluster_ids);
+}
+
+}
@@ -0,0 +1,44 @@
+#ifndef RADAR_CLUSTER_H
+#define RADAR_CLUSTER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Incremental clustering of radar tracks for radard. Gives the same clusters
+// as cluster_points_centroid, centroid linkage cut at a distance, without the
+// distance matrix: centroids are kept in a grid of cells as big as the
+// threshold, so only neighbouring cells are searched for the closest pair,
+// and merges are kept in a union-find. A few tracks are clustered faster on
+// their distance matrix, by fastcluster. Clusters keep their id from frame to
+// frame for as long as most of their tracks stay together.
+
+#define RADAR_CLUSTER_DIMS 3
+
+typedef struct RadarClusterConfig {
+  // scale of dRel, yRel and vRel in the distance
+  double weights[RADAR_CLUSTER_DIMS];
+  // clusters with centroids closer than this are merged
+  double threshold;
+  // up to this many tracks the distance matrix is used, the grid for more
+  int dense_max;
+} RadarClusterConfig;
+
+void radar_cluster_default_config(RadarClusterConfig *config);
+
+void* radar_cluster_init(const RadarClusterConfig *config);
+void radar_cluster_free(void* clusterer);
+
+// Clusters the n tracks of a frame. pts are dRel, yRel, vRel of every track
+// and track_ids their radar ids. Writes the cluster of every track to labels,
+// numbered by first track like cutree_k, and the persistent id of every
+// cluster to cluster_ids, which needs room for n. Returns the number of
+// clusters.
+int radar_cluster_update(void* clusterer, int n, const int *track_ids, const double *pts,
+                         int *labels, int *cluster_ids);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
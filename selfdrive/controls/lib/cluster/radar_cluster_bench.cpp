@@ -0,0 +1,183 @@
+#include <cassert>
+#include <cstdio>
+#include <cmath>
+#include <ctime>
+#include <vector>
+#include <random>
+#include <algorithm>
+
+extern "C" {
+#include "fastcluster.h"
+#include "radar_cluster.h"
+}
+
+// Clusters synthetic radar frames with cluster_points_centroid and with
+// radar_cluster, on the grid only and as configured, for growing numbers of
+// tracks. Checks that all give the same labels, counts how often tracks change
+// cluster label and id, and times them. Drives are timed as a whole, a thread
+// cpu clock read costs about as much as clustering a few tracks.
+
+#define FRAMES 2000
+#define DT 0.05
+// every drive is timed this many times, in turns, the fastest counts
+#define RUNS 5
+
+static double cpu_us() {
+  struct timespec t;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &t);
+  return t.tv_sec * 1e6 + t.tv_nsec * 1e-3;
+}
+
+struct Car {
+  double d, y, v, a;
+  int n_points, first_track;
+};
+
+struct Frame {
+  std::vector<int> track_ids;
+  std::vector<double> pts;
+};
+
+// cars that drive around at their own speeds, seen by 1 to 4 tracks each that
+// come and go
+static std::vector<Frame> drive(int n_tracks, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> uniform(0., 1.);
+  std::normal_distribution<double> noise(0., 1.);
+
+  std::vector<Car> cars;
+  int next_track = 0;
+  for (int tracks = 0; tracks < n_tracks * 3 / 4;) {
+    Car c = {5. + 150. * uniform(gen), -10. + 20. * uniform(gen), -5. + 10. * uniform(gen), 0.,
+             1 + (int)(4 * uniform(gen)), next_track};
+    next_track += c.n_points;
+    tracks += c.n_points;
+    cars.push_back(c);
+  }
+  // and the rest is clutter by the road, that comes at the speed of the car
+  std::vector<double> clutter;
+  for (int k = next_track; k < n_tracks; k++) {
+    clutter.push_back(160. * uniform(gen));
+    clutter.push_back(-15. + 30. * uniform(gen));
+  }
+
+  std::vector<Frame> frames(FRAMES);
+  for (Frame &f : frames) {
+    for (Car &c : cars) {
+      c.a = 0.95 * c.a + 0.3 * noise(gen);
+      c.v += c.a * DT;
+      c.d += c.v * DT;
+      // wrap around the field of view
+      if (c.d < 0. || c.d > 160.) {
+        c.d = c.d < 0. ? 160. : 0.;
+      }
+      for (int k = 0; k < c.n_points; k++) {
+        if (uniform(gen) < 0.05) {
+          continue;  // dropped track
+        }
+        f.track_ids.push_back(c.first_track + k);
+        f.pts.push_back(c.d + 0.8 * k + 0.2 * noise(gen));
+        f.pts.push_back(c.y + 0.3 * noise(gen));
+        f.pts.push_back(c.v + 0.2 * noise(gen));
+      }
+    }
+    for (size_t k = 0; k < clutter.size() / 2; k++) {
+      double &d = clutter[2 * k];
+      d -= 20. * DT;
+      if (d < 0.) {
+        d += 160.;
+      }
+      f.track_ids.push_back(next_track + k);
+      f.pts.push_back(d + 0.2 * noise(gen));
+      f.pts.push_back(clutter[2 * k + 1] + 0.3 * noise(gen));
+      f.pts.push_back(-20. + 0.2 * noise(gen));
+    }
+  }
+  return frames;
+}
+
+// clusters all frames with radar_cluster, returns the cpu time
+static double run_radar_cluster(const RadarClusterConfig &config, const std::vector<Frame> &frames,
+                                std::vector<std::vector<int> > &labels, std::vector<std::vector<int> > &ids) {
+  void *clusterer = radar_cluster_init(&config);
+  const double t = cpu_us();
+  for (size_t k = 0; k < frames.size(); k++) {
+    radar_cluster_update(clusterer, frames[k].track_ids.size(), frames[k].track_ids.data(), frames[k].pts.data(),
+                         labels[k].data(), ids[k].data());
+  }
+  const double us = cpu_us() - t;
+  radar_cluster_free(clusterer);
+  return us;
+}
+
+int main() {
+  RadarClusterConfig config;
+  radar_cluster_default_config(&config);
+  RadarClusterConfig grid_config = config;
+  grid_config.dense_max = 0;
+
+  // cluster changes are the share of tracks that are in a cluster with
+  // another label or id than in the frame before
+  printf("%6s %12s %12s %13s %8s %11s %11s\n", "tracks", "fastcluster", "grid", "radar_cluster", "speedup",
+         "label chg", "id chg");
+  const int sizes[] = {4, 8, 16, 32, 64, 96, 128};
+  for (int n_tracks : sizes) {
+    std::vector<Frame> frames = drive(n_tracks, 1337 + n_tracks);
+
+    std::vector<std::vector<double> > weighted(FRAMES);
+    std::vector<std::vector<int> > fast_labels(FRAMES), grid_labels(FRAMES), labels(FRAMES), ids(FRAMES);
+    for (int k = 0; k < FRAMES; k++) {
+      const int n = frames[k].track_ids.size();
+      weighted[k] = frames[k].pts;
+      for (int i = 0; i < n; i++) {
+        for (int d = 0; d < RADAR_CLUSTER_DIMS; d++) {
+          weighted[k][i * RADAR_CLUSTER_DIMS + d] *= config.weights[d];
+        }
+      }
+      fast_labels[k].resize(n);
+      grid_labels[k].resize(n);
+      labels[k].resize(n);
+      ids[k].resize(n);
+    }
+
+    double fast_us = INFINITY, grid_us = INFINITY, radar_us = INFINITY;
+    for (int run = 0; run < RUNS; run++) {
+      const double t = cpu_us();
+      for (int k = 0; k < FRAMES; k++) {
+        cluster_points_centroid(frames[k].track_ids.size(), RADAR_CLUSTER_DIMS, weighted[k].data(),
+                                config.threshold * config.threshold, fast_labels[k].data());
+      }
+      fast_us = std::min(fast_us, cpu_us() - t);
+      grid_us = std::min(grid_us, run_radar_cluster(grid_config, frames, grid_labels, ids));
+      radar_us = std::min(radar_us, run_radar_cluster(config, frames, labels, ids));
+    }
+
+    // how often a track sees its cluster change name
+    int id_changes = 0, label_changes = 0, track_frames = 0;
+    std::vector<int> last_id, last_label;
+    for (int k = 0; k < FRAMES; k++) {
+      const Frame &f = frames[k];
+      assert(grid_labels[k] == fast_labels[k]);
+      assert(labels[k] == fast_labels[k]);
+      for (size_t i = 0; i < f.track_ids.size(); i++) {
+        const int track = f.track_ids[i], label = labels[k][i], id = ids[k][label];
+        if ((int)last_id.size() <= track) {
+          last_id.resize(track + 1, -1);
+          last_label.resize(track + 1, -1);
+        }
+        if (last_id[track] >= 0) {
+          id_changes += last_id[track] != id;
+          label_changes += last_label[track] != label;
+          track_frames++;
+        }
+        last_id[track] = id;
+        last_label[track] = label;
+      }
+    }
+
+    printf("%6d %9.1f us %9.1f us %10.1f us %7.1fx %10.2f%% %10.2f%%\n", n_tracks, fast_us / FRAMES,
+           grid_us / FRAMES, radar_us / FRAMES, fast_us / radar_us, 100. * label_changes / track_frames,
+           100. * id_changes / track_frames);
+  }
+  return 0;
+}
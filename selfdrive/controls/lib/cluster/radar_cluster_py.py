@@ -0,0 +1,53 @@
+import os
+import subprocess
+
+from cffi import FFI
+
+cluster_dir = os.path.dirname(os.path.abspath(__file__))
+subprocess.check_call(["make", "libradar_cluster.so"], cwd=cluster_dir)
+
+ffi = FFI()
+ffi.cdef("""
+typedef struct RadarClusterConfig {
+  double weights[3];
+  double threshold;
+  int dense_max;
+} RadarClusterConfig;
+
+void radar_cluster_default_config(RadarClusterConfig *config);
+void* radar_cluster_init(const RadarClusterConfig *config);
+void radar_cluster_free(void* clusterer);
+int radar_cluster_update(void* clusterer, int n, const int *track_ids, const double *pts,
+                         int *labels, int *cluster_ids);
+""")
+
+libradar_cluster = ffi.dlopen(os.path.join(cluster_dir, "libradar_cluster.so"))
+
+
+class RadarClusterer(object):
+  """Clusters radar tracks as cluster_points_centroid, and keeps the ids of
+  clusters from frame to frame. The distance weighs dRel, yRel and vRel by
+  weights, clusters closer than threshold are merged. Up to dense_max tracks
+  are clustered on their distance matrix, more on a grid."""
+
+  def __init__(self, threshold=None, weights=None, dense_max=None):
+    config = ffi.new("RadarClusterConfig *")
+    libradar_cluster.radar_cluster_default_config(config)
+    if threshold is not None:
+      config.threshold = threshold
+    if weights is not None:
+      config.weights = list(weights)
+    if dense_max is not None:
+      config.dense_max = dense_max
+    self.clusterer = ffi.gc(libradar_cluster.radar_cluster_init(config), libradar_cluster.radar_cluster_free)
+
+  def update(self, track_ids, pts):
+    """pts are dRel, yRel, vRel of every track. Returns the cluster of every
+    track, numbered by first track, and the id of every cluster"""
+    n = len(track_ids)
+    labels = ffi.new("int[]", n)
+    cluster_ids = ffi.new("int[]", n)
+    n_clusters = libradar_cluster.radar_cluster_update(self.clusterer, n, ffi.new("int[]", list(track_ids)),
+                                                       ffi.new("double[]", [x for pt in pts for x in pt]),
+                                                       labels, cluster_ids)
+    return list(labels), list(cluster_ids[0:n_clusters])
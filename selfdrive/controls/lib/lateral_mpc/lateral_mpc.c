@@ -1,7 +1,9 @@
 #include "acado_common.h"
 #include "acado_auxiliary_functions.h"
+#include "lateral_mpc.h"
 
 #include <stdio.h>
+#include <stdlib.h>
 
 #define NX          ACADO_NX  /* Number of differential state variables.  */
 #define NXA         ACADO_NXA /* Number of algebraic variables. */
@@ -13,38 +15,30 @@
 
 #define N           ACADO_N   /* Number of intervals in the horizon. */
 
-ACADOvariables acadoVariables;
-ACADOworkspace acadoWorkspace;
-
-typedef struct {
-  double x, y, psi, delta, t;
-} state_t;
 
+ACADOcontext* mpc_create(void){
+  return (ACADOcontext*)calloc(1, sizeof(ACADOcontext));
+}
 
-typedef struct {
-  double x[N+1];
-  double y[N+1];
-  double psi[N+1];
-  double delta[N+1];
-  double rate[N];
-  double cost;
-} log_t;
+void mpc_destroy(ACADOcontext* ctx){
+  free(ctx);
+}
 
-void init(double pathCost, double laneCost, double headingCost, double steerRateCost){
-  acado_initializeSolver();
+void init(ACADOcontext* ctx, double pathCost, double laneCost, double headingCost, double steerRateCost){
+  acado_initializeSolver(ctx);
   int    i;
   const int STEP_MULTIPLIER = 3;
 
   /* Initialize the states and controls. */
-  for (i = 0; i < NX * (N + 1); ++i)  acadoVariables.x[ i ] = 0.0;
-  for (i = 0; i < NU * N; ++i)  acadoVariables.u[ i ] = 0.1;
+  for (i = 0; i < NX * (N + 1); ++i)  ctx->acadoVariables.x[ i ] = 0.0;
+  for (i = 0; i < NU * N; ++i)  ctx->acadoVariables.u[ i ] = 0.1;
 
   /* Initialize the measurements/reference. */
-  for (i = 0; i < NY * N; ++i)  acadoVariables.y[ i ] = 0.0;
-  for (i = 0; i < NYN; ++i)  acadoVariables.yN[ i ] = 0.0;
+  for (i = 0; i < NY * N; ++i)  ctx->acadoVariables.y[ i ] = 0.0;
+  for (i = 0; i < NYN; ++i)  ctx->acadoVariables.yN[ i ] = 0.0;
 
   /* MPC: initialize the current state feedback. */
-  for (i = 0; i < NX; ++i) acadoVariables.x0[ i ] = 0.0;
+  for (i = 0; i < NX; ++i) ctx->acadoVariables.x0[ i ] = 0.0;
 
   for (i = 0; i < N; i++) {
     int f = 1;
@@ -52,78 +46,78 @@ void init(double pathCost, double laneCost, double headingCost, double steerRate
       f = STEP_MULTIPLIER;
     }
     // Setup diagonal entries
-    acadoVariables.W[NY*NY*i + (NY+1)*0] = pathCost * f;
-    acadoVariables.W[NY*NY*i + (NY+1)*1] = laneCost * f;
-    acadoVariables.W[NY*NY*i + (NY+1)*2] = laneCost * f;
-    acadoVariables.W[NY*NY*i + (NY+1)*3] = headingCost * f;
-    acadoVariables.W[NY*NY*i + (NY+1)*4] = steerRateCost * f;
+    ctx->acadoVariables.W[NY*NY*i + (NY+1)*0] = pathCost * f;
+    ctx->acadoVariables.W[NY*NY*i + (NY+1)*1] = laneCost * f;
+    ctx->acadoVariables.W[NY*NY*i + (NY+1)*2] = laneCost * f;
+    ctx->acadoVariables.W[NY*NY*i + (NY+1)*3] = headingCost * f;
+    ctx->acadoVariables.W[NY*NY*i + (NY+1)*4] = steerRateCost * f;
   }
-  acadoVariables.WN[(NYN+1)*0] = pathCost * STEP_MULTIPLIER;
-  acadoVariables.WN[(NYN+1)*1] = laneCost * STEP_MULTIPLIER;
-  acadoVariables.WN[(NYN+1)*2] = laneCost * STEP_MULTIPLIER;
-  acadoVariables.WN[(NYN+1)*3] = headingCost * STEP_MULTIPLIER;
+  ctx->acadoVariables.WN[(NYN+1)*0] = pathCost * STEP_MULTIPLIER;
+  ctx->acadoVariables.WN[(NYN+1)*1] = laneCost * STEP_MULTIPLIER;
+  ctx->acadoVariables.WN[(NYN+1)*2] = laneCost * STEP_MULTIPLIER;
+  ctx->acadoVariables.WN[(NYN+1)*3] = headingCost * STEP_MULTIPLIER;
 }
 
-int run_mpc(state_t * x0, log_t * solution,
+int run_mpc(ACADOcontext* ctx, state_t * x0, log_t * solution,
              double l_poly[4], double r_poly[4], double p_poly[4],
              double l_prob, double r_prob, double p_prob, double curvature_factor, double v_ref, double lane_width){
 
   int    i;
 
   for (i = 0; i <= NOD * N; i+= NOD){
-    acadoVariables.od[i] = curvature_factor;
-    acadoVariables.od[i+1] = v_ref;
+    ctx->acadoVariables.od[i] = curvature_factor;
+    ctx->acadoVariables.od[i+1] = v_ref;
 
-    acadoVariables.od[i+2] = l_poly[0];
-    acadoVariables.od[i+3] = l_poly[1];
-    acadoVariables.od[i+4] = l_poly[2];
-    acadoVariables.od[i+5] = l_poly[3];
+    ctx->acadoVariables.od[i+2] = l_poly[0];
+    ctx->acadoVariables.od[i+3] = l_poly[1];
+    ctx->acadoVariables.od[i+4] = l_poly[2];
+    ctx->acadoVariables.od[i+5] = l_poly[3];
 
-    acadoVariables.od[i+6] = r_poly[0];
-    acadoVariables.od[i+7] = r_poly[1];
-    acadoVariables.od[i+8] = r_poly[2];
-    acadoVariables.od[i+9] = r_poly[3];
+    ctx->acadoVariables.od[i+6] = r_poly[0];
+    ctx->acadoVariables.od[i+7] = r_poly[1];
+    ctx->acadoVariables.od[i+8] = r_poly[2];
+    ctx->acadoVariables.od[i+9] = r_poly[3];
 
-    acadoVariables.od[i+10] = p_poly[0];
-    acadoVariables.od[i+11] = p_poly[1];
-    acadoVariables.od[i+12] = p_poly[2];
-    acadoVariables.od[i+13] = p_poly[3];
+    ctx->acadoVariables.od[i+10] = p_poly[0];
+    ctx->acadoVariables.od[i+11] = p_poly[1];
+    ctx->acadoVariables.od[i+12] = p_poly[2];
+    ctx->acadoVariables.od[i+13] = p_poly[3];
 
 
-    acadoVariables.od[i+14] = l_prob;
-    acadoVariables.od[i+15] = r_prob;
-    acadoVariables.od[i+16] = p_prob;
-    acadoVariables.od[i+17] = lane_width;
+    ctx->acadoVariables.od[i+14] = l_prob;
+    ctx->acadoVariables.od[i+15] = r_prob;
+    ctx->acadoVariables.od[i+16] = p_prob;
+    ctx->acadoVariables.od[i+17] = lane_width;
 
   }
 
-  acadoVariables.x0[0] = x0->x;
-  acadoVariables.x0[1] = x0->y;
-  acadoVariables.x0[2] = x0->psi;
-  acadoVariables.x0[3] = x0->delta;
+  ctx->acadoVariables.x0[0] = x0->x;
+  ctx->acadoVariables.x0[1] = x0->y;
+  ctx->acadoVariables.x0[2] = x0->psi;
+  ctx->acadoVariables.x0[3] = x0->delta;
 
 
-  acado_preparationStep();
-  acado_feedbackStep();
+  acado_preparationStep(ctx);
+  acado_feedbackStep(ctx);
 
-  /* printf("lat its: %d\n", acado_getNWSR());  // n iterations
-  printf("Objective: %.6f\n", acado_getObjective());  // solution cost */
+  /* printf("lat its: %d\n", acado_getNWSR(ctx));  // n iterations
+  printf("Objective: %.6f\n", acado_getObjective(ctx));  // solution cost */
 
   for (i = 0; i <= N; i++){
-    solution->x[i] = acadoVariables.x[i*NX];
-    solution->y[i] = acadoVariables.x[i*NX+1];
-    solution->psi[i] = acadoVariables.x[i*NX+2];
-    solution->delta[i] = acadoVariables.x[i*NX+3];
+    solution->x[i] = ctx->acadoVariables.x[i*NX];
+    solution->y[i] = ctx->acadoVariables.x[i*NX+1];
+    solution->psi[i] = ctx->acadoVariables.x[i*NX+2];
+    solution->delta[i] = ctx->acadoVariables.x[i*NX+3];
     if (i < N){
-      solution->rate[i] = acadoVariables.u[i];
+      solution->rate[i] = ctx->acadoVariables.u[i];
     }
   }
-  solution->cost = acado_getObjective();
+  solution->cost = acado_getObjective(ctx);
 
   // Dont shift states here. Current solution is closer to next timestep than if
   // we use the old solution as a starting point
-  //acado_shiftStates(2, 0, 0);
-  //acado_shiftControls( 0 );
+  //acado_shiftStates(ctx, 2, 0, 0);
+  //acado_shiftControls(ctx, 0);
 
-  return acado_getNWSR();
+  return acado_getNWSR(ctx);
 }
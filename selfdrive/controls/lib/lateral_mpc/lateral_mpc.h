@@ -0,0 +1,35 @@
+#pragma once
+
+#include "acado_common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+  double x, y, psi, delta, t;
+} state_t;
+
+
+typedef struct {
+  double x[ACADO_N+1];
+  double y[ACADO_N+1];
+  double psi[ACADO_N+1];
+  double delta[ACADO_N+1];
+  double rate[ACADO_N];
+  double cost;
+} log_t;
+
+// Every solver has its own context, created zeroed. Solvers can run at the
+// same time on different threads.
+ACADOcontext* mpc_create(void);
+void mpc_destroy(ACADOcontext* ctx);
+
+void init(ACADOcontext* ctx, double pathCost, double laneCost, double headingCost, double steerRateCost);
+int run_mpc(ACADOcontext* ctx, state_t * x0, log_t * solution,
+             double l_poly[4], double r_poly[4], double p_poly[4],
+             double l_prob, double r_prob, double p_prob, double curvature_factor, double v_ref, double lane_width);
+
+#ifdef __cplusplus
+}
+#endif
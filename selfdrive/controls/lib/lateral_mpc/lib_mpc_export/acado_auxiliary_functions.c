@@ -21,62 +21,62 @@
 
 #include <stdio.h>
 
-real_t* acado_getVariablesX( )
+real_t* acado_getVariablesX( ACADOcontext* const ctx )
 {
-	return acadoVariables.x;
+	return ctx->acadoVariables.x;
 }
 
-real_t* acado_getVariablesU( )
+real_t* acado_getVariablesU( ACADOcontext* const ctx )
 {
-	return acadoVariables.u;
+	return ctx->acadoVariables.u;
 }
 
 #if ACADO_NY > 0
-real_t* acado_getVariablesY( )
+real_t* acado_getVariablesY( ACADOcontext* const ctx )
 {
-	return acadoVariables.y;
+	return ctx->acadoVariables.y;
 }
 #endif
 
 #if ACADO_NYN > 0
-real_t* acado_getVariablesYN( )
+real_t* acado_getVariablesYN( ACADOcontext* const ctx )
 {
-	return acadoVariables.yN;
+	return ctx->acadoVariables.yN;
 }
 #endif
 
-real_t* acado_getVariablesX0( )
+real_t* acado_getVariablesX0( ACADOcontext* const ctx )
 {
 #if ACADO_INITIAL_VALUE_FIXED
-	return acadoVariables.x0;
+	return ctx->acadoVariables.x0;
 #else
 	return 0;
 #endif
 }
 
 /** Print differential variables. */
-void acado_printDifferentialVariables( )
+void acado_printDifferentialVariables( ACADOcontext* const ctx )
 {
 	int i, j;
 	printf("\nDifferential variables:\n[\n");
 	for (i = 0; i < ACADO_N + 1; ++i)
 	{
 		for (j = 0; j < ACADO_NX; ++j)
-			printf("\t%e", acadoVariables.x[i * ACADO_NX + j]);
+			printf("\t%e", ctx->acadoVariables.x[i * ACADO_NX + j]);
 		printf("\n");
 	}
 	printf("]\n\n");
 }
 
 /** Print control variables. */
-void acado_printControlVariables( )
+void acado_printControlVariables( ACADOcontext* const ctx )
 {
 	int i, j;
 	printf("\nControl variables:\n[\n");
 	for (i = 0; i < ACADO_N; ++i)
 	{
 		for (j = 0; j < ACADO_NU; ++j)
-			printf("\t%e", acadoVariables.u[i * ACADO_NU + j]);
+			printf("\t%e", ctx->acadoVariables.u[i * ACADO_NU + j]);
 		printf("\n");
 	}
 	printf("]\n\n");
@@ -30,29 +30,29 @@ extern "C"
 #endif /* __MATLAB__ */
 
 /** Get pointer to the matrix with differential variables. */
-real_t* acado_getVariablesX( );
+real_t* acado_getVariablesX( ACADOcontext* const ctx );
 
 /** Get pointer to the matrix with control variables. */
-real_t* acado_getVariablesU( );
+real_t* acado_getVariablesU( ACADOcontext* const ctx );
 
 #if ACADO_NY > 0
 /** Get pointer to the matrix with references/measurements. */
-real_t* acado_getVariablesY( );
+real_t* acado_getVariablesY( ACADOcontext* const ctx );
 #endif
 
 #if ACADO_NYN > 0
 /** Get pointer to the vector with references/measurement on the last node. */
-real_t* acado_getVariablesYN( );
+real_t* acado_getVariablesYN( ACADOcontext* const ctx );
 #endif
 
 /** Get pointer to the current state feedback vector. Only applicable for NMPC. */
-real_t* acado_getVariablesX0( );
+real_t* acado_getVariablesX0( ACADOcontext* const ctx );
 
 /** Print differential variables. */
-void acado_printDifferentialVariables( );
+void acado_printDifferentialVariables( ACADOcontext* const ctx );
 
 /** Print control variables. */
-void acado_printControlVariables( );
+void acado_printControlVariables( ACADOcontext* const ctx );
 
 /** Print ACADO code generation notice. */
 void acado_printHeader( );
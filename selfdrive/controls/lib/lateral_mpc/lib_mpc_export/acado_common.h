@@ -281,36 +281,36 @@ real_t y[ 64 ];
  *
  *  \return Status code of the integrator.
  */
-int acado_integrate( real_t* const rk_eta, int resetIntegrator, int rk_index );
+int acado_integrate( ACADOcontext* const ctx, real_t* const rk_eta, int resetIntegrator, int rk_index );
 
 /** Export of an ACADO symbolic function.
  *
  *  \param in Input to the exported function.
  *  \param out Output of the exported function.
  */
-void acado_rhs_forw(const real_t* in, real_t* out);
+void acado_rhs_forw(ACADOcontext* const ctx, const real_t* in, real_t* out);
 
 /** Preparation step of the RTI scheme.
  *
  *  \return Status of the integration module. =0: OK, otherwise the error code.
  */
-int acado_preparationStep(  );
+int acado_preparationStep( ACADOcontext* const ctx );
 
 /** Feedback/estimation step of the RTI scheme.
  *
  *  \return Status code of the qpOASES QP solver.
  */
-int acado_feedbackStep(  );
+int acado_feedbackStep( ACADOcontext* const ctx );
 
 /** Solver initialization. Must be called once before any other function call.
  *
  *  \return =0: OK, otherwise an error code of a QP solver.
  */
-int acado_initializeSolver(  );
+int acado_initializeSolver( ACADOcontext* const ctx );
 
 /** Initialize shooting nodes by a forward simulation starting from the first node.
  */
-void acado_initializeNodesByForwardSimulation(  );
+void acado_initializeNodesByForwardSimulation( ACADOcontext* const ctx );
 
 /** Shift differential variables vector by one interval.
  *
@@ -318,33 +318,40 @@ void acado_initializeNodesByForwardSimulation(  );
  *  \param xEnd Value for the x vector on the last node. If =0 the old value is used.
  *  \param uEnd Value for the u vector on the second to last node. If =0 the old value is used.
  */
-void acado_shiftStates( int strategy, real_t* const xEnd, real_t* const uEnd );
+void acado_shiftStates( ACADOcontext* const ctx, int strategy, real_t* const xEnd, real_t* const uEnd );
 
 /** Shift controls vector by one interval.
  *
  *  \param uEnd Value for the u vector on the second to last node. If =0 the old value is used.
  */
-void acado_shiftControls( real_t* const uEnd );
+void acado_shiftControls( ACADOcontext* const ctx, real_t* const uEnd );
 
 /** Get the KKT tolerance of the current iterate.
  *
  *  \return The KKT tolerance value.
  */
-real_t acado_getKKT(  );
+real_t acado_getKKT( ACADOcontext* const ctx );
 
 /** Calculate the objective value.
  *
  *  \return Value of the objective function.
  */
-real_t acado_getObjective(  );
+real_t acado_getObjective( ACADOcontext* const ctx );
 
 
 /* 
  * Extern declarations. 
  */
 
-extern ACADOworkspace acadoWorkspace;
-extern ACADOvariables acadoVariables;
+
+/** Solver state, one per solver instance. */
+struct ACADOcontext
+{
+ACADOvariables acadoVariables;
+ACADOworkspace acadoWorkspace;
+int acado_nWSR;
+};
+
 
 /** @} */
 
@@ -20,6 +20,8 @@
 #ifndef QPOASES_HEADER
 #define QPOASES_HEADER
 
+typedef struct ACADOcontext ACADOcontext;
+
 #ifdef PC_DEBUG
 #include <stdio.h>
 #endif /* PC_DEBUG */
@@ -54,10 +56,10 @@ typedef double real_t;
  */
 
 /** A function that calls the QP solver */
-EXTERNC int acado_solve( void );
+EXTERNC int acado_solve( ACADOcontext* const ctx );
 
 /** Get the number of active set changes */
-EXTERNC int acado_getNWSR( void );
+EXTERNC int acado_getNWSR( ACADOcontext* const ctx );
 
 /** Get the error string. */
 const char* acado_getErrorString( int error );
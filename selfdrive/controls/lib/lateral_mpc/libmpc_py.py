@@ -3,12 +3,16 @@ import subprocess
 
 from cffi import FFI
 
+from selfdrive.controls.lib import mpc_record
+
 mpc_dir = os.path.dirname(os.path.abspath(__file__))
 libmpc_fn = os.path.join(mpc_dir, "libmpc.so")
 subprocess.check_call(["make", "-j4"], cwd=mpc_dir)
 
 ffi = FFI()
 ffi.cdef("""
+typedef struct ACADOcontext ACADOcontext;
+
 typedef struct {
     double x, y, psi, delta, t;
 } state_t;
@@ -22,10 +26,24 @@ typedef struct {
     double cost;
 } log_t;
 
-void init(double pathCost, double laneCost, double headingCost, double steerRateCost);
-int run_mpc(state_t * x0, log_t * solution,
+ACADOcontext* mpc_create(void);
+void mpc_destroy(ACADOcontext* ctx);
+void init(ACADOcontext* ctx, double pathCost, double laneCost, double headingCost, double steerRateCost);
+int run_mpc(ACADOcontext* ctx, state_t * x0, log_t * solution,
              double l_poly[4], double r_poly[4], double p_poly[4],
              double l_prob, double r_prob, double p_prob, double curvature_factor, double v_ref, double lane_width);
 """)
 
 libmpc = ffi.dlopen(libmpc_fn)
+
+# MPC_RECORD=dir records the calls for mpc_bench
+libmpc = mpc_record.recording(ffi, libmpc, "lateral_mpc", {
+  'init': (mpc_record.INIT, lambda *costs: costs),
+  'run_mpc': (mpc_record.RUN, lambda x0, solution, l_poly, r_poly, p_poly, *args:
+              [x0.x, x0.y, x0.psi, x0.delta, x0.t] + list(l_poly) + list(r_poly) + list(p_poly) + list(args)),
+}, 25)
+
+
+def new_context():
+  """A solver of its own, freed with the returned object."""
+  return ffi.gc(libmpc.mpc_create(), libmpc.mpc_destroy)
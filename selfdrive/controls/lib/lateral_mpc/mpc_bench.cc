@@ -0,0 +1,106 @@
+#include <cmath>
+#include <map>
+
+#include "lateral_mpc.h"
+#include "acado_auxiliary_functions.h"
+#include "acado_qpoases_interface.hpp"
+#include "../mpc_bench.h"
+
+// Times run_mpc over the calls the path planner made, recorded with
+// MPC_RECORD set, or over winding roads without a recording.
+//   make mpc_bench && ./mpc_bench -b 2000 /data/mpc/lateral_mpc.bin
+
+#define RECORD_SIZE 25
+
+static std::map<int, ACADOcontext*> solvers;
+
+static ACADOcontext* solver(int k) {
+  ACADOcontext* &ctx = solvers[k];
+  if (ctx == NULL) {
+    ctx = mpc_create();
+  }
+  return ctx;
+}
+
+static void reset() {
+  for (auto &s : solvers) {
+    mpc_destroy(s.second);
+  }
+  solvers.clear();
+}
+
+static void replay(const double *rec, std::vector<MpcSolve> &solves) {
+  const int k = rec[1];
+  const double *a = rec + 2;
+  ACADOcontext* ctx = solver(k);
+
+  switch ((int)rec[0]) {
+  case MPC_CALL_INIT:
+    init(ctx, a[0], a[1], a[2], a[3]);
+    break;
+  case MPC_CALL_RUN: {
+    state_t x0 = {a[0], a[1], a[2], a[3], a[4]};
+    double l_poly[4] = {a[5], a[6], a[7], a[8]};
+    double r_poly[4] = {a[9], a[10], a[11], a[12]};
+    double p_poly[4] = {a[13], a[14], a[15], a[16]};
+    log_t solution;
+    MpcSolve s;
+    s.solver = k;
+    const double t = mpc_bench_now_us();
+    s.its = run_mpc(ctx, &x0, &solution, l_poly, r_poly, p_poly, a[17], a[18], a[19], a[20], a[21], a[22]);
+    s.us = mpc_bench_now_us() - t;
+    s.kkt = acado_getKKT(ctx);
+    s.cost = solution.cost;
+    s.nan = std::isnan(s.cost);
+    for (int i = 0; i <= ACADO_N; i++) {
+      s.nan = s.nan || std::isnan(solution.delta[i]);
+    }
+    solves.push_back(s);
+    break;
+  }
+  }
+}
+
+// What the path planner calls on roads that bend either way with lanes that
+// come and go, as a recording
+static void builtin(std::vector<double> &records) {
+  const double dt = 0.05, delay = 0.1;
+  auto add = [&records](std::vector<double> rec) {
+    rec.resize(RECORD_SIZE);
+    records.insert(records.end(), rec.begin(), rec.end());
+  };
+
+  for (int k = 0; k < 8; k++) {
+    // a solver per road, set up as the planner does
+    add({MPC_CALL_INIT, (double)k, 1.0, 1.0, 1.0, 0.5});
+
+    const double v_ego = 5.0 + 4.0 * k;
+    const double curvature_factor = 1.0 / (1.0 + 0.0015 * v_ego * v_ego);
+    double delta = 0.0;
+
+    for (int i = 0; i < 1000; i++) {
+      const double curv = 0.003 * (1 + k % 3) * sin(i * dt * (0.2 + 0.05 * k));
+      const double offset = 0.6 * sin(i * dt * 0.5 + k);
+      const double l_prob = (i / 150) % 4 == 3 ? 0.0 : 0.9;
+      const double r_prob = (i / 250) % 3 == 2 ? 0.1 : 0.8;
+      const double p_prob = 0.5 + 0.05 * k;
+      const double psi = v_ego * curvature_factor * delta * delay;
+
+      add({MPC_CALL_RUN, (double)k, v_ego * delay, 0.0, psi, delta, 0.0,
+           0.0, curv, 0.02 * (k - 4), 1.8 + offset,
+           0.0, curv, 0.02 * (k - 4), -1.8 + offset,
+           0.0, curv, 0.02 * (k - 4), offset,
+           l_prob, r_prob, p_prob, curvature_factor, fmax(v_ego, 5.0), 3.6});
+
+      // steer roughly to the road, the bench is about the solver not the control
+      delta = 0.8 * delta + 0.2 * (2.7 * curv - 0.02 * offset);
+    }
+  }
+}
+
+int main(int argc, char *argv[]) {
+  const int ret = mpc_bench_main("lateral mpc", argc, argv, RECORD_SIZE, QPOASES_NWSRMAX,
+                                 builtin, replay, reset);
+  reset();
+  return ret;
+}
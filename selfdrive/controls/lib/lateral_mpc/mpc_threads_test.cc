@@ -0,0 +1,90 @@
+#include <cstdio>
+#include <cstring>
+#include <cmath>
+#include <cassert>
+#include <vector>
+#include <thread>
+
+#include "lateral_mpc.h"
+
+// Follows a different road with every solver, first one after the other on
+// one context and then all at once on threads of their own, and checks that
+// every solution is the same bit for bit.
+
+#define SCENARIOS 8
+#define STEPS 200
+#define REPEATS 5
+
+struct Run {
+  std::vector<log_t> solutions;
+  std::vector<int> its;
+
+  Run() : solutions(STEPS), its(STEPS) {}
+};
+
+static void run_scenario(ACADOcontext* ctx, int k, Run &run) {
+  const double dt = 0.05;
+  const double v_ref = 10.0 + 3.0 * k;
+  const double curvature_factor = 0.3 / (1.0 + 0.002 * v_ref * v_ref);
+
+  memset(run.solutions.data(), 0, STEPS * sizeof(log_t));
+  init(ctx, 1.0, 3.0, 1.0, 1.0);
+
+  state_t s = {0.0, 0.0, 0.0, 0.0, 0.0};
+  for (int i = 0; i < STEPS; i++) {
+    // a road that bends and a car that is off its middle
+    double curv = 0.002 * (1 + k % 3) * sin(i * dt * (0.3 + 0.05 * k));
+    double offset = 0.5 * sin(i * dt * 0.7 + k);
+    double l_poly[4] = {0.0, curv, 0.01 * (k - 4), 1.8 + offset};
+    double r_poly[4] = {0.0, curv, 0.01 * (k - 4), -1.8 + offset};
+    double p_poly[4] = {0.0, curv, 0.01 * (k - 4), offset};
+    double l_prob = 0.9, r_prob = 0.4 + 0.05 * k, p_prob = 0.6;
+
+    run.its[i] = run_mpc(ctx, &s, &run.solutions[i], l_poly, r_poly, p_poly,
+                         l_prob, r_prob, p_prob, curvature_factor, v_ref, 3.6);
+    s.delta = run.solutions[i].delta[1];
+  }
+}
+
+static bool same(const Run &a, const Run &b) {
+  return memcmp(a.solutions.data(), b.solutions.data(), STEPS * sizeof(log_t)) == 0 && a.its == b.its;
+}
+
+int main() {
+  std::vector<Run> serial(SCENARIOS);
+  ACADOcontext* ctx = mpc_create();
+  for (int k = 0; k < SCENARIOS; k++) {
+    run_scenario(ctx, k, serial[k]);
+  }
+  mpc_destroy(ctx);
+
+  // the same context again gives the same
+  Run again;
+  ctx = mpc_create();
+  run_scenario(ctx, 0, again);
+  assert(same(again, serial[0]));
+  mpc_destroy(ctx);
+
+  std::vector<std::thread> threads;
+  std::vector<int> ok(SCENARIOS, 1);
+  for (int k = 0; k < SCENARIOS; k++) {
+    threads.emplace_back([k, &serial, &ok] {
+      ACADOcontext* ctx = mpc_create();
+      Run run;
+      for (int r = 0; r < REPEATS; r++) {
+        run_scenario(ctx, k, run);
+        ok[k] = ok[k] && same(run, serial[k]);
+      }
+      mpc_destroy(ctx);
+    });
+  }
+  for (auto &t : threads) t.join();
+
+  for (int k = 0; k < SCENARIOS; k++) {
+    printf("road %d: %s, %d qp iterations in the last solve, cost %f\n", k, ok[k] ? "same" : "DIFFERENT",
+           serial[k].its[STEPS - 1], serial[k].solutions[STEPS - 1].cost);
+    assert(ok[k]);
+  }
+  printf("%d solvers on threads match\n", SCENARIOS);
+  return 0;
+}
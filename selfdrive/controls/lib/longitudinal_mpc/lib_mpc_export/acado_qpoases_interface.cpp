@@ -28,7 +28,6 @@ extern "C"
 #include "INCLUDE/EXTRAS/SolutionAnalysis.hpp"
 #endif /* ACADO_COMPUTE_COVARIANCE_MATRIX */
 
-static int acado_nWSR;
 
 
 
@@ -36,16 +35,16 @@ static int acado_nWSR;
 static SolutionAnalysis acado_sa;
 #endif /* ACADO_COMPUTE_COVARIANCE_MATRIX */
 
-int acado_solve( void )
+int acado_solve( ACADOcontext* const ctx )
 {
-	acado_nWSR = QPOASES_NWSRMAX;
+	ctx->acado_nWSR = QPOASES_NWSRMAX;
 
 	QProblem qp(23, 20);
 	
-	returnValue retVal = qp.init(acadoWorkspace.H, acadoWorkspace.g, acadoWorkspace.A, acadoWorkspace.lb, acadoWorkspace.ub, acadoWorkspace.lbA, acadoWorkspace.ubA, acado_nWSR, acadoWorkspace.y);
+	returnValue retVal = qp.init(ctx->acadoWorkspace.H, ctx->acadoWorkspace.g, ctx->acadoWorkspace.A, ctx->acadoWorkspace.lb, ctx->acadoWorkspace.ub, ctx->acadoWorkspace.lbA, ctx->acadoWorkspace.ubA, ctx->acado_nWSR, ctx->acadoWorkspace.y);
 
-    qp.getPrimalSolution( acadoWorkspace.x );
-    qp.getDualSolution( acadoWorkspace.y );
+    qp.getPrimalSolution( ctx->acadoWorkspace.x );
+    qp.getDualSolution( ctx->acadoWorkspace.y );
 	
 #if ACADO_COMPUTE_COVARIANCE_MATRIX == 1
 
@@ -59,9 +58,9 @@ int acado_solve( void )
 	return (int)retVal;
 }
 
-int acado_getNWSR( void )
+int acado_getNWSR( ACADOcontext* const ctx )
 {
-	return acado_nWSR;
+	return ctx->acado_nWSR;
 }
 
 const char* acado_getErrorString( int error )
@@ -4,48 +4,61 @@ import subprocess
 
 from cffi import FFI
 
+from selfdrive.controls.lib import mpc_record
+
 mpc_dir = os.path.join(os.path.dirname(os.path.abspath(__file__)))
 
+libmpc_fn = os.path.join(mpc_dir, "libmpc.so")
+
 if platform.machine() == "x86_64":
   try:
-    FFI().dlopen(os.path.join(mpc_dir, "libmpc1.so"))
+    FFI().dlopen(libmpc_fn)
   except OSError:
-    # libmpc1.so is likely built for aarch64. cleaning...
+    # libmpc.so is likely built for aarch64. cleaning...
     subprocess.check_call(["make", "clean"], cwd=mpc_dir)
 
 subprocess.check_call(["make", "-j4"], cwd=mpc_dir)
 
-def _get_libmpc(mpc_id):
-    libmpc_fn = os.path.join(mpc_dir, "libmpc%d.so" % mpc_id)
+ffi = FFI()
+ffi.cdef("""
+typedef struct ACADOcontext ACADOcontext;
+
+typedef struct {
+double x_ego, v_ego, a_ego, x_l, v_l, a_l;
+} state_t;
 
-    ffi = FFI()
-    ffi.cdef("""
-    typedef struct {
-    double x_ego, v_ego, a_ego, x_l, v_l, a_l;
-    } state_t;
 
+typedef struct {
+double x_ego[21];
+double v_ego[21];
+double a_ego[21];
+double j_ego[20];
+double x_l[21];
+double v_l[21];
+double a_l[21];
+double t[21];
+double cost;
+} log_t;
 
-    typedef struct {
-    double x_ego[21];
-    double v_ego[21];
-    double a_ego[21];
-    double j_ego[20];
-    double x_l[21];
-    double v_l[21];
-    double a_l[21];
-    double t[21];
-    double cost;
-    } log_t;
+ACADOcontext* mpc_create(void);
+void mpc_destroy(ACADOcontext* ctx);
+void init(ACADOcontext* ctx, double ttcCost, double distanceCost, double accelerationCost, double jerkCost);
+void init_with_simulation(ACADOcontext* ctx, double v_ego, double x_l, double v_l, double a_l, double l);
+int run_mpc(ACADOcontext* ctx, state_t * x0, log_t * solution,
+            double l, double a_l_0);
+""")
 
-    void init(double ttcCost, double distanceCost, double accelerationCost, double jerkCost);
-    void init_with_simulation(double v_ego, double x_l, double v_l, double a_l, double l);
-    int run_mpc(state_t * x0, log_t * solution,
-                double l, double a_l_0);
-    """)
+libmpc = ffi.dlopen(libmpc_fn)
 
-    return (ffi, ffi.dlopen(libmpc_fn))
+# MPC_RECORD=dir records the calls for mpc_bench
+libmpc = mpc_record.recording(ffi, libmpc, "longitudinal_mpc", {
+  'init': (mpc_record.INIT, lambda *costs: costs),
+  'init_with_simulation': (mpc_record.INIT_WITH_SIMULATION, lambda *args: args),
+  'run_mpc': (mpc_record.RUN, lambda x0, solution, l, a_l_0:
+              [x0.x_ego, x0.v_ego, x0.a_ego, x0.x_l, x0.v_l, x0.a_l, l, a_l_0]),
+}, 10)
 
-mpcs = [_get_libmpc(1), _get_libmpc(2)]
 
-def get_libmpc(mpc_id):
-    return mpcs[mpc_id - 1]
+def new_context():
+  """A solver of its own, freed with the returned object."""
+  return ffi.gc(libmpc.mpc_create(), libmpc.mpc_destroy)
@@ -1,7 +1,9 @@
 #include "acado_common.h"
 #include "acado_auxiliary_functions.h"
+#include "longitudinal_mpc.h"
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <math.h>
 
 #define NX          ACADO_NX  /* Number of differential state variables.  */
@@ -14,41 +16,30 @@
 
 #define N           ACADO_N   /* Number of intervals in the horizon. */
 
-ACADOvariables acadoVariables;
-ACADOworkspace acadoWorkspace;
-
-typedef struct {
-  double x_ego, v_ego, a_ego, x_l, v_l, a_l;
-} state_t;
 
+ACADOcontext* mpc_create(void){
+  return (ACADOcontext*)calloc(1, sizeof(ACADOcontext));
+}
 
-typedef struct {
-  double x_ego[N+1];
-  double v_ego[N+1];
-  double a_ego[N+1];
-  double j_ego[N];
-  double x_l[N+1];
-  double v_l[N+1];
-  double a_l[N+1];
-  double t[N+1];
-  double cost;
-} log_t;
+void mpc_destroy(ACADOcontext* ctx){
+  free(ctx);
+}
 
-void init(double ttcCost, double distanceCost, double accelerationCost, double jerkCost){
-  acado_initializeSolver();
+void init(ACADOcontext* ctx, double ttcCost, double distanceCost, double accelerationCost, double jerkCost){
+  acado_initializeSolver(ctx);
   int    i;
   const int STEP_MULTIPLIER = 3;
 
   /* Initialize the states and controls. */
-  for (i = 0; i < NX * (N + 1); ++i)  acadoVariables.x[ i ] = 0.0;
-  for (i = 0; i < NU * N; ++i)  acadoVariables.u[ i ] = 0.0;
+  for (i = 0; i < NX * (N + 1); ++i)  ctx->acadoVariables.x[ i ] = 0.0;
+  for (i = 0; i < NU * N; ++i)  ctx->acadoVariables.u[ i ] = 0.0;
 
   /* Initialize the measurements/reference. */
-  for (i = 0; i < NY * N; ++i)  acadoVariables.y[ i ] = 0.0;
-  for (i = 0; i < NYN; ++i)  acadoVariables.yN[ i ] = 0.0;
+  for (i = 0; i < NY * N; ++i)  ctx->acadoVariables.y[ i ] = 0.0;
+  for (i = 0; i < NYN; ++i)  ctx->acadoVariables.yN[ i ] = 0.0;
 
   /* MPC: initialize the current state feedback. */
-  for (i = 0; i < NX; ++i) acadoVariables.x0[ i ] = 0.0;
+  for (i = 0; i < NX; ++i) ctx->acadoVariables.x0[ i ] = 0.0;
   // Set weights
 
   for (i = 0; i < N; i++) {
@@ -57,18 +48,18 @@ void init(double ttcCost, double distanceCost, double accelerationCost, double j
       f = STEP_MULTIPLIER;
     }
     // Setup diagonal entries
-    acadoVariables.W[NY*NY*i + (NY+1)*0] = ttcCost * f; // exponential cost for time-to-collision (ttc)
-    acadoVariables.W[NY*NY*i + (NY+1)*1] = distanceCost * f; // desired distance
-    acadoVariables.W[NY*NY*i + (NY+1)*2] = accelerationCost * f; // acceleration
-    acadoVariables.W[NY*NY*i + (NY+1)*3] = jerkCost * f; // jerk
+    ctx->acadoVariables.W[NY*NY*i + (NY+1)*0] = ttcCost * f; // exponential cost for time-to-collision (ttc)
+    ctx->acadoVariables.W[NY*NY*i + (NY+1)*1] = distanceCost * f; // desired distance
+    ctx->acadoVariables.W[NY*NY*i + (NY+1)*2] = accelerationCost * f; // acceleration
+    ctx->acadoVariables.W[NY*NY*i + (NY+1)*3] = jerkCost * f; // jerk
   }
-  acadoVariables.WN[(NYN+1)*0] = ttcCost * STEP_MULTIPLIER; // exponential cost for danger zone
-  acadoVariables.WN[(NYN+1)*1] = distanceCost * STEP_MULTIPLIER; // desired distance
-  acadoVariables.WN[(NYN+1)*2] = accelerationCost * STEP_MULTIPLIER; // acceleration
+  ctx->acadoVariables.WN[(NYN+1)*0] = ttcCost * STEP_MULTIPLIER; // exponential cost for danger zone
+  ctx->acadoVariables.WN[(NYN+1)*1] = distanceCost * STEP_MULTIPLIER; // desired distance
+  ctx->acadoVariables.WN[(NYN+1)*2] = accelerationCost * STEP_MULTIPLIER; // acceleration
 
 }
 
-void init_with_simulation(double v_ego, double x_l_0, double v_l_0, double a_l_0, double l){
+void init_with_simulation(ACADOcontext* ctx, double v_ego, double x_l_0, double v_l_0, double a_l_0, double l){
   int i;
 
   double x_l = x_l_0;
@@ -92,9 +83,9 @@ void init_with_simulation(double v_ego, double x_l_0, double v_l_0, double a_l_0
     }
 
     /* printf("%.2f\t%.2f\t%.2f\t%.2f\n", t, x_ego, v_ego, a_l); */
-    acadoVariables.x[i*NX] = x_ego;
-    acadoVariables.x[i*NX+1] = v_ego;
-    acadoVariables.x[i*NX+2] = a_ego;
+    ctx->acadoVariables.x[i*NX] = x_ego;
+    ctx->acadoVariables.x[i*NX+1] = v_ego;
+    ctx->acadoVariables.x[i*NX+2] = a_ego;
 
     v_ego += a_ego * dt;
 
@@ -107,12 +98,12 @@ void init_with_simulation(double v_ego, double x_l_0, double v_l_0, double a_l_0
     t += dt;
   }
 
-  for (i = 0; i < NU * N; ++i)  acadoVariables.u[ i ] = 0.0;
-  for (i = 0; i < NY * N; ++i)  acadoVariables.y[ i ] = 0.0;
-  for (i = 0; i < NYN; ++i)  acadoVariables.yN[ i ] = 0.0;
+  for (i = 0; i < NU * N; ++i)  ctx->acadoVariables.u[ i ] = 0.0;
+  for (i = 0; i < NY * N; ++i)  ctx->acadoVariables.y[ i ] = 0.0;
+  for (i = 0; i < NYN; ++i)  ctx->acadoVariables.yN[ i ] = 0.0;
 }
 
-int run_mpc(state_t * x0, log_t * solution, double l, double a_l_0){
+int run_mpc(ACADOcontext* ctx, state_t * x0, log_t * solution, double l, double a_l_0){
   // Calculate lead vehicle predictions
   int i;
   double t = 0.;
@@ -129,8 +120,8 @@ int run_mpc(state_t * x0, log_t * solution, double l, double a_l_0){
 
     /* printf("%.2f\t%.2f\t%.2f\t%.2f\n", t, x_l, v_l, a_l); */
 
-    acadoVariables.od[i*NOD] = x_l;
-    acadoVariables.od[i*NOD+1] = v_l;
+    ctx->acadoVariables.od[i*NOD] = x_l;
+    ctx->acadoVariables.od[i*NOD+1] = v_l;
 
     solution->x_l[i] = x_l;
     solution->v_l[i] = v_l;
@@ -148,26 +139,26 @@ int run_mpc(state_t * x0, log_t * solution, double l, double a_l_0){
     t += dt;
   }
 
-  acadoVariables.x[0] = acadoVariables.x0[0] = x0->x_ego;
-  acadoVariables.x[1] = acadoVariables.x0[1] = x0->v_ego;
-  acadoVariables.x[2] = acadoVariables.x0[2] = x0->a_ego;
+  ctx->acadoVariables.x[0] = ctx->acadoVariables.x0[0] = x0->x_ego;
+  ctx->acadoVariables.x[1] = ctx->acadoVariables.x0[1] = x0->v_ego;
+  ctx->acadoVariables.x[2] = ctx->acadoVariables.x0[2] = x0->a_ego;
 
-  acado_preparationStep();
-  acado_feedbackStep();
+  acado_preparationStep(ctx);
+  acado_feedbackStep(ctx);
 
   for (i = 0; i <= N; i++){
-    solution->x_ego[i] = acadoVariables.x[i*NX];
-    solution->v_ego[i] = acadoVariables.x[i*NX+1];
-    solution->a_ego[i] = acadoVariables.x[i*NX+2];
+    solution->x_ego[i] = ctx->acadoVariables.x[i*NX];
+    solution->v_ego[i] = ctx->acadoVariables.x[i*NX+1];
+    solution->a_ego[i] = ctx->acadoVariables.x[i*NX+2];
 
     if (i < N){
-      solution->j_ego[i] = acadoVariables.u[i];
+      solution->j_ego[i] = ctx->acadoVariables.u[i];
     }
   }
-  solution->cost = acado_getObjective();
+  solution->cost = acado_getObjective(ctx);
 
   // Dont shift states here. Current solution is closer to next timestep than if
   // we shift by 0.2 seconds.
 
-  return acado_getNWSR();
+  return acado_getNWSR(ctx);
 }
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "acado_common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+  double x_ego, v_ego, a_ego, x_l, v_l, a_l;
+} state_t;
+
+
+typedef struct {
+  double x_ego[ACADO_N+1];
+  double v_ego[ACADO_N+1];
+  double a_ego[ACADO_N+1];
+  double j_ego[ACADO_N];
+  double x_l[ACADO_N+1];
+  double v_l[ACADO_N+1];
+  double a_l[ACADO_N+1];
+  double t[ACADO_N+1];
+  double cost;
+} log_t;
+
+// Every solver has its own context, created zeroed. Solvers can run at the
+// same time on different threads.
+ACADOcontext* mpc_create(void);
+void mpc_destroy(ACADOcontext* ctx);
+
+void init(ACADOcontext* ctx, double ttcCost, double distanceCost, double accelerationCost, double jerkCost);
+void init_with_simulation(ACADOcontext* ctx, double v_ego, double x_l_0, double v_l_0, double a_l_0, double l);
+int run_mpc(ACADOcontext* ctx, state_t * x0, log_t * solution, double l, double a_l_0);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,107 @@
+#include <cmath>
+#include <map>
+
+#include "longitudinal_mpc.h"
+#include "acado_auxiliary_functions.h"
+#include "acado_qpoases_interface.hpp"
+#include "../mpc_bench.h"
+
+// Times run_mpc over the calls plannerd made, recorded with MPC_RECORD set,
+// or over leads that brake and speed up without a recording.
+//   make mpc_bench && ./mpc_bench -b 2000 /data/mpc/longitudinal_mpc.bin
+
+#define RECORD_SIZE 10
+
+static std::map<int, ACADOcontext*> solvers;
+
+static ACADOcontext* solver(int k) {
+  ACADOcontext* &ctx = solvers[k];
+  if (ctx == NULL) {
+    ctx = mpc_create();
+  }
+  return ctx;
+}
+
+static void reset() {
+  for (auto &s : solvers) {
+    mpc_destroy(s.second);
+  }
+  solvers.clear();
+}
+
+static void replay(const double *rec, std::vector<MpcSolve> &solves) {
+  const int k = rec[1];
+  const double *a = rec + 2;
+  ACADOcontext* ctx = solver(k);
+
+  switch ((int)rec[0]) {
+  case MPC_CALL_INIT:
+    init(ctx, a[0], a[1], a[2], a[3]);
+    break;
+  case MPC_CALL_INIT_WITH_SIMULATION:
+    init_with_simulation(ctx, a[0], a[1], a[2], a[3], a[4]);
+    break;
+  case MPC_CALL_RUN: {
+    state_t x0 = {a[0], a[1], a[2], a[3], a[4], a[5]};
+    log_t solution;
+    MpcSolve s;
+    s.solver = k;
+    const double t = mpc_bench_now_us();
+    s.its = run_mpc(ctx, &x0, &solution, a[6], a[7]);
+    s.us = mpc_bench_now_us() - t;
+    s.kkt = acado_getKKT(ctx);
+    s.cost = solution.cost;
+    s.nan = std::isnan(s.cost);
+    for (int i = 0; i <= ACADO_N; i++) {
+      s.nan = s.nan || std::isnan(solution.a_ego[i]);
+    }
+    solves.push_back(s);
+    break;
+  }
+  }
+}
+
+// What plannerd calls with a lead that comes and goes, as a recording
+static void builtin(std::vector<double> &records) {
+  const double dt = 0.05, tau = 1.5;
+  auto add = [&records](std::vector<double> rec) {
+    rec.resize(RECORD_SIZE);
+    records.insert(records.end(), rec.begin(), rec.end());
+  };
+
+  for (int k = 0; k < 8; k++) {
+    // the planner's solvers are set up at start
+    add({MPC_CALL_INIT, (double)k, 5.0, 0.1, 10.0, 20.0});
+
+    double v_ego = 5.0 + 4.0 * k, a_ego = 0.0;
+    double x_l = 15.0 + 5.0 * k, v_l = v_ego - 3.0 + k, a_l = 0.0;
+    add({MPC_CALL_INIT_WITH_SIMULATION, (double)k, v_ego, x_l, v_l, a_l, tau});
+
+    for (int i = 0; i < 1000; i++) {
+      // a lead that brakes hard and speeds up again, cutting out for a while
+      a_l = (1.0 + 0.4 * k) * sin(i * dt * (0.3 + 0.07 * k));
+      const bool lead = (i / 200) % 3 != 2;
+      if (lead && (i % 200) == 0 && i > 0) {
+        add({MPC_CALL_INIT_WITH_SIMULATION, (double)k, v_ego, x_l, v_l, a_l, tau});
+      }
+      if (lead) {
+        add({MPC_CALL_RUN, (double)k, 0.0, v_ego, a_ego, x_l, v_l, a_l, tau, a_l});
+      } else {
+        add({MPC_CALL_RUN, (double)k, 0.0, v_ego, a_ego, 50.0, v_ego + 10.0, 0.0, tau, 0.0});
+      }
+
+      // follow roughly, the bench is about the solver not the control
+      a_ego = fmax(-3.0, fmin(1.5, 0.1 * (x_l - 10.0 - 1.8 * v_ego) + 0.5 * (v_l - v_ego)));
+      v_ego = fmax(0.0, v_ego + a_ego * dt);
+      v_l = fmax(0.0, v_l + a_l * dt);
+      x_l = fmax(2.0, x_l + (v_l - v_ego) * dt);
+    }
+  }
+}
+
+int main(int argc, char *argv[]) {
+  const int ret = mpc_bench_main("longitudinal mpc", argc, argv, RECORD_SIZE, QPOASES_NWSRMAX,
+                                 builtin, replay, reset);
+  reset();
+  return ret;
+}
@@ -0,0 +1,92 @@
+#include <cstdio>
+#include <cstring>
+#include <cmath>
+#include <cassert>
+#include <vector>
+#include <thread>
+
+#include "longitudinal_mpc.h"
+
+// Follows a different lead with every solver, first one after the other on
+// one context and then all at once on threads of their own, and checks that
+// every solution is the same bit for bit.
+
+#define SCENARIOS 8
+#define STEPS 200
+#define REPEATS 5
+
+struct Run {
+  std::vector<log_t> solutions;
+  std::vector<int> its;
+
+  Run() : solutions(STEPS), its(STEPS) {}
+};
+
+static void run_scenario(ACADOcontext* ctx, int k, Run &run) {
+  const double dt = 0.05, tau = 1.5;
+  double v_ego = 10.0 + 3.0 * k;
+  double x_l = 20.0 + 5.0 * k;
+  double v_l = v_ego - 2.0 + 0.5 * k;
+  double a_l = 0.0;
+
+  memset(run.solutions.data(), 0, STEPS * sizeof(log_t));
+  init(ctx, 5.0, 0.1, 10.0, 20.0);
+  init_with_simulation(ctx, v_ego, x_l, v_l, a_l, tau);
+
+  state_t s = {0.0, v_ego, 0.0, x_l, v_l, a_l};
+  for (int i = 0; i < STEPS; i++) {
+    a_l = (1.0 + 0.2 * k) * sin(i * dt * (0.5 + 0.1 * k));
+    s.x_ego = 0.0;
+    s.x_l = x_l;
+    s.v_l = v_l;
+    run.its[i] = run_mpc(ctx, &s, &run.solutions[i], tau, a_l);
+
+    s.v_ego = run.solutions[i].v_ego[1];
+    s.a_ego = run.solutions[i].a_ego[1];
+    v_l = fmax(0.0, v_l + a_l * dt);
+    x_l += (v_l - s.v_ego) * dt;
+  }
+}
+
+static bool same(const Run &a, const Run &b) {
+  return memcmp(a.solutions.data(), b.solutions.data(), STEPS * sizeof(log_t)) == 0 && a.its == b.its;
+}
+
+int main() {
+  std::vector<Run> serial(SCENARIOS);
+  ACADOcontext* ctx = mpc_create();
+  for (int k = 0; k < SCENARIOS; k++) {
+    run_scenario(ctx, k, serial[k]);
+  }
+  mpc_destroy(ctx);
+
+  // the same context again gives the same
+  Run again;
+  ctx = mpc_create();
+  run_scenario(ctx, 0, again);
+  assert(same(again, serial[0]));
+  mpc_destroy(ctx);
+
+  std::vector<std::thread> threads;
+  std::vector<int> ok(SCENARIOS, 1);
+  for (int k = 0; k < SCENARIOS; k++) {
+    threads.emplace_back([k, &serial, &ok] {
+      ACADOcontext* ctx = mpc_create();
+      Run run;
+      for (int r = 0; r < REPEATS; r++) {
+        run_scenario(ctx, k, run);
+        ok[k] = ok[k] && same(run, serial[k]);
+      }
+      mpc_destroy(ctx);
+    });
+  }
+  for (auto &t : threads) t.join();
+
+  for (int k = 0; k < SCENARIOS; k++) {
+    printf("lead %d: %s, %d qp iterations in the last solve, cost %f\n", k, ok[k] ? "same" : "DIFFERENT",
+           serial[k].its[STEPS - 1], serial[k].solutions[STEPS - 1].cost);
+    assert(ok[k]);
+  }
+  printf("%d solvers on threads match\n", SCENARIOS);
+  return 0;
+}
@@ -0,0 +1,220 @@
+#pragma once
+
+// Shared by the mpc_bench of every solver. The solvers are built from
+// generated code with the same symbols, so each has a bench binary of its
+// own that replays its calls and hands every solve here to be reported.
+
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <ctime>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <functional>
+
+// Calls as recorded by mpc_record.py, every record being a fixed number of
+// doubles: the call, the index of the solver it went to and its arguments.
+enum {
+  MPC_CALL_INIT = 0,
+  MPC_CALL_INIT_WITH_SIMULATION = 1,
+  MPC_CALL_RUN = 2,
+};
+
+struct MpcSolve {
+  size_t record;
+  int solver;
+  double us;
+  int its;
+  double kkt, cost;
+  bool nan;
+};
+
+static inline double mpc_bench_now_us() {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec * 1e6 + t.tv_nsec * 1e-3;
+}
+
+// Reads a recording of records of n doubles, false if it can't be read.
+static bool mpc_bench_read(const char *fn, size_t n, std::vector<double> &records) {
+  FILE *f = fopen(fn, "rb");
+  if (f == NULL) {
+    return false;
+  }
+  double rec[64];
+  while (fread(rec, sizeof(double), n, f) == n) {
+    records.insert(records.end(), rec, rec + n);
+  }
+  fclose(f);
+  return true;
+}
+
+static double mpc_bench_percentile(std::vector<double> v, double p) {
+  if (v.empty()) {
+    return NAN;
+  }
+  size_t k = std::min(v.size() - 1, (size_t)(p / 100.0 * v.size()));
+  std::nth_element(v.begin(), v.begin() + k, v.end());
+  return v[k];
+}
+
+// Counts in power of two buckets, as a bar per bucket that has any.
+static void mpc_bench_histogram(const char *unit, const std::vector<double> &v) {
+  const int buckets = 24;
+  size_t counts[buckets] = {0};
+  for (double x : v) {
+    int b = x < 1.0 ? 0 : std::min(buckets - 1, 1 + (int)log2(x));
+    counts[b]++;
+  }
+  const size_t most = *std::max_element(counts, counts + buckets);
+  for (int b = 0; b < buckets; b++) {
+    if (counts[b] == 0) {
+      continue;
+    }
+    const double lo = b == 0 ? 0.0 : ldexp(1.0, b - 1);
+    const int bar = (int)(50 * counts[b] / most);
+    printf("  %8.0f - %-8.0f %-4s %8zu %6.2f%% %.*s\n", lo, ldexp(1.0, b), unit, counts[b],
+           100.0 * counts[b] / v.size(), std::max(bar, 1),
+           "##################################################");
+  }
+}
+
+static void mpc_bench_summary(const char *name, const std::vector<double> &v) {
+  double sum = 0.0;
+  for (double x : v) sum += x;
+  printf("%-12s mean %10.4g  p50 %10.4g  p90 %10.4g  p99 %10.4g  max %10.4g\n", name, sum / v.size(),
+         mpc_bench_percentile(v, 50), mpc_bench_percentile(v, 90), mpc_bench_percentile(v, 99),
+         mpc_bench_percentile(v, 100));
+}
+
+// Prints the report and returns how many solves went over the budget, hit
+// the limit of QP iterations or gave NaNs.
+static size_t mpc_bench_report(const char *solver, const std::vector<MpcSolve> &solves,
+                               double budget_us, int max_its, FILE *csv) {
+  std::vector<double> us, its, kkt, cost;
+  std::vector<const MpcSolve*> flagged;
+  size_t over_budget = 0, at_limit = 0, nans = 0;
+  for (const MpcSolve &s : solves) {
+    us.push_back(s.us);
+    its.push_back(s.its);
+    kkt.push_back(s.kkt);
+    cost.push_back(s.cost);
+    over_budget += s.us > budget_us;
+    at_limit += s.its >= max_its;
+    nans += s.nan;
+    if (s.us > budget_us || s.its >= max_its || s.nan) {
+      flagged.push_back(&s);
+    }
+    if (csv != NULL) {
+      fprintf(csv, "%zu,%d,%.3f,%d,%.9g,%.9g,%d\n", s.record, s.solver, s.us, s.its, s.kkt, s.cost, s.nan);
+    }
+  }
+  if (solves.empty()) {
+    printf("%s: no solves\n", solver);
+    return 0;
+  }
+
+  printf("%s: %zu solves, budget %.0f us\n", solver, solves.size(), budget_us);
+  mpc_bench_summary("time (us)", us);
+  mpc_bench_summary("qp its", its);
+  mpc_bench_summary("kkt", kkt);
+  mpc_bench_summary("cost", cost);
+  printf("time:\n");
+  mpc_bench_histogram("us", us);
+  printf("qp iterations:\n");
+  mpc_bench_histogram("its", its);
+  printf("over budget %zu, at the %d iteration limit %zu, nan %zu\n", over_budget, max_its, at_limit, nans);
+
+  for (size_t i = 0; i < flagged.size() && i < 20; i++) {
+    const MpcSolve &s = *flagged[i];
+    printf("  record %zu solver %d: %.1f us, %d its, kkt %g, cost %g%s\n", s.record, s.solver, s.us, s.its,
+           s.kkt, s.cost, s.nan ? ", nan" : "");
+  }
+  if (flagged.size() > 20) {
+    printf("  ... and %zu more\n", flagged.size() - 20);
+  }
+  return flagged.size();
+}
+
+struct MpcBenchArgs {
+  const char *recording = NULL;
+  const char *csv = NULL;
+  double budget_us = 5000.0;
+  int repeats = 1;
+};
+
+static void mpc_bench_usage(const char *prog) {
+  fprintf(stderr,
+          "usage: %s [-b budget_us] [-r repeats] [-o solves.csv] [recording]\n"
+          "Replays calls recorded with MPC_RECORD set, or built in drives without\n"
+          "a recording. Exits with 1 when any solve is over the budget, hits the\n"
+          "iteration limit or gives NaNs.\n", prog);
+  exit(2);
+}
+
+static MpcBenchArgs mpc_bench_args(int argc, char *argv[]) {
+  MpcBenchArgs args;
+  for (int i = 1; i < argc; i++) {
+    std::string a = argv[i];
+    if ((a == "-b" || a == "-r" || a == "-o") && i + 1 < argc) {
+      const char *v = argv[++i];
+      if (a == "-b") args.budget_us = atof(v);
+      else if (a == "-r") args.repeats = std::max(1, atoi(v));
+      else args.csv = v;
+    } else if (a[0] != '-' && args.recording == NULL) {
+      args.recording = argv[i];
+    } else {
+      mpc_bench_usage(argv[0]);
+    }
+  }
+  return args;
+}
+
+// Replays the recording, or what builtin makes without one, repeats times.
+// reset starts over with fresh solvers and replay makes the call of one
+// record, adding a solve for every run. Returns the exit status.
+static int mpc_bench_main(const char *solver, int argc, char *argv[], size_t record_size, int max_its,
+                          std::function<void(std::vector<double>&)> builtin,
+                          std::function<void(const double*, std::vector<MpcSolve>&)> replay,
+                          std::function<void()> reset) {
+  MpcBenchArgs args = mpc_bench_args(argc, argv);
+
+  std::vector<double> records;
+  if (args.recording != NULL) {
+    if (!mpc_bench_read(args.recording, record_size, records)) {
+      fprintf(stderr, "can't read %s\n", args.recording);
+      return 2;
+    }
+  } else {
+    builtin(records);
+  }
+  const size_t n = records.size() / record_size;
+
+  std::vector<MpcSolve> solves;
+  for (int r = 0; r < args.repeats; r++) {
+    reset();
+    for (size_t i = 0; i < n; i++) {
+      const size_t before = solves.size();
+      replay(&records[i * record_size], solves);
+      for (size_t k = before; k < solves.size(); k++) {
+        solves[k].record = i;
+      }
+    }
+  }
+
+  FILE *csv = NULL;
+  if (args.csv != NULL) {
+    csv = fopen(args.csv, "w");
+    if (csv == NULL) {
+      fprintf(stderr, "can't write %s\n", args.csv);
+      return 2;
+    }
+    fprintf(csv, "record,solver,us,its,kkt,cost,nan\n");
+  }
+  const size_t flagged = mpc_bench_report(solver, solves, args.budget_us, max_its, csv);
+  if (csv != NULL) {
+    fclose(csv);
+  }
+  return flagged > 0 ? 1 : 0;
+}
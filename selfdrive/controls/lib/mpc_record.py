@@ -0,0 +1,47 @@
+import os
+import struct
+
+# Calls, as in mpc_bench.h
+INIT = 0
+INIT_WITH_SIMULATION = 1
+RUN = 2
+
+
+class RecordingLib(object):
+  """Stands in for a solver library and appends every call to fn, for
+  mpc_bench to replay. A record is record_size doubles: the call, the
+  index of the solver it went to and its arguments, as flattened by calls,
+  a dict of function name to call and a function of the arguments after
+  the context."""
+
+  def __init__(self, ffi, lib, fn, calls, record_size):
+    self.ffi = ffi
+    self.lib = lib
+    self.calls = calls
+    self.record_size = record_size
+    self.solvers = {}
+    self.f = open(fn, 'ab')
+
+  def __getattr__(self, name):
+    f = getattr(self.lib, name)
+    if name not in self.calls:
+      return f
+
+    call, flatten = self.calls[name]
+
+    def record(ctx, *args):
+      solver = self.solvers.setdefault(int(self.ffi.cast("uintptr_t", ctx)), len(self.solvers))
+      rec = [call, solver] + [float(x) for x in flatten(*args)]
+      rec += [0.0] * (self.record_size - len(rec))
+      self.f.write(struct.pack('<%dd' % self.record_size, *rec))
+      self.f.flush()
+      return f(ctx, *args)
+    return record
+
+
+def recording(ffi, lib, name, calls, record_size):
+  """lib, recording to MPC_RECORD/name.bin when MPC_RECORD is set."""
+  record_dir = os.environ.get('MPC_RECORD')
+  if not record_dir:
+    return lib
+  return RecordingLib(ffi, lib, os.path.join(record_dir, name + ".bin"), calls, record_size)
@@ -2,6 +2,7 @@ import numpy as np
 
 from common.numpy_fast import clip, interp
 from common.kalman.simple_kalman import KF1D
+from selfdrive.controls.lib.cluster.radar_cluster_py import RadarClusterer
 
 _LEAD_ACCEL_TAU = 1.5
 NO_FUSION_SCORE = 100 # bad default fusion score
@@ -113,17 +114,15 @@ class Track(object):
       self.vision = True
       self.stationary = False
 
-  def get_key_for_cluster(self):
-    # Weigh y higher since radar is inaccurate in this dimension
-    return [self.dRel, self.yRel*2, self.vRel]
-
 
 def mean(l):
   return sum(l) / len(l)
 
 
 class Cluster(object):
-  def __init__(self):
+  def __init__(self, cluster_id):
+    # kept from frame to frame while most of its tracks stay together
+    self.cluster_id = cluster_id
     self.tracks = set()
 
   def add(self, t):
@@ -208,7 +207,7 @@ class Cluster(object):
     }
 
   def __str__(self):
-    ret = "x: %4.1f  y: %4.1f  v: %4.1f  a: %4.1f  d: %4.2f" % (self.dRel, self.yRel, self.vRel, self.aLeadK, self.dPath)
+    ret = "id: %4d  x: %4.1f  y: %4.1f  v: %4.1f  a: %4.1f  d: %4.2f" % (self.cluster_id, self.dRel, self.yRel, self.vRel, self.aLeadK, self.dPath)
     if self.stationary:
       ret += " stationary"
     if self.vision:
@@ -257,3 +256,84 @@ class Cluster(object):
     # is this cluster trustrable enough for triggering fcw?
     # fcw can trigger only on clusters that have been fused vision model for at least 20 frames
     return self.vision_cnt >= 20
+
+
+class RadarTracker(object):
+  """The tracks of radard, from the radar points of every cycle to the leads.
+  NativeRadarTracker of radar_tracker does the same for all tracks at once."""
+
+  def __init__(self):
+    self.tracks = {}
+    self.clusterer = RadarClusterer()
+
+  def update(self, ar_pts, vision_pt, path_x, path_y, v_ego, v_ego_t_aligned, steer_override):
+    """ar_pts are dRel, yRel, vRel and measured of the radar points by track
+    id, vision_pt dRel, yRel and vRel of the vision lead or None. Returns
+    leadOne and leadTwo of radarState, None without a lead, and liveTracks."""
+    # *** remove missing points from meta data ***
+    for ids in self.tracks.keys():
+      if ids not in ar_pts:
+        self.tracks.pop(ids, None)
+
+    # *** compute the tracks ***
+    for ids in ar_pts:
+      rpt = ar_pts[ids]
+
+      d_path = np.sqrt(np.amin((path_x - rpt[0]) ** 2 + (path_y - rpt[1]) ** 2))
+      # add sign
+      d_path *= np.sign(rpt[1] - np.interp(rpt[0], path_x, path_y))
+
+      # create the track if it doesn't exist or it's a new track
+      if ids not in self.tracks:
+        self.tracks[ids] = Track()
+      self.tracks[ids].update(rpt[0], rpt[1], rpt[2], d_path, v_ego_t_aligned, rpt[3], steer_override)
+
+    # allow the vision model to remove the stationary flag if distance and rel speed roughly match
+    if vision_pt is not None:
+      fused_id = None
+      best_score = NO_FUSION_SCORE
+      for ids in self.tracks:
+        dist_to_vision = np.sqrt((0.5*(vision_pt[0] - self.tracks[ids].dRel)) ** 2 + (2*(vision_pt[1] - self.tracks[ids].yRel)) ** 2)
+        rel_speed_diff = abs(vision_pt[2] - self.tracks[ids].vRel)
+        self.tracks[ids].update_vision_score(dist_to_vision, rel_speed_diff)
+        if best_score > self.tracks[ids].vision_score:
+          fused_id = ids
+          best_score = self.tracks[ids].vision_score
+
+      if fused_id is not None:
+        self.tracks[fused_id].vision_cnt += 1
+        self.tracks[fused_id].update_vision_fusion()
+
+    # cluster the tracks, clusters keep their id while their tracks stay together
+    idens = list(self.tracks.keys())
+    track_pts = [[self.tracks[iden].dRel, self.tracks[iden].yRel, self.tracks[iden].vRel] for iden in idens]
+    cluster_idxs, cluster_ids = self.clusterer.update(idens, track_pts)
+    clusters = [Cluster(cluster_id) for cluster_id in cluster_ids]
+    for idx in xrange(len(idens)):
+      clusters[cluster_idxs[idx]].add(self.tracks[idens[idx]])
+
+    # *** extract the lead car ***
+    lead_clusters = [c for c in clusters
+                     if c.is_potential_lead(v_ego)]
+    lead_clusters.sort(key=lambda x: x.dRel)
+
+    # *** extract the second lead from the whole set of leads ***
+    lead2_clusters = [c for c in lead_clusters
+                      if c.is_potential_lead2(lead_clusters)]
+    lead2_clusters.sort(key=lambda x: x.dRel)
+
+    lead_one = lead_clusters[0].toRadarState() if len(lead_clusters) > 0 else None
+    lead_two = lead2_clusters[0].toRadarState() if len(lead2_clusters) > 0 else None
+
+    live_tracks = []
+    for ids in self.tracks:
+      live_tracks.append({
+        "trackId": ids,
+        "dRel": float(self.tracks[ids].dRel),
+        "yRel": float(self.tracks[ids].yRel),
+        "vRel": float(self.tracks[ids].vRel),
+        "aRel": float(self.tracks[ids].aRel),
+        "stationary": bool(self.tracks[ids].stationary),
+        "oncoming": bool(self.tracks[ids].oncoming),
+      })
+    return lead_one, lead_two, live_tracks
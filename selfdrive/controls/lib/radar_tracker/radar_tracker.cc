@@ -0,0 +1,397 @@
+#include <cmath>
+#include <cstdint>
+#include <vector>
+#include <algorithm>
+#include <utility>
+
+#include "radar_cluster.h"
+#include "radar_tracker.h"
+
+// Everything is evaluated as radar_helpers.py and radard.py do, in the same
+// order, so tracks are the same to the bit. Cluster means only differ in the
+// order Python sums the set of tracks.
+
+namespace {
+
+const double RATE = 20.;  // model and radar are both at 20Hz
+const double TS = 1. / RATE;
+const double FREQ_V_LAT = 0.2;  // Hz
+const double K_V_LAT = 2 * M_PI * FREQ_V_LAT * TS / (1 + 2 * M_PI * FREQ_V_LAT * TS);
+const double FREQ_A_LEAD = .5;  // Hz
+const double K_A_LEAD = 2 * M_PI * FREQ_A_LEAD * TS / (1 + 2 * M_PI * FREQ_A_LEAD * TS);
+
+// stationary qualification parameters
+const double V_STATIONARY_THR = 4.;
+const double V_ONCOMING_THR = -3.9;
+const double V_EGO_STATIONARY = 4.;
+
+const double LEAD_ACCEL_TAU = 1.5;
+const double NO_FUSION_SCORE = 100.;
+const double RDR_TO_LDR = 2.7;
+
+// lead Kalman filter of speed and acceleration with the steady state gain,
+// A - K C as KF1D keeps it
+const double VLEAD_K0 = 0.1988689, VLEAD_K1 = 0.28555364;
+const double VLEAD_A_K_0 = 1.0 - VLEAD_K0 * 1.0;
+const double VLEAD_A_K_1 = TS - VLEAD_K0 * 0.0;
+const double VLEAD_A_K_2 = 0.0 - VLEAD_K1 * 1.0;
+const double VLEAD_A_K_3 = 1.0 - VLEAD_K1 * 0.0;
+
+double clip(double x, double lo, double hi) {
+  return std::max(lo, std::min(hi, x));
+}
+
+// numpy.interp
+double np_interp(double x, const double *xp, const double *fp, int n) {
+  // NaN fails both compares and upper_bound would put it past the end
+  if (std::isnan(x)) return NAN;
+  if (x < xp[0]) return fp[0];
+  if (x >= xp[n - 1]) return fp[n - 1];
+  const int j = std::upper_bound(xp, xp + n, x) - xp - 1;
+  const double slope = (fp[j + 1] - fp[j]) / (xp[j + 1] - xp[j]);
+  return slope * (x - xp[j]) + fp[j];
+}
+
+double np_sign(double x) {
+  return x > 0. ? 1. : x < 0. ? -1. : x;
+}
+
+// the tracks, one array for each value of Track
+struct Tracks {
+  std::vector<int> id;
+  std::vector<double> d_rel, y_rel, v_rel, d_path;
+  std::vector<double> v_lead, a_rel, v_lat, v_lead_k, a_lead_k, a_lead_tau;
+  std::vector<int> vision_cnt;
+  std::vector<char> measured, stationary, oncoming, vision, initted;
+
+  void resize(int n) {
+    id.resize(n);
+    for (auto v : {&d_rel, &y_rel, &v_rel, &d_path, &v_lead, &a_rel, &v_lat, &v_lead_k, &a_lead_k, &a_lead_tau}) {
+      v->resize(n);
+    }
+    vision_cnt.resize(n);
+    for (auto v : {&measured, &stationary, &oncoming, &vision, &initted}) {
+      v->resize(n);
+    }
+  }
+};
+
+// the means of the tracks in a cluster, as Cluster
+struct Cluster {
+  int n;
+  double d_rel, y_rel, v_rel, a_rel, v_lead, d_path, v_lat, v_lead_k, a_lead_k, a_lead_tau;
+  bool vision, measured, stationary, oncoming;
+  int vision_cnt;
+};
+
+class RadarTracker {
+public:
+  RadarTracker() {
+    RadarClusterConfig config;
+    radar_cluster_default_config(&config);
+    clusterer = radar_cluster_init(&config);
+  }
+
+  ~RadarTracker() {
+    radar_cluster_free(clusterer);
+  }
+
+  void update(const RadarTrackerInput &in, RadarTrackerLead &lead_one, RadarTrackerLead &lead_two,
+              RadarTrackerTrack *out) {
+    const int n = in.n;
+    birth_and_death(in);
+    step(in);
+    if (in.vision) {
+      fuse_vision(in);
+    }
+    cluster(n);
+    pick_leads(in.v_ego, lead_one, lead_two);
+
+    for (int i = 0; i < n; i++) {
+      out[i].a_rel = t.a_rel[i];
+      out[i].stationary = t.stationary[i];
+      out[i].oncoming = t.oncoming[i];
+    }
+  }
+
+private:
+  // tracks of points that are still there carry on, in the order of the points
+  void birth_and_death(const RadarTrackerInput &in) {
+    const int n = in.n;
+    std::swap(t, last);
+    slots.clear();
+    for (int i = 0; i < (int)last.id.size(); i++) {
+      slots.push_back(std::make_pair(last.id[i], i));
+    }
+    std::sort(slots.begin(), slots.end());
+
+    t.resize(n);
+    d_path_prev.resize(n);
+    v_rel_prev.resize(n);
+    for (int i = 0; i < n; i++) {
+      t.id[i] = in.track_ids[i];
+      auto it = std::lower_bound(slots.begin(), slots.end(), std::make_pair(in.track_ids[i], INT32_MIN));
+      if (it != slots.end() && it->first == in.track_ids[i]) {
+        const int j = it->second;
+        t.initted[i] = true;
+        d_path_prev[i] = last.d_path[j];
+        v_rel_prev[i] = last.v_rel[j];
+        t.a_rel[i] = last.a_rel[j];
+        t.v_lat[i] = last.v_lat[j];
+        t.v_lead_k[i] = last.v_lead_k[j];
+        t.a_lead_k[i] = last.a_lead_k[j];
+        t.a_lead_tau[i] = last.a_lead_tau[j];
+        t.vision_cnt[i] = last.vision_cnt[j];
+        t.stationary[i] = last.stationary[j];
+        t.vision[i] = last.vision[j];
+      } else {
+        t.initted[i] = false;
+        d_path_prev[i] = 0.;
+        v_rel_prev[i] = 0.;
+        t.a_rel[i] = 0.;  // nidec gives no information about this
+        t.v_lat[i] = 0.;
+        t.v_lead_k[i] = 0.;
+        t.a_lead_k[i] = 0.;
+        t.a_lead_tau[i] = LEAD_ACCEL_TAU;
+        t.vision_cnt[i] = 0;
+        t.stationary[i] = true;
+        t.vision[i] = false;
+      }
+    }
+  }
+
+  // signed distance of a point to the closest point of the path
+  double path_distance(const RadarTrackerInput &in, double d_rel, double y_rel) const {
+    // points further along x than the closest so far can't be closer
+    const int n = in.n_path;
+    const int k = std::min(std::max(int(std::lower_bound(in.path_x, in.path_x + n, d_rel) - in.path_x), 0), n - 1);
+    double best = INFINITY;
+    for (int j = k; j < n; j++) {
+      const double dx = in.path_x[j] - d_rel, dy = in.path_y[j] - y_rel;
+      if (dx * dx > best) break;
+      best = std::min(best, dx * dx + dy * dy);
+    }
+    for (int j = k - 1; j >= 0; j--) {
+      const double dx = in.path_x[j] - d_rel, dy = in.path_y[j] - y_rel;
+      if (dx * dx > best) break;
+      best = std::min(best, dx * dx + dy * dy);
+    }
+    return std::sqrt(best) * np_sign(y_rel - np_interp(d_rel, in.path_x, in.path_y, n));
+  }
+
+  // Track.update of all tracks
+  void step(const RadarTrackerInput &in) {
+    const int n = in.n;
+    for (int i = 0; i < n; i++) {
+      t.d_rel[i] = in.d_rel[i];
+      t.y_rel[i] = in.y_rel[i];
+      t.v_rel[i] = in.v_rel[i];
+      t.measured[i] = in.measured[i];
+      t.d_path[i] = path_distance(in, in.d_rel[i], in.y_rel[i]);
+    }
+
+    const double v_ego = in.v_ego_t_aligned;
+    for (int i = 0; i < n; i++) {
+      const double v_lead = t.v_rel[i] + v_ego;
+      t.v_lead[i] = v_lead;
+
+      // TODO: use Kalman filter
+      const double a_rel_unfilt = clip((t.v_rel[i] - v_rel_prev[i]) / TS, -10., 10.);
+      const double a_rel = K_A_LEAD * a_rel_unfilt + (1 - K_A_LEAD) * t.a_rel[i];
+      // neglect steer override cases as dPath is too noisy
+      const double v_lat_unfilt = in.steer_override ? 0. : (t.d_path[i] - d_path_prev[i]) / TS;
+      const double v_lat = K_V_LAT * v_lat_unfilt + (1 - K_V_LAT) * t.v_lat[i];
+
+      const double x0 = t.v_lead_k[i], x1 = t.a_lead_k[i];
+      const double v_lead_k = VLEAD_A_K_0 * x0 + VLEAD_A_K_1 * x1 + VLEAD_K0 * v_lead;
+      const double a_lead_k = VLEAD_A_K_2 * x0 + VLEAD_A_K_3 * x1 + VLEAD_K1 * v_lead;
+
+      // new tracks start the filters
+      const bool initted = t.initted[i];
+      t.a_rel[i] = initted ? a_rel : 0.;
+      t.v_lat[i] = initted ? v_lat : 0.;
+      t.v_lead_k[i] = initted ? v_lead_k : v_lead;
+      t.a_lead_k[i] = initted ? a_lead_k : 0.;
+
+      // stationary objects can become non stationary, but not the other way around
+      t.stationary[i] = t.stationary[i] && v_ego > V_EGO_STATIONARY && std::abs(v_lead) < V_STATIONARY_THR;
+      t.oncoming[i] = v_lead < V_ONCOMING_THR;
+
+      // Learn if constant acceleration
+      t.a_lead_tau[i] = std::abs(t.a_lead_k[i]) < 0.5 ? LEAD_ACCEL_TAU : t.a_lead_tau[i] * 0.9;
+    }
+  }
+
+  // the vision lead removes the stationary flag of the closest track, if
+  // distance and rel speed roughly match
+  void fuse_vision(const RadarTrackerInput &in) {
+    int fused = -1;
+    double best_score = NO_FUSION_SCORE;
+    for (int i = 0; i < in.n; i++) {
+      const double dd = 0.5 * (in.vision_d_rel - t.d_rel[i]), dy = 2 * (in.vision_y_rel - t.y_rel[i]);
+      const double dist_to_vision = std::sqrt(dd * dd + dy * dy);
+      const double rel_speed_diff = std::abs(in.vision_v_rel - t.v_rel[i]);
+      // rel speed is very hard to estimate from vision
+      const double score = dist_to_vision < 4.0 && rel_speed_diff < 10. ? dist_to_vision + rel_speed_diff
+                                                                          : NO_FUSION_SCORE;
+      if (best_score > score) {
+        fused = i;
+        best_score = score;
+      }
+    }
+
+    if (fused >= 0) {
+      t.vision_cnt[fused]++;
+      // vision point is never stationary
+      // don't trust 1 or 2 fusions until model quality is much better
+      if (t.vision_cnt[fused] >= 3) {
+        t.vision[fused] = true;
+        t.stationary[fused] = false;
+      }
+    }
+  }
+
+  void cluster(int n) {
+    pts.resize(n * 3);
+    for (int i = 0; i < n; i++) {
+      pts[i * 3 + 0] = t.d_rel[i];
+      pts[i * 3 + 1] = t.y_rel[i];
+      pts[i * 3 + 2] = t.v_rel[i];
+    }
+    labels.resize(n);
+    cluster_ids.resize(n);
+    const int n_clusters = radar_cluster_update(clusterer, n, t.id.data(), pts.data(), labels.data(),
+                                                cluster_ids.data());
+
+    clusters.assign(n_clusters, Cluster{0, 0., 0., 0., 0., 0., 0., 0., 0., 0., 0., false, false, true, true, 0});
+    for (int i = 0; i < n; i++) {
+      Cluster &c = clusters[labels[i]];
+      c.n++;
+      c.d_rel += t.d_rel[i];
+      c.y_rel += t.y_rel[i];
+      c.v_rel += t.v_rel[i];
+      c.a_rel += t.a_rel[i];
+      c.v_lead += t.v_lead[i];
+      c.d_path += t.d_path[i];
+      c.v_lat += t.v_lat[i];
+      c.v_lead_k += t.v_lead_k[i];
+      c.a_lead_k += t.a_lead_k[i];
+      c.a_lead_tau += t.a_lead_tau[i];
+      c.vision = c.vision || t.vision[i];
+      c.measured = c.measured || t.measured[i];
+      c.stationary = c.stationary && t.stationary[i];
+      c.oncoming = c.oncoming && t.oncoming[i];
+      c.vision_cnt = std::max(c.vision_cnt, t.vision_cnt[i]);
+    }
+    for (Cluster &c : clusters) {
+      for (double *v : {&c.d_rel, &c.y_rel, &c.v_rel, &c.a_rel, &c.v_lead, &c.d_path, &c.v_lat, &c.v_lead_k,
+                        &c.a_lead_k, &c.a_lead_tau}) {
+        *v /= c.n;
+      }
+    }
+  }
+
+  static bool is_potential_lead(const Cluster &c, double v_ego) {
+    // predict cut-ins by extrapolating lateral speed by a lookahead time
+    // lookahead time depends on cut-in distance. more attentive for close cut-ins
+    // also, above 50 meters the predicted path isn't very reliable
+
+    // the distance at which v_lat matters is higher at higher speed
+    const double lookahead_dist = 40. + v_ego / 1.2;  // 40m at 0mph, ~70m at 80mph
+
+    // interp(dRel, [10., lookahead_dist], [1., 0.]) of numpy_fast
+    double t_lookahead;
+    if (c.d_rel > lookahead_dist && c.d_rel > 10.) {
+      t_lookahead = 0.;
+    } else if (!(c.d_rel > 10.)) {
+      t_lookahead = 1.;
+    } else {
+      t_lookahead = (c.d_rel - 10.) * (0. - 1.) / (lookahead_dist - 10.) + 1.;
+    }
+
+    // correct d_path for lookahead time, considering only cut-ins and no more than 1m impact.
+    const double lat_corr = c.measured ? clip(t_lookahead * c.v_lat, -1., 1.) : 0.;
+
+    // consider only cut-ins
+    const double d_path = clip(c.d_path + lat_corr, c.d_path < 0. ? c.d_path : 0., c.d_path > 0. ? c.d_path : 0.);
+
+    return std::abs(d_path) < 1.5 && !c.stationary && !c.oncoming;
+  }
+
+  static void to_lead(const Cluster &c, RadarTrackerLead &lead) {
+    lead.status = true;
+    lead.d_rel = c.d_rel - RDR_TO_LDR;
+    lead.y_rel = c.y_rel;
+    lead.v_rel = c.v_rel;
+    lead.a_rel = c.a_rel;
+    lead.v_lead = c.v_lead;
+    lead.d_path = c.d_path;
+    lead.v_lat = c.v_lat;
+    lead.v_lead_k = c.v_lead_k;
+    lead.a_lead_k = c.a_lead_k;
+    lead.a_lead_tau = c.a_lead_tau;
+    // fcw can trigger only on clusters that have been fused vision model for at least 20 frames
+    lead.fcw = c.vision_cnt >= 20;
+  }
+
+  void pick_leads(double v_ego, RadarTrackerLead &lead_one, RadarTrackerLead &lead_two) {
+    lead_one = RadarTrackerLead{};
+    lead_two = RadarTrackerLead{};
+
+    leads.clear();
+    for (int i = 0; i < (int)clusters.size(); i++) {
+      if (is_potential_lead(clusters[i], v_ego)) {
+        leads.push_back(i);
+      }
+    }
+    if (leads.empty()) {
+      return;
+    }
+    auto by_d_rel = [&](int a, int b) { return clusters[a].d_rel < clusters[b].d_rel; };
+    std::stable_sort(leads.begin(), leads.end(), by_d_rel);
+    const Cluster &lead = clusters[leads[0]];
+    to_lead(lead, lead_one);
+
+    // the second lead, if it isn't too close and roughly at the same speed of
+    // the first lead: it might just be the second axle of the same vehicle
+    int lead2 = -1;
+    for (int i : leads) {
+      const Cluster &c = clusters[i];
+      if (((c.d_rel - lead.d_rel) > 8. || std::abs(c.v_rel - lead.v_rel) > 1.) &&
+          (lead2 < 0 || by_d_rel(i, lead2))) {
+        lead2 = i;
+      }
+    }
+    if (lead2 >= 0) {
+      to_lead(clusters[lead2], lead_two);
+    }
+  }
+
+  Tracks t, last;
+  std::vector<std::pair<int, int> > slots;
+  std::vector<double> d_path_prev, v_rel_prev;
+
+  void *clusterer;
+  std::vector<double> pts;
+  std::vector<int> labels, cluster_ids, leads;
+  std::vector<Cluster> clusters;
+};
+
+}  // namespace
+
+extern "C" {
+
+void* radar_tracker_init(void) {
+  return new RadarTracker();
+}
+
+void radar_tracker_free(void* tracker) {
+  delete (RadarTracker*)tracker;
+}
+
+void radar_tracker_update(void* tracker, const RadarTrackerInput *input, RadarTrackerLead *lead_one,
+                          RadarTrackerLead *lead_two, RadarTrackerTrack *tracks) {
+  ((RadarTracker*)tracker)->update(*input, *lead_one, *lead_two, tracks);
+}
+
+}
@@ -0,0 +1,63 @@
+#ifndef RADAR_TRACKER_H
+#define RADAR_TRACKER_H
+
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// The tracks of radard: the Track and Cluster of radar_helpers.py for all
+// radar points at once. Tracks are kept as arrays of each value, so a cycle
+// steps the lead Kalman filters and filters of all tracks in one loop, then
+// fuses the vision lead, clusters the tracks with radar_cluster and picks
+// the leads.
+
+typedef struct RadarTrackerInput {
+  // the radar points of the cycle, dRel from the lidar as radard
+  int n;
+  const int *track_ids;
+  const double *d_rel, *y_rel, *v_rel;
+  const bool *measured;
+
+  // the vision lead, when the model has one
+  bool vision;
+  double vision_d_rel, vision_y_rel, vision_v_rel;
+
+  // the likely path, path_x ascending
+  int n_path;
+  const double *path_x, *path_y;
+
+  double v_ego;
+  // v_ego at the time of the radar measurement
+  double v_ego_t_aligned;
+  bool steer_override;
+} RadarTrackerInput;
+
+typedef struct RadarTrackerLead {
+  bool status;
+  double d_rel, y_rel, v_rel, a_rel;
+  double v_lead, d_path, v_lat;
+  double v_lead_k, a_lead_k, a_lead_tau;
+  bool fcw;
+} RadarTrackerLead;
+
+typedef struct RadarTrackerTrack {
+  double a_rel;
+  bool stationary, oncoming;
+} RadarTrackerTrack;
+
+void* radar_tracker_init(void);
+void radar_tracker_free(void* tracker);
+
+// Tracks the points of a cycle. Tracks of points that are gone die, new
+// points start tracks. Writes the two leads, and the track of every point to
+// tracks, in the order of the points.
+void radar_tracker_update(void* tracker, const RadarTrackerInput *input, RadarTrackerLead *lead_one,
+                          RadarTrackerLead *lead_two, RadarTrackerTrack *tracks);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
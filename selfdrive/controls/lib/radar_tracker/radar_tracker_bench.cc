@@ -0,0 +1,125 @@
+#include <cassert>
+#include <cstdio>
+#include <cmath>
+#include <ctime>
+#include <vector>
+#include <random>
+
+extern "C" {
+#include "radar_tracker.h"
+}
+
+// Runs radar_tracker over synthetic drives with growing numbers of radar
+// points and a path as radard has, 140 m in steps of 0.1 m, and times a
+// cycle. The car ahead in the lane has to come out as leadOne.
+
+#define CYCLES 2000
+#define DT 0.05
+#define PATH_POINTS 1400
+
+static double cpu_us() {
+  struct timespec t;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &t);
+  return t.tv_sec * 1e6 + t.tv_nsec * 1e-3;
+}
+
+struct Car {
+  double d, y, v;
+  int first_track;
+};
+
+static void bench(int n_points, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> uniform(0., 1.);
+  std::normal_distribution<double> noise(0., 1.);
+
+  // a gentle curve to the left
+  std::vector<double> path_x(PATH_POINTS), path_y(PATH_POINTS);
+  for (int i = 0; i < PATH_POINTS; i++) {
+    path_x[i] = 0.1 * i;
+    path_y[i] = 1e-3 * path_x[i] * path_x[i];
+  }
+
+  // the lead in the lane with two points, the rest are cars in other lanes
+  // and clutter by the road
+  const double v_ego = 25.;
+  std::vector<Car> cars;
+  cars.push_back({30., 0., -1., 0});
+  int next_track = 2;
+  while (next_track < n_points) {
+    const double lane = uniform(gen) < 0.5 ? -3.7 : 3.7;
+    cars.push_back({10. + 130. * uniform(gen), lane * (1 + (int)(2 * uniform(gen))), -5. + 10. * uniform(gen),
+                    next_track});
+    next_track += 2;
+  }
+
+  void *tracker = radar_tracker_init();
+  std::vector<int> track_ids;
+  std::vector<double> d_rel, y_rel, v_rel;
+  std::vector<char> measured;
+  std::vector<RadarTrackerTrack> tracks(n_points);
+  RadarTrackerLead lead_one, lead_two;
+
+  double t = 0.;
+  int lead_found = 0;
+  for (int cycle = 0; cycle < CYCLES; cycle++) {
+    track_ids.clear();
+    d_rel.clear();
+    y_rel.clear();
+    v_rel.clear();
+    measured.clear();
+    for (Car &c : cars) {
+      c.d += c.v * DT;
+      if (c.d < 5. || c.d > 140.) {
+        c.d = c.d < 5. ? 140. : 5.;
+      }
+      for (int k = 0; k < 2 && (int)track_ids.size() < n_points; k++) {
+        const double d = c.d + 0.8 * k + 0.1 * noise(gen);
+        track_ids.push_back(c.first_track + k);
+        d_rel.push_back(d);
+        y_rel.push_back(1e-3 * d * d + c.y + 0.1 * noise(gen));
+        v_rel.push_back(c.v + 0.1 * noise(gen));
+        measured.push_back(uniform(gen) < 0.9);
+      }
+    }
+
+    RadarTrackerInput input = {};
+    input.n = track_ids.size();
+    input.track_ids = track_ids.data();
+    input.d_rel = d_rel.data();
+    input.y_rel = y_rel.data();
+    input.v_rel = v_rel.data();
+    input.measured = (const bool *)measured.data();
+    input.vision = true;
+    input.vision_d_rel = cars[0].d;
+    input.vision_y_rel = 1e-3 * cars[0].d * cars[0].d;
+    input.vision_v_rel = cars[0].v;
+    input.n_path = PATH_POINTS;
+    input.path_x = path_x.data();
+    input.path_y = path_y.data();
+    input.v_ego = v_ego;
+    input.v_ego_t_aligned = v_ego;
+    input.steer_override = false;
+
+    const double t0 = cpu_us();
+    radar_tracker_update(tracker, &input, &lead_one, &lead_two, tracks.data());
+    t += cpu_us() - t0;
+
+    // leadOne is the middle of the two points, with RDR_TO_LDR taken off again
+    lead_found += lead_one.status && std::abs(lead_one.d_rel - (cars[0].d + 0.4 - 2.7)) < 1.;
+  }
+  radar_tracker_free(tracker);
+
+  // the lead wraps around the field of view, which takes some cycles to settle
+  assert(lead_found > CYCLES * 9 / 10);
+  printf("%3d points: %6.1f us a cycle, lead found in %.1f%% of cycles\n",
+         n_points, t / CYCLES, 100. * lead_found / CYCLES);
+}
+
+int main() {
+  static_assert(sizeof(bool) == sizeof(char), "measured is passed as chars");
+  for (int n_points : {16, 32, 64}) {
+    bench(n_points, 1337);
+  }
+  return 0;
+}
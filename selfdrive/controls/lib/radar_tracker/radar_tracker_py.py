@@ -0,0 +1,123 @@
+import os
+import subprocess
+import numpy as np
+
+from cffi import FFI
+
+tracker_dir = os.path.dirname(os.path.abspath(__file__))
+subprocess.check_call(["make", "libradar_tracker.so"], cwd=tracker_dir)
+
+ffi = FFI()
+ffi.cdef("""
+typedef struct RadarTrackerInput {
+  int n;
+  const int *track_ids;
+  const double *d_rel, *y_rel, *v_rel;
+  const bool *measured;
+
+  bool vision;
+  double vision_d_rel, vision_y_rel, vision_v_rel;
+
+  int n_path;
+  const double *path_x, *path_y;
+
+  double v_ego;
+  double v_ego_t_aligned;
+  bool steer_override;
+} RadarTrackerInput;
+
+typedef struct RadarTrackerLead {
+  bool status;
+  double d_rel, y_rel, v_rel, a_rel;
+  double v_lead, d_path, v_lat;
+  double v_lead_k, a_lead_k, a_lead_tau;
+  bool fcw;
+} RadarTrackerLead;
+
+typedef struct RadarTrackerTrack {
+  double a_rel;
+  bool stationary, oncoming;
+} RadarTrackerTrack;
+
+void* radar_tracker_init(void);
+void radar_tracker_free(void* tracker);
+void radar_tracker_update(void* tracker, const RadarTrackerInput *input, RadarTrackerLead *lead_one,
+                          RadarTrackerLead *lead_two, RadarTrackerTrack *tracks);
+""")
+
+libradar_tracker = ffi.dlopen(os.path.join(tracker_dir, "libradar_tracker.so"))
+
+
+def _lead(lead):
+  if not lead.status:
+    return None
+  return {
+    "dRel": lead.d_rel,
+    "yRel": lead.y_rel,
+    "vRel": lead.v_rel,
+    "aRel": lead.a_rel,
+    "vLead": lead.v_lead,
+    "dPath": lead.d_path,
+    "vLat": lead.v_lat,
+    "vLeadK": lead.v_lead_k,
+    "aLeadK": lead.a_lead_k,
+    "status": True,
+    "fcw": lead.fcw,
+    "aLeadTau": lead.a_lead_tau
+  }
+
+
+class NativeRadarTracker(object):
+  """RadarTracker of radar_helpers, with the tracks in radar_tracker"""
+
+  def __init__(self):
+    self.tracker = ffi.gc(libradar_tracker.radar_tracker_init(), libradar_tracker.radar_tracker_free)
+
+  def update(self, ar_pts, vision_pt, path_x, path_y, v_ego, v_ego_t_aligned, steer_override):
+    idens = list(ar_pts.keys())
+    pts = [ar_pts[iden] for iden in idens]
+    n = len(idens)
+
+    # the arrays have to live as long as inp points to them
+    track_ids = ffi.new("int[]", idens)
+    d_rel = ffi.new("double[]", [pt[0] for pt in pts])
+    y_rel = ffi.new("double[]", [pt[1] for pt in pts])
+    v_rel = ffi.new("double[]", [pt[2] for pt in pts])
+    measured = ffi.new("bool[]", [bool(pt[3]) for pt in pts])
+    path_x = np.ascontiguousarray(path_x, dtype=np.float64)
+    path_y = np.ascontiguousarray(path_y, dtype=np.float64)
+
+    inp = ffi.new("RadarTrackerInput *")
+    inp.n = n
+    inp.track_ids = track_ids
+    inp.d_rel = d_rel
+    inp.y_rel = y_rel
+    inp.v_rel = v_rel
+    inp.measured = measured
+    if vision_pt is not None:
+      inp.vision = True
+      inp.vision_d_rel, inp.vision_y_rel, inp.vision_v_rel = vision_pt[0], vision_pt[1], vision_pt[2]
+    inp.n_path = len(path_x)
+    inp.path_x = ffi.cast("double *", path_x.ctypes.data)
+    inp.path_y = ffi.cast("double *", path_y.ctypes.data)
+    inp.v_ego = v_ego
+    inp.v_ego_t_aligned = v_ego_t_aligned
+    inp.steer_override = steer_override
+
+    lead_one = ffi.new("RadarTrackerLead *")
+    lead_two = ffi.new("RadarTrackerLead *")
+    tracks = ffi.new("RadarTrackerTrack[]", n)
+    libradar_tracker.radar_tracker_update(self.tracker, inp, lead_one, lead_two, tracks)
+
+    live_tracks = []
+    for i in xrange(n):
+      live_tracks.append({
+        "trackId": idens[i],
+        "dRel": float(pts[i][0]),
+        "yRel": float(pts[i][1]),
+        "vRel": float(pts[i][2]),
+        "aRel": tracks[i].a_rel,
+        "stationary": tracks[i].stationary,
+        "oncoming": tracks[i].oncoming,
+      })
+    return _lead(lead_one), _lead(lead_two), live_tracks
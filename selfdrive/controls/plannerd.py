@@ -1,4 +1,5 @@
 #!/usr/bin/env python
+import os
 import gc
 
 from cereal import car
@@ -10,6 +11,9 @@ from selfdrive.controls.lib.vehicle_model import VehicleModel
 from selfdrive.controls.lib.pathplanner import PathPlanner
 import selfdrive.messaging as messaging
 
+# pathplannerd plans the path instead
+NATIVE_PATH_PLANNER = os.getenv("NATIVE_PATH_PLANNER") is not None
+
 
 def plannerd_thread():
   gc.disable()
@@ -27,7 +31,7 @@ def plannerd_thread():
   cloudlog.info("plannerd got CarParams: %s", CP.carName)
 
   PL = Planner(CP, fcw_enabled)
-  PP = PathPlanner(CP)
+  PP = None if NATIVE_PATH_PLANNER else PathPlanner(CP)
 
   VM = VehicleModel(CP)
 
@@ -43,7 +47,7 @@ def plannerd_thread():
   while True:
     sm.update()
 
-    if sm.updated['model']:
+    if sm.updated['model'] and PP is not None:
       PP.update(sm, CP, VM)
     if sm.updated['radarState']:
       PL.update(sm, CP, VM, PP, live_map_data.liveMapData)
@@ -2,16 +2,14 @@
 import numpy as np
 import numpy.matlib
 import importlib
-from collections import defaultdict, deque
+from collections import deque
 
 import selfdrive.messaging as messaging
 from selfdrive.services import service_list
 from selfdrive.controls.lib.latcontrol_helpers import calc_lookahead_offset
 from selfdrive.controls.lib.model_parser import ModelParser
-from selfdrive.controls.lib.radar_helpers import Track, Cluster, \
-                                                 RDR_TO_LDR, NO_FUSION_SCORE
-
-from selfdrive.controls.lib.cluster.fastcluster_py import cluster_points_centroid
+from selfdrive.controls.lib.radar_helpers import RDR_TO_LDR
+from selfdrive.controls.lib.radar_tracker.radar_tracker_py import NativeRadarTracker
 from selfdrive.controls.lib.vehicle_model import VehicleModel
 from selfdrive.swaglog import cloudlog
 from cereal import car
@@ -88,7 +86,7 @@ def radard_thread(gctx=None):
   steer_angle = 0.
   steer_override = False
 
-  tracks = defaultdict(dict)
+  tracker = NativeRadarTracker()
 
   # Kalman filter stuff:
   ekfv = EKFV1D()
@@ -98,7 +96,6 @@ def radard_thread(gctx=None):
   v_ego = 0.
   v_ego_hist_t = deque([0], maxlen=v_len)
   v_ego_hist_v = deque([0], maxlen=v_len)
-  v_ego_t_aligned = 0.
 
   rk = Ratekeeper(rate, print_delay_threshold=None)
   while 1:
@@ -160,87 +157,24 @@ def radard_thread(gctx=None):
       # use path from steer, set angle_offset to 0 it does not only report the physical offset
       path_y = calc_lookahead_offset(v_ego, steer_angle, path_x, VM, angle_offset=live_parameters.liveParameters.angleOffsetAverage)[0]
 
-    # *** remove missing points from meta data ***
-    for ids in tracks.keys():
-      if ids not in ar_pts:
-        tracks.pop(ids, None)
-
-    # *** compute the tracks ***
-    for ids in ar_pts:
-      # ignore standalone vision point, unless we are mocking the radar
-      if ids == VISION_POINT and not mocked:
-        continue
-      rpt = ar_pts[ids]
-
-      # align v_ego by a fixed time to align it with the radar measurement
-      cur_time = float(rk.frame)/rate
-      v_ego_t_aligned = np.interp(cur_time - RI.delay, v_ego_hist_t, v_ego_hist_v)
-
-      d_path = np.sqrt(np.amin((path_x - rpt[0]) ** 2 + (path_y - rpt[1]) ** 2))
-      # add sign
-      d_path *= np.sign(rpt[1] - np.interp(rpt[0], path_x, path_y))
-
-      # create the track if it doesn't exist or it's a new track
-      if ids not in tracks:
-        tracks[ids] = Track()
-      tracks[ids].update(rpt[0], rpt[1], rpt[2], d_path, v_ego_t_aligned, rpt[3], steer_override)
-
-    # allow the vision model to remove the stationary flag if distance and rel speed roughly match
-    if VISION_POINT in ar_pts:
-      fused_id = None
-      best_score = NO_FUSION_SCORE
-      for ids in tracks:
-        dist_to_vision = np.sqrt((0.5*(ar_pts[VISION_POINT][0] - tracks[ids].dRel)) ** 2 + (2*(ar_pts[VISION_POINT][1] - tracks[ids].yRel)) ** 2)
-        rel_speed_diff = abs(ar_pts[VISION_POINT][2] - tracks[ids].vRel)
-        tracks[ids].update_vision_score(dist_to_vision, rel_speed_diff)
-        if best_score > tracks[ids].vision_score:
-          fused_id = ids
-          best_score = tracks[ids].vision_score
-
-      if fused_id is not None:
-        tracks[fused_id].vision_cnt += 1
-        tracks[fused_id].update_vision_fusion()
+    # align v_ego by a fixed time to align it with the radar measurement
+    cur_time = float(rk.frame)/rate
+    v_ego_t_aligned = np.interp(cur_time - RI.delay, v_ego_hist_t, v_ego_hist_v)
 
-    if DEBUG:
-      print("NEW CYCLE")
-      if VISION_POINT in ar_pts:
-        print("vision", ar_pts[VISION_POINT])
-
-    idens = list(tracks.keys())
-    track_pts = np.array([tracks[iden].get_key_for_cluster() for iden in idens])
-
-    # If we have multiple points, cluster them
-    if len(track_pts) > 1:
-      cluster_idxs = cluster_points_centroid(track_pts, 2.5)
-      clusters = [None] * (max(cluster_idxs) + 1)
-
-      for idx in xrange(len(track_pts)):
-        cluster_i = cluster_idxs[idx]
-        if clusters[cluster_i] is None:
-          clusters[cluster_i] = Cluster()
-        clusters[cluster_i].add(tracks[idens[idx]])
-
-    elif len(track_pts) == 1:
-      # TODO: why do we need this?
-      clusters = [Cluster()]
-      clusters[0].add(tracks[idens[0]])
-    else:
-      clusters = []
+    # ignore standalone vision point, unless we are mocking the radar
+    vision_pt = ar_pts.get(VISION_POINT)
+    if vision_pt is not None and not mocked:
+      del ar_pts[VISION_POINT]
+
+    lead_one, lead_two, live_tracks = tracker.update(ar_pts, vision_pt, path_x, path_y, v_ego,
+                                                     v_ego_t_aligned, steer_override)
 
     if DEBUG:
-      for i in clusters:
-        print(i)
-    # *** extract the lead car ***
-    lead_clusters = [c for c in clusters
-                     if c.is_potential_lead(v_ego)]
-    lead_clusters.sort(key=lambda x: x.dRel)
-    lead_len = len(lead_clusters)
-
-    # *** extract the second lead from the whole set of leads ***
-    lead2_clusters = [c for c in lead_clusters
-                      if c.is_potential_lead2(lead_clusters)]
-    lead2_clusters.sort(key=lambda x: x.dRel)
-    lead2_len = len(lead2_clusters)
+      print("NEW CYCLE")
+      if vision_pt is not None:
+        print("vision", vision_pt)
+      print("lead one", lead_one)
+      print("lead two", lead_two)
 
     # *** publish radarState ***
     dat = messaging.new_message()
@@ -250,10 +184,10 @@ def radard_thread(gctx=None):
     dat.radarState.canMonoTimes = list(rr.canMonoTimes)
     dat.radarState.radarErrors = list(rr.errors)
     dat.radarState.controlsStateMonoTime = last_controls_state_ts
-    if lead_len > 0:
-      dat.radarState.leadOne = lead_clusters[0].toRadarState()
-      if lead2_len > 0:
-        dat.radarState.leadTwo = lead2_clusters[0].toRadarState()
+    if lead_one is not None:
+      dat.radarState.leadOne = lead_one
+      if lead_two is not None:
+        dat.radarState.leadTwo = lead_two
       else:
         dat.radarState.leadTwo.status = False
     else:
@@ -264,26 +198,14 @@ def radard_thread(gctx=None):
 
     # *** publish tracks for UI debugging (keep last) ***
     dat = messaging.new_message()
-    dat.init('liveTracks', len(tracks))
+    dat.init('liveTracks', len(live_tracks))
 
-    for cnt, ids in enumerate(tracks.keys()):
+    for cnt, track in enumerate(live_tracks):
       if DEBUG:
-        print("id: %4.0f x:  %4.1f  y: %4.1f  vr: %4.1f d: %4.1f  va: %4.1f  vl: %4.1f  vlk: %4.1f alk: %4.1f  s: %1.0f  v: %1.0f" % \
-          (ids, tracks[ids].dRel, tracks[ids].yRel, tracks[ids].vRel,
-           tracks[ids].dPath, tracks[ids].vLat,
-           tracks[ids].vLead, tracks[ids].vLeadK,
-           tracks[ids].aLeadK,
-           tracks[ids].stationary,
-           tracks[ids].measured))
-      dat.liveTracks[cnt] = {
-        "trackId": ids,
-        "dRel": float(tracks[ids].dRel),
-        "yRel": float(tracks[ids].yRel),
-        "vRel": float(tracks[ids].vRel),
-        "aRel": float(tracks[ids].aRel),
-        "stationary": bool(tracks[ids].stationary),
-        "oncoming": bool(tracks[ids].oncoming),
-      }
+        print("id: %4.0f x:  %4.1f  y: %4.1f  vr: %4.1f  ar: %4.1f  s: %1.0f  o: %1.0f" % \
+          (track["trackId"], track["dRel"], track["yRel"], track["vRel"], track["aRel"],
+           track["stationary"], track["oncoming"]))
+      dat.liveTracks[cnt] = track
     liveTracks.send(dat.to_bytes())
 
     rk.monitor_time()
@@ -12,7 +12,8 @@ def run_mpc(v_ref=30., x_init=0., y_init=0., psi_init=0., delta_init=0.,
             lane_width=3.6, poly_shift=0.):
 
   libmpc = libmpc_py.libmpc
-  libmpc.init(1.0, 3.0, 1.0, 1.0)
+  ctx = libmpc_py.new_context()
+  libmpc.init(ctx, 1.0, 3.0, 1.0, 1.0)
 
   mpc_solution = libmpc_py.ffi.new("log_t *")
 
@@ -41,7 +42,7 @@ def run_mpc(v_ref=30., x_init=0., y_init=0., psi_init=0., delta_init=0.,
 
   # converge in no more than 20 iterations
   for _ in range(20):
-    libmpc.run_mpc(cur_state, mpc_solution, l_poly, r_poly, p_poly, l_prob, r_prob, p_prob,
+    libmpc.run_mpc(ctx, cur_state, mpc_solution, l_poly, r_poly, p_poly, l_prob, r_prob, p_prob,
                    curvature_factor, v_ref, lane_width)
 
   return mpc_solution
@@ -0,0 +1,176 @@
+import os
+import math
+import time
+import unittest
+import numpy as np
+import requests
+
+from cereal import log
+import selfdrive.messaging as messaging
+from selfdrive.car.honda.interface import CarInterface
+from selfdrive.controls.lib import pathplanner
+from selfdrive.controls.lib.vehicle_model import VehicleModel
+from selfdrive.pathplannerd.path_planner_py import NativePathPlanner, ffi, set_input
+from tools.lib.logreader import LogReader
+
+BASE_URL = "https://commadataci.blob.core.windows.net/openpilotci/"
+ROUTE = "b0c9d2329ad1606b|2019-05-30--20-23-57"
+
+
+class FakeSocket(object):
+  def __init__(self):
+    self.last = None
+
+  def send(self, data):
+    self.last = data
+
+
+class FakeSubMaster(dict):
+  def all_alive_and_valid(self, service_list=None):
+    return True
+
+
+def drive(n, points=False):
+  """What plannerd has when models come, on a road that bends both ways
+  with lanes that fade out and a driver who takes over now and then"""
+  for i in range(n):
+    t = i * 0.05
+    curv = 0.002 * math.sin(t * 0.05) + 0.0005 * math.sin(t * 0.7)
+    heading = 0.01 * math.sin(t * 0.3)
+    offset = 0.3 * math.sin(t * 0.2)
+
+    sm = FakeSubMaster()
+    md = messaging.new_message()
+    md.init('model')
+    for path, c in [(md.model.leftLane, 1.8), (md.model.rightLane, -1.8), (md.model.path, 0.)]:
+      poly = [curv * 0.01, curv, heading, c + offset]
+      if points:
+        path.points = [float(np.polyval(poly, x)) for x in range(50)]
+      else:
+        path.poly = poly
+    md.model.leftLane.prob = 0.9 if t % 40. < 30. else 0.1
+    md.model.rightLane.prob = 0.8 if t % 65. < 50. else 0.0
+    sm['model'] = md.model
+
+    cs = messaging.new_message()
+    cs.init('carState')
+    cs.carState.vEgo = 15. + 10. * math.sin(t * 0.01)
+    cs.carState.steeringAngle = 15.38 * 2.70 * math.degrees(curv) + 0.5 * math.sin(t * 1.3)
+    sm['carState'] = cs.carState
+
+    controls = messaging.new_message()
+    controls.init('controlsState')
+    controls.controlsState.active = t % 90. > 5.
+    controls.controlsState.angleModelBias = 0.1
+    sm['controlsState'] = controls.controlsState
+
+    params = messaging.new_message()
+    params.init('liveParameters')
+    params.liveParameters.angleOffsetAverage = -0.4
+    params.liveParameters.stiffnessFactor = 1.05
+    params.liveParameters.steerRatio = 15.0
+    params.liveParameters.valid = True
+    params.liveParameters.sensorValid = True
+    sm['liveParameters'] = params.liveParameters
+    yield sm
+
+
+def recorded_drive(route_filename):
+  """What plannerd had on a drive, a step for each model once all of its
+  inputs have come"""
+  sm = FakeSubMaster()
+  for msg in LogReader(route_filename):
+    which = msg.which()
+    if which in ['carState', 'controlsState', 'liveParameters']:
+      sm[which] = getattr(msg, which)
+    elif which == 'model':
+      sm['model'] = msg.model
+      if len(sm) == 4:
+        yield sm
+
+
+def f32(x):
+  return float(np.float32(x))
+
+
+class TestNativePathPlanner(unittest.TestCase):
+  def setUp(self):
+    self.CP = CarInterface.get_params("HONDA CIVIC 2016 TOURING", {})
+    self.VM = VehicleModel(self.CP)
+
+    socks = {}
+    pub_sock = messaging.pub_sock
+    messaging.pub_sock = lambda port: socks.setdefault(port, FakeSocket())
+    try:
+      self.PP = pathplanner.PathPlanner(self.CP)
+    finally:
+      messaging.pub_sock = pub_sock
+    self.plan_sock = self.PP.plan
+
+  def check_same(self, sms):
+    native = NativePathPlanner(self.CP)
+    cycles, py_t, native_t = 0, 0., 0.
+    for sm in sms:
+      t = time.time()
+      self.PP.update(sm, self.CP, self.VM)
+      py_t += time.time() - t
+      plan = log.Event.from_bytes(self.plan_sock.last).pathPlan
+
+      t = time.time()
+      out = native.update(sm)
+      native_t += time.time() - t
+
+      # pathPlan is in floats, and models with points are fitted as plannerd does
+      if len(sm['model'].leftLane.poly):
+        self.assertEqual(list(plan.dPoly), [f32(x) for x in out.d_poly])
+        self.assertEqual(list(plan.cPoly), [f32(x) for x in out.c_poly])
+        self.assertEqual(list(plan.lPoly), [f32(x) for x in out.l_poly])
+        self.assertEqual(list(plan.rPoly), [f32(x) for x in out.r_poly])
+        self.assertEqual(plan.laneWidth, f32(out.lane_width))
+        self.assertEqual(plan.angleSteers, f32(out.angle_steers))
+        self.assertEqual(plan.rateSteers, f32(out.rate_steers))
+        self.assertEqual(list(self.PP.mpc_solution[0].delta), list(out.mpc_delta))
+      else:
+        # the fit of the points only differs in how numpy rounds
+        np.testing.assert_allclose(plan.dPoly, list(out.d_poly), rtol=1e-5, atol=1e-9)
+        self.assertAlmostEqual(plan.angleSteers, out.angle_steers, places=3)
+      self.assertEqual(plan.cProb, f32(out.c_prob))
+      self.assertEqual(plan.lProb, f32(out.l_prob))
+      self.assertEqual(plan.rProb, f32(out.r_prob))
+      self.assertEqual(plan.angleOffset, f32(out.angle_offset))
+      self.assertEqual(plan.mpcSolutionValid, out.mpc_solution_valid)
+      cycles += 1
+    self.assertGreater(cycles, 0)
+    print("%d cycles, python %.1f us, native %.1f us a cycle" %
+          (cycles, py_t / cycles * 1e6, native_t / cycles * 1e6))
+
+  def test_same_as_python(self):
+    self.check_same(drive(2000))
+
+  def test_same_as_python_points(self):
+    self.check_same(drive(2000, True))
+
+  def test_recorded_drive(self):
+    """Plans a drive with the models, carStates, controlsStates and
+    liveParameters it had, in Python and native"""
+    route_filename = ROUTE + ".bz2"
+    if not os.path.isfile(route_filename):
+      with open(route_filename, "w") as f:
+        f.write(requests.get(BASE_URL + route_filename).content)
+    self.check_same(recorded_drive(route_filename))
+
+  def test_many_at_once(self):
+    native = NativePathPlanner(self.CP)
+    sms = list(drive(200))
+    one_at_a_time = [native.update(sm) for sm in sms]
+
+    inputs = ffi.new("PathPlannerInput[]", len(sms))
+    for i, sm in enumerate(sms):
+      set_input(inputs[i], sm)
+    outputs = NativePathPlanner(self.CP).update_many(inputs)
+    for i, out in enumerate(one_at_a_time):
+      self.assertEqual(ffi.buffer(out)[:], ffi.buffer(ffi.addressof(outputs, i))[:])
+
+
+if __name__ == "__main__":
+  unittest.main()
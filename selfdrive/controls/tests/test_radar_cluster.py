@@ -0,0 +1,122 @@
+import os
+import time
+import unittest
+import numpy as np
+import requests
+
+from selfdrive.controls.lib.cluster.fastcluster_py import cluster_points_centroid
+from selfdrive.controls.lib.cluster.radar_cluster_py import RadarClusterer
+from selfdrive.controls.tests.test_clustering import TRACK_PTS, CORRECT_LABELS, same_clusters
+from tools.lib.logreader import LogReader
+
+BASE_URL = "https://commadataci.blob.core.windows.net/openpilotci/"
+ROUTE = "b0c9d2329ad1606b|2019-05-30--20-23-57"
+
+# how radard weighs dRel, yRel and vRel
+WEIGHTS = np.array([1., 2., 1.])
+
+
+def old_clusters(pts):
+  if len(pts) < 2:
+    return [0] * len(pts)
+  return cluster_points_centroid(np.asarray(pts) * WEIGHTS, 2.5)
+
+
+class TestRadarCluster(unittest.TestCase):
+  def test_track_pts(self):
+    # on the distance matrix and on the grid
+    for dense_max in [None, 0]:
+      clusterer = RadarClusterer(weights=[1., 1., 1.], dense_max=dense_max)
+      labels, cluster_ids = clusterer.update(range(len(TRACK_PTS)), TRACK_PTS)
+      self.assertTrue(same_clusters(CORRECT_LABELS, labels))
+      self.assertEqual(labels, cluster_points_centroid(TRACK_PTS, 2.5))
+      self.assertEqual(len(cluster_ids), max(labels) + 1)
+
+  def test_random_frames(self):
+    np.random.seed(1337)
+    t_old, t_new = 0., 0.
+    for _ in range(1000):
+      n = int(np.random.uniform(2, 128))
+      pts = np.hstack([np.random.uniform(-10, 50, (n, 1)),
+                       np.random.uniform(-5, 5, (n, 1)),
+                       np.random.uniform(-5, 5, (n, 1))])
+      t = time.time()
+      old = old_clusters(pts)
+      t_old += time.time() - t
+
+      t = time.time()
+      labels, _ = RadarClusterer().update(range(n), pts.tolist())
+      t_new += time.time() - t
+      self.assertEqual(old, labels)
+
+      grid_labels, _ = RadarClusterer(dense_max=0).update(range(n), pts.tolist())
+      self.assertEqual(old, grid_labels)
+    print("1000 frames, fastcluster %.1f us, radar_cluster %.1f us a frame" % (t_old * 1e3, t_new * 1e3))
+
+  def test_persistent_ids(self):
+    for dense_max in [None, 0]:
+      self.check_persistent_ids(RadarClusterer(dense_max=dense_max))
+
+  def check_persistent_ids(self, clusterer):
+    # two cars with two tracks each
+    labels, ids = clusterer.update([1, 2, 3, 4], [[20., 0., 0.], [21., 0., 0.], [50., 3., 1.], [51., 3., 1.]])
+    self.assertEqual(labels, [0, 0, 1, 1])
+    car1, car2 = ids
+
+    # a new track comes first, a track of the first car goes, and the second
+    # car gets a third track and its tracks come in another order
+    labels, ids = clusterer.update([9, 4, 2, 3, 5], [[80., 0., 0.], [52., 3., 1.], [22., 0., 0.],
+                                                     [51., 3., 1.], [52.5, 3., 1.]])
+    self.assertEqual(labels, [0, 1, 2, 1, 1])
+    self.assertNotIn(ids[0], [car1, car2])
+    self.assertEqual(ids[1:], [car2, car1])
+
+    # the second car splits, the part with the most of its tracks keeps its id
+    labels, ids = clusterer.update([2, 3, 4, 5], [[22., 0., 0.], [45., 3., 1.], [51., 3., 1.], [52., 3., 1.]])
+    self.assertEqual(labels, [0, 1, 2, 2])
+    self.assertEqual([ids[0], ids[2]], [car1, car2])
+    self.assertNotIn(ids[1], [car1, car2])
+
+  def test_recorded_tracks(self):
+    """Clusters liveTracks of a drive, the tracks radard clusters, as
+    radard did and with radar_cluster"""
+    route_filename = ROUTE + ".bz2"
+    if not os.path.isfile(route_filename):
+      with open(route_filename, "w") as f:
+        f.write(requests.get(BASE_URL + route_filename).content)
+
+    clusterer = RadarClusterer()
+    frames, t_old, t_new = 0, 0., 0.
+    last_label, last_id = {}, {}
+    label_changes, id_changes = 0, 0
+    for msg in LogReader(route_filename):
+      if msg.which() != 'liveTracks':
+        continue
+      track_ids = [t.trackId for t in msg.liveTracks]
+      pts = [[t.dRel, t.yRel, t.vRel] for t in msg.liveTracks]
+
+      t = time.time()
+      old = old_clusters(pts)
+      t_old += time.time() - t
+
+      t = time.time()
+      labels, cluster_ids = clusterer.update(track_ids, pts)
+      t_new += time.time() - t
+      self.assertEqual(old, labels)
+
+      for track_id, label in zip(track_ids, labels):
+        if track_id in last_label:
+          label_changes += last_label[track_id] != label
+          id_changes += last_id[track_id] != cluster_ids[label]
+        last_label[track_id] = label
+        last_id[track_id] = cluster_ids[label]
+      frames += 1
+
+    self.assertGreater(frames, 0)
+    self.assertLessEqual(id_changes, label_changes)
+    print("%d frames, fastcluster %.1f us, radar_cluster %.1f us a frame, %d label and %d id changes" %
+          (frames, t_old / frames * 1e6, t_new / frames * 1e6, label_changes, id_changes))
+
+
+if __name__ == "__main__":
+  unittest.main()
@@ -0,0 +1,126 @@
+import os
+import time
+import unittest
+import numpy as np
+import requests
+
+from selfdrive.controls.lib.model_parser import ModelParser
+from selfdrive.controls.lib.radar_helpers import RadarTracker, RDR_TO_LDR
+from selfdrive.controls.lib.radar_tracker.radar_tracker_py import NativeRadarTracker
+from tools.lib.logreader import LogReader
+
+BASE_URL = "https://commadataci.blob.core.windows.net/openpilotci/"
+ROUTE = "b0c9d2329ad1606b|2019-05-30--20-23-57"
+
+PATH_X = np.arange(0.0, 140.0, 0.1)
+
+
+class TestRadarTracker(unittest.TestCase):
+  def assertSameCycle(self, old, new):
+    # tracks are the same to the bit, the means of a cluster are summed in
+    # another order than radar_helpers does
+    old_lead_one, old_lead_two, old_tracks = old
+    new_lead_one, new_lead_two, new_tracks = new
+    self.assertEqual(sorted(old_tracks, key=lambda t: t["trackId"]),
+                     sorted(new_tracks, key=lambda t: t["trackId"]))
+    for old_lead, new_lead in [(old_lead_one, new_lead_one), (old_lead_two, new_lead_two)]:
+      self.assertEqual(old_lead is None, new_lead is None)
+      if old_lead is None:
+        continue
+      self.assertEqual(sorted(old_lead.keys()), sorted(new_lead.keys()))
+      for k in old_lead:
+        if isinstance(old_lead[k], bool):
+          self.assertEqual(old_lead[k], new_lead[k], k)
+        else:
+          self.assertAlmostEqual(old_lead[k], new_lead[k], places=6, msg=k)
+
+  def test_synthetic_drive(self):
+    np.random.seed(1337)
+    old, new = RadarTracker(), NativeRadarTracker()
+    path_y = 1e-3 * PATH_X ** 2
+    # cars with a few points each, that come and go
+    cars = [[np.random.uniform(5, 140), np.random.uniform(-8, 8), np.random.uniform(-5, 5)] for _ in range(12)]
+    v_ego = 20.
+    t_old, t_new = 0., 0.
+    for cycle in range(2000):
+      v_ego = max(0., v_ego + np.random.normal(0., 0.2))
+      ar_pts = {}
+      for c, car in enumerate(cars):
+        car[0] += car[2] * 0.05
+        if car[0] < 5. or car[0] > 140.:
+          car[0] = 140. if car[0] < 5. else 5.
+        for k in range(3):
+          if np.random.uniform() < 0.1:
+            continue
+          d = car[0] + 0.8 * k + np.random.normal(0., 0.1)
+          ar_pts[10 * c + k] = [d + RDR_TO_LDR, 1e-3 * d ** 2 + car[1] + np.random.normal(0., 0.1),
+                                car[2] + np.random.normal(0., 0.1), np.random.uniform() < 0.9]
+
+      vision_pt = None
+      if cycle % 100 < 70:
+        lead = min(cars, key=lambda car: abs(car[1]) + car[0])
+        vision_pt = (lead[0] + RDR_TO_LDR, 1e-3 * lead[0] ** 2 + lead[1], lead[2], False)
+      steer_override = cycle % 300 > 250
+
+      args = (vision_pt, PATH_X, path_y, v_ego, v_ego - 0.1, steer_override)
+
+      t = time.time()
+      old_cycle = old.update(dict(ar_pts), *args)
+      t_old += time.time() - t
+
+      t = time.time()
+      new_cycle = new.update(dict(ar_pts), *args)
+      t_new += time.time() - t
+
+      self.assertSameCycle(old_cycle, new_cycle)
+    print("2000 cycles, radar_helpers %.1f us, radar_tracker %.1f us a cycle" % (t_old / 2000 * 1e6, t_new / 2000 * 1e6))
+
+  def test_recorded_tracks(self):
+    """Tracks the liveTracks of a drive along the path of the model, with
+    radar_helpers and radar_tracker"""
+    route_filename = ROUTE + ".bz2"
+    if not os.path.isfile(route_filename):
+      # fetched first, a failed download leaves no empty route behind
+      r = requests.get(BASE_URL + route_filename)
+      r.raise_for_status()
+      with open(route_filename, "wb") as f:
+        f.write(r.content)
+
+    old, new = RadarTracker(), NativeRadarTracker()
+    MP = ModelParser()
+    v_ego, steer_override = 0., False
+    cycles, t_old, t_new = 0, 0., 0.
+    for msg in LogReader(route_filename):
+      if msg.which() == 'controlsState':
+        v_ego = msg.controlsState.vEgo
+        steer_override = msg.controlsState.steerOverride
+      elif msg.which() == 'model':
+        MP.update(v_ego, msg.model)
+      elif msg.which() == 'liveTracks':
+        ar_pts = {}
+        for t in msg.liveTracks:
+          ar_pts[t.trackId] = [t.dRel, t.yRel, t.vRel, True]
+        path_y = np.polyval(MP.d_poly, PATH_X)
+        vision_pt = None
+        if MP.lead_prob > 0.7:
+          vision_pt = (MP.lead_dist, np.polyval(MP.d_poly, MP.lead_dist), 0., False)
+        args = (vision_pt, PATH_X, path_y, v_ego, v_ego, steer_override)
+
+        t = time.time()
+        old_cycle = old.update(dict(ar_pts), *args)
+        t_old += time.time() - t
+
+        t = time.time()
+        new_cycle = new.update(dict(ar_pts), *args)
+        t_new += time.time() - t
+
+        self.assertSameCycle(old_cycle, new_cycle)
+        cycles += 1
+
+    self.assertGreater(cycles, 0)
+    print("%d cycles, radar_helpers %.1f us, radar_tracker %.1f us a cycle" %
+          (cycles, t_old / cycles * 1e6, t_new / cycles * 1e6))
+
+
+if __name__ == "__main__":
+  unittest.main()
@@ -39,6 +39,8 @@ typedef struct VisionStreamBufs {
   union {
     VisionUIInfo ui_info;
   } buf_info;
+
+  bool ring;
 } VisionStreamBufs;
 
 typedef struct VIPCBuf {
@@ -60,6 +62,13 @@ typedef struct VisionStream {
   int num_bufs;
   VisionStreamBufs bufs_info;
   VIPCBuf *bufs;
+
+  struct VIPCRing *ring;
+  int ring_fd;
+  int ring_reader;
+  bool ring_latest;
+  uint64_t ring_seq;
+  uint64_t dropped;
 } VisionStream;
 
 int visionstream_init(VisionStream *s, VisionStreamType type, bool tbuffer, VisionStreamBufs *out_bufs_info);
@@ -28,14 +28,66 @@ int get_intersections(double *lines, double *intersections, long long n) {
   return k;
 }
 
+// Lines of a block of the ones with L[1] < 0, split by the sign of L[0].
+#define VP_BLOCK 256
+
+typedef struct {
+  int n;
+  double a[VP_BLOCK], b[VP_BLOCK], c[VP_BLOCK];
+} vp_lines;
+
+// Votes for where L1 crosses each line of B. The intersections are worked
+// out for the whole block in a loop without branches that vectorizes, only
+// the votes are scattered.
+static void vote_block(double *grid, const double *L1, const vp_lines *B, double weight) {
+  // x is -1 for a crossing outside the frame
+  double xs[VP_BLOCK], ys[VP_BLOCK];
+  for (int j=0; j < B->n; j++) {
+    double D = L1[0] * B->b[j] - L1[1] * B->a[j];
+    double Dx = L1[2] * B->b[j] - L1[1] * B->c[j];
+    double Dy = L1[0] * B->c[j] - L1[2] * B->a[j];
+    double x = Dx / D;
+    double y = Dy / D;
+    int in = (D != 0) & (0 < x) & (x < W) & (0 < y) & (y < H);
+    xs[j] = in ? x : -1.;
+    ys[j] = y;
+  }
+  for (int j=0; j < B->n; j++) {
+    if (xs[j] >= 0) {
+      int x = (int) (xs[j] + 0.5);
+      int y = (int) (ys[j] + 0.5);
+      grid[y*(W+1) + x] += weight;
+    }
+  }
+}
+
+// Same votes as get_intersections gives, without storing them. Two lines
+// only cross when L[0] has the same sign and L[1] opposite signs, so only
+// those pairs are intersected, each once with the two votes the ordered
+// pairs would give.
 void increment_grid(double *grid, double *lines, long long n) {
-  double *intersections = (double*) malloc(n*n*2*sizeof(double));
-  int y, x, k;
-  k = get_intersections(lines, intersections, n);
-  for (int i=0; i < k; i++) {
-    x = (int) (intersections[i*2 + 0] + 0.5);
-    y = (int) (intersections[i*2 + 1] + 0.5);
-    grid[y*(W+1) + x] += 1.;
+  vp_lines pos, neg;
+  for (long long jb=0; jb < n; jb += VP_BLOCK) {
+    pos.n = neg.n = 0;
+    for (long long j=jb; j < n && j < jb + VP_BLOCK; j++) {
+      const double *L2 = lines + j*3;
+      if (L2[1] < 0 && L2[0] != 0) {
+        vp_lines *B = L2[0] > 0 ? &pos : &neg;
+        B->a[B->n] = L2[0];
+        B->b[B->n] = L2[1];
+        B->c[B->n] = L2[2];
+        B->n++;
+      }
+    }
+    if (pos.n == 0 && neg.n == 0) {
+      continue;
+    }
+
+    for (long long i=0; i < n; i++) {
+      const double *L1 = lines + i*3;
+      if (L1[1] > 0 && L1[0] != 0) {
+        vote_block(grid, L1, L1[0] > 0 ? &pos : &neg, 2.);
+      }
+    }
   }
-  free(intersections);
 }
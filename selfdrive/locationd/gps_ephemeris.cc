@@ -0,0 +1,243 @@
+#include <math.h>
+#include <string.h>
+#include <stddef.h>
+
+#include "gps_ephemeris.h"
+
+#define GET_FIELD_U(w, nb, pos) (((w) >> (pos)) & ((1U<<(nb))-1))
+
+namespace {
+
+inline int32_t sign_extend(uint32_t v, int nb) {
+  return (int32_t)(v << (32 - nb)) >> (32 - nb);
+}
+
+// Definition of Pi used in the GPS coordinate system
+const double GPS_PI = 3.1415926535898;
+
+// exact scale factors
+const double P2_5 = 1.0 / (1U << 5);
+const double P2_19 = 1.0 / (1U << 19);
+const double P2_29 = 1.0 / (1U << 29);
+const double P2_31 = 1.0 / (1U << 31);
+const double P2_33 = 1.0 / (1ULL << 33);
+const double P2_43 = 1.0 / (1ULL << 43);
+const double P2_55 = 1.0 / (1ULL << 55);
+
+// A field of the ephemeris, nb bits at pos of word in subframe. Fields of
+// 32 bits have their top 8 bits there and the other 24 at bit 6 of the
+// next word. Words count from 0, 0 and 1 are TLM and HOW.
+struct Field {
+  uint8_t subframe, word, nb, pos;
+  bool split, is_signed, semicircles;
+  double scale;
+  double GpsEphemeris::*value;
+};
+
+const Field FIELDS[] = {
+  {1, 6, 8, 6, false, true, false, P2_31, &GpsEphemeris::Tgd},
+  {1, 7, 16, 6, false, false, false, 16.0, &GpsEphemeris::toc},
+  {1, 8, 8, 22, false, true, false, P2_55, &GpsEphemeris::af2},
+  {1, 8, 16, 6, false, true, false, P2_43, &GpsEphemeris::af1},
+  {1, 9, 22, 8, false, true, false, P2_31, &GpsEphemeris::af0},
+
+  {2, 2, 16, 6, false, true, false, P2_5, &GpsEphemeris::crs},
+  {2, 3, 16, 14, false, true, true, P2_43, &GpsEphemeris::deltaN},
+  {2, 3, 8, 6, true, true, true, P2_31, &GpsEphemeris::M0},
+  {2, 5, 16, 14, false, true, false, P2_29, &GpsEphemeris::cuc},
+  {2, 5, 8, 6, true, false, false, P2_33, &GpsEphemeris::ecc},
+  {2, 7, 16, 14, false, true, false, P2_29, &GpsEphemeris::cus},
+  // square root of A, squared below
+  {2, 7, 8, 6, true, false, false, P2_19, &GpsEphemeris::A},
+  {2, 9, 16, 14, false, false, false, 16.0, &GpsEphemeris::toe},
+
+  {3, 2, 16, 14, false, true, false, P2_29, &GpsEphemeris::cic},
+  {3, 2, 8, 6, true, true, true, P2_31, &GpsEphemeris::omega0},
+  {3, 4, 16, 14, false, true, false, P2_29, &GpsEphemeris::cis},
+  {3, 4, 8, 6, true, true, true, P2_31, &GpsEphemeris::i0},
+  {3, 6, 16, 14, false, true, false, P2_5, &GpsEphemeris::crc},
+  {3, 6, 8, 6, true, true, true, P2_31, &GpsEphemeris::omega},
+  {3, 8, 24, 6, false, true, true, P2_43, &GpsEphemeris::omega_dot},
+  {3, 9, 14, 8, false, true, true, P2_43, &GpsEphemeris::idot},
+};
+
+// Klobuchar coefficients in subframe 4 page 18, as words and bits
+const struct {
+  uint8_t word, pos;
+  double scale;
+} IONO_ALPHA[4] = {{2, 14, 1.0 / (1U << 30)}, {2, 6, 1.0 / (1U << 27)}, {3, 22, 1.0 / (1U << 24)}, {3, 14, 1.0 / (1U << 24)}},
+  IONO_BETA[4] = {{3, 6, 1U << 11}, {4, 22, 1U << 14}, {4, 14, 1U << 16}, {4, 6, 1U << 16}};
+
+// WGS 84 values of IS-GPS-200 Table 20-IV
+const double GM = 3.986005e14;
+const double OMEGA_E = 7.2921151467e-5;
+const double F_REL = -4.442807633e-10;
+
+// What an ephemeris gives that doesn't depend on time.
+struct Orbit {
+  bool present;
+  GpsEphemeris eph;
+  double sqrt_a, n, sqrt_1_e2, f_e_sqrt_a, omega_dot_e;
+};
+
+#define MAX_SV 64
+
+class GpsOrbits {
+  public:
+    GpsOrbits() {
+      memset(orbits, 0, sizeof(orbits));
+    }
+
+    void update(const GpsEphemeris *eph) {
+      if (eph->svId >= MAX_SV) return;
+      Orbit &o = orbits[eph->svId];
+      o.present = true;
+      o.eph = *eph;
+      o.sqrt_a = sqrt(eph->A);
+      o.n = sqrt(GM / (eph->A * eph->A * eph->A)) + eph->deltaN;
+      o.sqrt_1_e2 = sqrt(1.0 - eph->ecc * eph->ecc);
+      o.f_e_sqrt_a = F_REL * eph->ecc * o.sqrt_a;
+      o.omega_dot_e = eph->omega_dot - OMEGA_E;
+    }
+
+    int sat_info(int n, const int *sv_ids, const double *t,
+                 double *pos, double *vel, double *clock_err, double *clock_rate_err) {
+      int found = 0;
+      for (int i = 0; i < n; i++) {
+        if (sv_ids[i] < 0 || sv_ids[i] >= MAX_SV || !orbits[sv_ids[i]].present) {
+          pos[3*i] = pos[3*i+1] = pos[3*i+2] = NAN;
+          vel[3*i] = vel[3*i+1] = vel[3*i+2] = NAN;
+          clock_err[i] = clock_rate_err[i] = NAN;
+          continue;
+        }
+        sat_info_one(orbits[sv_ids[i]], t[i], &pos[3*i], &vel[3*i], &clock_err[i], &clock_rate_err[i]);
+        found++;
+      }
+      return found;
+    }
+
+  private:
+    static double week_wrap(double dt) {
+      if (dt > 302400.0) return dt - 604800.0;
+      if (dt < -302400.0) return dt + 604800.0;
+      return dt;
+    }
+
+    // IS-GPS-200 Table 20-IV and its time derivative
+    static void sat_info_one(const Orbit &o, double t, double *pos, double *vel,
+                             double *clock_err, double *clock_rate_err) {
+      const GpsEphemeris &e = o.eph;
+      const double tk = week_wrap(t - e.toe);
+
+      // Kepler's equation by Newton, GPS orbits are close enough to round
+      // for a fixed count to reach double precision
+      const double mk = e.M0 + o.n * tk;
+      double ek = mk;
+      for (int k = 0; k < 4; k++) {
+        ek -= (ek - e.ecc * sin(ek) - mk) / (1.0 - e.ecc * cos(ek));
+      }
+      const double sin_e = sin(ek), cos_e = cos(ek);
+      const double one_e_cos = 1.0 - e.ecc * cos_e;
+
+      const double vk = atan2(o.sqrt_1_e2 * sin_e, cos_e - e.ecc);
+      const double phi = vk + e.omega;
+      const double sin_2phi = sin(2.0 * phi), cos_2phi = cos(2.0 * phi);
+
+      const double uk = phi + e.cus * sin_2phi + e.cuc * cos_2phi;
+      const double rk = e.A * one_e_cos + e.crs * sin_2phi + e.crc * cos_2phi;
+      const double ik = e.i0 + e.idot * tk + e.cis * sin_2phi + e.cic * cos_2phi;
+      const double sin_u = sin(uk), cos_u = cos(uk);
+      const double sin_i = sin(ik), cos_i = cos(ik);
+      const double xp = rk * cos_u, yp = rk * sin_u;
+
+      const double omega_k = e.omega0 + o.omega_dot_e * tk - OMEGA_E * e.toe;
+      const double sin_o = sin(omega_k), cos_o = cos(omega_k);
+      pos[0] = xp * cos_o - yp * cos_i * sin_o;
+      pos[1] = xp * sin_o + yp * cos_i * cos_o;
+      pos[2] = yp * sin_i;
+
+      const double ek_dot = o.n / one_e_cos;
+      const double phi_dot = o.sqrt_1_e2 * ek_dot / one_e_cos;
+      const double uk_dot = phi_dot * (1.0 + 2.0 * (e.cus * cos_2phi - e.cuc * sin_2phi));
+      const double rk_dot = e.A * e.ecc * sin_e * ek_dot + 2.0 * phi_dot * (e.crs * cos_2phi - e.crc * sin_2phi);
+      const double ik_dot = e.idot + 2.0 * phi_dot * (e.cis * cos_2phi - e.cic * sin_2phi);
+      const double xp_dot = rk_dot * cos_u - yp * uk_dot;
+      const double yp_dot = rk_dot * sin_u + xp * uk_dot;
+      vel[0] = xp_dot * cos_o - yp_dot * cos_i * sin_o + yp * sin_i * sin_o * ik_dot - pos[1] * o.omega_dot_e;
+      vel[1] = xp_dot * sin_o + yp_dot * cos_i * cos_o - yp * sin_i * cos_o * ik_dot + pos[0] * o.omega_dot_e;
+      vel[2] = yp_dot * sin_i + yp * cos_i * ik_dot;
+
+      // the relativistic term and Tgd for single frequency L1 users
+      const double tc = week_wrap(t - e.toc);
+      *clock_err = e.af0 + e.af1 * tc + e.af2 * tc * tc + o.f_e_sqrt_a * sin_e - e.Tgd;
+      *clock_rate_err = e.af1 + 2.0 * e.af2 * tc + o.f_e_sqrt_a * cos_e * ek_dot;
+    }
+
+    Orbit orbits[MAX_SV];
+};
+
+}
+
+extern "C" {
+  void gps_ephemeris_decode(uint8_t svId, const uint32_t *const subframes[6], GpsEphemeris *eph) {
+    memset(eph, 0, sizeof(*eph));
+    eph->svId = svId;
+
+    for (size_t i = 0; i < sizeof(FIELDS) / sizeof(FIELDS[0]); i++) {
+      const Field &f = FIELDS[i];
+      const uint32_t *words = subframes[f.subframe];
+      uint32_t raw = GET_FIELD_U(words[f.word], f.nb, f.pos);
+      int nb = f.nb;
+      if (f.split) {
+        raw = (raw << 24) | GET_FIELD_U(words[f.word + 1], 24, 6);
+        nb += 24;
+      }
+      double v = f.is_signed ? (double)sign_extend(raw, nb) : (double)raw;
+      v *= f.scale;
+      if (f.semicircles) v *= GPS_PI;
+      eph->*f.value = v;
+    }
+    eph->A *= eph->A;
+
+    eph->gpsWeek = GET_FIELD_U(subframes[1][2], 10, 20);
+    const uint32_t iodc = (GET_FIELD_U(subframes[1][2], 2, 6) << 8) | GET_FIELD_U(subframes[1][7], 8, 22);
+    const uint32_t iode1 = GET_FIELD_U(subframes[2][2], 8, 22);
+    const uint32_t iode2 = GET_FIELD_U(subframes[3][9], 8, 22);
+    eph->valid = (iode1 == iode2) && (iode1 == (iodc & 0xff));
+    eph->iode = iode1;
+
+    eph->_rsvd1 = GET_FIELD_U(subframes[1][3], 23, 6);
+    eph->_rsvd2 = GET_FIELD_U(subframes[1][4], 24, 6);
+    eph->_rsvd3 = GET_FIELD_U(subframes[1][5], 24, 6);
+    eph->_rsvd4 = GET_FIELD_U(subframes[1][6], 16, 14);
+    eph->aodo = GET_FIELD_U(subframes[2][9], 5, 8);
+
+    eph->ionoCoeffsValid = GET_FIELD_U(subframes[4][2], 6, 22) == 56 &&
+                           GET_FIELD_U(subframes[4][2], 2, 28) == 1 &&
+                           GET_FIELD_U(subframes[5][2], 2, 28) == 1;
+    if (eph->ionoCoeffsValid) {
+      for (int i = 0; i < 4; i++) {
+        eph->ionoAlpha[i] = sign_extend(GET_FIELD_U(subframes[4][IONO_ALPHA[i].word], 8, IONO_ALPHA[i].pos), 8) * IONO_ALPHA[i].scale;
+        eph->ionoBeta[i] = sign_extend(GET_FIELD_U(subframes[4][IONO_BETA[i].word], 8, IONO_BETA[i].pos), 8) * IONO_BETA[i].scale;
+      }
+    }
+  }
+
+  void* gps_orbits_init(void) {
+    GpsOrbits * orbits = new GpsOrbits;
+    return (void*)orbits;
+  }
+
+  void gps_orbits_free(void* orbits) {
+    delete (GpsOrbits*) orbits;
+  }
+
+  void gps_orbits_update(void* orbits, const GpsEphemeris *eph) {
+    ((GpsOrbits*) orbits)->update(eph);
+  }
+
+  int gps_orbits_sat_info(void* orbits, int n, const int *sv_ids, const double *t,
+                          double *pos, double *vel, double *clock_err, double *clock_rate_err) {
+    return ((GpsOrbits*) orbits)->sat_info(n, sv_ids, t, pos, vel, clock_err, clock_rate_err);
+  }
+}
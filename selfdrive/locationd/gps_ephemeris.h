@@ -0,0 +1,40 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// GPS LNAV ephemeris and clock terms in meters, seconds and radians,
+// see IS-GPS-200 Table 20-III. Also declared in gps_ephemeris_py.py.
+typedef struct GpsEphemeris {
+  uint16_t svId;
+  double Tgd, A, cic, cis, crc, crs, cuc, cus, deltaN, ecc, i0, idot, M0, omega, omega_dot, omega0, toe, toc;
+  uint32_t gpsWeek, iode, _rsvd1, _rsvd2, _rsvd3, _rsvd4, aodo;
+  double af0, af1, af2;
+  bool valid;
+  double ionoAlpha[4], ionoBeta[4];
+  bool ionoCoeffsValid;
+} GpsEphemeris;
+
+// Decodes subframes 1 to 5 of a satellite, as the 10 words of RXM_SFRBX.
+// subframes[0] is unused.
+void gps_ephemeris_decode(uint8_t svId, const uint32_t *const subframes[6], GpsEphemeris *eph);
+
+// Satellite positions and clocks from the latest ephemeris of every SV.
+void* gps_orbits_init(void);
+void gps_orbits_free(void* orbits);
+void gps_orbits_update(void* orbits, const GpsEphemeris *eph);
+
+// For n satellites at transmit times t, in GPS seconds of week, fills ECEF
+// positions and velocities (3 per satellite), the clock error for L1 in
+// seconds and its rate. Satellites without an ephemeris get NAN. Returns how
+// many were computed.
+int gps_orbits_sat_info(void* orbits, int n, const int *sv_ids, const double *t,
+                        double *pos, double *vel, double *clock_err, double *clock_rate_err);
+
+#ifdef __cplusplus
+}
+#endif
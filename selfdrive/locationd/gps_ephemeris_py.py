@@ -0,0 +1,75 @@
+import os
+import numpy as np
+
+from cffi import FFI
+import subprocess
+
+locationd_dir = os.path.dirname(os.path.abspath(__file__))
+subprocess.check_call(["make", "libgpsephemeris.so"], cwd=locationd_dir)
+
+ffi = FFI()
+ffi.cdef("""
+typedef struct GpsEphemeris {
+  uint16_t svId;
+  double Tgd, A, cic, cis, crc, crs, cuc, cus, deltaN, ecc, i0, idot, M0, omega, omega_dot, omega0, toe, toc;
+  uint32_t gpsWeek, iode, _rsvd1, _rsvd2, _rsvd3, _rsvd4, aodo;
+  double af0, af1, af2;
+  bool valid;
+  double ionoAlpha[4], ionoBeta[4];
+  bool ionoCoeffsValid;
+} GpsEphemeris;
+
+void* gps_orbits_init(void);
+void gps_orbits_free(void* orbits);
+void gps_orbits_update(void* orbits, const GpsEphemeris *eph);
+int gps_orbits_sat_info(void* orbits, int n, const int *sv_ids, const double *t,
+                        double *pos, double *vel, double *clock_err, double *clock_rate_err);
+""")
+
+libgpsephemeris = ffi.dlopen(os.path.join(locationd_dir, "libgpsephemeris.so"))
+
+# ubloxGnss.ephemeris fields by GpsEphemeris field
+EPHEMERIS_FIELDS = [
+  ('Tgd', 'tgd'), ('A', 'a'), ('cic', 'cic'), ('cis', 'cis'), ('crc', 'crc'), ('crs', 'crs'),
+  ('cuc', 'cuc'), ('cus', 'cus'), ('deltaN', 'deltaN'), ('ecc', 'ecc'), ('i0', 'i0'),
+  ('idot', 'iDot'), ('M0', 'm0'), ('omega', 'omega'), ('omega_dot', 'omegaDot'),
+  ('omega0', 'omega0'), ('toe', 'toe'), ('toc', 'toc'), ('af0', 'af0'), ('af1', 'af1'), ('af2', 'af2'),
+]
+
+
+class GpsOrbits(object):
+  """Satellite positions, velocities and clocks from the latest ephemeris of
+  every GPS satellite, computed natively for all of them at once."""
+
+  def __init__(self):
+    self.orbits = ffi.gc(libgpsephemeris.gps_orbits_init(), libgpsephemeris.gps_orbits_free)
+
+  def update(self, ephemeris):
+    """ephemeris is a ubloxGnss.ephemeris"""
+    eph = ffi.new("GpsEphemeris *")
+    eph.svId = ephemeris.svId
+    for field, name in EPHEMERIS_FIELDS:
+      setattr(eph, field, getattr(ephemeris, name))
+    eph.gpsWeek = int(ephemeris.gpsWeek)
+    eph.iode = int(ephemeris.iode)
+    libgpsephemeris.gps_orbits_update(self.orbits, eph)
+
+  def sat_info(self, sv_ids, t):
+    """For satellites sv_ids at transmit times t, in GPS seconds of week,
+    returns ECEF positions and velocities, clock errors and their rates.
+    Satellites without an ephemeris are nan."""
+    sv_ids = np.ascontiguousarray(sv_ids, dtype=np.int32)
+    t = np.ascontiguousarray(t, dtype=np.float64)
+    n = len(sv_ids)
+    pos = np.empty((n, 3))
+    vel = np.empty((n, 3))
+    clock_err = np.empty(n)
+    clock_rate_err = np.empty(n)
+    libgpsephemeris.gps_orbits_sat_info(self.orbits, n,
+                                        ffi.cast("int *", sv_ids.ctypes.data),
+                                        ffi.cast("double *", t.ctypes.data),
+                                        ffi.cast("double *", pos.ctypes.data),
+                                        ffi.cast("double *", vel.ctypes.data),
+                                        ffi.cast("double *", clock_err.ctypes.data),
+                                        ffi.cast("double *", clock_rate_err.ctypes.data))
+    return pos, vel, clock_err, clock_rate_err
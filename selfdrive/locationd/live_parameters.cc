@@ -0,0 +1,19 @@
+#include "live_parameters.h"
+
+LiveParameters live_parameters_update(const Localizer &localizer, ParamsLearner &learner) {
+  LiveParameters p;
+  double yaw_rate = -localizer.x[0];
+  p.valid = learner.update(yaw_rate, localizer.car_speed, localizer.steering_angle);
+
+  // TODO: Fix in replay
+  double sensor_data_age = localizer.controls_state_time - localizer.sensor_data_time;
+
+  p.yaw_rate = localizer.x[0];
+  p.gyro_bias = localizer.x[1];
+  p.sensor_valid = sensor_data_age < 5.0;
+  p.angle_offset = RADIANS_TO_DEGREES * learner.ao;
+  p.angle_offset_average = RADIANS_TO_DEGREES * learner.slow_ao;
+  p.stiffness_factor = learner.x;
+  p.steer_ratio = learner.sR;
+  return p;
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include "localizer.h"
+#include "params_learner.h"
+
+// liveParameters as locationd sends them, decoded. Angles in degrees.
+struct LiveParameters {
+  bool valid;
+  double yaw_rate, gyro_bias;
+  bool sensor_valid;
+  double angle_offset, angle_offset_average;
+  double stiffness_factor, steer_ratio;
+};
+
+// What locationd does on every controlsState once the localizer has it:
+// updates the learner and returns the liveParameters values. Shared by the
+// daemon and params_replay.
+LiveParameters live_parameters_update(const Localizer &localizer, ParamsLearner &learner);
@@ -0,0 +1,57 @@
+#include <cmath>
+
+#include "params_learner.h"
+#include "localizer.h"
+
+Localizer::Localizer(const LocalizerConfig &config) {
+  A << 1, 0, 0, 1;
+  I << 1, 0, 0, 1;
+
+  Q << pow(config.q_yaw, 2.0), 0, 0, pow(config.q_bias, 2.0);
+  P << pow(config.p0_yaw, 2.0), 0, 0, pow(config.p0_bias, 2.0);
+
+  C_posenet << 1, 0;
+  C_gyro << 1, 1;
+  x << 0, 0;
+
+  R_gyro = pow(config.r_gyro, 2.0);
+  R_posenet_scale = config.r_posenet_scale;
+}
+
+void Localizer::update_state(const Eigen::Matrix<double, 1, 2> &C, const double R, double current_time, double meas) {
+  double dt = current_time - prev_update_time;
+  prev_update_time = current_time;
+  if (dt < 1.0e-9) {
+    return;
+  }
+
+  // x = A * x;
+  // P = A * P * A.transpose() + dt * Q;
+  // Simplify because A is unity
+  P = P + dt * Q;
+
+  double y = meas - C * x;
+  double S = R + C * P * C.transpose();
+  Eigen::Vector2d K = P * C.transpose() * (1.0 / S);
+  x = x + K * y;
+  P = (I - K * C) * P;
+}
+
+void Localizer::handle_gyro(double gyro, double current_time) {
+  sensor_data_time = current_time;
+
+  double meas = -gyro;
+  update_state(C_gyro, R_gyro, current_time, meas);
+}
+
+void Localizer::handle_camera_odometry(double rot_z, double rot_std_z, double current_time) {
+  double R = R_posenet_scale * pow(rot_std_z, 2);
+  double meas = rot_z;
+  update_state(C_posenet, R, current_time, meas);
+}
+
+void Localizer::handle_controls_state(double angle_steers, double v_ego, double current_time) {
+  steering_angle = angle_steers * DEGREES_TO_RADIANS;
+  car_speed = v_ego;
+  controls_state_time = current_time;
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <eigen3/Eigen/Dense>
+
+// Noise of the yaw rate and gyro bias filter, as standard deviations.
+struct LocalizerConfig {
+  double q_yaw = 0.1;
+  double q_bias = 0.005 / 100.0;
+  double p0_yaw = 1.0;
+  double p0_bias = 0.05;
+  double r_gyro = 0.05;
+  // cameraOdometry noise is this times its rotation std squared
+  double r_posenet_scale = 250.0;
+};
+
+// Kalman filter of yaw rate and gyro bias. Takes the values it uses from
+// sensorEvents, cameraOdometry and controlsState already decoded, so logs
+// can be replayed without capnp.
+class Localizer
+{
+  Eigen::Matrix2d A;
+  Eigen::Matrix2d I;
+  Eigen::Matrix2d Q;
+  Eigen::Matrix2d P;
+  Eigen::Matrix<double, 1, 2> C_posenet;
+  Eigen::Matrix<double, 1, 2> C_gyro;
+
+  double R_gyro;
+  double R_posenet_scale;
+
+  void update_state(const Eigen::Matrix<double, 1, 2> &C, const double R, double current_time, double meas);
+
+public:
+  Eigen::Vector2d x;
+  double steering_angle = 0;
+  double car_speed = 0;
+  double prev_update_time = -1;
+  double controls_state_time = -1;
+  double sensor_data_time = -1;
+
+  Localizer(const LocalizerConfig &config = LocalizerConfig());
+
+  // every event goes through here first, with its logMonoTime in seconds
+  void handle_time(double current_time) {
+    if (prev_update_time < 0) {
+      prev_update_time = current_time;
+    }
+  }
+  // gyro is v[0] of a sensor event of type 4
+  void handle_gyro(double gyro, double current_time);
+  void handle_camera_odometry(double rot_z, double rot_std_z, double current_time);
+  void handle_controls_state(double angle_steers, double v_ego, double current_time);
+};
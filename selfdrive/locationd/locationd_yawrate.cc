@@ -14,115 +14,44 @@
 #include "common/params.h"
 #include "common/timing.h"
 #include "params_learner.h"
+#include "localizer.h"
+#include "live_parameters.h"
 
 const int num_polls = 3;
 
-class Localizer
-{
-  Eigen::Matrix2d A;
-  Eigen::Matrix2d I;
-  Eigen::Matrix2d Q;
-  Eigen::Matrix2d P;
-  Eigen::Matrix<double, 1, 2> C_posenet;
-  Eigen::Matrix<double, 1, 2> C_gyro;
-
-  double R_gyro;
-
-  void update_state(const Eigen::Matrix<double, 1, 2> &C, const double R, double current_time, double meas) {
-    double dt = current_time - prev_update_time;
-    prev_update_time = current_time;
-    if (dt < 1.0e-9) {
-      return;
-    }
+static cereal::Event::Which handle_log(Localizer &localizer, const unsigned char* msg_dat, size_t msg_size) {
+  const kj::ArrayPtr<const capnp::word> view((const capnp::word*)msg_dat, msg_size);
+  capnp::FlatArrayMessageReader msg(view);
+  cereal::Event::Reader event = msg.getRoot<cereal::Event>();
+  double current_time = event.getLogMonoTime() / 1.0e9;
 
-    // x = A * x;
-    // P = A * P * A.transpose() + dt * Q;
-    // Simplify because A is unity
-    P = P + dt * Q;
+  localizer.handle_time(current_time);
 
-    double y = meas - C * x;
-    double S = R + C * P * C.transpose();
-    Eigen::Vector2d K = P * C.transpose() * (1.0 / S);
-    x = x + K * y;
-    P = (I - K * C) * P;
+  auto type = event.which();
+  switch(type) {
+  case cereal::Event::CONTROLS_STATE: {
+    auto controls_state = event.getControlsState();
+    localizer.handle_controls_state(controls_state.getAngleSteers(), controls_state.getVEgo(), current_time);
+    break;
   }
-
-  void handle_sensor_events(capnp::List<cereal::SensorEventData>::Reader sensor_events, double current_time) {
-    for (cereal::SensorEventData::Reader sensor_event : sensor_events){
+  case cereal::Event::CAMERA_ODOMETRY: {
+    auto camera_odometry = event.getCameraOdometry();
+    localizer.handle_camera_odometry(camera_odometry.getRot()[2], camera_odometry.getRotStd()[2], current_time);
+    break;
+  }
+  case cereal::Event::SENSOR_EVENTS:
+    for (cereal::SensorEventData::Reader sensor_event : event.getSensorEvents()){
       if (sensor_event.getType() == 4) {
-        sensor_data_time = current_time;
-
-        double meas = -sensor_event.getGyro().getV()[0];
-        update_state(C_gyro, R_gyro, current_time, meas);
+        localizer.handle_gyro(sensor_event.getGyro().getV()[0], current_time);
       }
     }
-
-  }
-
-  void handle_camera_odometry(cereal::CameraOdometry::Reader camera_odometry, double current_time) {
-    double R = 250.0 * pow(camera_odometry.getRotStd()[2], 2);
-    double meas = camera_odometry.getRot()[2];
-    update_state(C_posenet, R, current_time, meas);
-  }
-
-  void handle_controls_state(cereal::ControlsState::Reader controls_state, double current_time) {
-    steering_angle = controls_state.getAngleSteers() * DEGREES_TO_RADIANS;
-    car_speed = controls_state.getVEgo();
-    controls_state_time = current_time;
-  }
-
-
-public:
-  Eigen::Vector2d x;
-  double steering_angle = 0;
-  double car_speed = 0;
-  double prev_update_time = -1;
-  double controls_state_time = -1;
-  double sensor_data_time = -1;
-
-  Localizer() {
-    A << 1, 0, 0, 1;
-    I << 1, 0, 0, 1;
-
-    Q << pow(0.1, 2.0), 0, 0, pow(0.005 / 100.0, 2.0);
-    P << pow(1.0, 2.0), 0, 0, pow(0.05, 2.0);
-
-    C_posenet << 1, 0;
-    C_gyro << 1, 1;
-    x << 0, 0;
-
-    R_gyro = pow(0.05, 2.0);
-  }
-
-  cereal::Event::Which handle_log(const unsigned char* msg_dat, size_t msg_size) {
-    const kj::ArrayPtr<const capnp::word> view((const capnp::word*)msg_dat, msg_size);
-    capnp::FlatArrayMessageReader msg(view);
-    cereal::Event::Reader event = msg.getRoot<cereal::Event>();
-    double current_time = event.getLogMonoTime() / 1.0e9;
-
-    if (prev_update_time < 0) {
-      prev_update_time = current_time;
-    }
-
-    auto type = event.which();
-    switch(type) {
-    case cereal::Event::CONTROLS_STATE:
-      handle_controls_state(event.getControlsState(), current_time);
-      break;
-    case cereal::Event::CAMERA_ODOMETRY:
-      handle_camera_odometry(event.getCameraOdometry(), current_time);
-      break;
-    case cereal::Event::SENSOR_EVENTS:
-      handle_sensor_events(event.getSensorEvents(), current_time);
-      break;
-    default:
-      break;
-    }
-
-    return type;
+    break;
+  default:
+    break;
   }
-};
 
+  return type;
+}
 
 
 int main(int argc, char *argv[]) {
@@ -199,7 +128,15 @@ int main(int argc, char *argv[]) {
     }
   }
 
-  ParamsLearner learner(car_params, ao, x, sR, 1.0);
+  ParamsLearnerCar car = {
+    car_params.getTireStiffnessFront(),
+    car_params.getTireStiffnessRear(),
+    car_params.getWheelbase(),
+    car_params.getMass(),
+    car_params.getCenterToFront(),
+    car_params.getSteerRatio(),
+  };
+  ParamsLearner learner(car, ao, x, sR);
 
   // Main loop
   int save_counter = 0;
@@ -223,20 +160,13 @@ int main(int argc, char *argv[]) {
         auto amsg = kj::heapArray<capnp::word>((zmq_msg_size(&msg) / sizeof(capnp::word)) + 1);
         memcpy(amsg.begin(), zmq_msg_data(&msg), zmq_msg_size(&msg));
 
-        auto which = localizer.handle_log((const unsigned char*)amsg.begin(), amsg.size());
+        auto which = handle_log(localizer, (const unsigned char*)amsg.begin(), amsg.size());
         zmq_msg_close(&msg);
 
         if (which == cereal::Event::CONTROLS_STATE){
           save_counter++;
 
-          double yaw_rate = -localizer.x[0];
-          bool valid = learner.update(yaw_rate, localizer.car_speed, localizer.steering_angle);
-
-          // TODO: Fix in replay
-          double sensor_data_age = localizer.controls_state_time - localizer.sensor_data_time;
-
-          double angle_offset_degrees = RADIANS_TO_DEGREES * learner.ao;
-          double angle_offset_average_degrees = RADIANS_TO_DEGREES * learner.slow_ao;
+          LiveParameters p = live_parameters_update(localizer, learner);
 
           // Send parameters at 10 Hz
           if (save_counter % 10 == 0){
@@ -244,14 +174,14 @@ int main(int argc, char *argv[]) {
             cereal::Event::Builder event = msg.initRoot<cereal::Event>();
             event.setLogMonoTime(nanos_since_boot());
             auto live_params = event.initLiveParameters();
-            live_params.setValid(valid);
-            live_params.setYawRate(localizer.x[0]);
-            live_params.setGyroBias(localizer.x[1]);
-            live_params.setSensorValid(sensor_data_age < 5.0);
-            live_params.setAngleOffset(angle_offset_degrees);
-            live_params.setAngleOffsetAverage(angle_offset_average_degrees);
-            live_params.setStiffnessFactor(learner.x);
-            live_params.setSteerRatio(learner.sR);
+            live_params.setValid(p.valid);
+            live_params.setYawRate(p.yaw_rate);
+            live_params.setGyroBias(p.gyro_bias);
+            live_params.setSensorValid(p.sensor_valid);
+            live_params.setAngleOffset(p.angle_offset);
+            live_params.setAngleOffsetAverage(p.angle_offset_average);
+            live_params.setStiffnessFactor(p.stiffness_factor);
+            live_params.setSteerRatio(p.steer_ratio);
 
             auto words = capnp::messageToFlatArray(msg);
             auto bytes = words.asBytes();
@@ -264,9 +194,9 @@ int main(int argc, char *argv[]) {
             json11::Json json = json11::Json::object {
               {"carVin", vin},
               {"carFingerprint", fingerprint},
-              {"steerRatio", learner.sR},
-              {"stiffnessFactor", learner.x},
-              {"angleOffsetAverage", angle_offset_average_degrees},
+              {"steerRatio", p.steer_ratio},
+              {"stiffnessFactor", p.stiffness_factor},
+              {"angleOffsetAverage", p.angle_offset_average},
             };
 
             std::string out = json.dump();
@@ -293,7 +223,7 @@ extern "C" {
 
   void localizer_handle_log(void * localizer, const unsigned char * data, size_t len) {
     Localizer * loc = (Localizer*) localizer;
-    loc->handle_log(data, len);
+    handle_log(*loc, data, len);
   }
 
   double localizer_get_yaw(void * localizer) {
@@ -2,8 +2,6 @@
 #include <cmath>
 #include <iostream>
 
-#include "cereal/gen/cpp/log.capnp.h"
-#include "cereal/gen/cpp/car.capnp.h"
 #include "params_learner.h"
 
 // #define DEBUG
@@ -13,32 +11,36 @@ T clip(const T& n, const T& lower, const T& upper) {
   return std::max(lower, std::min(n, upper));
 }
 
-ParamsLearner::ParamsLearner(cereal::CarParams::Reader car_params,
+ParamsLearner::ParamsLearner(const ParamsLearnerCar &car,
                 double angle_offset,
                 double stiffness_factor,
                 double steer_ratio,
-                double learning_rate) :
+                const ParamsLearnerConfig &config) :
     ao(angle_offset * DEGREES_TO_RADIANS),
     slow_ao(angle_offset * DEGREES_TO_RADIANS),
     x(stiffness_factor),
     sR(steer_ratio) {
-  cF0 = car_params.getTireStiffnessFront();
-  cR0 = car_params.getTireStiffnessRear();
+  cF0 = car.tire_stiffness_front;
+  cR0 = car.tire_stiffness_rear;
 
-  l = car_params.getWheelbase();
-  m = car_params.getMass();
+  l = car.wheelbase;
+  m = car.mass;
 
-  aF = car_params.getCenterToFront();
+  aF = car.center_to_front;
   aR = l - aF;
 
-  min_sr = MIN_SR * car_params.getSteerRatio();
-  max_sr = MAX_SR * car_params.getSteerRatio();
-  min_sr_th = MIN_SR_TH * car_params.getSteerRatio();
-  max_sr_th = MAX_SR_TH * car_params.getSteerRatio();
-  alpha1 = 0.01 * learning_rate;
-  alpha2 = 0.0005 * learning_rate;
-  alpha3 = 0.1 * learning_rate;
-  alpha4 = 1.0 * learning_rate;
+  min_sr = config.min_sr * car.steer_ratio;
+  max_sr = config.max_sr * car.steer_ratio;
+  min_sr_th = config.min_sr_th * car.steer_ratio;
+  max_sr_th = config.max_sr_th * car.steer_ratio;
+  min_stiffness = config.min_stiffness;
+  max_stiffness = config.max_stiffness;
+  max_angle_offset = config.max_angle_offset;
+  max_angle_offset_th = config.max_angle_offset_th;
+  alpha1 = 0.01 * config.learning_rate;
+  alpha2 = 0.0005 * config.learning_rate;
+  alpha3 = 0.1 * config.learning_rate;
+  alpha4 = 1.0 * config.learning_rate;
 }
 
 bool ParamsLearner::update(double psi, double u, double sa) {
@@ -63,13 +65,18 @@ bool ParamsLearner::update(double psi, double u, double sa) {
   std::cout << "\tStiffness: " << x << "\t sR: " << sR << std::endl;
 #endif
 
-  ao = clip(ao, -MAX_ANGLE_OFFSET, MAX_ANGLE_OFFSET);
-  slow_ao = clip(slow_ao, -MAX_ANGLE_OFFSET, MAX_ANGLE_OFFSET);
-  x = clip(x, MIN_STIFFNESS, MAX_STIFFNESS);
+  ao = clip(ao, -max_angle_offset, max_angle_offset);
+  slow_ao = clip(slow_ao, -max_angle_offset, max_angle_offset);
+  x = clip(x, min_stiffness, max_stiffness);
   sR = clip(sR, min_sr, max_sr);
 
-  bool valid = fabs(slow_ao) < MAX_ANGLE_OFFSET_TH;
+  bool valid = fabs(slow_ao) < max_angle_offset_th;
   valid = valid && sR > min_sr_th;
   valid = valid && sR < max_sr_th;
   return valid;
 }
+
+double ParamsLearner::angle_error(double psi, double u, double sa) const {
+  double d = cF0*cR0*pow(l, 2)*x - m*pow(u, 2)*(aF*cF0 - aR*cR0);
+  return (sa - slow_ao) - psi*sR*d/(cF0*cR0*l*u*x);
+}
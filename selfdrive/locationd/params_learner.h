@@ -12,12 +12,34 @@
 #define MIN_SR_TH  0.55
 #define MAX_SR_TH  1.9
 
+// What the learner needs of CarParams.
+struct ParamsLearnerCar {
+  double tire_stiffness_front, tire_stiffness_rear;
+  double wheelbase, mass, center_to_front;
+  double steer_ratio;
+};
+
+// Steer ratio bounds are times the steer ratio of the car.
+struct ParamsLearnerConfig {
+  double learning_rate = 1.0;
+  double min_sr = MIN_SR;
+  double max_sr = MAX_SR;
+  double min_sr_th = MIN_SR_TH;
+  double max_sr_th = MAX_SR_TH;
+  double min_stiffness = MIN_STIFFNESS;
+  double max_stiffness = MAX_STIFFNESS;
+  double max_angle_offset = MAX_ANGLE_OFFSET;
+  double max_angle_offset_th = MAX_ANGLE_OFFSET_TH;
+};
+
 class ParamsLearner {
   double cF0, cR0;
   double aR, aF;
   double l, m;
 
   double min_sr, max_sr, min_sr_th, max_sr_th;
+  double min_stiffness, max_stiffness;
+  double max_angle_offset, max_angle_offset_th;
   double alpha1, alpha2, alpha3, alpha4;
 
 public:
@@ -25,11 +47,15 @@ public:
   double slow_ao;
   double x, sR;
 
-  ParamsLearner(cereal::CarParams::Reader car_params,
+  ParamsLearner(const ParamsLearnerCar &car,
                 double angle_offset,
                 double stiffness_factor,
                 double steer_ratio,
-                double learning_rate);
+                const ParamsLearnerConfig &config = ParamsLearnerConfig());
 
   bool update(double psi, double u, double sa);
+
+  // how far, in radians of steering angle, sa is from what the model says
+  // for yaw rate psi at speed u
+  double angle_error(double psi, double u, double sa) const;
 };
@@ -0,0 +1,231 @@
+#include <cassert>
+#include <cmath>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "localizer.h"
+#include "params_learner.h"
+#include "live_parameters.h"
+#include "params_replay.h"
+
+namespace {
+
+enum Source { CONTROLS, GYRO, ODOMETRY, CAR };
+
+// Merges the columns of a log by time. Ties go in the order params_learner
+// polls its sockets, controlsState, sensorEvents and then cameraOdometry.
+class EventMerge {
+  const ReplayLog *log;
+  int idx[4] = {0, 0, 0, 0};
+  int n[4];
+  const double *t[4];
+
+public:
+  EventMerge(const ReplayLog *log, bool use_car_state) : log(log) {
+    n[CONTROLS] = use_car_state ? 0 : log->n_controls;
+    n[GYRO] = log->n_gyro;
+    n[ODOMETRY] = log->n_odometry;
+    n[CAR] = use_car_state ? log->n_car : 0;
+    t[CONTROLS] = log->controls_t;
+    t[GYRO] = log->gyro_t;
+    t[ODOMETRY] = log->odometry_t;
+    t[CAR] = log->car_t;
+  }
+
+  // Returns false at the end of the log, else the source and index of the
+  // next event.
+  bool next(int *source, int *i) {
+    int best = -1;
+    for (int s = 0; s < 4; s++) {
+      if (idx[s] < n[s] && (best < 0 || t[s][idx[s]] < t[best][idx[best]])) {
+        best = s;
+      }
+    }
+    if (best < 0) {
+      return false;
+    }
+    *source = best;
+    *i = idx[best]++;
+    return true;
+  }
+};
+
+void replay_one(const ReplayCar *car, const ReplayLog *log, const ReplayConfig *config,
+                ReplayResult *result, int decimation) {
+  LocalizerConfig loc_config;
+  loc_config.q_yaw = config->q_yaw;
+  loc_config.q_bias = config->q_bias;
+  loc_config.p0_yaw = config->p0_yaw;
+  loc_config.p0_bias = config->p0_bias;
+  loc_config.r_gyro = config->r_gyro;
+  loc_config.r_posenet_scale = config->r_posenet_scale;
+
+  ParamsLearnerConfig learner_config;
+  learner_config.learning_rate = config->learning_rate;
+  learner_config.min_sr = config->min_sr;
+  learner_config.max_sr = config->max_sr;
+  learner_config.min_sr_th = config->min_sr_th;
+  learner_config.max_sr_th = config->max_sr_th;
+  learner_config.min_stiffness = config->min_stiffness;
+  learner_config.max_stiffness = config->max_stiffness;
+  learner_config.max_angle_offset = config->max_angle_offset;
+  learner_config.max_angle_offset_th = config->max_angle_offset_th;
+
+  ParamsLearnerCar learner_car = {
+    car->tire_stiffness_front,
+    car->tire_stiffness_rear,
+    car->wheelbase,
+    car->mass,
+    car->center_to_front,
+    car->steer_ratio,
+  };
+
+  Localizer localizer(loc_config);
+  ParamsLearner learner(learner_car, config->angle_offset, config->stiffness_factor, config->steer_ratio, learner_config);
+
+  // steer ratio after every update, for the settle time
+  std::vector<double> sr_t, sr;
+  sr_t.reserve(config->use_car_state ? log->n_car : log->n_controls);
+  sr.reserve(sr_t.capacity());
+
+  int updates = 0, valid_updates = 0, learning_updates = 0;
+  double angle_error_sq = 0;
+  int n_samples = 0;
+
+  EventMerge events(log, config->use_car_state);
+  int source, i;
+  while (events.next(&source, &i)) {
+    double current_time;
+    switch (source) {
+    case GYRO:
+      current_time = log->gyro_t[i];
+      localizer.handle_time(current_time);
+      localizer.handle_gyro(log->gyro[i], current_time);
+      continue;
+    case ODOMETRY:
+      current_time = log->odometry_t[i];
+      localizer.handle_time(current_time);
+      localizer.handle_camera_odometry(log->rot[i], log->rot_std[i], current_time);
+      continue;
+    case CAR:
+      current_time = log->car_t[i];
+      localizer.handle_time(current_time);
+      localizer.handle_controls_state(log->steering_angle[i], log->car_v_ego[i], current_time);
+      break;
+    default:
+      current_time = log->controls_t[i];
+      localizer.handle_time(current_time);
+      localizer.handle_controls_state(log->angle_steers[i], log->v_ego[i], current_time);
+      break;
+    }
+
+    updates++;
+    LiveParameters p = live_parameters_update(localizer, learner);
+    valid_updates += p.valid;
+
+    // where update() learns
+    if (localizer.car_speed > 10.0 && fabs(localizer.steering_angle) < (DEGREES_TO_RADIANS * 15.)) {
+      double e = learner.angle_error(-localizer.x[0], localizer.car_speed, localizer.steering_angle);
+      angle_error_sq += e * e;
+      learning_updates++;
+    }
+
+    sr_t.push_back(current_time);
+    sr.push_back(learner.sR);
+
+    if (updates % decimation == 0) {
+      const int k = n_samples++;
+      if (result->t) result->t[k] = current_time;
+      if (result->yaw_rate) result->yaw_rate[k] = p.yaw_rate;
+      if (result->gyro_bias) result->gyro_bias[k] = p.gyro_bias;
+      if (result->angle_offset) result->angle_offset[k] = p.angle_offset;
+      if (result->angle_offset_average) result->angle_offset_average[k] = p.angle_offset_average;
+      if (result->stiffness_factor) result->stiffness_factor[k] = p.stiffness_factor;
+      if (result->steer_ratio) result->steer_ratio[k] = p.steer_ratio;
+      if (result->valid) result->valid[k] = p.valid;
+      if (result->sensor_valid) result->sensor_valid[k] = p.sensor_valid;
+    }
+  }
+
+  result->n_samples = n_samples;
+  result->steer_ratio_final = learner.sR;
+  result->stiffness_factor_final = learner.x;
+  result->angle_offset_average_final = RADIANS_TO_DEGREES * learner.slow_ao;
+  result->valid_fraction = updates > 0 ? (double)valid_updates / updates : 0.0;
+  result->angle_error_rms = learning_updates > 0 ? RADIANS_TO_DEGREES * sqrt(angle_error_sq / learning_updates) : 0.0;
+
+  result->steer_ratio_settle_time = 0.0;
+  for (int k = (int)sr.size() - 1; k >= 0; k--) {
+    if (fabs(sr[k] - learner.sR) > 0.01 * fabs(learner.sR)) {
+      result->steer_ratio_settle_time = (k + 1 < (int)sr.size() ? sr_t[k + 1] : sr_t[k]) - sr_t[0];
+      break;
+    }
+  }
+}
+
+}
+
+extern "C" {
+
+void params_replay_default_config(const ReplayCar *car, ReplayConfig *config) {
+  LocalizerConfig loc_config;
+  config->q_yaw = loc_config.q_yaw;
+  config->q_bias = loc_config.q_bias;
+  config->p0_yaw = loc_config.p0_yaw;
+  config->p0_bias = loc_config.p0_bias;
+  config->r_gyro = loc_config.r_gyro;
+  config->r_posenet_scale = loc_config.r_posenet_scale;
+
+  ParamsLearnerConfig learner_config;
+  config->learning_rate = learner_config.learning_rate;
+  config->min_sr = learner_config.min_sr;
+  config->max_sr = learner_config.max_sr;
+  config->min_sr_th = learner_config.min_sr_th;
+  config->max_sr_th = learner_config.max_sr_th;
+  config->min_stiffness = learner_config.min_stiffness;
+  config->max_stiffness = learner_config.max_stiffness;
+  config->max_angle_offset = learner_config.max_angle_offset;
+  config->max_angle_offset_th = learner_config.max_angle_offset_th;
+
+  // as without LiveParameters from an earlier drive
+  config->steer_ratio = car->steer_ratio;
+  config->stiffness_factor = 1.0;
+  config->angle_offset = 0.0;
+  config->use_car_state = 0;
+}
+
+int params_replay_samples(const ReplayLog *log, const ReplayConfig *config, int decimation) {
+  assert(decimation > 0);
+  return (config->use_car_state ? log->n_car : log->n_controls) / decimation;
+}
+
+void params_replay(const ReplayCar *car, const ReplayLog *log, const ReplayConfig *configs,
+                   ReplayResult *results, int n_configs, int decimation, int n_threads) {
+  assert(decimation > 0);
+  if (n_threads <= 0) {
+    n_threads = std::max(1u, std::thread::hardware_concurrency());
+  }
+  n_threads = std::min(n_threads, n_configs);
+
+  // configs are handed out one at a time, a thread that is done early takes
+  // the next
+  std::atomic<int> next(0);
+  auto worker = [&]() {
+    for (int k = next++; k < n_configs; k = next++) {
+      replay_one(car, log, &configs[k], &results[k], decimation);
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (int k = 1; k < n_threads; k++) {
+    threads.emplace_back(worker);
+  }
+  worker();
+  for (auto &t : threads) {
+    t.join();
+  }
+}
+
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Runs the yaw rate localizer and the params learner of locationd over a
+// recorded drive for many configurations at once. Also declared in
+// params_replay_py.py.
+
+// What the learner needs of CarParams.
+typedef struct ReplayCar {
+  double tire_stiffness_front, tire_stiffness_rear;
+  double wheelbase, mass, center_to_front;
+  double steer_ratio;
+} ReplayCar;
+
+// Columns of the logs, by logMonoTime in seconds and in log order.
+typedef struct ReplayLog {
+  // sensorEvents of type 4, gyro v[0]
+  int n_gyro;
+  const double *gyro_t, *gyro;
+  // cameraOdometry rot[2] and rotStd[2]
+  int n_odometry;
+  const double *odometry_t, *rot, *rot_std;
+  // controlsState angleSteers in degrees and vEgo
+  int n_controls;
+  const double *controls_t, *angle_steers, *v_ego;
+  // carState steeringAngle in degrees and vEgo, used with use_car_state
+  int n_car;
+  const double *car_t, *steering_angle, *car_v_ego;
+} ReplayLog;
+
+typedef struct ReplayConfig {
+  // localizer noise, as standard deviations
+  double q_yaw, q_bias, p0_yaw, p0_bias, r_gyro, r_posenet_scale;
+  // learner, steer ratio bounds are times the steer ratio of the car
+  double learning_rate;
+  double min_sr, max_sr, min_sr_th, max_sr_th;
+  double min_stiffness, max_stiffness;
+  double max_angle_offset, max_angle_offset_th;
+  // where learning starts, angle offset in degrees
+  double steer_ratio, stiffness_factor, angle_offset;
+  // learn on carState instead of controlsState, for logs without it
+  int use_car_state;
+} ReplayConfig;
+
+typedef struct ReplayResult {
+  // liveParameters as params_learner would send them, every decimation
+  // controlsState. Arrays of params_replay_samples() each, may be NULL.
+  double *t, *yaw_rate, *gyro_bias, *angle_offset, *angle_offset_average;
+  double *stiffness_factor, *steer_ratio;
+  uint8_t *valid, *sensor_valid;
+  int n_samples;
+
+  double steer_ratio_final, stiffness_factor_final, angle_offset_average_final;
+  // seconds from the first learner update until steer ratio stays within 1%
+  // of where it ends
+  double steer_ratio_settle_time;
+  // of all learner updates
+  double valid_fraction;
+  // rms of steering angle against the learned model over the updates
+  // that learn, in degrees
+  double angle_error_rms;
+} ReplayResult;
+
+// the config params_learner runs with
+void params_replay_default_config(const ReplayCar *car, ReplayConfig *config);
+int params_replay_samples(const ReplayLog *log, const ReplayConfig *config, int decimation);
+// n_threads 0 is one per core
+void params_replay(const ReplayCar *car, const ReplayLog *log, const ReplayConfig *configs,
+                   ReplayResult *results, int n_configs, int decimation, int n_threads);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,157 @@
+import os
+import numpy as np
+
+from cffi import FFI
+import subprocess
+
+locationd_dir = os.path.dirname(os.path.abspath(__file__))
+subprocess.check_call(["make", "libparams_replay.so"], cwd=locationd_dir)
+
+ffi = FFI()
+ffi.cdef("""
+typedef struct ReplayCar {
+  double tire_stiffness_front, tire_stiffness_rear;
+  double wheelbase, mass, center_to_front;
+  double steer_ratio;
+} ReplayCar;
+
+typedef struct ReplayLog {
+  int n_gyro;
+  const double *gyro_t, *gyro;
+  int n_odometry;
+  const double *odometry_t, *rot, *rot_std;
+  int n_controls;
+  const double *controls_t, *angle_steers, *v_ego;
+  int n_car;
+  const double *car_t, *steering_angle, *car_v_ego;
+} ReplayLog;
+
+typedef struct ReplayConfig {
+  double q_yaw, q_bias, p0_yaw, p0_bias, r_gyro, r_posenet_scale;
+  double learning_rate;
+  double min_sr, max_sr, min_sr_th, max_sr_th;
+  double min_stiffness, max_stiffness;
+  double max_angle_offset, max_angle_offset_th;
+  double steer_ratio, stiffness_factor, angle_offset;
+  int use_car_state;
+} ReplayConfig;
+
+typedef struct ReplayResult {
+  double *t, *yaw_rate, *gyro_bias, *angle_offset, *angle_offset_average;
+  double *stiffness_factor, *steer_ratio;
+  uint8_t *valid, *sensor_valid;
+  int n_samples;
+
+  double steer_ratio_final, stiffness_factor_final, angle_offset_average_final;
+  double steer_ratio_settle_time;
+  double valid_fraction;
+  double angle_error_rms;
+} ReplayResult;
+
+void params_replay_default_config(const ReplayCar *car, ReplayConfig *config);
+int params_replay_samples(const ReplayLog *log, const ReplayConfig *config, int decimation);
+void params_replay(const ReplayCar *car, const ReplayLog *log, const ReplayConfig *configs,
+                   ReplayResult *results, int n_configs, int decimation, int n_threads);
+""")
+
+libparams_replay = ffi.dlopen(os.path.join(locationd_dir, "libparams_replay.so"))
+
+CONFIG_FIELDS = ['q_yaw', 'q_bias', 'p0_yaw', 'p0_bias', 'r_gyro', 'r_posenet_scale',
+                 'learning_rate', 'min_sr', 'max_sr', 'min_sr_th', 'max_sr_th',
+                 'min_stiffness', 'max_stiffness', 'max_angle_offset', 'max_angle_offset_th',
+                 'steer_ratio', 'stiffness_factor', 'angle_offset', 'use_car_state']
+
+SAMPLE_FIELDS = [('t', np.float64, 'double *'), ('yaw_rate', np.float64, 'double *'),
+                 ('gyro_bias', np.float64, 'double *'), ('angle_offset', np.float64, 'double *'),
+                 ('angle_offset_average', np.float64, 'double *'),
+                 ('stiffness_factor', np.float64, 'double *'), ('steer_ratio', np.float64, 'double *'),
+                 ('valid', np.uint8, 'uint8_t *'), ('sensor_valid', np.uint8, 'uint8_t *')]
+
+METRIC_FIELDS = ['steer_ratio_final', 'stiffness_factor_final', 'angle_offset_average_final',
+                 'steer_ratio_settle_time', 'valid_fraction', 'angle_error_rms']
+
+
+def _ptr(a):
+  return ffi.cast("double *", a.ctypes.data)
+
+
+class ParamsReplay(object):
+  """Runs the yaw rate localizer and params learner of params_learner over
+  a drive, for many configs at once on all cores. Trajectories are the
+  liveParameters it would have sent, metrics are of the whole drive."""
+
+  def __init__(self, car_params, msgs):
+    """car_params is a CarParams, msgs the events of a drive in log order,
+    as from LogReader"""
+    self.car = ffi.new("ReplayCar *")
+    self.car.tire_stiffness_front = car_params.tireStiffnessFront
+    self.car.tire_stiffness_rear = car_params.tireStiffnessRear
+    self.car.wheelbase = car_params.wheelbase
+    self.car.mass = car_params.mass
+    self.car.center_to_front = car_params.centerToFront
+    self.car.steer_ratio = car_params.steerRatio
+
+    cols = {k: [] for k in ['gyro_t', 'gyro', 'odometry_t', 'rot', 'rot_std',
+                            'controls_t', 'angle_steers', 'v_ego', 'car_t', 'steering_angle', 'car_v_ego']}
+    for msg in msgs:
+      t = msg.logMonoTime / 1.0e9
+      which = msg.which()
+      if which == 'sensorEvents':
+        for sensor_event in msg.sensorEvents:
+          if sensor_event.type == 4:
+            cols['gyro_t'].append(t)
+            cols['gyro'].append(sensor_event.gyro.v[0])
+      elif which == 'cameraOdometry':
+        cols['odometry_t'].append(t)
+        cols['rot'].append(msg.cameraOdometry.rot[2])
+        cols['rot_std'].append(msg.cameraOdometry.rotStd[2])
+      elif which == 'controlsState':
+        cols['controls_t'].append(t)
+        cols['angle_steers'].append(msg.controlsState.angleSteers)
+        cols['v_ego'].append(msg.controlsState.vEgo)
+      elif which == 'carState':
+        cols['car_t'].append(t)
+        cols['steering_angle'].append(msg.carState.steeringAngle)
+        cols['car_v_ego'].append(msg.carState.vEgo)
+
+    # kept alive as long as the log points at them
+    self.cols = {k: np.ascontiguousarray(v, dtype=np.float64) for k, v in cols.items()}
+    self.log = ffi.new("ReplayLog *")
+    self.log.n_gyro = len(self.cols['gyro'])
+    self.log.n_odometry = len(self.cols['rot'])
+    self.log.n_controls = len(self.cols['v_ego'])
+    self.log.n_car = len(self.cols['car_v_ego'])
+    for k, v in self.cols.items():
+      setattr(self.log, k, _ptr(v))
+
+  def default_config(self):
+    config = ffi.new("ReplayConfig *")
+    libparams_replay.params_replay_default_config(self.car, config)
+    return {k: getattr(config, k) for k in CONFIG_FIELDS}
+
+  def run(self, configs, decimation=10, threads=0):
+    """configs is a list of dicts of what differs from default_config().
+    Returns a dict of trajectories and metrics for each."""
+    default = self.default_config()
+    n = len(configs)
+    c_configs = ffi.new("ReplayConfig[]", n)
+    c_results = ffi.new("ReplayResult[]", n)
+    out = []
+    for i, config in enumerate(configs):
+      for k in CONFIG_FIELDS:
+        setattr(c_configs[i], k, config.get(k, default[k]))
+      n_samples = libparams_replay.params_replay_samples(self.log, ffi.addressof(c_configs, i), decimation)
+      res = {}
+      for k, dtype, ctype in SAMPLE_FIELDS:
+        res[k] = np.empty(n_samples, dtype=dtype)
+        setattr(c_results[i], k, ffi.cast(ctype, res[k].ctypes.data))
+      out.append(res)
+
+    libparams_replay.params_replay(self.car, self.log, c_configs, c_results, n, decimation, threads)
+
+    for i, res in enumerate(out):
+      res['valid'] = res['valid'].astype(bool)
+      res['sensor_valid'] = res['sensor_valid'].astype(bool)
+      for k in METRIC_FIELDS:
+        res[k] = getattr(c_results[i], k)
+    return out
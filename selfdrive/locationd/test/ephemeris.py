@@ -70,7 +70,7 @@ on of this parser
     i_0 = (GET_FIELD_S(subframes[3][2+2], 8, 6) << 24) | GET_FIELD_U(
       subframes[3][2+3], 24, 6)
     c_rc = GET_FIELD_S(subframes[3][2+4], 16, 14)
-    w = (GET_FIELD_S(subframes[3][2+4], 8, 6) << 24) | GET_FIELD_U(subframes[3][5], 24, 6)
+    w = (GET_FIELD_S(subframes[3][2+4], 8, 6) << 24) | GET_FIELD_U(subframes[3][2+5], 24, 6)
     omega_dot = GET_FIELD_S(subframes[3][2+6], 24, 6)
     idot = GET_FIELD_S(subframes[3][2+7], 14, 8)
 
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <stdint.h>
+#include <math.h>
+#include <map>
+#include <vector>
+
+// EphemerisData as ubloxd had it before the table driven decoding, kept to
+// test gps_ephemeris_decode against.
+namespace ublox_old {
+
+typedef std::map<uint8_t, std::vector<uint32_t>> subframes_map;
+
+#define GET_FIELD_U(w, nb, pos) (((w) >> (pos)) & ((1<<(nb))-1))
+
+inline int twos_complement(uint32_t v, uint32_t nb) {
+  int sign = v >> (nb - 1);
+  int value = v;
+  if(sign != 0)
+    value = value - (1 << nb);
+  return value;
+}
+
+inline int GET_FIELD_S(uint32_t w, uint32_t nb, uint32_t pos) {
+  int v = GET_FIELD_U(w, nb, pos);
+  return twos_complement(v, nb);
+}
+
+class EphemerisData {
+  public:
+    EphemerisData(uint8_t svId, subframes_map subframes) {
+      this->svId = svId;
+      int week_no = GET_FIELD_U(subframes[1][2+0], 10, 20);
+      int t_gd = GET_FIELD_S(subframes[1][2+4], 8, 6);
+      int iodc = (GET_FIELD_U(subframes[1][2+0], 2, 6) << 8) | GET_FIELD_U(
+        subframes[1][2+5], 8, 22);
+
+      int t_oc = GET_FIELD_U(subframes[1][2+5], 16, 6);
+      int a_f2 = GET_FIELD_S(subframes[1][2+6], 8, 22);
+      int a_f1 = GET_FIELD_S(subframes[1][2+6], 16, 6);
+      int a_f0 = GET_FIELD_S(subframes[1][2+7], 22, 8);
+
+      int c_rs = GET_FIELD_S(subframes[2][2+0], 16, 6);
+      int delta_n = GET_FIELD_S(subframes[2][2+1], 16, 14);
+      int m_0 = (GET_FIELD_S(subframes[2][2+1], 8, 6) << 24) | GET_FIELD_U(
+        subframes[2][2+2], 24, 6);
+      int c_uc = GET_FIELD_S(subframes[2][2+3], 16, 14);
+      int e = (GET_FIELD_U(subframes[2][2+3], 8, 6) << 24) | GET_FIELD_U(subframes[2][2+4], 24, 6);
+      int c_us = GET_FIELD_S(subframes[2][2+5], 16, 14);
+      uint32_t a_powhalf = (GET_FIELD_U(subframes[2][2+5], 8, 6) << 24) | GET_FIELD_U(
+        subframes[2][2+6], 24, 6);
+      int t_oe = GET_FIELD_U(subframes[2][2+7], 16, 14);
+
+      int c_ic = GET_FIELD_S(subframes[3][2+0], 16, 14);
+      int omega_0 = (GET_FIELD_S(subframes[3][2+0], 8, 6) << 24) | GET_FIELD_U(
+        subframes[3][2+1], 24, 6);
+      int c_is = GET_FIELD_S(subframes[3][2+2], 16, 14);
+      int i_0 = (GET_FIELD_S(subframes[3][2+2], 8, 6) << 24) | GET_FIELD_U(
+        subframes[3][2+3], 24, 6);
+      int c_rc = GET_FIELD_S(subframes[3][2+4], 16, 14);
+      int w = (GET_FIELD_S(subframes[3][2+4], 8, 6) << 24) | GET_FIELD_U(subframes[3][5], 24, 6);
+      int omega_dot = GET_FIELD_S(subframes[3][2+6], 24, 6);
+      int idot = GET_FIELD_S(subframes[3][2+7], 14, 8);
+
+      this->_rsvd1 = GET_FIELD_U(subframes[1][2+1], 23, 6);
+      this->_rsvd2 = GET_FIELD_U(subframes[1][2+2], 24, 6);
+      this->_rsvd3 = GET_FIELD_U(subframes[1][2+3], 24, 6);
+      this->_rsvd4 = GET_FIELD_U(subframes[1][2+4], 16, 14);
+      this->aodo = GET_FIELD_U(subframes[2][2+7], 5, 8);
+
+      double gpsPi = 3.1415926535898;
+
+      // now form variables in radians, meters and seconds etc
+      this->Tgd = t_gd * pow(2, -31);
+      this->A = pow(a_powhalf * pow(2, -19), 2.0);
+      this->cic = c_ic * pow(2, -29);
+      this->cis = c_is * pow(2, -29);
+      this->crc = c_rc * pow(2, -5);
+      this->crs = c_rs * pow(2, -5);
+      this->cuc = c_uc * pow(2, -29);
+      this->cus = c_us * pow(2, -29);
+      this->deltaN = delta_n * pow(2, -43) * gpsPi;
+      this->ecc = e * pow(2, -33);
+      this->i0 = i_0 * pow(2, -31) * gpsPi;
+      this->idot = idot * pow(2, -43) * gpsPi;
+      this->M0 = m_0 * pow(2, -31) * gpsPi;
+      this->omega = w * pow(2, -31) * gpsPi;
+      this->omega_dot = omega_dot * pow(2, -43) * gpsPi;
+      this->omega0 = omega_0 * pow(2, -31) * gpsPi;
+      this->toe = t_oe * pow(2, 4);
+
+      this->toc = t_oc * pow(2, 4);
+      this->gpsWeek = week_no;
+      this->af0 = a_f0 * pow(2, -31);
+      this->af1 = a_f1 * pow(2, -43);
+      this->af2 = a_f2 * pow(2, -55);
+
+      uint32_t iode1 = GET_FIELD_U(subframes[2][2+0], 8, 22);
+      uint32_t iode2 = GET_FIELD_U(subframes[3][2+7], 8, 22);
+      this->valid = (iode1 == iode2) && (iode1 == (iodc & 0xff));
+      this->iode = iode1;
+
+      if (GET_FIELD_U(subframes[4][2+0], 6, 22) == 56 &&
+        GET_FIELD_U(subframes[4][2+0], 2, 28) == 1 &&
+        GET_FIELD_U(subframes[5][2+0], 2, 28) == 1) {
+        double a0 = GET_FIELD_S(subframes[4][2], 8, 14) * pow(2, -30);
+        double a1 = GET_FIELD_S(subframes[4][2], 8, 6) * pow(2, -27);
+        double a2 = GET_FIELD_S(subframes[4][3], 8, 22) * pow(2, -24);
+        double a3 = GET_FIELD_S(subframes[4][3], 8, 14) * pow(2, -24);
+        double b0 = GET_FIELD_S(subframes[4][3], 8, 6) * pow(2, 11);
+        double b1 = GET_FIELD_S(subframes[4][4], 8, 22) * pow(2, 14);
+        double b2 = GET_FIELD_S(subframes[4][4], 8, 14) * pow(2, 16);
+        double b3 = GET_FIELD_S(subframes[4][4], 8, 6) * pow(2, 16);
+        this->ionoAlpha[0] = a0;this->ionoAlpha[1] = a1;this->ionoAlpha[2] = a2;this->ionoAlpha[3] = a3;
+        this->ionoBeta[0] = b0;this->ionoBeta[1] = b1;this->ionoBeta[2] = b2;this->ionoBeta[3] = b3;
+        this->ionoCoeffsValid = true;
+      } else {
+        this->ionoCoeffsValid = false;
+      }
+    }
+    uint16_t svId;
+    double Tgd, A, cic, cis, crc, crs, cuc, cus, deltaN, ecc, i0, idot, M0, omega, omega_dot, omega0, toe, toc;
+    uint32_t gpsWeek, iode, _rsvd1, _rsvd2, _rsvd3, _rsvd4, aodo;
+    double af0, af1, af2;
+    bool valid;
+    double ionoAlpha[4], ionoBeta[4];
+    bool ionoCoeffsValid;
+};
+
+#undef GET_FIELD_U
+
+}
@@ -0,0 +1,123 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <assert.h>
+
+#include "common/timing.h"
+
+#define W 1164
+#define H 874
+
+#include "../get_vp.c"
+#include "get_vp_old.h"
+
+// Checks that increment_grid votes as it did, on flow lines through a
+// vanishing point with outliers, and prints how long a call takes against
+// the number of lines. Lines recorded as triples of doubles can be passed
+// in a file, they are checked the same way.
+//
+// usage: get_vp_test [lines file]
+
+#define VP_X 570.0
+#define VP_Y 430.0
+
+static double rand_uniform(double lo, double hi) {
+  return lo + (hi - lo) * rand() / RAND_MAX;
+}
+
+// a x + b y = c through p along d
+static void make_line(double *L, double px, double py, double dx, double dy) {
+  L[0] = -dy;
+  L[1] = dx;
+  L[2] = -dy * px + dx * py;
+}
+
+static void make_lines(double *lines, int n) {
+  for (int i = 0; i < n; i++) {
+    double px = rand_uniform(0, W), py = rand_uniform(0, H);
+    if (i % 5 == 0) {
+      make_line(lines + i*3, px, py, rand_uniform(-1, 1), rand_uniform(-1, 1));
+    } else {
+      double dx = px - VP_X + rand_uniform(-2, 2), dy = py - VP_Y + rand_uniform(-2, 2);
+      make_line(lines + i*3, px, py, dx, dy);
+    }
+  }
+}
+
+static void grid_max(const double *grid, int *x, int *y) {
+  int best = 0;
+  for (int i = 1; i < (W+1)*(H+1); i++) {
+    if (grid[i] > grid[best]) best = i;
+  }
+  *x = best % (W+1);
+  *y = best / (W+1);
+}
+
+static void check(double *lines, int n, double *grid, double *grid_old) {
+  memset(grid, 0, (W+1)*(H+1)*sizeof(double));
+  memset(grid_old, 0, (W+1)*(H+1)*sizeof(double));
+  increment_grid(grid, lines, n);
+  increment_grid_old(grid_old, lines, n);
+  for (int i = 0; i < (W+1)*(H+1); i++) {
+    assert(grid[i] == grid_old[i]);
+  }
+}
+
+int main(int argc, char **argv) {
+  double *grid = (double *)calloc((W+1)*(H+1), sizeof(double));
+  double *grid_old = (double *)calloc((W+1)*(H+1), sizeof(double));
+  double *lines = (double *)malloc(2000*3*sizeof(double));
+
+  for (int r = 0; r < 20; r++) {
+    int n = 1 + rand() % 300;
+    make_lines(lines, n);
+    // lines along the axes and through the border
+    if (r % 2) {
+      lines[0] = 0;
+      lines[n > 1 ? 4 : 1] = 0;
+    }
+    check(lines, n, grid, grid_old);
+  }
+
+  int x, y;
+  make_lines(lines, 500);
+  check(lines, 500, grid, grid_old);
+  grid_max(grid, &x, &y);
+  printf("synthetic ok, vanishing point %d %d\n", x, y);
+  assert(fabs(x - VP_X) <= 3 && fabs(y - VP_Y) <= 3);
+
+  if (argc > 1) {
+    FILE *f = fopen(argv[1], "rb");
+    assert(f);
+    fseek(f, 0, SEEK_END);
+    long n = ftell(f) / (3*sizeof(double));
+    fseek(f, 0, SEEK_SET);
+    double *recorded = (double *)malloc(n*3*sizeof(double));
+    assert(fread(recorded, 3*sizeof(double), n, f) == (size_t)n);
+    fclose(f);
+    check(recorded, n, grid, grid_old);
+    grid_max(grid, &x, &y);
+    printf("recorded ok, %ld lines, vanishing point %d %d\n", n, x, y);
+    free(recorded);
+  }
+
+  const int sizes[] = {50, 100, 200, 500, 1000, 2000};
+  for (int s = 0; s < (int)(sizeof(sizes) / sizeof(sizes[0])); s++) {
+    int n = sizes[s];
+    int reps = 2000000 / (n * n) + 1;
+    make_lines(lines, n);
+
+    double t1 = millis_since_boot();
+    for (int r = 0; r < reps; r++) increment_grid(grid, lines, n);
+    double t2 = millis_since_boot();
+    for (int r = 0; r < reps; r++) increment_grid_old(grid_old, lines, n);
+    double t3 = millis_since_boot();
+    printf("%5d lines: %9.3f ms, was %9.3f ms\n", n, (t2 - t1) / reps, (t3 - t2) / reps);
+  }
+
+  free(lines);
+  free(grid);
+  free(grid_old);
+  return 0;
+}
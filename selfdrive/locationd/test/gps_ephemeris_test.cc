@@ -0,0 +1,328 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <assert.h>
+#include <string>
+#include <vector>
+
+#include "common/timing.h"
+
+#include "../gps_ephemeris.h"
+#include "../ublox_frame.h"
+#include "ephemeris_old.h"
+
+// Checks gps_ephemeris_decode against the EphemerisData it replaced and
+// gps_orbits_sat_info against a plain reference of IS-GPS-200 Table 20-IV,
+// and prints how many satellites a second each does. With a raw ublox
+// stream, as ubloxd_test takes it, the ephemerides and measurements in it
+// are checked too.
+//
+// usage: gps_ephemeris_test [stream file]
+
+#define SATS 12
+#define EPOCHS 100000
+
+static const double C = 299792458.0;
+
+static double rand_uniform(double lo, double hi) {
+  return lo + (hi - lo) * rand() / RAND_MAX;
+}
+
+static uint32_t rand_word() {
+  return (((uint32_t)rand() << 8) ^ rand()) & 0x3fffffff;
+}
+
+static void reference_pos_clock(const GpsEphemeris &e, double t, double pos[3], double *clock_err) {
+  const double gm = 3.986005e14, omega_e = 7.2921151467e-5, f_rel = -4.442807633e-10;
+  double tk = t - e.toe;
+  if (tk > 302400) tk -= 604800;
+  if (tk < -302400) tk += 604800;
+  const double n = sqrt(gm / pow(e.A, 3)) + e.deltaN;
+  const double mk = e.M0 + n * tk;
+  double ek = mk;
+  for (int i = 0; i < 30; i++) {
+    const double next = mk + e.ecc * sin(ek);
+    const bool done = fabs(next - ek) < 1e-15;
+    ek = next;
+    if (done) break;
+  }
+  const double vk = atan2(sqrt(1 - e.ecc * e.ecc) * sin(ek), cos(ek) - e.ecc);
+  const double phi = vk + e.omega;
+  const double uk = phi + e.cus * sin(2 * phi) + e.cuc * cos(2 * phi);
+  const double rk = e.A * (1 - e.ecc * cos(ek)) + e.crs * sin(2 * phi) + e.crc * cos(2 * phi);
+  const double ik = e.i0 + e.idot * tk + e.cis * sin(2 * phi) + e.cic * cos(2 * phi);
+  const double xp = rk * cos(uk), yp = rk * sin(uk);
+  const double om = e.omega0 + (e.omega_dot - omega_e) * tk - omega_e * e.toe;
+  pos[0] = xp * cos(om) - yp * cos(ik) * sin(om);
+  pos[1] = xp * sin(om) + yp * cos(ik) * cos(om);
+  pos[2] = yp * sin(ik);
+
+  double tc = t - e.toc;
+  if (tc > 302400) tc -= 604800;
+  if (tc < -302400) tc += 604800;
+  *clock_err = e.af0 + e.af1 * tc + e.af2 * tc * tc + f_rel * e.ecc * sqrt(e.A) * sin(ek) - e.Tgd;
+}
+
+// velocities and clock rate by differences
+static void reference_sat_info(const GpsEphemeris &e, double t, double pos[3], double vel[3],
+                               double *clock_err, double *clock_rate_err) {
+  // long enough for the rounding of t not to matter
+  const double dt = 0.1;
+  double p1[3], p2[3], c1, c2;
+  reference_pos_clock(e, t, pos, clock_err);
+  reference_pos_clock(e, t - dt, p1, &c1);
+  reference_pos_clock(e, t + dt, p2, &c2);
+  for (int k = 0; k < 3; k++) vel[k] = (p2[k] - p1[k]) / (2 * dt);
+  *clock_rate_err = (c2 - c1) / (2 * dt);
+}
+
+static int check_sats(void *orbits, const std::vector<GpsEphemeris> &ephs, const std::vector<int> &sv_ids,
+                      const std::vector<double> &t) {
+  const int n = sv_ids.size();
+  std::vector<double> pos(3 * n), vel(3 * n), clock_err(n), clock_rate_err(n);
+  const int found = gps_orbits_sat_info(orbits, n, sv_ids.data(), t.data(), pos.data(), vel.data(),
+                                        clock_err.data(), clock_rate_err.data());
+  for (int i = 0; i < n; i++) {
+    const GpsEphemeris *e = NULL;
+    for (const GpsEphemeris &x : ephs) {
+      if (x.svId == sv_ids[i]) e = &x;
+    }
+    if (e == NULL) {
+      assert(isnan(pos[3 * i]) && isnan(clock_err[i]));
+      continue;
+    }
+    double rp[3], rv[3], rc, rcr;
+    reference_sat_info(*e, t[i], rp, rv, &rc, &rcr);
+    const double r = sqrt(rp[0] * rp[0] + rp[1] * rp[1] + rp[2] * rp[2]);
+    assert(r > 2.5e7 && r < 2.8e7);
+    for (int k = 0; k < 3; k++) {
+      assert(fabs(pos[3 * i + k] - rp[k]) < 1e-6);
+      assert(fabs(vel[3 * i + k] - rv[k]) < 1e-4);
+    }
+    assert(fabs(clock_err[i] - rc) < 1e-15);
+    assert(fabs(clock_rate_err[i] - rcr) < 1e-12);
+  }
+  return found;
+}
+
+// a made up ephemeris of a GPS orbit
+static GpsEphemeris random_ephemeris(int sv_id) {
+  GpsEphemeris e;
+  memset(&e, 0, sizeof(e));
+  e.svId = sv_id;
+  e.A = pow(rand_uniform(5153.5, 5153.8), 2);
+  e.ecc = rand_uniform(0, 0.02);
+  e.i0 = rand_uniform(0.93, 0.99);
+  e.omega0 = rand_uniform(-M_PI, M_PI);
+  e.omega = rand_uniform(-M_PI, M_PI);
+  e.M0 = rand_uniform(-M_PI, M_PI);
+  e.deltaN = rand_uniform(3e-9, 6e-9);
+  e.omega_dot = rand_uniform(-8.5e-9, -7.5e-9);
+  e.idot = rand_uniform(-5e-10, 5e-10);
+  e.cuc = rand_uniform(-1e-5, 1e-5);
+  e.cus = rand_uniform(-1e-5, 1e-5);
+  e.cic = rand_uniform(-2e-7, 2e-7);
+  e.cis = rand_uniform(-2e-7, 2e-7);
+  e.crc = rand_uniform(-300, 300);
+  e.crs = rand_uniform(-300, 300);
+  // near the end of the week now and then, for the times after it
+  e.toe = rand() % 4 == 0 ? 597600 : 16 * (rand() % 37800);
+  e.toc = e.toe;
+  e.af0 = rand_uniform(-5e-4, 5e-4);
+  e.af1 = rand_uniform(-1e-11, 1e-11);
+  e.af2 = 0;
+  e.Tgd = rand_uniform(-1e-8, 1e-8);
+  return e;
+}
+
+static void test_decode() {
+  for (int it = 0; it < 10000; it++) {
+    std::vector<uint32_t> words[6];
+    for (int s = 1; s <= 5; s++) {
+      for (int w = 0; w < 10; w++) words[s].push_back(rand_word());
+    }
+    // the old decoder keeps e in an int, real ones are far from its sign bit
+    words[2][5] &= ~(1U << 13);
+    if (it % 2) {
+      words[4][2] = (words[4][2] & ~(0xffU << 22)) | (1U << 28) | (56U << 22);
+      words[5][2] = (words[5][2] & ~(0x3U << 28)) | (1U << 28);
+    }
+
+    ublox_old::subframes_map map;
+    const uint32_t *subframes[6] = {NULL};
+    for (int s = 1; s <= 5; s++) {
+      map[s] = words[s];
+      subframes[s] = words[s].data();
+    }
+    ublox_old::EphemerisData old(it % 32 + 1, map);
+    GpsEphemeris eph;
+    gps_ephemeris_decode(it % 32 + 1, subframes, &eph);
+
+#define SAME(f) assert(memcmp(&eph.f, &old.f, sizeof(eph.f)) == 0)
+    SAME(svId); SAME(Tgd); SAME(A); SAME(cic); SAME(cis); SAME(crc); SAME(crs); SAME(cuc); SAME(cus);
+    SAME(deltaN); SAME(ecc); SAME(i0); SAME(idot); SAME(M0); SAME(omega_dot); SAME(omega0);
+    SAME(toe); SAME(toc); SAME(gpsWeek); SAME(iode); SAME(_rsvd1); SAME(_rsvd2); SAME(_rsvd3);
+    SAME(_rsvd4); SAME(aodo); SAME(af0); SAME(af1); SAME(af2); SAME(valid); SAME(ionoCoeffsValid);
+    if (eph.ionoCoeffsValid) {
+      SAME(ionoAlpha); SAME(ionoBeta);
+    }
+#undef SAME
+    // the old decoder took the low bits of omega from the word of i0
+    const int32_t w = (int32_t)((((words[3][6] >> 6) & 0xff) << 24) | ((words[3][7] >> 6) & 0xffffff));
+    assert(eph.omega == w * pow(2, -31) * 3.1415926535898);
+  }
+  printf("decode ok\n");
+}
+
+static void test_orbits() {
+  void *orbits = gps_orbits_init();
+  std::vector<GpsEphemeris> ephs;
+  for (int sv = 1; sv <= 32; sv++) {
+    if (sv % 5 == 0) continue;
+    ephs.push_back(random_ephemeris(sv));
+    gps_orbits_update(orbits, &ephs.back());
+  }
+
+  int found = 0;
+  for (int it = 0; it < 2000; it++) {
+    std::vector<int> sv_ids;
+    std::vector<double> t;
+    for (int i = 0; i < SATS; i++) {
+      const int sv = rand() % 34;
+      sv_ids.push_back(sv);
+      const GpsEphemeris *e = NULL;
+      for (const GpsEphemeris &x : ephs) {
+        if (x.svId == sv) e = &x;
+      }
+      double ti = (e ? e->toe : 0) + rand_uniform(-7200, 7200);
+      ti = fmod(ti + 604800, 604800);
+      t.push_back(ti);
+    }
+    found += check_sats(orbits, ephs, sv_ids, t);
+  }
+  gps_orbits_free(orbits);
+  printf("orbits ok, %d satellites\n", found);
+}
+
+static void bench() {
+  void *orbits = gps_orbits_init();
+  std::vector<GpsEphemeris> ephs;
+  std::vector<int> sv_ids;
+  std::vector<double> t;
+  for (int sv = 1; sv <= SATS; sv++) {
+    ephs.push_back(random_ephemeris(sv));
+    gps_orbits_update(orbits, &ephs.back());
+    sv_ids.push_back(sv);
+    t.push_back(ephs.back().toe + 100);
+  }
+
+  std::vector<double> pos(3 * SATS), vel(3 * SATS), clock_err(SATS), clock_rate_err(SATS);
+  double sum = 0;
+  double t1 = millis_since_boot();
+  for (int e = 0; e < EPOCHS; e++) {
+    for (int i = 0; i < SATS; i++) t[i] += 1e-3;
+    gps_orbits_sat_info(orbits, SATS, sv_ids.data(), t.data(), pos.data(), vel.data(), clock_err.data(), clock_rate_err.data());
+    sum += pos[0];
+  }
+  double t2 = millis_since_boot();
+  printf("gps_orbits_sat_info: %.0f satellites/s, positions, velocities and clocks\n", SATS * EPOCHS / (t2 - t1) * 1000);
+
+  t1 = millis_since_boot();
+  for (int e = 0; e < EPOCHS; e++) {
+    for (int i = 0; i < SATS; i++) {
+      t[i] += 1e-3;
+      reference_pos_clock(ephs[i], t[i], &pos[3 * i], &clock_err[i]);
+    }
+    sum += pos[0];
+  }
+  t2 = millis_since_boot();
+  printf("reference:           %.0f satellites/s, positions and clocks only\n", SATS * EPOCHS / (t2 - t1) * 1000);
+  assert(!isnan(sum));
+  gps_orbits_free(orbits);
+}
+
+// the ephemerides in a recorded stream against the old decoder and the
+// satellites of every measurement against the reference
+static void test_stream(const char *fn) {
+  FILE *f = fopen(fn, "rb");
+  assert(f);
+  std::string stream;
+  char buf[4096];
+  size_t n;
+  while ((n = fread(buf, 1, sizeof(buf), f)) > 0) stream.append(buf, n);
+  fclose(f);
+
+  static ublox::FrameScanner scanner;
+  void *orbits = gps_orbits_init();
+  std::vector<GpsEphemeris> ephs;
+  std::map<int, ublox_old::subframes_map> subframes;
+  int n_eph = 0, n_sats = 0;
+  size_t pos = 0;
+  while (pos < stream.size()) {
+    size_t consumed;
+    const bool got = scanner.add_data((const uint8_t *)stream.data() + pos, stream.size() - pos, consumed);
+    pos += consumed;
+    if (!got) continue;
+    const uint8_t *p = scanner.payload();
+    const uint8_t cls = scanner.frame()[2], id = scanner.frame()[3];
+
+    if (cls == 0x02 && id == 0x13 && scanner.payload_size() == 8 + 40 && p[0] == 0) {
+      const uint8_t sv = p[1];
+      std::vector<uint32_t> words(10);
+      memcpy(words.data(), p + 8, 40);
+      const uint32_t subframe_id = (words[1] >> 8) & 7;
+      if (subframe_id == 1) {
+        subframes[sv].clear();
+        subframes[sv][1] = words;
+      } else if (subframes[sv].count(subframe_id - 1)) {
+        subframes[sv][subframe_id] = words;
+      }
+      if (subframes[sv].size() == 5) {
+        const uint32_t *sf[6] = {NULL};
+        for (int s = 1; s <= 5; s++) sf[s] = subframes[sv][s].data();
+        GpsEphemeris eph;
+        gps_ephemeris_decode(sv, sf, &eph);
+        ublox_old::EphemerisData old(sv, subframes[sv]);
+        assert(eph.A == old.A && eph.M0 == old.M0 && eph.af0 == old.af0 && eph.toe == old.toe);
+        gps_orbits_update(orbits, &eph);
+        for (auto it = ephs.begin(); it != ephs.end(); ++it) {
+          if (it->svId == sv) {
+            ephs.erase(it);
+            break;
+          }
+        }
+        ephs.push_back(eph);
+        n_eph++;
+      }
+    } else if (cls == 0x02 && id == 0x15 && scanner.payload_size() >= 16) {
+      double rcv_tow;
+      memcpy(&rcv_tow, p, sizeof(rcv_tow));
+      const int num_meas = p[11];
+      if (scanner.payload_size() != 16 + 32 * (size_t)num_meas) continue;
+      std::vector<int> sv_ids;
+      std::vector<double> t;
+      for (int i = 0; i < num_meas; i++) {
+        const uint8_t *m = p + 16 + 32 * i;
+        double pr;
+        memcpy(&pr, m, sizeof(pr));
+        // GPS only
+        if (m[20] != 0 || pr <= 0) continue;
+        sv_ids.push_back(m[21]);
+        t.push_back(rcv_tow - pr / C);
+      }
+      n_sats += check_sats(orbits, ephs, sv_ids, t);
+    }
+  }
+  gps_orbits_free(orbits);
+  printf("stream ok, %d ephemerides, %d satellites\n", n_eph, n_sats);
+}
+
+int main(int argc, char **argv) {
+  srand(1);
+  test_decode();
+  test_orbits();
+  if (argc > 1) test_stream(argv[1]);
+  bench();
+  return 0;
+}
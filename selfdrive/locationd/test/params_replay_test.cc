@@ -0,0 +1,253 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <assert.h>
+#include <vector>
+
+#include "common/timing.h"
+
+#include "../localizer.h"
+#include "../params_learner.h"
+#include "../live_parameters.h"
+#include "../params_replay.h"
+
+// Checks params_replay on a synthetic drive: with the default config it
+// sends what locationd_yawrate.cc's loop sends for the same events, bit for
+// bit, threads don't change results, and the learner moves to the steer ratio
+// and angle offset the drive was made with. Prints how many times realtime
+// a sweep runs.
+
+#define DRIVE_S 3600
+#define SWEEP 64
+
+static const ReplayCar car = {
+  // civic
+  2.0 * 192150.0, 2.0 * 202500.0,
+  2.70, 1326.0 + 136.0, 2.70 * 0.4,
+  15.38,
+};
+
+static const double TRUE_SR = 1.1 * 15.38;
+static const double TRUE_AO = 1.5;
+static const double GYRO_BIAS = 0.01;
+
+static double rand_normal(double std) {
+  // Box-Muller
+  double u1 = (rand() + 1.0) / (RAND_MAX + 2.0), u2 = (rand() + 1.0) / (RAND_MAX + 2.0);
+  return std * sqrt(-2.0 * log(u1)) * cos(2.0 * M_PI * u2);
+}
+
+enum Kind { CONTROLS, GYRO, ODOMETRY };
+
+struct Event {
+  Kind kind;
+  double t;
+  double a, b, c;
+};
+
+struct Drive {
+  // as params_learner receives them
+  std::vector<Event> events;
+  std::vector<double> gyro_t, gyro, odometry_t, rot, rot_std, controls_t, angle_steers, v_ego;
+  ReplayLog log;
+};
+
+static double yaw_rate(double sa_deg, double u) {
+  const double cF0 = car.tire_stiffness_front, cR0 = car.tire_stiffness_rear;
+  const double l = car.wheelbase, m = car.mass, aF = car.center_to_front, aR = l - aF;
+  const double d = cF0*cR0*l*l - m*u*u*(aF*cF0 - aR*cR0);
+  return (sa_deg - TRUE_AO) * DEGREES_TO_RADIANS * cF0*cR0*l*u / (TRUE_SR * d);
+}
+
+static void make_drive(Drive &d) {
+  // controlsState and gyro at 100 Hz, cameraOdometry at 20 Hz
+  for (int k = 0; k < DRIVE_S * 100; k++) {
+    double t = 100.0 + k * 0.01;
+    double u = 22.0 + 10.0 * sin(t / 60.0);
+    double sa = 5.0 * sin(t / 7.0) + 3.0 * sin(t / 2.3) + TRUE_AO;
+    double psi = yaw_rate(sa, u);
+
+    d.events.push_back({CONTROLS, t + 0.0003, sa, u, 0});
+    d.events.push_back({GYRO, t + 0.0005 + 0.001 * rand() / RAND_MAX, psi - GYRO_BIAS + rand_normal(0.005), 0, 0});
+    if (k % 5 == 0) {
+      d.events.push_back({ODOMETRY, t + 0.002, -psi + rand_normal(0.01), 0.01, 0});
+    }
+  }
+
+  for (const Event &e : d.events) {
+    if (e.kind == CONTROLS) {
+      d.controls_t.push_back(e.t);
+      d.angle_steers.push_back(e.a);
+      d.v_ego.push_back(e.b);
+    } else if (e.kind == GYRO) {
+      d.gyro_t.push_back(e.t);
+      d.gyro.push_back(e.a);
+    } else {
+      d.odometry_t.push_back(e.t);
+      d.rot.push_back(e.a);
+      d.rot_std.push_back(e.b);
+    }
+  }
+
+  memset(&d.log, 0, sizeof(d.log));
+  d.log.n_gyro = d.gyro.size();
+  d.log.gyro_t = d.gyro_t.data();
+  d.log.gyro = d.gyro.data();
+  d.log.n_odometry = d.rot.size();
+  d.log.odometry_t = d.odometry_t.data();
+  d.log.rot = d.rot.data();
+  d.log.rot_std = d.rot_std.data();
+  d.log.n_controls = d.v_ego.size();
+  d.log.controls_t = d.controls_t.data();
+  d.log.angle_steers = d.angle_steers.data();
+  d.log.v_ego = d.v_ego.data();
+}
+
+struct Samples {
+  std::vector<double> t, yaw_rate, gyro_bias, angle_offset, angle_offset_average, stiffness_factor, steer_ratio;
+  std::vector<uint8_t> valid, sensor_valid;
+
+  Samples(int n) : t(n), yaw_rate(n), gyro_bias(n), angle_offset(n), angle_offset_average(n),
+                   stiffness_factor(n), steer_ratio(n), valid(n), sensor_valid(n) {}
+
+  void attach(ReplayResult *r) {
+    memset(r, 0, sizeof(*r));
+    r->t = t.data();
+    r->yaw_rate = yaw_rate.data();
+    r->gyro_bias = gyro_bias.data();
+    r->angle_offset = angle_offset.data();
+    r->angle_offset_average = angle_offset_average.data();
+    r->stiffness_factor = stiffness_factor.data();
+    r->steer_ratio = steer_ratio.data();
+    r->valid = valid.data();
+    r->sensor_valid = sensor_valid.data();
+  }
+
+  bool operator==(const Samples &o) const {
+    const size_t n = t.size() * sizeof(double);
+    return memcmp(t.data(), o.t.data(), n) == 0
+        && memcmp(yaw_rate.data(), o.yaw_rate.data(), n) == 0
+        && memcmp(gyro_bias.data(), o.gyro_bias.data(), n) == 0
+        && memcmp(angle_offset.data(), o.angle_offset.data(), n) == 0
+        && memcmp(angle_offset_average.data(), o.angle_offset_average.data(), n) == 0
+        && memcmp(stiffness_factor.data(), o.stiffness_factor.data(), n) == 0
+        && memcmp(steer_ratio.data(), o.steer_ratio.data(), n) == 0
+        && valid == o.valid && sensor_valid == o.sensor_valid;
+  }
+};
+
+// The main loop of locationd_yawrate.cc without the sockets: the events go
+// into the localizer as handle_log does, and every controlsState is the
+// daemon's own step.
+static void daemon_loop(const Drive &d, Samples &s) {
+  Localizer localizer;
+  ParamsLearnerCar learner_car = {
+    car.tire_stiffness_front, car.tire_stiffness_rear,
+    car.wheelbase, car.mass, car.center_to_front,
+    car.steer_ratio,
+  };
+  ParamsLearner learner(learner_car, 0.0, 1.0, car.steer_ratio);
+
+  int save_counter = 0, k = 0;
+  for (const Event &e : d.events) {
+    localizer.handle_time(e.t);
+    if (e.kind == GYRO) {
+      localizer.handle_gyro(e.a, e.t);
+    } else if (e.kind == ODOMETRY) {
+      localizer.handle_camera_odometry(e.a, e.b, e.t);
+    } else {
+      localizer.handle_controls_state(e.a, e.b, e.t);
+      save_counter++;
+
+      LiveParameters p = live_parameters_update(localizer, learner);
+
+      if (save_counter % 10 == 0) {
+        s.t[k] = e.t;
+        s.yaw_rate[k] = p.yaw_rate;
+        s.gyro_bias[k] = p.gyro_bias;
+        s.angle_offset[k] = p.angle_offset;
+        s.angle_offset_average[k] = p.angle_offset_average;
+        s.stiffness_factor[k] = p.stiffness_factor;
+        s.steer_ratio[k] = p.steer_ratio;
+        s.valid[k] = p.valid;
+        s.sensor_valid[k] = p.sensor_valid;
+        k++;
+      }
+    }
+  }
+  assert(k == (int)s.t.size());
+}
+
+static void print_result(const char *name, const ReplayResult &r) {
+  printf("%s: sR %.3f x %.3f ao %.3f deg, settled after %.0f s, %.1f%% valid, angle error %.3f deg rms\n", name,
+         r.steer_ratio_final, r.stiffness_factor_final, r.angle_offset_average_final,
+         r.steer_ratio_settle_time, 100.0 * r.valid_fraction, r.angle_error_rms);
+}
+
+int main() {
+  srand(1);
+  Drive d;
+  make_drive(d);
+
+  ReplayConfig config;
+  params_replay_default_config(&car, &config);
+  const int n = params_replay_samples(&d.log, &config, 10);
+  assert(n == DRIVE_S * 10);
+
+  Samples live(n), replayed(n);
+  daemon_loop(d, live);
+  ReplayResult result;
+  replayed.attach(&result);
+  params_replay(&car, &d.log, &config, &result, 1, 10, 1);
+  assert(result.n_samples == n);
+  assert(live == replayed);
+  printf("default config matches locationd\n");
+
+  print_result("default", result);
+  // steer ratio and stiffness trade off against each other, what was
+  // learned has to fit the drive though
+  assert(fabs(result.steer_ratio_final - TRUE_SR) < 0.5 * fabs(car.steer_ratio - TRUE_SR));
+  assert(result.angle_error_rms < 0.5);
+  assert(fabs(result.angle_offset_average_final - TRUE_AO) < 0.2);
+  assert(result.valid_fraction == 1.0);
+
+  // a sweep over learning rate and gyro noise, the default config in it
+  std::vector<ReplayConfig> configs(SWEEP, config);
+  for (int k = 0; k < SWEEP; k++) {
+    configs[k].learning_rate = 0.25 * (1 + k % 8);
+    configs[k].r_gyro = 0.0125 * (1 << (k / 8 % 4));
+    configs[k].steer_ratio = k < SWEEP / 2 ? car.steer_ratio : 0.8 * car.steer_ratio;
+  }
+  const int default_k = 3 + 8 * 2;
+  assert(memcmp(&configs[default_k], &config, sizeof(config)) == 0);
+
+  std::vector<ReplayResult> single(SWEEP), threaded(SWEEP);
+  std::vector<Samples> threaded_samples(SWEEP, Samples(n));
+  for (int k = 0; k < SWEEP; k++) {
+    memset(&single[k], 0, sizeof(single[k]));
+    threaded_samples[k].attach(&threaded[k]);
+  }
+
+  double t1 = millis_since_boot();
+  params_replay(&car, &d.log, configs.data(), single.data(), SWEEP, 10, 1);
+  double t2 = millis_since_boot();
+  params_replay(&car, &d.log, configs.data(), threaded.data(), SWEEP, 10, 0);
+  double t3 = millis_since_boot();
+
+  for (int k = 0; k < SWEEP; k++) {
+    assert(memcmp(&single[k].steer_ratio_final, &threaded[k].steer_ratio_final,
+                  sizeof(ReplayResult) - offsetof(ReplayResult, steer_ratio_final)) == 0);
+  }
+  assert(threaded_samples[default_k] == live);
+  printf("threads match\n");
+
+  print_result("learning rate 0.25", single[0]);
+  print_result("learning rate 2.0", single[7]);
+  print_result("start at 0.8 sR", single[SWEEP / 2 + 3]);
+  assert(single[SWEEP / 2 + 3].steer_ratio_final > configs[SWEEP / 2 + 3].steer_ratio + 0.5 * (TRUE_SR - configs[SWEEP / 2 + 3].steer_ratio));
+
+  printf("%d configs of a %d s drive: %.0fx realtime on one thread, %.0fx on all cores\n", SWEEP, DRIVE_S,
+         SWEEP * DRIVE_S / (t2 - t1) * 1000, SWEEP * DRIVE_S / (t3 - t2) * 1000);
+  return 0;
+}
@@ -0,0 +1,92 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <string>
+#include <vector>
+
+#include "common/timing.h"
+
+#include "../ublox_frame.h"
+#include "ublox_parser_old.h"
+
+// Throughput of FrameScanner against the byte at a time parser it replaced,
+// on a recorded ubloxRaw stream, the raw bytes as ubloxd_test takes them, or
+// on made up traffic like the receiver sends: a solution, raw measurements
+// of 20 satellites and a few subframes every 100 ms.
+//
+// usage: ublox_parser_bench [stream file]
+
+using namespace ublox;
+
+#define STREAM_SIZE (16 << 20)
+
+static std::string make_frame(uint8_t cls, uint8_t id, size_t len) {
+  std::string f;
+  f += (char)PREAMBLE1;
+  f += (char)PREAMBLE2;
+  f += (char)cls;
+  f += (char)id;
+  f += (char)(len & 0xff);
+  f += (char)(len >> 8);
+  for (size_t i = 0; i < len; i++) f += (char)rand();
+  uint8_t ck_a = 0, ck_b = 0;
+  for (size_t i = 2; i < f.size(); i++) {
+    ck_a += (uint8_t)f[i];
+    ck_b += ck_a;
+  }
+  f += (char)ck_a;
+  f += (char)ck_b;
+  return f;
+}
+
+template <class P>
+static void bench(P &parser, const char *name, const std::string &stream, size_t chunk) {
+  size_t frames = 0;
+  const double t1 = millis_since_boot();
+  for (size_t pos = 0; pos < stream.size(); pos += chunk) {
+    const size_t len = chunk < stream.size() - pos ? chunk : stream.size() - pos;
+    const uint8_t *data = (const uint8_t *)stream.data() + pos;
+    size_t consumed = 0;
+    while (consumed < len) {
+      size_t consumed_this_time = 0;
+      if (parser.add_data(data + consumed, len - consumed, consumed_this_time)) {
+        frames++;
+        parser.reset();
+      }
+      consumed += consumed_this_time;
+    }
+  }
+  const double t2 = millis_since_boot();
+  printf("%-8s %5zu byte chunks: %8.1f MB/s  %6.1f ns/frame  %zu frames\n", name, chunk,
+         stream.size() / (t2 - t1) / 1000, (t2 - t1) * 1e6 / frames, frames);
+}
+
+int main(int argc, char **argv) {
+  std::string stream;
+  if (argc > 1) {
+    FILE *f = fopen(argv[1], "rb");
+    assert(f);
+    char buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0) stream.append(buf, n);
+    fclose(f);
+  } else {
+    while (stream.size() < STREAM_SIZE) {
+      stream += make_frame(0x01, 0x07, 92);
+      stream += make_frame(0x02, 0x15, 16 + 32 * 20);
+      for (int i = 0; i < 3; i++) {
+        stream += make_frame(0x02, 0x13, 8 + 4 * 10);
+      }
+    }
+  }
+
+  static FrameScanner scanner;
+  static UbloxMsgParserOld old_parser;
+  const size_t chunks[] = {128, 4096};
+  for (size_t chunk : chunks) {
+    bench(old_parser, "old", stream, chunk);
+    bench(scanner, "scanner", stream, chunk);
+  }
+  return 0;
+}
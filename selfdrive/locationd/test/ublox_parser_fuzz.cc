@@ -0,0 +1,198 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <string>
+#include <vector>
+
+#include "../ublox_frame.h"
+#include "ublox_parser_old.h"
+
+// Feeds FrameScanner and the byte at a time parser it replaced the same
+// streams of frames, torn in random chunks and corrupted with flipped bits,
+// lost bytes, garbage and false preambles. FrameScanner has to find what a
+// plain search of the whole stream finds, whatever the chunks. The old
+// parser drops the frames that start within a false frame and waits for
+// any length a false preamble claims, so it finds fewer.
+//
+// usage: ublox_parser_fuzz [iterations] [seed]
+
+using namespace ublox;
+
+static std::string make_frame(uint8_t cls, uint8_t id, const std::string &payload) {
+  std::string f;
+  f += (char)PREAMBLE1;
+  f += (char)PREAMBLE2;
+  f += (char)cls;
+  f += (char)id;
+  f += (char)(payload.size() & 0xff);
+  f += (char)(payload.size() >> 8);
+  f += payload;
+  uint8_t ck_a = 0, ck_b = 0;
+  for (size_t i = 2; i < f.size(); i++) {
+    ck_a += (uint8_t)f[i];
+    ck_b += ck_a;
+  }
+  f += (char)ck_a;
+  f += (char)ck_b;
+  return f;
+}
+
+static std::string random_bytes(size_t n) {
+  std::string s(n, 0);
+  for (size_t i = 0; i < n; i++) s[i] = rand();
+  return s;
+}
+
+// a mix like the receiver sends: solutions, raw measurements, subframes and
+// the odd other message
+static std::string random_frame() {
+  switch (rand() % 4) {
+  case 0: return make_frame(0x01, 0x07, random_bytes(92));
+  case 1: return make_frame(0x02, 0x15, random_bytes(16 + 32 * (rand() % 24)));
+  case 2: return make_frame(0x02, 0x13, random_bytes(8 + 4 * 10));
+  default: return make_frame(rand(), rand(), random_bytes(rand() % 300));
+  }
+}
+
+static void corrupt(std::string &s) {
+  const int n = 1 + rand() % 8;
+  for (int k = 0; k < n && s.size() > 0; k++) {
+    const size_t pos = rand() % s.size();
+    switch (rand() % 5) {
+    case 0:
+      s[pos] ^= 1 << (rand() % 8);
+      break;
+    case 1:
+      s.erase(pos, 1 + rand() % 40);
+      break;
+    case 2:
+      s.insert(pos, random_bytes(1 + rand() % 40));
+      break;
+    case 3:
+      s.insert(pos, std::string("\xb5\x62", 2));
+      break;
+    default: {
+      // a header claiming a length that isn't there
+      std::string hdr("\xb5\x62\x01\x07", 4);
+      const uint16_t len = rand() % 4 == 0 ? rand() % 65536 : rand() % 3000;
+      hdr += (char)(len & 0xff);
+      hdr += (char)(len >> 8);
+      s.insert(pos, hdr);
+      break;
+    }
+    }
+  }
+}
+
+// every valid frame, looking at the next byte when there's none, up to a
+// frame that isn't over by the end
+static std::vector<std::string> search(const std::string &stream) {
+  std::vector<std::string> frames;
+  const uint8_t *d = (const uint8_t *)stream.data();
+  size_t pos = 0;
+  while (pos + UBLOX_HEADER_SIZE + UBLOX_CHECKSUM_SIZE <= stream.size()) {
+    const size_t total = UBLOX_HEADER_SIZE + (d[pos + 4] | (d[pos + 5] << 8)) + UBLOX_CHECKSUM_SIZE;
+    uint8_t a = 0, b = 0;
+    if (d[pos] == PREAMBLE1 && d[pos + 1] == PREAMBLE2 &&
+        total <= UBLOX_HEADER_SIZE + UBLOX_MAX_PAYLOAD_SIZE + UBLOX_CHECKSUM_SIZE) {
+      // a frame that goes past the end might still be, the parsers wait
+      if (pos + total > stream.size()) break;
+      for (size_t i = pos + 2; i < pos + total - 2; i++) {
+        a += d[i];
+        b += a;
+      }
+      if (a == d[pos + total - 2] && b == d[pos + total - 1]) {
+        frames.push_back(stream.substr(pos, total));
+        pos += total;
+        continue;
+      }
+    }
+    pos++;
+  }
+  return frames;
+}
+
+template <class P>
+static std::vector<std::string> parse(P &parser, const std::string &stream, unsigned chunk_seed) {
+  std::vector<std::string> frames;
+  srand(chunk_seed);
+  size_t pos = 0;
+  while (pos < stream.size()) {
+    const size_t chunk = rand() % 8 == 0 ? stream.size() - pos : 1 + rand() % 512;
+    const size_t len = chunk < stream.size() - pos ? chunk : stream.size() - pos;
+    // a copy, so a frame handed out in place is only good until the next chunk
+    std::vector<uint8_t> data(stream.begin() + pos, stream.begin() + pos + len);
+    size_t consumed = 0;
+    while (consumed < len) {
+      size_t consumed_this_time = 0;
+      if (parser.add_data(data.data() + consumed, len - consumed, consumed_this_time)) {
+        frames.push_back(std::string((const char *)parser.frame(), parser.frame_size()));
+        parser.reset();
+      }
+      consumed += consumed_this_time;
+    }
+    pos += len;
+  }
+  return frames;
+}
+
+static void test_checksum() {
+  for (int n = 0; n < 200; n++) {
+    const std::string s = random_bytes(n);
+    uint8_t a = 0, b = 0;
+    for (char c : s) {
+      a += (uint8_t)c;
+      b += a;
+    }
+    uint8_t ck_a, ck_b;
+    frame_checksum((const uint8_t *)s.data(), s.size(), &ck_a, &ck_b);
+    assert(ck_a == a && ck_b == b);
+  }
+  printf("checksum ok\n");
+}
+
+int main(int argc, char **argv) {
+  const int iterations = argc > 1 ? atoi(argv[1]) : 2000;
+  const unsigned seed = argc > 2 ? atoi(argv[2]) : 1;
+  srand(seed);
+
+  test_checksum();
+
+  static FrameScanner scanner;
+  static UbloxMsgParserOld old_parser;
+  size_t total_frames = 0, total_old_frames = 0, total_bytes = 0;
+  for (int it = 0; it < iterations; it++) {
+    std::vector<std::string> sent;
+    std::string stream;
+    const int n = 1 + rand() % 40;
+    for (int i = 0; i < n; i++) {
+      sent.push_back(random_frame());
+      stream += sent.back();
+    }
+    const bool clean = it % 4 == 0;
+    if (!clean) corrupt(stream);
+
+    const unsigned chunk_seed = rand();
+    const unsigned next_seed = rand();
+    // parsers start fresh for every stream
+    scanner = FrameScanner();
+    old_parser = UbloxMsgParserOld();
+    std::vector<std::string> got = parse(scanner, stream, chunk_seed);
+    std::vector<std::string> old_got = parse(old_parser, stream, chunk_seed);
+    srand(next_seed);
+
+    if (got != search(stream)) {
+      printf("iteration %d: %zu frames, search %zu\n", it, got.size(), search(stream).size());
+      fflush(stdout);
+      assert(false);
+    }
+    if (clean) assert(got == sent && old_got == sent);
+    total_frames += got.size();
+    total_old_frames += old_got.size();
+    total_bytes += stream.size();
+  }
+  printf("%d streams, %zu bytes, %zu frames ok, old parser found %zu\n", iterations, total_bytes, total_frames, total_old_frames);
+  assert(total_frames >= total_old_frames);
+  return 0;
+}
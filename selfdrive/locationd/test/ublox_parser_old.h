@@ -0,0 +1,89 @@
+#pragma once
+
+#include <string.h>
+#include <stdint.h>
+
+#include "../ublox_frame.h"
+
+// The framing of UbloxMsgParser before frames were found in place, kept to
+// fuzz and bench FrameScanner against.
+namespace ublox {
+
+#define UBLOX_MSG_SIZE(hdr) (*(uint16_t *)&hdr[4])
+
+class UbloxMsgParserOld {
+  public:
+    UbloxMsgParserOld() :bytes_in_parse_buf(0) {}
+
+    bool add_data(const uint8_t *incoming_data, uint32_t incoming_data_len, size_t &bytes_consumed) {
+      int needed = needed_bytes();
+      if(needed > 0) {
+        bytes_consumed = (size_t)needed < incoming_data_len ? (size_t)needed : incoming_data_len;
+        // Add data to buffer
+        memcpy(msg_parse_buf + bytes_in_parse_buf, incoming_data, bytes_consumed);
+        bytes_in_parse_buf += bytes_consumed;
+      } else {
+        bytes_consumed = incoming_data_len;
+      }
+      // Validate msg format, detect invalid header and invalid checksum.
+      while(!valid_so_far() && bytes_in_parse_buf != 0) {
+        // Corrupted msg, drop a byte.
+        bytes_in_parse_buf -= 1;
+        if(bytes_in_parse_buf > 0)
+          memmove(&msg_parse_buf[0], &msg_parse_buf[1], bytes_in_parse_buf);
+      }
+      // There is redundant data at the end of buffer, reset the buffer.
+      if(needed_bytes() == -1)
+        bytes_in_parse_buf = 0;
+      return valid();
+    }
+    inline void reset() {bytes_in_parse_buf = 0;}
+    inline const uint8_t *frame() const { return msg_parse_buf; }
+    inline size_t frame_size() const { return bytes_in_parse_buf; }
+
+  private:
+    inline int needed_bytes() {
+      // Msg header incomplete?
+      if(bytes_in_parse_buf < UBLOX_HEADER_SIZE)
+        return UBLOX_HEADER_SIZE + UBLOX_CHECKSUM_SIZE - bytes_in_parse_buf;
+      uint16_t needed = UBLOX_MSG_SIZE(msg_parse_buf) + UBLOX_HEADER_SIZE + UBLOX_CHECKSUM_SIZE;
+      // too much data
+      if(needed < (uint16_t)bytes_in_parse_buf)
+        return -1;
+      return needed - (uint16_t)bytes_in_parse_buf;
+    }
+
+    inline bool valid_cheksum() {
+      uint8_t ck_a = 0, ck_b = 0;
+      for(int i = 2; i < bytes_in_parse_buf - UBLOX_CHECKSUM_SIZE;i++) {
+        ck_a = (ck_a + msg_parse_buf[i]) & 0xFF;
+        ck_b = (ck_b + ck_a) & 0xFF;
+      }
+      return ck_a == msg_parse_buf[bytes_in_parse_buf - 2] && ck_b == msg_parse_buf[bytes_in_parse_buf - 1];
+    }
+
+    inline bool valid() {
+      return bytes_in_parse_buf >= UBLOX_HEADER_SIZE + UBLOX_CHECKSUM_SIZE &&
+        needed_bytes() == 0 &&
+        valid_cheksum();
+    }
+
+    inline bool valid_so_far() {
+      if(bytes_in_parse_buf > 0 && msg_parse_buf[0] != PREAMBLE1) {
+        return false;
+      }
+      if(bytes_in_parse_buf > 1 && msg_parse_buf[1] != PREAMBLE2) {
+        return false;
+      }
+      if(needed_bytes() == 0 && !valid())
+        return false;
+      return true;
+    }
+
+    uint8_t msg_parse_buf[UBLOX_HEADER_SIZE + UBLOX_MAX_MSG_SIZE];
+    int bytes_in_parse_buf;
+};
+
+#undef UBLOX_MSG_SIZE
+
+}
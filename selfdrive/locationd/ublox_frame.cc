@@ -0,0 +1,149 @@
+#include <string.h>
+
+#include "ublox_frame.h"
+
+namespace ublox {
+
+void frame_checksum(const uint8_t *data, size_t len, uint8_t *ck_a, uint8_t *ck_b) {
+  // ck_b is the sum of all running sums of ck_a, so over a block it gains
+  // the block length times ck_a before it, plus every byte weighted by how
+  // many of the sums it is in. Blocks keep the loop free of the byte to
+  // byte dependency and let it vectorize, wrapping at 32 bits is fine
+  // as only the low byte is kept.
+  uint32_t a = 0, b = 0;
+  size_t i = 0;
+  for (; i + 16 <= len; i += 16) {
+    const uint8_t *p = data + i;
+    uint32_t s = 0, w = 0;
+    for (int k = 0; k < 16; k++) {
+      s += p[k];
+      w += (16 - k) * p[k];
+    }
+    b += 16 * a + w;
+    a += s;
+  }
+  for (; i < len; i++) {
+    a += data[i];
+    b += a;
+  }
+  *ck_a = a;
+  *ck_b = b;
+}
+
+// Checks the frame that starts with PREAMBLE1 at p as far as avail goes.
+// Returns 1 for a whole valid frame, 0 when more bytes are needed and -1
+// when p isn't a frame. total is the frame size, or the header and checksum
+// size while the length isn't known.
+static int check_candidate(const uint8_t *p, size_t avail, size_t *total) {
+  if (avail >= 2 && p[1] != PREAMBLE2) {
+    return -1;
+  }
+  if (avail < UBLOX_HEADER_SIZE) {
+    *total = UBLOX_HEADER_SIZE + UBLOX_CHECKSUM_SIZE;
+    return 0;
+  }
+  const size_t payload_len = p[4] | (p[5] << 8);
+  if (payload_len > UBLOX_MAX_PAYLOAD_SIZE) {
+    return -1;
+  }
+  *total = UBLOX_HEADER_SIZE + payload_len + UBLOX_CHECKSUM_SIZE;
+  if (avail < *total) {
+    return 0;
+  }
+  uint8_t ck_a, ck_b;
+  frame_checksum(p + 2, *total - 2 - UBLOX_CHECKSUM_SIZE, &ck_a, &ck_b);
+  if (ck_a != p[*total - 2] || ck_b != p[*total - 1]) {
+    return -1;
+  }
+  return 1;
+}
+
+bool FrameScanner::carry_check() {
+  while (carry_len > 0) {
+    size_t total;
+    const int r = check_candidate(carry, carry_len, &total);
+    if (r > 0) {
+      frame_data = carry;
+      frame_len = total;
+      return true;
+    } else if (r == 0) {
+      return false;
+    }
+    // false preamble, go on from the next one in the carry
+    drop_carry(1);
+  }
+  return false;
+}
+
+// Drops n bytes from the front of the carry and what's left up to the next
+// preamble. The carry holds the bytes after a false preamble that were taken
+// to check it, or that came after a frame, they are searched again.
+void FrameScanner::drop_carry(size_t n) {
+  const uint8_t *next = (const uint8_t *)memchr(carry + n, PREAMBLE1, carry_len - n);
+  if (next == NULL) {
+    carry_len = 0;
+  } else {
+    carry_len -= next - carry;
+    memmove(carry, next, carry_len);
+  }
+}
+
+bool FrameScanner::add_data(const uint8_t *data, size_t len, size_t &consumed) {
+  reset();
+  consumed = 0;
+
+  // the frame started in an earlier chunk, the bytes of data taken into the
+  // carry are at its end
+  while (carry_len > 0) {
+    if (carry_check()) {
+      // what was taken for a false frame and comes after this one goes back,
+      // it is searched on the next call
+      const size_t extra = carry_len - frame_len < consumed ? carry_len - frame_len : consumed;
+      carry_len -= extra;
+      consumed -= extra;
+      return true;
+    }
+    if (carry_len <= consumed) {
+      // nothing from earlier chunks is left, search data in place
+      consumed -= carry_len;
+      carry_len = 0;
+      break;
+    }
+    if (consumed == len) {
+      return false;
+    }
+    size_t total;
+    check_candidate(carry, carry_len, &total);
+    const size_t n = total - carry_len < len - consumed ? total - carry_len : len - consumed;
+    memcpy(carry + carry_len, data + consumed, n);
+    carry_len += n;
+    consumed += n;
+  }
+
+  size_t pos = consumed;
+  while (pos < len) {
+    const uint8_t *p = (const uint8_t *)memchr(data + pos, PREAMBLE1, len - pos);
+    if (p == NULL) {
+      break;
+    }
+    pos = p - data;
+
+    size_t total;
+    const int r = check_candidate(p, len - pos, &total);
+    if (r > 0) {
+      frame_data = p;
+      frame_len = total;
+      consumed = pos + total;
+      return true;
+    } else if (r == 0) {
+      carry_len = len - pos;
+      memcpy(carry, p, carry_len);
+      break;
+    }
+    pos++;
+  }
+  consumed = len;
+  return false;
+}
+
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace ublox {
+  // protocol constants
+  const uint8_t PREAMBLE1 = 0xb5;
+  const uint8_t PREAMBLE2 = 0x62;
+
+  const int UBLOX_HEADER_SIZE = 6;
+  const int UBLOX_CHECKSUM_SIZE = 2;
+  const int UBLOX_MAX_MSG_SIZE = 65536;
+
+  // Longest payload of a frame that is taken, RXM_RAW with 255 measurements.
+  // A false preamble in corrupted data claims any length, waiting for up to
+  // 64k of it would hold up every frame behind it.
+  const int UBLOX_MAX_PAYLOAD_SIZE = 16 + 32 * 255;
+
+  // Fletcher-8 over class, id, length and payload of a frame.
+  void frame_checksum(const uint8_t *data, size_t len, uint8_t *ck_a, uint8_t *ck_b);
+
+  // Finds ubx frames in a byte stream that comes in arbitrary chunks.
+  //
+  // Frames are looked for in place: the preamble is found with memchr and the
+  // checksum is computed over the caller's bytes, so a frame that lies within
+  // one chunk is handed out as a view of that chunk. Only a frame that runs
+  // over the end of a chunk is gathered into the carry buffer. After a bad
+  // checksum or a length that is too long the search resumes at the byte
+  // after the false preamble, frames that start within the false one are
+  // still found.
+  class FrameScanner {
+    public:
+      FrameScanner() : frame_data(NULL), frame_len(0), carry_len(0) {}
+
+      // Looks for the next frame in data. Returns true when one is complete,
+      // it is then at frame() until the next call. consumed is how many bytes
+      // of data were used, the rest are passed again.
+      bool add_data(const uint8_t *data, size_t len, size_t &consumed);
+      inline void reset() {
+        if (frame_data == carry) drop_carry(frame_len);
+        frame_data = NULL;
+        frame_len = 0;
+      }
+
+      inline const uint8_t *frame() const { return frame_data; }
+      inline size_t frame_size() const { return frame_len; }
+      inline const uint8_t *payload() const { return frame_data + UBLOX_HEADER_SIZE; }
+      inline size_t payload_size() const { return frame_len - UBLOX_HEADER_SIZE - UBLOX_CHECKSUM_SIZE; }
+
+    private:
+      bool carry_check();
+      void drop_carry(size_t n);
+
+      const uint8_t *frame_data;
+      size_t frame_len;
+
+      uint8_t carry[UBLOX_HEADER_SIZE + UBLOX_MAX_PAYLOAD_SIZE + UBLOX_CHECKSUM_SIZE];
+      size_t carry_len;
+  };
+}
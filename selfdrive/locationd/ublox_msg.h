@@ -2,6 +2,8 @@
 
 #include <stdint.h>
 
+#include "ublox_frame.h"
+
 #define min(x, y) ((x) <= (y) ? (x) : (y))
 
 // NAV_PVT
@@ -85,10 +87,6 @@ typedef struct __attribute__((packed)) {
 } rxm_sfrbx_msg_extra;
 
 namespace ublox {
-  // protocol constants
-  const uint8_t PREAMBLE1 = 0xb5;
-  const uint8_t PREAMBLE2 = 0x62;
-
   // message classes
   const uint8_t CLASS_NAV = 0x01;
   const uint8_t CLASS_RXM = 0x02;
@@ -100,10 +98,6 @@ namespace ublox {
   const uint8_t MSG_RXM_RAW = 0x15;
   const uint8_t MSG_RXM_SFRBX = 0x13;
 
-  const int UBLOX_HEADER_SIZE = 6;
-  const int UBLOX_CHECKSUM_SIZE = 2;
-  const int UBLOX_MAX_MSG_SIZE = 65536;
-
   typedef std::map<uint8_t, std::vector<uint32_t>> subframes_map;
 
   class UbloxMsgParser {
@@ -114,16 +108,19 @@ namespace ublox {
       kj::Array<capnp::word> gen_raw();
 
       kj::Array<capnp::word> gen_nav_data();
-      bool add_data(const uint8_t *incoming_data, uint32_t incoming_data_len, size_t &bytes_consumed);
-      inline void reset() {bytes_in_parse_buf = 0;}
+      // The frame found stays valid until the next add_data or reset, when it
+      // lies within incoming_data it is read from there.
+      bool add_data(const uint8_t *incoming_data, uint32_t incoming_data_len, size_t &bytes_consumed) {
+        return scanner.add_data(incoming_data, incoming_data_len, bytes_consumed);
+      }
+      inline void reset() {scanner.reset();}
       inline uint8_t msg_class() {
-        return msg_parse_buf[2];
+        return scanner.frame()[2];
       }
 
       inline uint8_t msg_id() {
-        return msg_parse_buf[3];
+        return scanner.frame()[3];
       }
-      inline int needed_bytes();
 
       void hexdump(uint8_t *d, int l) {
         for (int i = 0; i < l; i++) {
@@ -133,12 +130,7 @@ namespace ublox {
         printf("\n");
       }
     private:
-      inline bool valid_cheksum();
-      inline bool valid();
-      inline bool valid_so_far();
-
-      uint8_t msg_parse_buf[UBLOX_HEADER_SIZE + UBLOX_MAX_MSG_SIZE];
-      int bytes_in_parse_buf;
+      FrameScanner scanner;
       std::map<uint8_t, std::map<uint8_t, subframes_map>> nav_frame_buffer;
   };
 
@@ -58,10 +58,19 @@ int ubloxd_main(poll_ubloxraw_msg_func poll_func, send_gps_event_func send_func)
     } else if(err == 0) {
       continue;
     }
-    // format for board, make copy due to alignment issues, will be freed on out of scope
-    auto amsg = kj::heapArray<capnp::word>((zmq_msg_size(&msg) / sizeof(capnp::word)) + 1);
-    memcpy(amsg.begin(), zmq_msg_data(&msg), zmq_msg_size(&msg));
-    capnp::FlatArrayMessageReader cmsg(amsg);
+    // capnp needs the message word aligned, only copy it when it isn't,
+    // the copy will be freed on out of scope
+    const size_t msg_size = zmq_msg_size(&msg);
+    kj::Array<capnp::word> amsg;
+    kj::ArrayPtr<const capnp::word> words;
+    if((uintptr_t)zmq_msg_data(&msg) % sizeof(capnp::word) == 0 && msg_size % sizeof(capnp::word) == 0) {
+      words = kj::ArrayPtr<const capnp::word>((const capnp::word *)zmq_msg_data(&msg), msg_size / sizeof(capnp::word));
+    } else {
+      amsg = kj::heapArray<capnp::word>((msg_size / sizeof(capnp::word)) + 1);
+      memcpy(amsg.begin(), zmq_msg_data(&msg), msg_size);
+      words = amsg;
+    }
+    capnp::FlatArrayMessageReader cmsg(words);
     cereal::Event::Reader event = cmsg.getRoot<cereal::Event>();
     const uint8_t *data = event.getUbloxRaw().begin();
     size_t len = event.getUbloxRaw().size();
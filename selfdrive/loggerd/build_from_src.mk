@@ -65,6 +65,7 @@ OBJS += loggerd.o \
        ../common/cqueue.o \
        ../common/swaglog.o \
        ../common/visionipc.o \
+       ../common/vipc_ring.o \
        ../common/ipc.o \
        $(PHONELIBS)/json/src/json.o
 
@@ -182,9 +182,6 @@ void encoder_init(EncoderState *s, const char* filename, int width, int height,
 
   s->codec_config = NULL;
 
-  queue_init(&s->free_in);
-  queue_init(&s->done_out);
-
   pthread_mutex_init(&s->state_lock, NULL);
   pthread_cond_init(&s->state_cv, NULL);
 
@@ -353,6 +350,10 @@ void encoder_init(EncoderState *s, const char* filename, int width, int height,
   err = OMX_SendCommand(s->handle, OMX_CommandStateSet, OMX_StateIdle, NULL);
   assert(err == OMX_ErrorNone);
 
+  // each buffer is in its queue at most once
+  queue_init2(&s->free_in, s->num_in_bufs, QUEUE_MPMC);
+  queue_init2(&s->done_out, s->num_out_bufs, QUEUE_MPMC);
+
   s->in_buf_headers = calloc(s->num_in_bufs, sizeof(OMX_BUFFERHEADERTYPE*));
   for (int i=0; i<s->num_in_bufs; i++) {
     err = OMX_AllocateBuffer(s->handle, &s->in_buf_headers[i], PORT_INDEX_IN, s,
@@ -610,6 +611,9 @@ void encoder_destroy(EncoderState *s) {
 
   wait_for_state(s, OMX_StateLoaded);
 
+  queue_destroy(&s->free_in);
+  queue_destroy(&s->done_out);
+
   err = OMX_FreeHandle(s->handle);
   assert(err == OMX_ErrorNone);
 }
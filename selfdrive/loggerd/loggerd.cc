@@ -19,6 +19,8 @@
 #include <mutex>
 #include <condition_variable>
 #include <random>
+#include <deque>
+#include <chrono>
 
 #include <ftw.h>
 
@@ -53,6 +55,16 @@
 #define RAW_CLIP_LENGTH 100 // 5 seconds at 20fps
 #define RAW_CLIP_FREQUENCY (randrange(61, 8*60)) // once every ~4 minutes
 
+#define FRAME_REFS_MAX VIPC_RING_RETAIN // older frames are gone from the yuv ring
+#define FRAME_REF_TIMEOUT_MS 500
+
+#ifdef QCOM
+// the rear encoder on the device reads the stream like the front one
+#define ENCODE_FROM_REFS false
+#else
+#define ENCODE_FROM_REFS true
+#endif
+
 namespace {
 
 double randrange(double a, double b) {
@@ -67,6 +79,12 @@ volatile int do_exit = 0;
 static void set_do_exit(int sig) {
   do_exit = 1;
 }
+struct FrameRef {
+  uint32_t frame_id;
+  int buf_idx;
+  uint64_t timestamp_eof;
+};
+
 struct LoggerdState {
   void *ctx;
   LoggerState logger;
@@ -75,6 +93,10 @@ struct LoggerdState {
   std::condition_variable cv;
   char segment_path[4096];
   uint32_t last_frame_id;
+  // imageRefs of the frame events not encoded yet, oldest first
+  std::deque<FrameRef> frame_refs;
+  // refs the encoder never got to, too old in the queue or gone from the ring
+  uint64_t frame_refs_dropped;
   uint32_t rotate_last_frame_id;
   int rotate_segment;
 };
@@ -144,12 +166,53 @@ void encoder_thread(bool is_streaming, bool raw_clips, bool front) {
       rawlogger = new RawLogger("prcamera", buf_info.width, buf_info.height, CAMERA_FPS);
     }
 
+    {
+      std::unique_lock<std::mutex> lk(s.lock);
+      s.frame_refs.clear();
+    }
+
     while (!do_exit) {
       VIPCBufExtra extra;
-      VIPCBuf* buf = visionstream_get(&stream, &extra);
-      if (buf == NULL) {
-        LOG("visionstream get failed");
-        break;
+      VIPCBuf* buf = NULL;
+      if (ENCODE_FROM_REFS && !front && stream.ring) {
+        // the frame events say which buffer holds the frame, so this encodes
+        // exactly the frames that got logged and needs no sync to them
+        FrameRef ref;
+        {
+          std::unique_lock<std::mutex> lk(s.lock);
+          if (!s.cv.wait_for(lk, std::chrono::milliseconds(FRAME_REF_TIMEOUT_MS),
+                             [] { return !s.frame_refs.empty() || do_exit; })) {
+            // nothing is sent on the socket of a ring subscription, readable means visiond is gone
+            struct pollfd pfd = { .fd = stream.ipc_fd, .events = POLLIN };
+            if (poll(&pfd, 1, 0) != 0) {
+              LOG("visionstream gone");
+              break;
+            }
+            continue;
+          }
+          if (do_exit) break;
+          ref = s.frame_refs.front();
+          s.frame_refs.pop_front();
+        }
+
+        buf = visionstream_get_ref(&stream, ref.buf_idx, ref.frame_id);
+        if (buf == NULL) {
+          uint64_t dropped;
+          {
+            std::unique_lock<std::mutex> lk(s.lock);
+            dropped = ++s.frame_refs_dropped;
+          }
+          LOGW_100("frame %u is gone from the ring, %" PRIu64 " frame refs dropped", ref.frame_id, dropped);
+          continue;
+        }
+        extra.frame_id = ref.frame_id;
+        extra.timestamp_eof = ref.timestamp_eof;
+      } else {
+        buf = visionstream_get(&stream, &extra);
+        if (buf == NULL) {
+          LOG("visionstream get failed");
+          break;
+        }
       }
 
       uint64_t current_time = nanos_since_boot();
@@ -673,8 +736,18 @@ int main(int argc, char** argv) {
           capnp::FlatArrayMessageReader cmsg(amsg);
           cereal::Event::Reader event = cmsg.getRoot<cereal::Event>();
           if (event.isFrame()) {
+            auto frame = event.getFrame();
             std::unique_lock<std::mutex> lk(s.lock);
-            s.last_frame_id = event.getFrame().getFrameId();
+            s.last_frame_id = frame.getFrameId();
+            if (ENCODE_FROM_REFS && frame.hasImageRef() && frame.getImageRef().getStream() == VISION_STREAM_YUV) {
+              s.frame_refs.push_back({frame.getFrameId(), frame.getImageRef().getBufIdx(), frame.getTimestampEof()});
+              if (s.frame_refs.size() > FRAME_REFS_MAX) {
+                // the encoder is behind, this one would be gone from the ring anyway
+                LOGW_100("frame %u not encoded, %" PRIu64 " frame refs dropped",
+                         s.frame_refs.front().frame_id, ++s.frame_refs_dropped);
+                s.frame_refs.pop_front();
+              }
+            }
             lk.unlock();
             s.cv.notify_all();
           }
@@ -435,6 +435,11 @@ def manager_prepare():
   for p in managed_processes:
     prepare_managed_process(p)
 
+  # compile visiond's opencl kernels into the persistent cache now instead of
+  # on its first start. only does something after visiond changed
+  if os.path.isfile('/EON'):
+    subprocess.call(["make", "clcache"], cwd=os.path.join(BASEDIR, "selfdrive/visiond"))
+
 def uninstall():
   cloudlog.warning("uninstalling")
   with open('/cache/recovery/command', 'w') as f:
@@ -464,6 +469,9 @@ def main():
     del managed_processes['controlsd']
     del managed_processes['plannerd']
     del managed_processes['radard']
+  if os.getenv("NATIVE_PATH_PLANNER") is not None and 'plannerd' in managed_processes:
+    # plannerd leaves path planning to it
+    register_managed_process("pathplannerd", ("selfdrive/pathplannerd", ["./pathplannerd"]), car_started=True)
 
   # support additional internal only extensions
   try:
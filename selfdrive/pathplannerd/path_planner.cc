@@ -0,0 +1,243 @@
+#include <cmath>
+#include <map>
+#include <eigen3/Eigen/Dense>
+
+#include "lateral_mpc.h"
+#include "path_planner.h"
+
+// Every expression is written as in pathplanner.py, model_parser.py and
+// latcontrol_helpers.py and evaluated in the same order, with contraction
+// to fma off in the Makefile, so the plan comes out the same to the bit.
+
+static_assert(ACADO_N + 1 == sizeof(((PathPlannerOutput*)0)->mpc_x) / sizeof(double), "horizon");
+
+#define CAMERA_OFFSET 0.06
+
+// MPC_COST_LAT of drive_helpers.py
+#define MPC_COST_LAT_PATH 1.0
+#define MPC_COST_LAT_LANE 3.0
+#define MPC_COST_LAT_HEADING 1.0
+
+#define MPC_MAX_COST 20000.0
+
+// as math.radians and math.degrees
+static double radians(double x) {
+  return x * (M_PI / 180.0);
+}
+
+static double degrees(double x) {
+  return x * (180.0 / M_PI);
+}
+
+// common.numpy_fast.interp
+static double interp(double x, const double *xp, const double *fp, int n) {
+  int hi = 0;
+  while (hi < n && x > xp[hi]) {
+    hi++;
+  }
+  const int low = hi - 1;
+  if (hi == n && x > xp[low]) {
+    return fp[n - 1];
+  } else if (hi == 0) {
+    return fp[0];
+  }
+  return (x - xp[low]) * (fp[hi] - fp[low]) / (xp[hi] - xp[low]) + fp[low];
+}
+
+class PathPlanner {
+  PathPlannerCar car;
+  double aR;
+
+  ACADOcontext* ctx;
+  state_t cur_state = {};
+  log_t solution = {};
+  int solution_invalid_cnt = 0;
+
+  // ModelParser
+  double lane_width_estimate = 3.7;
+  double lane_width_certainty = 1.0;
+  double lane_width = 3.7;
+  std::map<int, Eigen::MatrixXd> path_pinv;
+
+  // compute_path_pinv, for as many points as the model has
+  const Eigen::MatrixXd &pinv(int n) {
+    auto it = path_pinv.find(n);
+    if (it == path_pinv.end()) {
+      Eigen::MatrixXd X(n, 4);
+      for (int i = 0; i < n; i++) {
+        for (int k = 0; k < 4; k++) {
+          X(i, k) = std::pow((double)i, 3 - k);
+        }
+      }
+      Eigen::JacobiSVD<Eigen::MatrixXd> svd(X, Eigen::ComputeThinU | Eigen::ComputeThinV);
+      it = path_pinv.emplace(n, svd.solve(Eigen::MatrixXd::Identity(n, n))).first;
+    }
+    return it->second;
+  }
+
+  // the poly of the model, or model_polyfit of its points
+  void polyfit(const PathPlannerLine &line, bool use_poly, double poly[4]) {
+    if (use_poly) {
+      for (int k = 0; k < 4; k++) {
+        poly[k] = line.poly[k];
+      }
+      return;
+    }
+    const Eigen::MatrixXd &p = pinv(line.n_points);
+    for (int k = 0; k < 4; k++) {
+      double s = 0.0;
+      for (int i = 0; i < line.n_points; i++) {
+        s += p(k, i) * line.points[i];
+      }
+      poly[k] = s;
+    }
+  }
+
+  // VehicleModel.curvature_factor, with the stiffness and steer ratio the
+  // params learner sent
+  double curvature_factor(double u, double stiffness_factor) const {
+    const double cF = stiffness_factor * car.tire_stiffness_front;
+    const double cR = stiffness_factor * car.tire_stiffness_rear;
+    const double l = car.wheelbase;
+    const double sf = car.mass * (cF * car.center_to_front - cR * aR) / (l * l * cF * cR);
+    return (1. - car.steer_ratio_rear) / (1. - sf * (u * u)) / l;
+  }
+
+  void init_mpc() {
+    init(ctx, MPC_COST_LAT_PATH, MPC_COST_LAT_LANE, MPC_COST_LAT_HEADING, car.steer_rate_cost);
+  }
+
+public:
+  PathPlanner(const PathPlannerCar &car) : car(car) {
+    aR = car.wheelbase - car.center_to_front;
+    ctx = mpc_create();
+    init_mpc();
+  }
+
+  ~PathPlanner() {
+    mpc_destroy(ctx);
+  }
+
+  void update(const PathPlannerInput &in, PathPlannerOutput &out);
+};
+
+void PathPlanner::update(const PathPlannerInput &in, PathPlannerOutput &out) {
+  const double v_ego = in.v_ego;
+  const double angle_steers = in.angle_steers;
+  const double angle_offset_average = in.angle_offset_average;
+  const double angle_offset_bias = (double)in.angle_model_bias + angle_offset_average;
+  const double sR = in.steer_ratio;
+
+  // ModelParser.update
+  double l_poly[4], r_poly[4], p_poly[4];
+  const bool use_poly = in.left_lane.n_poly > 0;
+  polyfit(in.left_lane, use_poly, l_poly);
+  polyfit(in.right_lane, use_poly, r_poly);
+  polyfit(in.path, use_poly, p_poly);
+  l_poly[3] += CAMERA_OFFSET;
+  r_poly[3] += CAMERA_OFFSET;
+
+  const double p_prob = 1.;
+  const double l_prob = in.left_lane.prob;
+  const double r_prob = in.right_lane.prob;
+
+  const double lr_prob = l_prob * r_prob;
+  lane_width_certainty += 0.05 * (lr_prob - lane_width_certainty);
+  const double current_lane_width = std::abs(l_poly[3] - r_poly[3]);
+  lane_width_estimate += 0.005 * (current_lane_width - lane_width_estimate);
+  const double speed_bp[] = {0., 31.}, speed_lane_width_v[] = {2.8, 3.5};
+  const double speed_lane_width = interp(v_ego, speed_bp, speed_lane_width_v, 2);
+  lane_width = lane_width_certainty * lane_width_estimate + (1 - lane_width_certainty) * speed_lane_width;
+
+  // calc_desired_path
+  const double half_lane_poly[4] = {0., 0., 0., lane_width / 2.};
+  double c_poly[4] = {0., 0., 0., 0.}, c_prob = 0.;
+  if (l_prob + r_prob > 0.01) {
+    for (int k = 0; k < 4; k++) {
+      c_poly[k] = ((l_poly[k] - half_lane_poly[k]) * l_prob +
+                   (r_poly[k] + half_lane_poly[k]) * r_prob) / (l_prob + r_prob);
+    }
+    c_prob = l_prob + r_prob - l_prob * r_prob;
+  }
+  const double p_weight = 1.;
+  for (int k = 0; k < 4; k++) {
+    out.d_poly[k] = (c_poly[k] * c_prob + p_poly[k] * p_prob * p_weight) / (c_prob + p_prob * p_weight);
+  }
+
+  // run the MPC, from where the car is after the actuator delay
+  const double curvature_factor = this->curvature_factor(v_ego, in.stiffness_factor);
+  const double delay = car.steer_actuator_delay;
+  cur_state.x = v_ego * delay;
+  cur_state.psi = v_ego * curvature_factor * radians(angle_steers - angle_offset_average) / sR * delay;
+
+  const double v_ego_mpc = std::max(v_ego, 5.0);
+  run_mpc(ctx, &cur_state, &solution, l_poly, r_poly, p_poly,
+          l_prob, r_prob, p_prob, curvature_factor, v_ego_mpc, lane_width);
+
+  // reset to current steer angle if not active or overriding
+  double delta_desired, rate_desired;
+  if (in.active) {
+    delta_desired = solution.delta[1];
+    rate_desired = degrees(solution.rate[0] * sR);
+  } else {
+    delta_desired = radians(angle_steers - angle_offset_bias) / sR;
+    rate_desired = 0.0;
+  }
+  cur_state.delta = delta_desired;
+  const double angle_steers_des_mpc = degrees(delta_desired * sR) + angle_offset_bias;
+
+  bool mpc_nans = false;
+  for (int i = 0; i <= ACADO_N; i++) {
+    mpc_nans = mpc_nans || std::isnan(solution.delta[i]);
+  }
+  if (mpc_nans) {
+    init_mpc();
+    cur_state.delta = radians(angle_steers - angle_offset_bias) / sR;
+  }
+
+  if (solution.cost > MPC_MAX_COST || mpc_nans) {
+    solution_invalid_cnt++;
+  } else {
+    solution_invalid_cnt = 0;
+  }
+
+  out.lane_width = lane_width;
+  for (int k = 0; k < 4; k++) {
+    out.c_poly[k] = c_poly[k];
+    out.l_poly[k] = l_poly[k];
+    out.r_poly[k] = r_poly[k];
+  }
+  out.c_prob = c_prob;
+  out.l_prob = l_prob;
+  out.r_prob = r_prob;
+  out.angle_steers = angle_steers_des_mpc;
+  out.rate_steers = rate_desired;
+  out.angle_offset = angle_offset_average;
+  out.mpc_solution_valid = solution_invalid_cnt < 2;
+  out.mpc_nans = mpc_nans;
+
+  for (int i = 0; i <= ACADO_N; i++) {
+    out.mpc_x[i] = solution.x[i];
+    out.mpc_y[i] = solution.y[i];
+    out.mpc_psi[i] = solution.psi[i];
+    out.mpc_delta[i] = solution.delta[i];
+  }
+  out.mpc_cost = solution.cost;
+}
+
+extern "C" {
+  void* path_planner_init(const PathPlannerCar *car) {
+    return new PathPlanner(*car);
+  }
+
+  void path_planner_free(void* planner) {
+    delete (PathPlanner*)planner;
+  }
+
+  void path_planner_update(void* planner, const PathPlannerInput *inputs, PathPlannerOutput *outputs, int n) {
+    PathPlanner* p = (PathPlanner*)planner;
+    for (int i = 0; i < n; i++) {
+      p->update(inputs[i], outputs[i]);
+    }
+  }
+}
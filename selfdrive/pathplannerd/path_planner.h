@@ -0,0 +1,62 @@
+#pragma once
+
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// The path planning step of pathplanner.py, without capnp so drives can be
+// replayed from Python. Also declared in path_planner_py.py.
+
+// What the planner needs of CarParams.
+typedef struct PathPlannerCar {
+  double mass, wheelbase, center_to_front, steer_ratio_rear;
+  double tire_stiffness_front, tire_stiffness_rear;
+  double steer_ratio, steer_rate_cost, steer_actuator_delay;
+} PathPlannerCar;
+
+#define PATH_PLANNER_MAX_POINTS 100
+
+// leftLane, rightLane or path of a model. The polys are used when the left
+// lane has one, and else the points are fit as model_parser.py does.
+typedef struct PathPlannerLine {
+  int n_points;
+  float points[PATH_PLANNER_MAX_POINTS];
+  int n_poly;
+  float poly[4];
+  float prob;
+} PathPlannerLine;
+
+// The values of model, carState, controlsState and liveParameters that the
+// planner reads, as the latest of each when a model comes.
+typedef struct PathPlannerInput {
+  PathPlannerLine left_lane, right_lane, path;
+  float v_ego, angle_steers;
+  bool active;
+  float angle_model_bias;
+  float angle_offset_average, stiffness_factor, steer_ratio;
+} PathPlannerInput;
+
+// pathPlan, except valid, paramsValid and sensorValid that the daemon fills
+// in, and the solution that goes out as liveMpc.
+typedef struct PathPlannerOutput {
+  double lane_width;
+  double d_poly[4], c_poly[4], c_prob;
+  double l_poly[4], l_prob, r_poly[4], r_prob;
+  double angle_steers, rate_steers, angle_offset;
+  bool mpc_solution_valid;
+  // the MPC restarted because of NaNs
+  bool mpc_nans;
+
+  double mpc_x[21], mpc_y[21], mpc_psi[21], mpc_delta[21], mpc_cost;
+} PathPlannerOutput;
+
+void* path_planner_init(const PathPlannerCar *car);
+void path_planner_free(void* planner);
+// Plans n steps in a row, as the planner would for n models.
+void path_planner_update(void* planner, const PathPlannerInput *inputs, PathPlannerOutput *outputs, int n);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,103 @@
+import os
+import subprocess
+
+from cffi import FFI
+
+pathplannerd_dir = os.path.dirname(os.path.abspath(__file__))
+subprocess.check_call(["make", "libpathplanner.so"], cwd=pathplannerd_dir)
+
+ffi = FFI()
+ffi.cdef("""
+typedef struct PathPlannerCar {
+  double mass, wheelbase, center_to_front, steer_ratio_rear;
+  double tire_stiffness_front, tire_stiffness_rear;
+  double steer_ratio, steer_rate_cost, steer_actuator_delay;
+} PathPlannerCar;
+
+typedef struct PathPlannerLine {
+  int n_points;
+  float points[100];
+  int n_poly;
+  float poly[4];
+  float prob;
+} PathPlannerLine;
+
+typedef struct PathPlannerInput {
+  PathPlannerLine left_lane, right_lane, path;
+  float v_ego, angle_steers;
+  bool active;
+  float angle_model_bias;
+  float angle_offset_average, stiffness_factor, steer_ratio;
+} PathPlannerInput;
+
+typedef struct PathPlannerOutput {
+  double lane_width;
+  double d_poly[4], c_poly[4], c_prob;
+  double l_poly[4], l_prob, r_poly[4], r_prob;
+  double angle_steers, rate_steers, angle_offset;
+  bool mpc_solution_valid;
+  bool mpc_nans;
+
+  double mpc_x[21], mpc_y[21], mpc_psi[21], mpc_delta[21], mpc_cost;
+} PathPlannerOutput;
+
+void* path_planner_init(const PathPlannerCar *car);
+void path_planner_free(void* planner);
+void path_planner_update(void* planner, const PathPlannerInput *inputs, PathPlannerOutput *outputs, int n);
+""")
+
+libpathplanner = ffi.dlopen(os.path.join(pathplannerd_dir, "libpathplanner.so"))
+
+
+def _set_line(line, path):
+  line.n_points = len(path.points)
+  line.points[0:len(path.points)] = list(path.points)
+  line.n_poly = len(path.poly)
+  line.poly[0:len(path.poly)] = list(path.poly)
+  line.prob = path.prob
+
+
+def set_input(inp, sm):
+  """Fills a PathPlannerInput from the SubMaster of plannerd"""
+  md = sm['model']
+  _set_line(inp.left_lane, md.leftLane)
+  _set_line(inp.right_lane, md.rightLane)
+  _set_line(inp.path, md.path)
+  inp.v_ego = sm['carState'].vEgo
+  inp.angle_steers = sm['carState'].steeringAngle
+  inp.active = sm['controlsState'].active
+  inp.angle_model_bias = sm['controlsState'].angleModelBias
+  inp.angle_offset_average = sm['liveParameters'].angleOffsetAverage
+  inp.stiffness_factor = sm['liveParameters'].stiffnessFactor
+  inp.steer_ratio = sm['liveParameters'].steerRatio
+
+
+class NativePathPlanner(object):
+  """The planner of pathplannerd, to run it on drives from Python, a step
+  or many at once."""
+
+  def __init__(self, CP):
+    car = ffi.new("PathPlannerCar *")
+    car.mass = CP.mass
+    car.wheelbase = CP.wheelbase
+    car.center_to_front = CP.centerToFront
+    car.steer_ratio_rear = CP.steerRatioRear
+    car.tire_stiffness_front = CP.tireStiffnessFront
+    car.tire_stiffness_rear = CP.tireStiffnessRear
+    car.steer_ratio = CP.steerRatio
+    car.steer_rate_cost = CP.steerRateCost
+    car.steer_actuator_delay = CP.steerActuatorDelay
+    self.planner = ffi.gc(libpathplanner.path_planner_init(car), libpathplanner.path_planner_free)
+
+  def update(self, sm):
+    inp = ffi.new("PathPlannerInput *")
+    set_input(inp, sm)
+    out = ffi.new("PathPlannerOutput *")
+    libpathplanner.path_planner_update(self.planner, inp, out, 1)
+    return out
+
+  def update_many(self, inputs):
+    """inputs is a PathPlannerInput[], returns the PathPlannerOutput[]"""
+    outputs = ffi.new("PathPlannerOutput[]", len(inputs))
+    libpathplanner.path_planner_update(self.planner, inputs, outputs, len(inputs))
+    return outputs
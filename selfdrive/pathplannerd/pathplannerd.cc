@@ -0,0 +1,261 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <signal.h>
+#include <unistd.h>
+#include <assert.h>
+
+#include <zmq.h>
+#include <capnp/message.h>
+#include <capnp/serialize.h>
+#include "cereal/gen/cpp/log.capnp.h"
+#include "cereal/gen/cpp/car.capnp.h"
+
+#include "common/params.h"
+#include "common/swaglog.h"
+#include "common/timing.h"
+#include "common/util.h"
+#include "common/messaging.h"
+
+#include "path_planner.h"
+
+// The path planning of plannerd, publishes pathPlan for every model. Runs
+// instead of the PathPlanner of plannerd with NATIVE_PATH_PLANNER set.
+
+volatile int do_exit = 0;
+
+static void set_do_exit(int sig) {
+  do_exit = 1;
+}
+
+enum { MODEL, CAR_STATE, CONTROLS_STATE, LIVE_PARAMETERS, NUM_SERVICES };
+
+static const struct {
+  const char *endpoint;
+  double freq;
+} services[NUM_SERVICES] = {
+  {"tcp://127.0.0.1:8009", 20.},   // model
+  {"tcp://127.0.0.1:8021", 100.},  // carState
+  {"tcp://127.0.0.1:8007", 100.},  // controlsState
+  {"tcp://127.0.0.1:8064", 10.},   // liveParameters
+};
+
+static void copy_line(cereal::ModelData::PathData::Reader path, PathPlannerLine &line) {
+  auto points = path.getPoints();
+  line.n_points = points.size() < PATH_PLANNER_MAX_POINTS ? points.size() : PATH_PLANNER_MAX_POINTS;
+  for (int i = 0; i < line.n_points; i++) {
+    line.points[i] = points[i];
+  }
+  auto poly = path.getPoly();
+  line.n_poly = poly.size() < 4 ? poly.size() : 4;
+  for (int i = 0; i < line.n_poly; i++) {
+    line.poly[i] = poly[i];
+  }
+  line.prob = path.getProb();
+}
+
+static void send(void *sock, capnp::MallocMessageBuilder &msg) {
+  auto words = capnp::messageToFlatArray(msg);
+  auto bytes = words.asBytes();
+  zmq_send(sock, bytes.begin(), bytes.size(), ZMQ_DONTWAIT);
+}
+
+int main(int argc, char *argv[]) {
+  signal(SIGINT, (sighandler_t)set_do_exit);
+  signal(SIGTERM, (sighandler_t)set_do_exit);
+
+  // as plannerd
+  int err = set_realtime_priority(2);
+  if (err != 0) {
+    LOGW("pathplannerd can't set realtime priority: %s", strerror(errno));
+  }
+
+  const bool log_mpc = getenv("LOG_MPC") != NULL;
+
+  void *ctx = zmq_ctx_new();
+  zmq_pollitem_t polls[NUM_SERVICES] = {{0}};
+  // conflated like the SubMaster of plannerd: only the latest message of each
+  // is used, and nothing piles up during the CarParams wait below
+  for (int i = 0; i < NUM_SERVICES; i++) {
+    polls[i].socket = sub_sock_conflate(ctx, services[i].endpoint, 1);
+    polls[i].events = ZMQ_POLLIN;
+  }
+  void *path_plan_sock = zmq_socket(ctx, ZMQ_PUB);
+  err = zmq_bind(path_plan_sock, "tcp://*:8067");
+  assert(err == 0);
+  void *live_mpc_sock = zmq_socket(ctx, ZMQ_PUB);
+  err = zmq_bind(live_mpc_sock, "tcp://*:8035");
+  assert(err == 0);
+
+  LOGW("pathplannerd is waiting for CarParams");
+  char *value;
+  size_t value_sz = 0;
+  read_db_value_blocking(NULL, "CarParams", &value, &value_sz);
+
+  // make copy due to alignment issues
+  auto amsg = kj::heapArray<capnp::word>((value_sz / sizeof(capnp::word)) + 1);
+  memcpy(amsg.begin(), value, value_sz);
+  free(value);
+  capnp::FlatArrayMessageReader cmsg(amsg);
+  cereal::CarParams::Reader car_params = cmsg.getRoot<cereal::CarParams>();
+
+  PathPlannerCar car = {
+    car_params.getMass(),
+    car_params.getWheelbase(),
+    car_params.getCenterToFront(),
+    car_params.getSteerRatioRear(),
+    car_params.getTireStiffnessFront(),
+    car_params.getTireStiffnessRear(),
+    car_params.getSteerRatio(),
+    car_params.getSteerRateCost(),
+    car_params.getSteerActuatorDelay(),
+  };
+  void *planner = path_planner_init(&car);
+
+  // as plannerd starts before the first liveParameters
+  PathPlannerInput in = {};
+  in.steer_ratio = car_params.getSteerRatio();
+  in.stiffness_factor = 1.0;
+  bool params_valid = true, sensor_valid = true;
+
+  double rcv_time[NUM_SERVICES] = {0};
+  bool valid[NUM_SERVICES] = {true, true, true, true};
+  double last_nan_log_t = 0;
+
+  while (!do_exit) {
+    int ret = zmq_poll(polls, NUM_SERVICES, 100);
+    if (ret < 0) {
+      break;
+    }
+
+    const double cur_time = seconds_since_boot();
+    bool model_updated = false;
+    for (int i = 0; i < NUM_SERVICES; i++) {
+      if (!polls[i].revents) {
+        continue;
+      }
+      zmq_msg_t msg;
+      err = zmq_msg_init(&msg);
+      assert(err == 0);
+      err = zmq_msg_recv(&msg, polls[i].socket, 0);
+      assert(err >= 0);
+      // make copy due to alignment issues, will be freed on out of scope
+      auto buf = kj::heapArray<capnp::word>((zmq_msg_size(&msg) / sizeof(capnp::word)) + 1);
+      memcpy(buf.begin(), zmq_msg_data(&msg), zmq_msg_size(&msg));
+      zmq_msg_close(&msg);
+
+      capnp::FlatArrayMessageReader reader(buf);
+      cereal::Event::Reader event = reader.getRoot<cereal::Event>();
+      rcv_time[i] = cur_time;
+      valid[i] = event.getValid();
+
+      switch (event.which()) {
+      case cereal::Event::MODEL: {
+        auto model = event.getModel();
+        copy_line(model.getLeftLane(), in.left_lane);
+        copy_line(model.getRightLane(), in.right_lane);
+        copy_line(model.getPath(), in.path);
+        model_updated = true;
+        break;
+      }
+      case cereal::Event::CAR_STATE: {
+        auto car_state = event.getCarState();
+        in.v_ego = car_state.getVEgo();
+        in.angle_steers = car_state.getSteeringAngle();
+        break;
+      }
+      case cereal::Event::CONTROLS_STATE: {
+        auto controls_state = event.getControlsState();
+        in.active = controls_state.getActive();
+        in.angle_model_bias = controls_state.getAngleModelBias();
+        break;
+      }
+      case cereal::Event::LIVE_PARAMETERS: {
+        auto live_params = event.getLiveParameters();
+        in.angle_offset_average = live_params.getAngleOffsetAverage();
+        in.stiffness_factor = live_params.getStiffnessFactor();
+        in.steer_ratio = live_params.getSteerRatio();
+        params_valid = live_params.getValid();
+        sensor_valid = live_params.getSensorValid();
+        break;
+      }
+      default:
+        break;
+      }
+    }
+
+    if (!model_updated) {
+      continue;
+    }
+
+    PathPlannerOutput out;
+    path_planner_update(planner, &in, &out, 1);
+
+    if (out.mpc_nans && cur_time > last_nan_log_t + 5.0) {
+      last_nan_log_t = cur_time;
+      LOGW("Lateral mpc - nan: True");
+    }
+
+    // alive if delay is within 10x the expected frequency, as SubMaster
+    bool all_alive_and_valid = true;
+    for (int i = 0; i < NUM_SERVICES; i++) {
+      all_alive_and_valid = all_alive_and_valid && (cur_time - rcv_time[i]) < (10. / services[i].freq) && valid[i];
+    }
+
+    capnp::MallocMessageBuilder msg;
+    cereal::Event::Builder event = msg.initRoot<cereal::Event>();
+    event.setLogMonoTime(nanos_since_boot());
+    event.setValid(all_alive_and_valid);
+    auto path_plan = event.initPathPlan();
+    path_plan.setLaneWidth(out.lane_width);
+    auto set_poly = [](capnp::List<float>::Builder l, const double *poly) {
+      for (int k = 0; k < 4; k++) {
+        l.set(k, poly[k]);
+      }
+    };
+    set_poly(path_plan.initDPoly(4), out.d_poly);
+    set_poly(path_plan.initCPoly(4), out.c_poly);
+    path_plan.setCProb(out.c_prob);
+    set_poly(path_plan.initLPoly(4), out.l_poly);
+    path_plan.setLProb(out.l_prob);
+    set_poly(path_plan.initRPoly(4), out.r_poly);
+    path_plan.setRProb(out.r_prob);
+    path_plan.setAngleSteers(out.angle_steers);
+    path_plan.setRateSteers(out.rate_steers);
+    path_plan.setAngleOffset(out.angle_offset);
+    path_plan.setMpcSolutionValid(out.mpc_solution_valid);
+    path_plan.setParamsValid(params_valid);
+    path_plan.setSensorValid(sensor_valid);
+    send(path_plan_sock, msg);
+
+    if (log_mpc) {
+      capnp::MallocMessageBuilder mpc_msg;
+      cereal::Event::Builder mpc_event = mpc_msg.initRoot<cereal::Event>();
+      mpc_event.setLogMonoTime(nanos_since_boot());
+      auto live_mpc = mpc_event.initLiveMpc();
+      const int n = sizeof(out.mpc_x) / sizeof(out.mpc_x[0]);
+      auto x = live_mpc.initX(n);
+      auto y = live_mpc.initY(n);
+      auto psi = live_mpc.initPsi(n);
+      auto delta = live_mpc.initDelta(n);
+      for (int i = 0; i < n; i++) {
+        x.set(i, out.mpc_x[i]);
+        y.set(i, out.mpc_y[i]);
+        psi.set(i, out.mpc_psi[i]);
+        delta.set(i, out.mpc_delta[i]);
+      }
+      live_mpc.setCost(out.mpc_cost);
+      send(live_mpc_sock, mpc_msg);
+    }
+  }
+
+  path_planner_free(planner);
+  for (int i = 0; i < NUM_SERVICES; i++) {
+    zmq_close(polls[i].socket);
+  }
+  zmq_close(path_plan_sock);
+  zmq_close(live_mpc_sock);
+  zmq_ctx_destroy(ctx);
+  return 0;
+}
@@ -0,0 +1,128 @@
+#include <cstdio>
+#include <cstring>
+#include <cmath>
+#include <cassert>
+#include <ctime>
+#include <vector>
+#include <algorithm>
+
+#include "path_planner.h"
+
+// Plans a drive of synthetic models, checks that planning is repeatable and
+// that fitting points gives the polys back, and times the CPU of a cycle.
+// test_pathplanner_native.py checks the plan against pathplanner.py.
+
+#define CYCLES (20 * 60 * 10)
+
+static const PathPlannerCar car = {
+  1326. + 150., 2.70, 2.70 * 0.4, 0.,  // civic
+  192150., 202500., 15.38, 0.5, 0.1,
+};
+
+static double cpu_us() {
+  struct timespec t;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &t);
+  return t.tv_sec * 1e6 + t.tv_nsec * 1e-3;
+}
+
+// a road that bends both ways, lanes that fade out, and a driver who takes
+// over now and then
+static std::vector<PathPlannerInput> drive(bool points) {
+  std::vector<PathPlannerInput> inputs(CYCLES);
+  for (int i = 0; i < CYCLES; i++) {
+    const double t = i * 0.05;
+    PathPlannerInput &in = inputs[i];
+    memset(&in, 0, sizeof(in));
+
+    const double curv = 0.002 * sin(t * 0.05) + 0.0005 * sin(t * 0.7);
+    const double heading = 0.01 * sin(t * 0.3);
+    const double offset = 0.3 * sin(t * 0.2);
+    const double polys[3][4] = {
+      {curv * 0.01, curv, heading, 1.8 + offset},
+      {curv * 0.01, curv, heading, -1.8 + offset},
+      {curv * 0.01, curv, heading, offset},
+    };
+    PathPlannerLine *lines[3] = {&in.left_lane, &in.right_lane, &in.path};
+    for (int k = 0; k < 3; k++) {
+      PathPlannerLine &line = *lines[k];
+      if (points) {
+        line.n_points = 50;
+        for (int x = 0; x < 50; x++) {
+          line.points[x] = ((polys[k][0] * x + polys[k][1]) * x + polys[k][2]) * x + polys[k][3];
+        }
+      } else {
+        line.n_poly = 4;
+        for (int c = 0; c < 4; c++) {
+          line.poly[c] = polys[k][c];
+        }
+      }
+    }
+    in.left_lane.prob = fmod(t, 40.) < 30. ? 0.9 : 0.1;
+    in.right_lane.prob = fmod(t, 65.) < 50. ? 0.8 : 0.0;
+
+    in.v_ego = 15. + 10. * sin(t * 0.01);
+    in.angle_steers = 15.38 * 2.70 * curv * 180. / M_PI + 0.5 * sin(t * 1.3);
+    in.active = fmod(t, 90.) > 5.;
+    in.angle_model_bias = 0.1;
+    in.angle_offset_average = -0.4;
+    in.stiffness_factor = 1.05;
+    in.steer_ratio = 15.0;
+  }
+  return inputs;
+}
+
+static void percentiles(const char *name, std::vector<double> v) {
+  std::sort(v.begin(), v.end());
+  double sum = 0.;
+  for (double x : v) sum += x;
+  printf("%-22s mean %7.1f us  p50 %7.1f  p99 %7.1f  max %7.1f\n", name, sum / v.size(),
+         v[v.size() / 2], v[v.size() * 99 / 100], v.back());
+}
+
+static std::vector<double> time_cycles(const std::vector<PathPlannerInput> &inputs,
+                                       std::vector<PathPlannerOutput> &outputs) {
+  void *planner = path_planner_init(&car);
+  std::vector<double> us(inputs.size());
+  for (size_t i = 0; i < inputs.size(); i++) {
+    const double t = cpu_us();
+    path_planner_update(planner, &inputs[i], &outputs[i], 1);
+    us[i] = cpu_us() - t;
+  }
+  path_planner_free(planner);
+  return us;
+}
+
+int main() {
+  std::vector<PathPlannerInput> polys = drive(false), points = drive(true);
+  std::vector<PathPlannerOutput> out(CYCLES), again(CYCLES), fit(CYCLES);
+
+  // a cycle at a time and all at once plan the same
+  std::vector<double> us = time_cycles(polys, out);
+  void *planner = path_planner_init(&car);
+  path_planner_update(planner, polys.data(), again.data(), CYCLES);
+  path_planner_free(planner);
+  for (int i = 0; i < CYCLES; i++) {
+    assert(memcmp(&out[i], &again[i], sizeof(PathPlannerOutput)) == 0);
+  }
+
+  // fitting the points gets the polys back, up to the floats they are in
+  std::vector<double> fit_us = time_cycles(points, fit);
+  double max_poly_err = 0., max_angle_err = 0.;
+  int valid = 0;
+  for (int i = 0; i < CYCLES; i++) {
+    for (int k = 0; k < 4; k++) {
+      max_poly_err = std::max(max_poly_err, std::abs(fit[i].d_poly[k] - out[i].d_poly[k]));
+    }
+    max_angle_err = std::max(max_angle_err, std::abs(fit[i].angle_steers - out[i].angle_steers));
+    valid += out[i].mpc_solution_valid;
+  }
+  printf("%d cycles, %d valid, fit polys within %.2g, angles within %.2g deg\n", CYCLES, valid,
+         max_poly_err, max_angle_err);
+  assert(max_poly_err < 1e-5);
+  assert(max_angle_err < 1e-2);
+  assert(valid > CYCLES * 9 / 10);
+
+  percentiles("cycle, model polys", us);
+  percentiles("cycle, model points", fit_us);
+  return 0;
+}
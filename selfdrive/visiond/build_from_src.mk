@@ -61,6 +61,14 @@ else
               -lSNPE -lsymphony-cpu \
               -Wl,-rpath $(PHONELIBS)/snpe/x86_64-linux-clang/
 
+  # modelreplay only
+  BZIP_FLAGS = -I$(PHONELIBS)/bzip2/
+  BZIP_LIBS = -lbz2
+  FFMPEG_LIBS = -lavformat \
+                -lavcodec \
+                -lavutil \
+                -lz
+
   CFLAGS += -g
   CXXFLAGS += -g -I../common
 
@@ -75,8 +83,7 @@ endif
 
   OTHER_LIBS = -lz -lm -lpthread
 
-  CFLAGS += -D_GNU_SOURCE \
-            -DCLU_NO_CACHE
+  CFLAGS += -D_GNU_SOURCE
   OBJS = visiond.o
 else
 	# assume phone
@@ -133,6 +140,7 @@ OBJS += $(PLATFORM_OBJS) \
         ../common/swaglog.o \
         ../common/ipc.o \
         ../common/visionipc.o \
+        ../common/vipc_ring.o \
         ../common/util.o \
         ../common/params.o \
         ../common/efd.o \
@@ -140,12 +148,17 @@ OBJS += $(PLATFORM_OBJS) \
         transforms/transform.o \
         transforms/loadyuv.o \
         transforms/rgb_to_yuv.o \
+        transforms/ae_histogram.o \
+        transforms/transform_cpu.o \
         models/commonmodel.o \
         runners/snpemodel.o \
+        models/posenet_frames.o \
         models/posenet.o \
         models/monitoring.o \
         models/driving.o \
         clutil.o \
+        thumbnail.o \
+        scheduler.o \
         $(PHONELIBS)/json/src/json.o \
         $(PHONELIBS)/json11/json11.o \
         $(CEREAL_OBJS)
@@ -162,6 +175,105 @@ rgb_to_yuv_test: transforms/rgb_to_yuv_test.o clutil.o transforms/rgb_to_yuv.o .
         $(OPENCL_LIBS) \
 
 
+ae_histogram_test: transforms/ae_histogram_test.o clutil.o transforms/ae_histogram.o ../common/util.o
+	@echo "[ LINK ] $@"
+	$(CXX) -fPIC -o '$@' $^ \
+        $(LDFLAGS) \
+        -L/usr/lib \
+        -L/system/vendor/lib64 \
+        $(OPENCL_LIBS)
+
+pipeline_test: transforms/pipeline_test.o clutil.o transforms/rgb_to_yuv.o transforms/transform.o transforms/loadyuv.o ../common/util.o
+	@echo "[ LINK ] $@"
+	$(CXX) -fPIC -o '$@' $^ \
+        $(LDFLAGS) \
+        -L/usr/lib \
+        -L/system/vendor/lib64 \
+        $(OPENCL_LIBS)
+
+# the scalar and vector coordinate math of transform_cpu give the same bits
+# only without fma contraction
+transforms/transform_cpu.o: CFLAGS += -ffp-contract=off
+
+transform_cpu_test: transforms/transform_cpu_test.o clutil.o transforms/transform.o transforms/transform_cpu.o transforms/loadyuv.o ../common/util.o
+	@echo "[ LINK ] $@"
+	$(CXX) -fPIC -o '$@' $^ \
+        $(LDFLAGS) \
+        -L/usr/lib \
+        -L/system/vendor/lib64 \
+        $(OPENCL_LIBS) \
+        -lpthread
+
+debayer_test: cameras/debayer_test.o clutil.o ../common/util.o
+	@echo "[ LINK ] $@"
+	$(CXX) -fPIC -o '$@' $^ \
+        $(LDFLAGS) \
+        -L/usr/lib \
+        -L/system/vendor/lib64 \
+        $(OPENCL_LIBS)
+
+runmodel_test: runners/runmodel_test.o runners/snpemodel.o $(filter runners/%,$(PLATFORM_OBJS)) ../common/util.o
+	@echo "[ LINK ] $@"
+	$(CXX) -fPIC -o '$@' $^ \
+        $(LDFLAGS) \
+        $(TF_LIBS) \
+        $(SNPE_LIBS) \
+        $(OTHER_LIBS)
+
+MODELREPLAY_OBJS = modelreplay.o \
+                   models/driving.o \
+                   models/posenet.o \
+                   models/posenet_frames.o \
+                   models/commonmodel.o \
+                   transforms/transform.o \
+                   transforms/transform_cpu.o \
+                   transforms/loadyuv.o \
+                   runners/snpemodel.o \
+                   $(filter runners/%,$(PLATFORM_OBJS)) \
+                   clutil.o \
+                   ../common/util.o \
+                   log.capnp.o \
+                   car.capnp.o \
+                   $(CEREAL_OBJS)
+
+modelreplay: $(MODELREPLAY_OBJS)
+	@echo "[ LINK ] $@"
+	$(CXX) -fPIC -o '$@' $^ \
+        $(LDFLAGS) \
+        $(CEREAL_LIBS) \
+        $(ZMQ_LIBS) \
+        $(FFMPEG_LIBS) \
+        $(BZIP_LIBS) \
+        -L/usr/lib \
+        $(OPENCL_LIBS) \
+        $(TF_LIBS) \
+        $(SNPE_LIBS) \
+        $(OTHER_LIBS)
+
+scheduler_test: scheduler_test.o scheduler.o
+	@echo "[ LINK ] $@"
+	$(CXX) -fPIC -o '$@' $^ \
+        $(LDFLAGS) \
+        -lpthread -lm
+
+vipc_ring_bench: vipc_ring_bench.o ../common/vipc_ring.o ../common/visionipc.o ../common/ipc.o
+	@echo "[ LINK ] $@"
+	$(CXX) -fPIC -o '$@' $^ \
+        $(LDFLAGS)
+
+frame_bench: frame_bench.o log.capnp.o car.capnp.o $(CEREAL_OBJS)
+	@echo "[ LINK ] $@"
+	$(CXX) -fPIC -o '$@' $^ \
+        $(LDFLAGS) \
+        $(CEREAL_LIBS) \
+        $(ZMQ_LIBS) \
+        $(OTHER_LIBS)
+
+posenet_bench: models/posenet_bench.o models/posenet_frames.o
+	@echo "[ LINK ] $@"
+	$(CXX) -fPIC -o '$@' $^ \
+        $(LDFLAGS)
+
 $(OUTPUT): $(OBJS)
 	@echo "[ LINK ] $@"
 	$(CXX) -fPIC -o '$@' $^ \
@@ -196,6 +308,7 @@ $(MODEL_OBJS): %.o: %.dlc
            $(LIBYUV_FLAGS) \
            $(TF_FLAGS) \
            $(SNPE_FLAGS) \
+           $(BZIP_FLAGS) \
            $(JSON_FLAGS) \
            $(JSON11_FLAGS) $(CURL_FLAGS) \
            -I$(PHONELIBS)/libgralloc/include \
@@ -215,8 +328,33 @@ $(MODEL_OBJS): %.o: %.dlc
           -I$(PHONELIBS)/linux/include \
           -c -o '$@' '$<'
 
+# Fills the persistent opencl kernel cache, so visiond doesn't compile on
+# its first start after an install or update. The stamp lives in the cache
+# directory clutil uses (keep in sync with cache_dir()), so it's gone with
+# the cache, and the compile is redone when visiond, a kernel or the opencl
+# driver changes.
+CL_SRCS = $(wildcard cameras/*.cl transforms/*.cl)
+
+ifeq ($(UNAME_M),x86_64)
+  CLCACHE_DIR = $(or $(CLU_CACHE_DIR),$(if $(HOME),$(HOME)/.cache/clcache,/tmp/clcache))/v2
+  # icd loader entries, and the libraries they name by absolute path
+  CL_DRIVER = $(wildcard /etc/OpenCL/vendors/*.icd $(shell cat /etc/OpenCL/vendors/*.icd 2>/dev/null))
+else
+  CLCACHE_DIR = $(or $(CLU_CACHE_DIR),/data/clcache)/v2
+  CL_DRIVER = $(wildcard /system/vendor/lib64/libOpenCL.so /system/vendor/lib64/libCB.so \
+                         /system/vendor/lib64/libgsl.so /system/vendor/lib64/libllvm-qcom.so)
+endif
+
+.PHONY: clcache
+clcache: $(CLCACHE_DIR)/visiond.stamp
+
+$(CLCACHE_DIR)/visiond.stamp: $(OUTPUT) $(CL_SRCS) $(CL_DRIVER)
+	@echo "[ CLCACHE ] $@"
+	./$(OUTPUT) -t
+	touch '$@'
+
 .PHONY: clean
 clean:
-	rm -f visiond rgb_to_yuv_test rgb_to_yuv_test.o $(OBJS) $(DEPS)
+	rm -f visiond rgb_to_yuv_test rgb_to_yuv_test.o ae_histogram_test transforms/ae_histogram_test.o pipeline_test transforms/pipeline_test.o debayer_test cameras/debayer_test.o transform_cpu_test transforms/transform_cpu_test.o runmodel_test runners/runmodel_test.o posenet_bench models/posenet_bench.o scheduler_test scheduler_test.o vipc_ring_bench vipc_ring_bench.o frame_bench frame_bench.o modelreplay modelreplay.o log.capnp.o car.capnp.o $(OBJS) $(DEPS)
 
 -include $(DEPS)
@@ -128,3 +128,185 @@ __kernel void debayer10(__global uchar const * const in,
     }
   }
 }
+
+// Non HDR path of debayer10 for one 2x2 quad, vx is the x of the pixel pair
+// the quad belongs to (debayer10 evaluates the vignetting once per pair).
+inline uchar3 debayer_quad(uint4 pint, int vx, int oy, float digital_gain) {
+  float4 p = convert_float4(pint);
+
+  const float black_level = 56.0f;
+  p = (p - black_level);
+
+  const float r = ((oy - RGB_HEIGHT/2)*(oy - RGB_HEIGHT/2) + (vx - RGB_WIDTH/2)*(vx - RGB_WIDTH/2));
+  const float fake_f = 700.0f;
+  const float lil_a = (1.0f + r/(fake_f*fake_f));
+  p = p * lil_a * lil_a;
+
+  p /= (1024.0f-black_level);
+
+  p *= digital_gain;
+
+#if BAYER_FLIP == 3
+  float3 c1 = (float3)(p.s3, (p.s1+p.s2)/2.0f, p.s0);
+#elif BAYER_FLIP == 2
+  float3 c1 = (float3)(p.s2, (p.s0+p.s3)/2.0f, p.s1);
+#elif BAYER_FLIP == 1
+  float3 c1 = (float3)(p.s1, (p.s0+p.s3)/2.0f, p.s2);
+#elif BAYER_FLIP == 0
+  float3 c1 = (float3)(p.s0, (p.s1+p.s2)/2.0f, p.s3);
+#endif
+
+  c1 = color_correct(c1);
+  return convert_uchar3_sat(c1.zyx * 255.0f);
+}
+
+// Unpacks the two quads of a 5 byte MIPI RAW10 group on each of the two rows.
+inline void unpack_raw10(uchar4 v1, uchar ex1, uchar4 v2, uchar ex2, uint4 *q0, uint4 *q1) {
+  *q0 = (uint4)(
+    (((uint)v1.s0 << 2) + ( (ex1 >> 0) & 3)),
+    (((uint)v1.s1 << 2) + ( (ex1 >> 2) & 3)),
+    (((uint)v2.s0 << 2) + ( (ex2 >> 0) & 3)),
+    (((uint)v2.s1 << 2) + ( (ex2 >> 2) & 3)));
+  *q1 = (uint4)(
+    (((uint)v1.s2 << 2) + ( (ex1 >> 4) & 3)),
+    (((uint)v1.s3 << 2) + ( (ex1 >> 6) & 3)),
+    (((uint)v2.s2 << 2) + ( (ex2 >> 4) & 3)),
+    (((uint)v2.s3 << 2) + ( (ex2 >> 6) & 3)));
+}
+
+// 2D tiled debayer10, only for non HDR sensors (HDR decompression is
+// sequential along a row and stays on debayer10).
+// A work group covers DEBAYER_TILE_Y output rows of DEBAYER_TILE_X *
+// DEBAYER_TILE_PX pixels. The packed input rows of the tile are read into
+// local memory with coalesced 4 byte loads, then every work item unpacks two
+// RAW10 groups and writes DEBAYER_TILE_PX bgr pixels. Every output pixel only
+// depends on its own 2x2 quad, so the tile needs no halo.
+#define DEBAYER_TILE_X 16
+#define DEBAYER_TILE_Y 8
+#define DEBAYER_TILE_PX 4
+#define DEBAYER_TILE_BYTES (DEBAYER_TILE_X * DEBAYER_TILE_PX / 2 * 5)
+
+__kernel __attribute__((reqd_work_group_size(DEBAYER_TILE_X, DEBAYER_TILE_Y, 1)))
+void debayer10_tiled(__global uchar const * const in,
+                     __global uchar * out, float digital_gain)
+{
+  __local uchar raw[DEBAYER_TILE_Y * 2][DEBAYER_TILE_BYTES];
+
+  const int lx = get_local_id(0);
+  const int ly = get_local_id(1);
+
+#if !HDR
+  const int tile_ix = get_group_id(0) * DEBAYER_TILE_BYTES;
+  const int tile_iy = get_group_id(1) * DEBAYER_TILE_Y * 2;
+  for (int i = ly * DEBAYER_TILE_X + lx; i < DEBAYER_TILE_Y * 2 * DEBAYER_TILE_BYTES / 4;
+       i += DEBAYER_TILE_X * DEBAYER_TILE_Y) {
+    const int r = i / (DEBAYER_TILE_BYTES / 4);
+    const int c = (i % (DEBAYER_TILE_BYTES / 4)) * 4;
+    const int iy = tile_iy + r;
+    const int ix = tile_ix + c;
+    if (iy < FRAME_HEIGHT && ix + 4 <= FRAME_STRIDE) {
+      vstore4(vload4(0, &in[iy * FRAME_STRIDE + ix]), 0, &raw[r][c]);
+    } else {
+      for (int k = 0; k < 4; k++) {
+        raw[r][c+k] = (iy < FRAME_HEIGHT && ix + k < FRAME_STRIDE) ? in[iy * FRAME_STRIDE + ix + k] : 0;
+      }
+    }
+  }
+  barrier(CLK_LOCAL_MEM_FENCE);
+
+  const int ox = get_global_id(0) * DEBAYER_TILE_PX;
+  const int oy = get_global_id(1);
+  if (ox >= RGB_WIDTH || oy >= RGB_HEIGHT) return;
+
+  uchar3 bgr[DEBAYER_TILE_PX];
+  #pragma unroll
+  for (int g = 0; g < DEBAYER_TILE_PX / 2; g++) {
+    const int c = (lx * DEBAYER_TILE_PX / 2 + g) * 5;
+    uint4 q0, q1;
+    unpack_raw10(vload4(0, &raw[ly*2][c]), raw[ly*2][c+4],
+                 vload4(0, &raw[ly*2+1][c]), raw[ly*2+1][c+4], &q0, &q1);
+    const int vx = ox + g*2;
+    bgr[g*2] = debayer_quad(q0, vx, oy, digital_gain);
+    bgr[g*2+1] = debayer_quad(q1, vx, oy, digital_gain);
+  }
+
+  __global uchar *dst = &out[oy * RGB_STRIDE + ox * 3];
+  if (ox + DEBAYER_TILE_PX <= RGB_WIDTH) {
+    vstore8((uchar8)(bgr[0], bgr[1], bgr[2].s01), 0, dst);
+    vstore4((uchar4)(bgr[2].s2, bgr[3]), 0, dst + 8);
+  } else {
+    for (int k = 0; k < DEBAYER_TILE_PX && ox + k < RGB_WIDTH; k++) {
+      vstore3(bgr[k], k, dst);
+    }
+  }
+#endif
+}
+
+// debayer10 fused with rgb_to_yuv, only for non HDR sensors.
+// One work item per output pixel, the bgr tile of the work group is kept
+// in local memory so the 2x2 chroma average doesn't go back to global.
+#define YUV_TILE_W 16
+#define YUV_TILE_H 8
+#define YUV_SIZE (RGB_WIDTH * RGB_HEIGHT)
+#define YUV_UV_WIDTH (RGB_WIDTH / 2)
+#define YUV_UV_HEIGHT (RGB_HEIGHT / 2)
+
+// same integer math as transforms/rgb_to_yuv.cl
+#define YUV_RGB_TO_Y(r, g, b) ((((mul24(b, 13) + mul24(g, 65) + mul24(r, 33)) + 64) >> 7) + 16)
+#define YUV_RGB_TO_U(r, g, b) ((mul24(b, 56) - mul24(g, 37) - mul24(r, 19) + 0x8080) >> 8)
+#define YUV_RGB_TO_V(r, g, b) ((mul24(r, 56) - mul24(g, 47) - mul24(b, 9) + 0x8080) >> 8)
+#define YUV_AVERAGE(x, y, z, w) ((convert_ushort(x) + convert_ushort(y) + convert_ushort(z) + convert_ushort(w) + 1) >> 1)
+
+__kernel __attribute__((reqd_work_group_size(YUV_TILE_W, YUV_TILE_H, 1)))
+void debayer10_yuv(__global uchar const * const in,
+                   __global uchar * out,
+                   __global uchar * out_yuv,
+                   float digital_gain)
+{
+  __local uchar4 tile[YUV_TILE_H][YUV_TILE_W];
+
+  const int ox = get_global_id(0);
+  const int oy = get_global_id(1);
+  const int lx = get_local_id(0);
+  const int ly = get_local_id(1);
+  const bool valid = ox < RGB_WIDTH && oy < RGB_HEIGHT;
+
+  uchar3 bgr = (uchar3)(0, 0, 0);
+#if !HDR
+  if (valid) {
+    const int iy = oy * 2;
+    const int ix = (ox/2) * 5;
+
+    const uchar4 v1 = vload4(0, &in[iy * FRAME_STRIDE + ix]);
+    const uchar ex1 = in[iy * FRAME_STRIDE + ix + 4];
+    const uchar4 v2 = vload4(0, &in[(iy+1) * FRAME_STRIDE + ix]);
+    const uchar ex2 = in[(iy+1) * FRAME_STRIDE + ix + 4];
+
+    uint4 q0, q1;
+    unpack_raw10(v1, ex1, v2, ex2, &q0, &q1);
+    bgr = debayer_quad((ox & 1) ? q1 : q0, ox & ~1, oy, digital_gain);
+
+    // output BGR for the UI and Y for the encoder/model
+    vstore3(bgr, 0, &out[oy * RGB_STRIDE + ox * 3]);
+    out_yuv[oy * RGB_WIDTH + ox] = YUV_RGB_TO_Y(bgr.s2, bgr.s1, bgr.s0);
+  }
+#endif
+
+  tile[ly][lx] = (uchar4)(bgr, 0);
+  barrier(CLK_LOCAL_MEM_FENCE);
+
+  // top left pixel of each 2x2 block writes U and V
+  if (valid && ((lx | ly) & 1) == 0) {
+    const uchar4 p00 = tile[ly][lx];
+    const uchar4 p01 = tile[ly][lx+1];
+    const uchar4 p10 = tile[ly+1][lx];
+    const uchar4 p11 = tile[ly+1][lx+1];
+    const short ab = YUV_AVERAGE(p00.s0, p01.s0, p10.s0, p11.s0);
+    const short ag = YUV_AVERAGE(p00.s1, p01.s1, p10.s1, p11.s1);
+    const short ar = YUV_AVERAGE(p00.s2, p01.s2, p10.s2, p11.s2);
+
+    const int uvi = (oy/2) * YUV_UV_WIDTH + ox/2;
+    out_yuv[YUV_SIZE + uvi] = YUV_RGB_TO_U(ar, ag, ab);
+    out_yuv[YUV_SIZE + YUV_UV_WIDTH * YUV_UV_HEIGHT + uvi] = YUV_RGB_TO_V(ar, ag, ab);
+  }
+}
@@ -0,0 +1,222 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <cassert>
+
+#include <CL/cl.h>
+
+#include "common/util.h"
+#include "clutil.h"
+
+// Compares debayer10_tiled against the row per work item debayer10 and
+// reports the device time of both from the profiling events.
+//
+// usage: debayer_test                       random frames for every non HDR sensor
+//        debayer_test <sensor> <raw>...     recorded frames, one raw RAW10 buffer per file
+
+struct Sensor {
+  const char *name;
+  int frame_width, frame_height, frame_stride;
+  int bayer_flip;
+};
+
+// non HDR entries of cameras_supported in camera_qcom.c
+static const Sensor sensors[] = {
+  {"imx179", 3280, 2464, 4104, 0},
+  {"s5k3p8sp", 2304, 1728, 2880, 1},
+  {"ov8865", 1632, 1224, 2040, 3},
+};
+
+// the kernels are built with -cl-fast-relaxed-math, allow off by one
+#define MAXE 1
+
+#define ITERS 20
+
+void cl_init(cl_device_id &device_id, cl_context &context) {
+  int err;
+  cl_platform_id platform_id = NULL;
+  cl_uint num_devices;
+  cl_uint num_platforms;
+
+  err = clGetPlatformIDs(1, &platform_id, &num_platforms);
+  err = clGetDeviceIDs(platform_id, CL_DEVICE_TYPE_DEFAULT, 1,
+                       &device_id, &num_devices);
+  cl_print_info(platform_id, device_id);
+  context = clCreateContext(NULL, 1, &device_id, NULL, NULL, &err);
+}
+
+static double event_ms(cl_event event) {
+  cl_ulong t_start = 0, t_end = 0;
+  clWaitForEvents(1, &event);
+  clGetEventProfilingInfo(event, CL_PROFILING_COMMAND_START, sizeof(t_start), &t_start, NULL);
+  clGetEventProfilingInfo(event, CL_PROFILING_COMMAND_END, sizeof(t_end), &t_end, NULL);
+  clReleaseEvent(event);
+  return (t_end - t_start) * 1e-6;
+}
+
+static bool load_frame(const char *path, uint8_t *frame, size_t frame_size) {
+  FILE *f = fopen(path, "rb");
+  if (!f) {
+    printf("can't open %s\n", path);
+    return false;
+  }
+  size_t n = fread(frame, 1, frame_size, f);
+  fclose(f);
+  if (n != frame_size) {
+    printf("%s: expected %zu bytes, got %zu\n", path, frame_size, n);
+    return false;
+  }
+  return true;
+}
+
+// returns the number of mismatched frames
+static int run_sensor(cl_context context, cl_device_id device_id, cl_command_queue q,
+                      const Sensor &sensor, int nframes, char **paths) {
+  int err;
+  const int rgb_width = sensor.frame_width / 2;
+  const int rgb_height = sensor.frame_height / 2;
+  const int rgb_stride = rgb_width * 3;
+
+  char args[4096];
+  snprintf(args, sizeof(args),
+           "-cl-fast-relaxed-math -cl-denorms-are-zero "
+           "-DFRAME_WIDTH=%d -DFRAME_HEIGHT=%d -DFRAME_STRIDE=%d "
+           "-DRGB_WIDTH=%d -DRGB_HEIGHT=%d -DRGB_STRIDE=%d "
+           "-DBAYER_FLIP=%d -DHDR=%d",
+           sensor.frame_width, sensor.frame_height, sensor.frame_stride,
+           rgb_width, rgb_height, rgb_stride,
+           sensor.bayer_flip, 0);
+  cl_program prg = CLU_LOAD_FROM_FILE(context, device_id, "cameras/debayer.cl", args);
+  cl_kernel krnl_row = clCreateKernel(prg, "debayer10", &err);
+  assert(err == 0);
+  cl_kernel krnl_tiled = clCreateKernel(prg, "debayer10_tiled", &err);
+  assert(err == 0);
+
+  const size_t frame_size = sensor.frame_stride * sensor.frame_height;
+  const size_t rgb_size = rgb_stride * rgb_height;
+
+  cl_mem frame_cl = clCreateBuffer(context, CL_MEM_READ_ONLY, frame_size, NULL, &err);
+  assert(err == 0);
+  cl_mem rgb_cl[2];
+  for (int k = 0; k < 2; k++) {
+    rgb_cl[k] = clCreateBuffer(context, CL_MEM_READ_WRITE, rgb_size, NULL, &err);
+    assert(err == 0);
+  }
+
+  uint8_t *frame = new uint8_t[frame_size];
+  uint8_t *rgb[2] = {new uint8_t[rgb_size], new uint8_t[rgb_size]};
+
+  // same launch shapes as debayer_enqueue in visiond.cc, except debayer10
+  // lets the runtime pick the group size since rgb_height isn't a multiple of 128
+  const size_t row_work_size = rgb_height;
+  const size_t tiled_work_size[2] = {(size_t)ALIGN(rgb_width, 64) / 4, (size_t)ALIGN(rgb_height, 8)};
+  const size_t tiled_local_work_size[2] = {16, 8};
+
+  double t_row = 0, t_tiled = 0;
+  int mismatched = 0;
+  for (int i = 0; i < nframes; i++) {
+    if (paths) {
+      if (!load_frame(paths[i], frame, frame_size)) {
+        mismatched++;
+        continue;
+      }
+    } else if (i == 0) {
+      // all black, below the black level
+      memset(frame, 0, frame_size);
+    } else {
+      for (size_t j = 0; j < frame_size; j++) {
+        frame[j] = (uint8_t)rand();
+      }
+    }
+    clEnqueueWriteBuffer(q, frame_cl, CL_TRUE, 0, frame_size, frame, 0, NULL, NULL);
+
+    const float digital_gain = 1.0f + (i % 4) * 0.25f;
+    for (int k = 0; k < 2; k++) {
+      // don't let stale output from the other kernel hide missed pixels
+      const uint8_t pattern = 0xA5;
+      clEnqueueFillBuffer(q, rgb_cl[k], &pattern, 1, 0, rgb_size, 0, NULL, NULL);
+    }
+
+    cl_event event;
+    clSetKernelArg(krnl_row, 0, sizeof(cl_mem), &frame_cl);
+    clSetKernelArg(krnl_row, 1, sizeof(cl_mem), &rgb_cl[0]);
+    clSetKernelArg(krnl_row, 2, sizeof(float), &digital_gain);
+    err = clEnqueueNDRangeKernel(q, krnl_row, 1, NULL, &row_work_size, NULL, 0, NULL, &event);
+    assert(err == 0);
+    t_row += event_ms(event);
+
+    clSetKernelArg(krnl_tiled, 0, sizeof(cl_mem), &frame_cl);
+    clSetKernelArg(krnl_tiled, 1, sizeof(cl_mem), &rgb_cl[1]);
+    clSetKernelArg(krnl_tiled, 2, sizeof(float), &digital_gain);
+    err = clEnqueueNDRangeKernel(q, krnl_tiled, 2, NULL, tiled_work_size, tiled_local_work_size, 0, NULL, &event);
+    assert(err == 0);
+    t_tiled += event_ms(event);
+
+    for (int k = 0; k < 2; k++) {
+      err = clEnqueueReadBuffer(q, rgb_cl[k], CL_TRUE, 0, rgb_size, rgb[k], 0, NULL, NULL);
+      assert(err == 0);
+    }
+
+    int max_e = 0;
+    for (size_t j = 0; j < rgb_size; j++) {
+      int e = abs((int)rgb[0][j] - (int)rgb[1][j]);
+      if (e > max_e) max_e = e;
+    }
+    if (max_e > MAXE) {
+      printf("%s frame %d: max error %d\n", sensor.name, i, max_e);
+      mismatched++;
+    }
+  }
+
+  printf("%s %dx%d: Matched: %d, Mismatched: %d | debayer10 %.3fms, debayer10_tiled %.3fms\n",
+         sensor.name, rgb_width, rgb_height, nframes - mismatched, mismatched,
+         t_row / nframes, t_tiled / nframes);
+
+  delete[] frame;
+  for (int k = 0; k < 2; k++) {
+    delete[] rgb[k];
+    clReleaseMemObject(rgb_cl[k]);
+  }
+  clReleaseMemObject(frame_cl);
+  clReleaseKernel(krnl_row);
+  clReleaseKernel(krnl_tiled);
+  clReleaseProgram(prg);
+
+  return mismatched;
+}
+
+int main(int argc, char** argv) {
+  srand(1337);
+
+  clu_init();
+  cl_device_id device_id;
+  cl_context context;
+  cl_init(device_id, context);
+
+  int err;
+  cl_command_queue q = clCreateCommandQueue(context, device_id, CL_QUEUE_PROFILING_ENABLE, &err);
+  assert(err == 0);
+
+  int mismatched = 0;
+  if (argc > 2) {
+    const Sensor *sensor = NULL;
+    for (size_t i = 0; i < ARRAYSIZE(sensors); i++) {
+      if (strcmp(sensors[i].name, argv[1]) == 0) sensor = &sensors[i];
+    }
+    if (!sensor) {
+      printf("unknown sensor %s\n", argv[1]);
+      return -1;
+    }
+    mismatched += run_sensor(context, device_id, q, *sensor, argc - 2, &argv[2]);
+  } else {
+    for (size_t i = 0; i < ARRAYSIZE(sensors); i++) {
+      mismatched += run_sensor(context, device_id, q, sensors[i], ITERS, NULL);
+    }
+  }
+
+  clReleaseCommandQueue(q);
+  clReleaseContext(context);
+
+  return mismatched == 0 ? 0 : -1;
+}
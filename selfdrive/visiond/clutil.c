@@ -5,6 +5,8 @@
 #include <string.h>
 #include <unistd.h>
 #include <inttypes.h>
+#include <errno.h>
+#include <pthread.h>
 #include <sys/stat.h>
 
 #ifdef __APPLE__
@@ -29,10 +31,61 @@ typedef struct CLUProgramIndex {
 static const CLUProgramIndex clu_index[] = {};
 #endif
 
+// Compiled programs are kept across reboots, keyed by the source, the build
+// options, the device and the driver. Bump the version when what goes into
+// the key or the files changes. The cache is filled by visiond -t at install
+// time (make clcache) and by any compile that misses.
+#define CLU_CACHE_VERSION 2
+
+#ifdef QCOM
+#define CLU_CACHE_ROOT "/data/clcache"
+#else
+#define CLU_CACHE_ROOT "/tmp/clcache"
+#endif
+
+static char clu_cache_dir[512];
+// the index is appended to from every thread that builds programs
+static pthread_mutex_t clu_index_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static void mkdir_p(const char* path) {
+  char tmp[512];
+  snprintf(tmp, sizeof(tmp), "%s", path);
+  for (char* p = tmp + 1; *p; p++) {
+    if (*p == '/') {
+      *p = 0;
+      mkdir(tmp, 0777);
+      *p = '/';
+    }
+  }
+  mkdir(tmp, 0777);
+}
+
+static const char* cache_dir(void) {
+  if (clu_cache_dir[0] == 0) {
+    const char* root = getenv("CLU_CACHE_DIR");
+#ifndef QCOM
+    // /tmp doesn't survive a reboot
+    char home_root[256];
+    if (root == NULL && getenv("HOME") != NULL) {
+      snprintf(home_root, sizeof(home_root), "%s/.cache/clcache", getenv("HOME"));
+      root = home_root;
+    }
+#endif
+    if (root == NULL) {
+      root = CLU_CACHE_ROOT;
+    }
+    snprintf(clu_cache_dir, sizeof(clu_cache_dir), "%s/v%d", root, CLU_CACHE_VERSION);
+  }
+  return clu_cache_dir;
+}
+
 void clu_init(void) {
 #ifndef CLU_NO_SRC
-  mkdir("/tmp/clcache", 0777);
-  unlink("/tmp/clcache/index.cli");
+  mkdir_p(cache_dir());
+
+  char index_path[1024];
+  snprintf(index_path, sizeof(index_path), "%s/index.cli", cache_dir());
+  unlink(index_path);
 #endif
 }
 
@@ -49,6 +102,18 @@ cl_program cl_create_program_from_file(cl_context ctx, const char* path) {
   return ret;
 }
 
+static char* get_device_string(cl_device_id device, cl_device_info param) {
+  size_t size = 0;
+  int err;
+  err = clGetDeviceInfo(device, param, 0, NULL, &size);
+  assert(err == 0);
+  char *str = malloc(size);
+  assert(str);
+  err = clGetDeviceInfo(device, param, size, str, NULL);
+  assert(err == 0);
+  return str;
+}
+
 static char* get_version_string(cl_platform_id platform) {
   size_t size = 0;
   int err;
@@ -152,11 +217,15 @@ uint64_t clu_fnv_hash(const uint8_t *data, size_t len) {
   return hval;
 }
 
+static void cache_path_for(char* path, size_t size, uint64_t hash) {
+  snprintf(path, size, "%s/%016" PRIx64 ".clb", cache_dir(), hash);
+}
+
 cl_program cl_cached_program_from_hash(cl_context ctx, cl_device_id device_id, uint64_t hash) {
   int err;
 
   char cache_path[1024];
-  snprintf(cache_path, sizeof(cache_path), "/tmp/clcache/%016" PRIx64 ".clb", hash);
+  cache_path_for(cache_path, sizeof(cache_path), hash);
 
   size_t bin_size;
   uint8_t *bin = read_file(cache_path, &bin_size);
@@ -165,16 +234,54 @@ cl_program cl_cached_program_from_hash(cl_context ctx, cl_device_id device_id, u
   }
 
   cl_program prg = clCreateProgramWithBinary(ctx, 1, &device_id, &bin_size, (const uint8_t**)&bin, NULL, &err);
-  assert(err == 0);
-
   free(bin);
-
-  err = clBuildProgram(prg, 1, &device_id, NULL, NULL, NULL);
-  assert(err == 0);
+  if (err == 0) {
+    err = clBuildProgram(prg, 1, &device_id, NULL, NULL, NULL);
+    if (err != 0) {
+      clReleaseProgram(prg);
+    }
+  }
+  if (err != 0) {
+    // the driver doesn't take it anymore, build it from source again
+    printf("clcache: dropping %s (%s)\n", cache_path, cl_get_error_string(err));
+    unlink(cache_path);
+    return NULL;
+  }
 
   return prg;
 }
 
+// written to a temporary file and renamed into place, so readers only ever
+// see whole binaries and concurrent builds of the same program don't mix
+static void cache_write(uint64_t hash, const uint8_t* bin, size_t bin_size) {
+  char cache_path[1024];
+  cache_path_for(cache_path, sizeof(cache_path), hash);
+
+  char tmp_path[1024];
+  snprintf(tmp_path, sizeof(tmp_path), "%s.XXXXXX", cache_path);
+  int fd = mkstemp(tmp_path);
+  if (fd < 0) {
+    printf("clcache: can't write %s: %s\n", cache_path, strerror(errno));
+    return;
+  }
+
+  bool ok = true;
+  size_t written = 0;
+  while (ok && written < bin_size) {
+    ssize_t ret = write(fd, bin + written, bin_size - written);
+    if (ret < 0 && errno == EINTR) continue;
+    ok = ret > 0;
+    if (ok) written += ret;
+  }
+  ok = ok && fsync(fd) == 0;
+  close(fd);
+
+  if (!ok || rename(tmp_path, cache_path) != 0) {
+    printf("clcache: can't write %s: %s\n", cache_path, strerror(errno));
+    unlink(tmp_path);
+  }
+}
+
 static uint8_t* get_program_binary(cl_program prg, size_t *out_size) {
   int err;
 
@@ -209,14 +316,22 @@ cl_program cl_cached_program_from_string(cl_context ctx, cl_device_id device_id,
   err = clGetDeviceInfo(device_id, CL_DEVICE_PLATFORM, sizeof(platform), &platform, NULL);
   assert(err == 0);
 
-  const char* platform_version = get_version_string(platform);
+  char* platform_version = get_version_string(platform);
+  char* device_name = get_device_string(device_id, CL_DEVICE_NAME);
+  char* device_version = get_device_string(device_id, CL_DEVICE_VERSION);
+  char* driver_version = get_device_string(device_id, CL_DRIVER_VERSION);
 
-  const size_t hash_len = strlen(platform_version)+1+strlen(src)+1+strlen(args)+1;
+  const size_t hash_len = strlen(platform_version)+1+strlen(device_name)+1+strlen(device_version)+1
+                          +strlen(driver_version)+1+strlen(src)+1+strlen(args)+1;
   char* hash_buf = malloc(hash_len);
   assert(hash_buf);
   memset(hash_buf, 0, hash_len);
-  snprintf(hash_buf, hash_len, "%s%c%s%c%s", platform_version, 1, src, 1, args);
-  free((void*)platform_version);
+  snprintf(hash_buf, hash_len, "%s%c%s%c%s%c%s%c%s%c%s",
+           platform_version, 1, device_name, 1, device_version, 1, driver_version, 1, src, 1, args);
+  free(platform_version);
+  free(device_name);
+  free(device_version);
+  free(driver_version);
 
   uint64_t hash = clu_fnv_hash((uint8_t*)hash_buf, hash_len);
   free(hash_buf);
@@ -240,14 +355,7 @@ cl_program cl_cached_program_from_string(cl_context ctx, cl_device_id device_id,
 
     size_t binary_size;
     uint8_t *binary_buf = get_program_binary(prg, &binary_size);
-
-    char cache_path[1024];
-    snprintf(cache_path, sizeof(cache_path), "/tmp/clcache/%016" PRIx64 ".clb", hash);
-    FILE* of = fopen(cache_path, "wb");
-    assert(of);
-    fwrite(binary_buf, 1, binary_size, of);
-    fclose(of);
-
+    cache_write(hash, binary_buf, binary_size);
     free(binary_buf);
 #endif
   }
@@ -266,10 +374,16 @@ cl_program cl_cached_program_from_file(cl_context ctx, cl_device_id device_id, c
 }
 
 static void add_index(uint64_t index_hash, uint64_t src_hash) {
-  FILE *f = fopen("/tmp/clcache/index.cli", "a");
-  assert(f);
-  fprintf(f, "%016" PRIx64 " %016" PRIx64 "\n", index_hash, src_hash);
-  fclose(f);
+  char index_path[1024];
+  snprintf(index_path, sizeof(index_path), "%s/index.cli", cache_dir());
+
+  pthread_mutex_lock(&clu_index_lock);
+  FILE *f = fopen(index_path, "a");
+  if (f) {
+    fprintf(f, "%016" PRIx64 " %016" PRIx64 "\n", index_hash, src_hash);
+    fclose(f);
+  }
+  pthread_mutex_unlock(&clu_index_lock);
 }
 
 
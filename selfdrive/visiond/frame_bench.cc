@@ -0,0 +1,153 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <cassert>
+#include <vector>
+#include <thread>
+#include <atomic>
+
+#include <time.h>
+#include <unistd.h>
+
+#include <czmq.h>
+#include <capnp/serialize.h>
+
+#include "common/timing.h"
+#include "common/visionipc.h"
+
+#include "cereal/gen/cpp/log.capnp.h"
+
+// Bandwidth and cpu of the frame path, with the image inlined in every
+// frame message as visiond used to on pc, and with the image left in the
+// yuv buffer and only referenced. Frames are the size of the frame stream
+// camera's and go over tcp loopback to a subscriber that reads them like
+// loggerd does.
+//
+// usage: frame_bench [frames] [hz]
+
+#define YUV_WIDTH 1164
+#define YUV_HEIGHT 874
+#define YUV_BUF_SIZE (YUV_WIDTH * YUV_HEIGHT * 3 / 2)
+#define YUV_COUNT 40
+
+#define ENDPOINT "tcp://127.0.0.1:18002"
+
+static double thread_cpu_ms() {
+  struct timespec t;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &t);
+  return t.tv_sec * 1000.0 + t.tv_nsec * 1e-6;
+}
+
+struct SubResult {
+  int frames;
+  size_t bytes;
+  double cpu_ms;
+};
+
+static void subscriber(std::atomic<bool>* done, SubResult* res) {
+  zsock_t* sock = zsock_new_sub(">" ENDPOINT, "");
+  assert(sock);
+  void* sock_raw = zsock_resolve(sock);
+  int timeout = 100;
+  zmq_setsockopt(sock_raw, ZMQ_RCVTIMEO, &timeout, sizeof(timeout));
+
+  const double t1 = thread_cpu_ms();
+  while (!*done) {
+    zmq_msg_t msg;
+    zmq_msg_init(&msg);
+    if (zmq_msg_recv(&msg, sock_raw, 0) < 0) {
+      zmq_msg_close(&msg);
+      continue;
+    }
+    // the copy loggerd makes to get aligned words
+    const size_t size = zmq_msg_size(&msg);
+    auto amsg = kj::heapArray<capnp::word>((size / sizeof(capnp::word)) + 1);
+    memcpy(amsg.begin(), zmq_msg_data(&msg), size);
+    zmq_msg_close(&msg);
+
+    capnp::FlatArrayMessageReader cmsg(amsg);
+    auto frame = cmsg.getRoot<cereal::Event>().getFrame();
+    assert(frame.getImage().size() == 0 || frame.getImage().size() == YUV_BUF_SIZE);
+
+    res->frames++;
+    res->bytes += size;
+  }
+  res->cpu_ms = thread_cpu_ms() - t1;
+
+  zsock_destroy(&sock);
+}
+
+static void run(bool inline_image, int frames, int hz) {
+  zsock_t* sock = zsock_new_pub("@" ENDPOINT);
+  assert(sock);
+  void* sock_raw = zsock_resolve(sock);
+
+  std::vector<uint8_t> yuv(YUV_BUF_SIZE * YUV_COUNT);
+  for (size_t i = 0; i < yuv.size(); i++) yuv[i] = i * 31;
+
+  std::atomic<bool> done(false);
+  SubResult sub = {0};
+  std::thread sub_thread(subscriber, &done, &sub);
+  // slow joiner
+  usleep(300 * 1000);
+
+  float transform[9] = {1, 0, 0, 0, 1, 0, 0, 0, 1};
+  double pub_cpu_ms = 0;
+  const uint64_t interval = 1000000000ULL / hz;
+  uint64_t next = nanos_since_boot();
+  for (int f = 0; f < frames; f++) {
+    next += interval;
+    const uint64_t now = nanos_since_boot();
+    if (next > now) usleep((next - now) / 1000);
+
+    const int yuv_idx = f % YUV_COUNT;
+    const double t1 = thread_cpu_ms();
+    {
+      // as visiond builds the frame event
+      capnp::MallocMessageBuilder msg;
+      cereal::Event::Builder event = msg.initRoot<cereal::Event>();
+      event.setLogMonoTime(nanos_since_boot());
+
+      auto framed = event.initFrame();
+      framed.setFrameId(f);
+      framed.setEncodeId(f);
+      framed.setTimestampEof(nanos_since_boot());
+      if (inline_image) {
+        framed.setImage(kj::arrayPtr(&yuv[yuv_idx * YUV_BUF_SIZE], YUV_BUF_SIZE));
+      } else {
+        auto image_ref = framed.initImageRef();
+        image_ref.setStream(VISION_STREAM_YUV);
+        image_ref.setBufIdx(yuv_idx);
+        image_ref.setBufLen(YUV_BUF_SIZE);
+      }
+      framed.setTransform(kj::ArrayPtr<const float>(transform, 9));
+
+      auto words = capnp::messageToFlatArray(msg);
+      auto bytes = words.asBytes();
+      zmq_send(sock_raw, bytes.begin(), bytes.size(), ZMQ_DONTWAIT);
+    }
+    pub_cpu_ms += thread_cpu_ms() - t1;
+  }
+
+  usleep(300 * 1000);
+  done = true;
+  sub_thread.join();
+  zsock_destroy(&sock);
+
+  const double per_frame = sub.frames > 0 ? (double)sub.bytes / sub.frames : 0;
+  printf("%-7s %7.0f bytes/frame  %7.2f MB/s at 20Hz  publisher %6.1fus/frame  subscriber %6.1fus/frame  received %d/%d\n",
+         inline_image ? "inline" : "ref", per_frame, per_frame * 20 / 1e6,
+         pub_cpu_ms * 1000 / frames, sub.frames > 0 ? sub.cpu_ms * 1000 / sub.frames : 0,
+         sub.frames, frames);
+}
+
+int main(int argc, char** argv) {
+  const int frames = argc > 1 ? atoi(argv[1]) : 500;
+  const int hz = argc > 2 ? atoi(argv[2]) : 100;
+  assert(frames > 0 && hz > 0);
+
+  run(true, frames, hz);
+  run(false, frames, hz);
+  return 0;
+}
@@ -0,0 +1,578 @@
+// Offline replay of the driving model and posenet over recorded segments.
+//
+// usage: modelreplay [-j workers] [-b batch] [--verify] [--tol t] [--scaling] <segment dir>...
+//
+// Every segment dir needs fcamera.hevc and rlog (or rlog.bz2). The frames are
+// decoded in batches of -b, calibrated with the liveCalibration that visiond
+// would have had at that frame, and run through the same model code as the
+// live path. model and cameraOdometry events are written to
+// <segment dir>/model_rlog in the rlog format. Segments are spread over -j
+// worker processes, one segment per worker at a time since the recurrent
+// state has to go through the frames in order.
+//
+// Posenet runs on the frames live visiond ran it on: the ones each logged
+// cameraOdometry event followed. Logs without them fall back to every 5th
+// frame id.
+//
+// --verify checks the replay two ways:
+// - exactly, against a second replay at batch 1 written to model_rlog.b1.
+//   The batch only groups the decoding, the model sees the same frames in
+//   the same order, so any differing bit is a bug. At -b 1 this checks that
+//   the replay is deterministic.
+// - against the model events visiond logged in the rlog, frame by frame.
+//   The live model saw the raw frame instead of the decoded hevc, through
+//   the OpenCL transform and the device runner, so a value passes if it is
+//   within --tol (default 0.05) of the logged one, relative to
+//   max(1, |logged|).
+// --scaling reruns with 1, 2, 4... workers up to the core count and prints
+// frames/s for each.
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cassert>
+#include <cmath>
+#include <string>
+#include <vector>
+#include <map>
+#include <algorithm>
+#include <iterator>
+
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include <bzlib.h>
+#include <capnp/serialize.h>
+
+extern "C" {
+#include <libavformat/avformat.h>
+#include <libavcodec/avcodec.h>
+}
+
+#include "common/util.h"
+#include "common/timing.h"
+#include "common/mat.h"
+
+#include "models/driving.h"
+#include "models/posenet.h"
+
+#include "cereal/gen/cpp/log.capnp.h"
+
+namespace {
+
+struct Calibration {
+  uint64_t log_mono_time;
+  mat3 transform;
+};
+
+struct SegmentFrame {
+  uint32_t frame_id;
+  uint64_t log_mono_time;
+  mat3 yuv_transform;
+  // live visiond ran posenet after this frame, at posenet_mono_time
+  bool posenet;
+  uint64_t posenet_mono_time;
+};
+
+// the compared values of the model events, by frame id
+typedef std::map<uint32_t, std::vector<float>> ModelOutputs;
+
+struct SegmentLog {
+  // indexed by the position in fcamera.hevc
+  std::vector<SegmentFrame> frames;
+  std::vector<Calibration> calibrations;
+  ModelOutputs models;
+};
+
+void add_model_outputs(cereal::ModelData::Reader md, ModelOutputs &models) {
+  std::vector<float> &v = models[md.getFrameId()];
+  v.clear();
+  for (auto path : {md.getPath(), md.getLeftLane(), md.getRightLane()}) {
+    for (float p : path.getPoints()) v.push_back(p);
+    v.push_back(path.getProb());
+    v.push_back(path.getStd());
+  }
+  auto lead = md.getLead();
+  v.push_back(lead.getDist());
+  v.push_back(lead.getProb());
+  v.push_back(lead.getStd());
+  v.push_back(lead.getRelVel());
+  v.push_back(lead.getRelVelStd());
+}
+
+template <typename F>
+void for_each_event(const std::vector<uint8_t> &raw, F f) {
+  // copy into words for alignment
+  kj::Array<capnp::word> words = kj::heapArray<capnp::word>(raw.size() / sizeof(capnp::word));
+  memcpy(words.begin(), raw.data(), words.size() * sizeof(capnp::word));
+
+  kj::ArrayPtr<const capnp::word> rest = words.asPtr();
+  while (rest.size() > 0) {
+    capnp::FlatArrayMessageReader reader(rest);
+    f(reader.getRoot<cereal::Event>());
+    rest = kj::arrayPtr(reader.getEnd(), rest.end());
+  }
+}
+
+bool read_bz2(const char* path, std::vector<uint8_t> &out) {
+  FILE *f = fopen(path, "rb");
+  if (!f) return false;
+  int bzerr;
+  BZFILE *bz = BZ2_bzReadOpen(&bzerr, f, 0, 0, NULL, 0);
+  assert(bzerr == BZ_OK);
+  uint8_t chunk[1 << 16];
+  while (bzerr == BZ_OK) {
+    int n = BZ2_bzRead(&bzerr, bz, chunk, sizeof(chunk));
+    if (bzerr == BZ_OK || bzerr == BZ_STREAM_END) {
+      out.insert(out.end(), chunk, chunk + n);
+    }
+  }
+  BZ2_bzReadClose(&bzerr, bz);
+  fclose(f);
+  return true;
+}
+
+bool read_log(const std::string &dir, SegmentLog &log) {
+  std::vector<uint8_t> raw;
+  size_t len;
+  uint8_t *data = (uint8_t*)read_file((dir + "/rlog").c_str(), &len);
+  if (data) {
+    raw.assign(data, data + len);
+    free(data);
+  } else if (!read_bz2((dir + "/rlog.bz2").c_str(), raw)) {
+    return false;
+  }
+
+  std::map<uint32_t, SegmentFrame> frames;
+  std::map<uint32_t, uint32_t> hevc_index;  // segmentId -> frameId
+  std::vector<uint64_t> odometry_times;
+  // same as visiond for a bayer rear camera, used if the frame has no transform
+  const mat3 identity = {{1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0}};
+  const mat3 default_yuv_transform = transform_scale_buffer(identity, 0.5);
+
+  for_each_event(raw, [&](cereal::Event::Reader event) {
+    if (event.isFrame()) {
+      auto fd = event.getFrame();
+      SegmentFrame frame = {fd.getFrameId(), event.getLogMonoTime(), default_yuv_transform, false, 0};
+      auto tv = fd.getTransform();
+      if (tv.size() == 3 * 3) {
+        for (int i = 0; i < 3 * 3; i++) frame.yuv_transform.v[i] = tv[i];
+      }
+      frames[frame.frame_id] = frame;
+    } else if (event.isEncodeIdx()) {
+      auto eidx = event.getEncodeIdx();
+      if (eidx.getType() == cereal::EncodeIndex::Type::FULL_H_E_V_C) {
+        hevc_index[eidx.getSegmentId()] = eidx.getFrameId();
+      }
+    } else if (event.isLiveCalibration()) {
+#ifdef MEDMODEL
+      auto wm2 = event.getLiveCalibration().getWarpMatrixBig();
+#else
+      auto wm2 = event.getLiveCalibration().getWarpMatrix2();
+#endif
+      if (wm2.size() != 3 * 3) return;
+      Calibration cal = {event.getLogMonoTime()};
+      for (int i = 0; i < 3 * 3; i++) cal.transform.v[i] = wm2[i];
+      log.calibrations.push_back(cal);
+    } else if (event.isModel()) {
+      add_model_outputs(event.getModel(), log.models);
+    } else if (event.isCameraOdometry()) {
+      odometry_times.push_back(event.getLogMonoTime());
+    }
+  });
+
+  if (!odometry_times.empty()) {
+    // visiond sends a frame's event before running posenet on it, so an
+    // odometry event belongs to the last frame logged before it
+    std::map<uint64_t, uint32_t> frame_by_time;
+    for (auto &it : frames) frame_by_time[it.second.log_mono_time] = it.first;
+    for (uint64_t t : odometry_times) {
+      auto it = frame_by_time.upper_bound(t);
+      if (it == frame_by_time.begin()) continue;
+      SegmentFrame &frame = frames[std::prev(it)->second];
+      frame.posenet = true;
+      frame.posenet_mono_time = t;
+    }
+  } else {
+    for (auto &it : frames) {
+      it.second.posenet = it.first % 5 == 0;
+      it.second.posenet_mono_time = it.second.log_mono_time;
+    }
+  }
+
+  if (!hevc_index.empty()) {
+    for (auto &it : hevc_index) {
+      if (it.first != log.frames.size()) break;
+      auto frame = frames.find(it.second);
+      if (frame == frames.end()) break;
+      log.frames.push_back(frame->second);
+    }
+  } else {
+    // old logs without encodeIdx, the encoder got every frame
+    for (auto &it : frames) log.frames.push_back(it.second);
+  }
+  return true;
+}
+
+// decodes fcamera.hevc into packed YUV420 frames, a batch at a time
+struct HevcReader {
+  AVFormatContext *fmt_ctx = NULL;
+  AVCodecContext *codec_ctx = NULL;
+  AVFrame *frame = NULL;
+  AVPacket pkt;
+  bool flushing = false;
+  int width = 0, height = 0;
+
+  bool open(const std::string &path) {
+    av_register_all();
+    AVInputFormat *hevc = av_find_input_format("hevc");
+    if (avformat_open_input(&fmt_ctx, path.c_str(), hevc, NULL) != 0) return false;
+    if (avformat_find_stream_info(fmt_ctx, NULL) < 0) return false;
+
+    AVCodec *codec = avcodec_find_decoder(AV_CODEC_ID_HEVC);
+    assert(codec);
+    codec_ctx = avcodec_alloc_context3(codec);
+    assert(codec_ctx);
+    int err = avcodec_parameters_to_context(codec_ctx, fmt_ctx->streams[0]->codecpar);
+    assert(err >= 0);
+    // the workers are the parallelism
+    codec_ctx->thread_count = 1;
+    err = avcodec_open2(codec_ctx, codec, NULL);
+    assert(err >= 0);
+
+    frame = av_frame_alloc();
+    av_init_packet(&pkt);
+    width = codec_ctx->width;
+    height = codec_ctx->height;
+    return true;
+  }
+
+  // appends up to n frames to out, returns the number decoded
+  int read(int n, std::vector<uint8_t> &out) {
+    const size_t frame_size = width * height * 3 / 2;
+    int got = 0;
+    while (got < n) {
+      int err = avcodec_receive_frame(codec_ctx, frame);
+      if (err == 0) {
+        assert(frame->width == width && frame->height == height);
+        const size_t off = out.size();
+        out.resize(off + frame_size);
+        uint8_t *dst = &out[off];
+        const int plane_w[3] = {width, width / 2, width / 2};
+        const int plane_h[3] = {height, height / 2, height / 2};
+        for (int p = 0; p < 3; p++) {
+          for (int y = 0; y < plane_h[p]; y++) {
+            memcpy(dst, frame->data[p] + y * frame->linesize[p], plane_w[p]);
+            dst += plane_w[p];
+          }
+        }
+        got++;
+        continue;
+      }
+      if (err == AVERROR_EOF) break;
+      assert(err == AVERROR(EAGAIN));
+
+      if (flushing) break;
+      if (av_read_frame(fmt_ctx, &pkt) < 0) {
+        flushing = true;
+        avcodec_send_packet(codec_ctx, NULL);
+      } else {
+        avcodec_send_packet(codec_ctx, &pkt);
+        av_packet_unref(&pkt);
+      }
+    }
+    return got;
+  }
+
+  ~HevcReader() {
+    if (frame) av_frame_free(&frame);
+    if (codec_ctx) avcodec_free_context(&codec_ctx);
+    if (fmt_ctx) avformat_close_input(&fmt_ctx);
+  }
+};
+
+void write_event(FILE *f, const uint8_t *data, size_t len) {
+  size_t written = fwrite(data, 1, len, f);
+  assert(written == len);
+}
+
+void write_posenet(FILE *f, uint64_t log_mono_time, const PosenetState *posenet) {
+  // same message as visiond
+  capnp::MallocMessageBuilder msg;
+  cereal::Event::Builder event = msg.initRoot<cereal::Event>();
+  event.setLogMonoTime(log_mono_time);
+
+  auto posenetd = event.initCameraOdometry();
+  kj::ArrayPtr<const float> trans_vs(&posenet->output[0], 3);
+  posenetd.setTrans(trans_vs);
+  kj::ArrayPtr<const float> rot_vs(&posenet->output[3], 3);
+  posenetd.setRot(rot_vs);
+  kj::ArrayPtr<const float> trans_std_vs(&posenet->output[6], 3);
+  posenetd.setTransStd(trans_std_vs);
+  kj::ArrayPtr<const float> rot_std_vs(&posenet->output[9], 3);
+  posenetd.setRotStd(rot_std_vs);
+
+  auto words = capnp::messageToFlatArray(msg);
+  auto bytes = words.asBytes();
+  write_event(f, bytes.begin(), bytes.size());
+}
+
+// returns the number of frames the model ran on, -1 on error
+int replay_segment(const std::string &dir, const std::string &out_path, int batch) {
+  SegmentLog log;
+  if (!read_log(dir, log)) {
+    fprintf(stderr, "%s: can't read rlog\n", dir.c_str());
+    return -1;
+  }
+  HevcReader reader;
+  if (!reader.open(dir + "/fcamera.hevc")) {
+    fprintf(stderr, "%s: can't open fcamera.hevc\n", dir.c_str());
+    return -1;
+  }
+
+  FILE *out = fopen(out_path.c_str(), "wb");
+  if (!out) {
+    fprintf(stderr, "can't write %s\n", out_path.c_str());
+    return -1;
+  }
+
+  // no OpenCL context, the model input is prepared on the cpu
+  ModelState model;
+  model_init(&model, NULL, NULL, 1);
+  PosenetState posenet;
+  posenet_init(&posenet);
+
+  const size_t frame_size = reader.width * reader.height * 3 / 2;
+  std::vector<uint8_t> frames;
+  int model_frames = 0;
+  size_t cal_idx = 0;
+  bool calibrated = false;
+  mat3 calibration;
+
+  for (size_t cnt = 0; ; ) {
+    frames.clear();
+    const int n = reader.read(batch, frames);
+    if (n == 0) break;
+
+    for (int i = 0; i < n; i++, cnt++) {
+      if (cnt >= log.frames.size()) break;
+      const SegmentFrame &fd = log.frames[cnt];
+      const uint8_t *yuv = &frames[i * frame_size];
+
+      // latest calibration visiond had received by this frame
+      while (cal_idx < log.calibrations.size() &&
+             log.calibrations[cal_idx].log_mono_time <= fd.log_mono_time) {
+        calibration = log.calibrations[cal_idx].transform;
+        calibrated = true;
+        cal_idx++;
+      }
+
+      if (calibrated) {
+        const mat3 model_transform = matmul3(fd.yuv_transform, calibration);
+        ModelData data = model_eval_frame_cpu(&model, yuv, reader.width, reader.height,
+                                              model_transform, NULL);
+        uint8_t buf[4096];
+        ssize_t len = model_serialize(buf, sizeof(buf), fd.log_mono_time, fd.frame_id, model_transform, data);
+        assert(len > 0);
+        write_event(out, buf, len);
+        model_frames++;
+      }
+
+      posenet_push(&posenet, (uint8_t*)yuv, reader.width);
+      if (fd.posenet) {
+        posenet_eval(&posenet);
+        write_posenet(out, fd.posenet_mono_time, &posenet);
+      }
+    }
+  }
+
+  fclose(out);
+  posenet_free(&posenet);
+  model_free(&model);
+  return model_frames;
+}
+
+// replays every segment in a pool of worker processes, returns total frames
+long run_workers(const std::vector<std::string> &segments, const char *out_name,
+                 int workers, int batch, double *elapsed) {
+  const double t1 = millis_since_boot();
+  long total = 0;
+  size_t next = 0;
+  int running = 0;
+  std::map<pid_t, int> pipes;
+
+  while (next < segments.size() || running > 0) {
+    while (running < workers && next < segments.size()) {
+      int fds[2];
+      int err = pipe(fds);
+      assert(err == 0);
+      const std::string dir = segments[next++];
+      pid_t pid = fork();
+      assert(pid >= 0);
+      if (pid == 0) {
+        close(fds[0]);
+        int n = replay_segment(dir, dir + "/" + out_name, batch);
+        ssize_t w = write(fds[1], &n, sizeof(n));
+        _exit(w == sizeof(n) && n >= 0 ? 0 : 1);
+      }
+      close(fds[1]);
+      pipes[pid] = fds[0];
+      running++;
+    }
+
+    int status;
+    pid_t pid = wait(&status);
+    assert(pid > 0);
+    int n = -1;
+    if (read(pipes[pid], &n, sizeof(n)) == sizeof(n) && n > 0) total += n;
+    close(pipes[pid]);
+    pipes.erase(pid);
+    running--;
+  }
+
+  *elapsed = (millis_since_boot() - t1) / 1000.0;
+  return total;
+}
+
+bool read_model_outputs(const std::string &path, ModelOutputs &outputs, std::vector<uint8_t> &raw) {
+  size_t len;
+  uint8_t *data = (uint8_t*)read_file(path.c_str(), &len);
+  if (!data) return false;
+  raw.assign(data, data + len);
+  free(data);
+  for_each_event(raw, [&](cereal::Event::Reader event) {
+    if (event.isModel()) add_model_outputs(event.getModel(), outputs);
+  });
+  return true;
+}
+
+// the replay against the batch 1 replay, every event has to be the same bits
+bool verify_exact(const std::string &dir) {
+  ModelOutputs replayed, reference;
+  std::vector<uint8_t> raw, raw_reference;
+  if (!read_model_outputs(dir + "/model_rlog", replayed, raw) ||
+      !read_model_outputs(dir + "/model_rlog.b1", reference, raw_reference)) {
+    printf("%s: no model_rlog to compare\n", dir.c_str());
+    return false;
+  }
+  if (raw == raw_reference) {
+    printf("%s: %zu model frames bit exact with batch 1: OK\n", dir.c_str(), replayed.size());
+    return true;
+  }
+
+  int bad_frames = 0;
+  long first_bad = -1;
+  for (auto &it : reference) {
+    auto r = replayed.find(it.first);
+    if (r == replayed.end() || r->second.size() != it.second.size() ||
+        memcmp(r->second.data(), it.second.data(), it.second.size() * sizeof(float)) != 0) {
+      if (first_bad < 0) first_bad = it.first;
+      bad_frames++;
+    }
+  }
+  printf("%s: replay differs from batch 1 (%zu vs %zu bytes), %d of %zu model frames, first frame %ld: FAILED\n",
+         dir.c_str(), raw.size(), raw_reference.size(), bad_frames, reference.size(), first_bad);
+  return false;
+}
+
+// compares the replayed model events of a segment to the logged ones,
+// returns false if any value is off by more than tol
+bool verify_live(const std::string &dir, float tol) {
+  SegmentLog log;
+  if (!read_log(dir, log)) {
+    printf("%s: can't read rlog\n", dir.c_str());
+    return false;
+  }
+  ModelOutputs replayed;
+  std::vector<uint8_t> raw;
+  if (!read_model_outputs(dir + "/model_rlog", replayed, raw)) {
+    printf("%s: no model_rlog\n", dir.c_str());
+    return false;
+  }
+
+  int compared = 0, bad_frames = 0;
+  float max_e = 0;
+  for (auto &it : replayed) {
+    auto live = log.models.find(it.first);
+    if (live == log.models.end()) continue;
+    if (live->second.size() != it.second.size()) {
+      bad_frames++;
+      continue;
+    }
+    bool bad = false;
+    for (size_t i = 0; i < it.second.size(); i++) {
+      const float ref = live->second[i];
+      const float e = fabsf(it.second[i] - ref) / std::max(1.0f, fabsf(ref));
+      max_e = std::max(max_e, e);
+      bad |= !(e <= tol);
+    }
+    bad_frames += bad;
+    compared++;
+  }
+
+  const bool ok = compared > 0 && bad_frames == 0;
+  printf("%s: %d frames compared to the logged model, max error %g, %d over %g: %s\n",
+         dir.c_str(), compared, max_e, bad_frames, tol, ok ? "OK" : "FAILED");
+  return ok;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  int workers = sysconf(_SC_NPROCESSORS_ONLN);
+  int batch = 20;
+  bool verify = false, scaling = false;
+  float tol = 0.05;
+  std::vector<std::string> segments;
+
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-j") == 0 && i + 1 < argc) {
+      workers = std::max(1, atoi(argv[++i]));
+    } else if (strcmp(argv[i], "-b") == 0 && i + 1 < argc) {
+      batch = std::max(1, atoi(argv[++i]));
+    } else if (strcmp(argv[i], "--verify") == 0) {
+      verify = true;
+    } else if (strcmp(argv[i], "--tol") == 0 && i + 1 < argc) {
+      tol = atof(argv[++i]);
+    } else if (strcmp(argv[i], "--scaling") == 0) {
+      scaling = true;
+    } else {
+      segments.push_back(argv[i]);
+    }
+  }
+  if (segments.empty()) {
+    printf("usage: %s [-j workers] [-b batch] [--verify] [--tol t] [--scaling] <segment dir>...\n", argv[0]);
+    return -1;
+  }
+
+  // one inference thread per worker process, unless asked otherwise
+  setenv("RUNMODEL_THREADS", "1", 0);
+  setenv("MODEL_INPUT_CPU", "1", 0);
+
+  double elapsed;
+  long frames = run_workers(segments, "model_rlog", workers, batch, &elapsed);
+  printf("%ld frames in %.1fs with %d workers, batch %d: %.1f frames/s\n",
+         frames, elapsed, workers, batch, frames / elapsed);
+
+  int failed = 0;
+  if (verify) {
+    run_workers(segments, "model_rlog.b1", workers, 1, &elapsed);
+    for (const std::string &dir : segments) {
+      if (!verify_exact(dir)) failed++;
+      if (!verify_live(dir, tol)) failed++;
+    }
+  }
+
+  if (scaling) {
+    const int ncpu = sysconf(_SC_NPROCESSORS_ONLN);
+    double base_fps = 0;
+    for (int j = 1; j <= ncpu; j *= 2) {
+      long n = run_workers(segments, "model_rlog", j, batch, &elapsed);
+      const double fps = n / elapsed;
+      if (j == 1) base_fps = fps;
+      printf("workers %2d: %.1f frames/s, %.2fx\n", j, fps, base_fps > 0 ? fps / base_fps : 0.0);
+    }
+  }
+
+  return failed == 0 ? 0 : -1;
+}
@@ -1,5 +1,7 @@
 #include "commonmodel.h"
 
+#include <stdlib.h>
+#include <unistd.h>
 #include <czmq.h>
 #include "cereal/gen/c/log.capnp.h"
 #include "common/mat.h"
@@ -11,6 +13,23 @@ void model_input_init(ModelInput* s, int width, int height,
   s->device_id = device_id;
   s->context = context;
 
+  const char* cpu_threads = getenv("MODEL_INPUT_CPU");
+  s->cpu = context == NULL || cpu_threads != NULL;
+  if (s->cpu) {
+    // MODEL_INPUT_CPU=<threads>, defaults to one per core
+    int threads = cpu_threads ? atoi(cpu_threads) : 0;
+    if (threads <= 0) {
+      threads = sysconf(_SC_NPROCESSORS_ONLN);
+    }
+    transform_cpu_init(&s->transform_cpu, threads);
+    s->transformed_width = width;
+    s->transformed_height = height;
+    s->net_input_size = ((width*height*3)/2)*sizeof(float);
+    s->net_input_cpu = (float*)malloc(s->net_input_size);
+    assert(s->net_input_cpu);
+    return;
+  }
+
   transform_init(&s->transform, context, device_id);
   s->transformed_width = width;
   s->transformed_height = height;
@@ -38,6 +57,24 @@ float *model_input_prepare(ModelInput* s, cl_command_queue q,
                            mat3 transform) {
   int err;
   int i = 0;
+  if (s->cpu) {
+    const size_t yuv_size = width*height*3/2;
+    uint8_t *yuv = (uint8_t *)clEnqueueMapBuffer(q, yuv_cl, CL_TRUE,
+                                                 CL_MAP_READ, 0, yuv_size,
+                                                 0, NULL, NULL, &err);
+    assert(err == 0);
+    float *net_input_buf = model_input_prepare_cpu(s, yuv, width, height, transform);
+    err = clEnqueueUnmapMemObject(q, yuv_cl, yuv, 0, NULL, NULL);
+    assert(err == 0);
+    clFinish(q);
+    return net_input_buf;
+  }
+#ifdef FUSED_PIPELINE
+  transform_load_queue(&s->transform, q,
+                       yuv_cl, width, height,
+                       s->net_input, s->transformed_width, s->transformed_height,
+                       transform);
+#else
   transform_queue(&s->transform, q,
                   yuv_cl, width, height,
                   s->transformed_y_cl, s->transformed_u_cl, s->transformed_v_cl,
@@ -46,6 +83,7 @@ float *model_input_prepare(ModelInput* s, cl_command_queue q,
   loadyuv_queue(&s->loadyuv, q,
                 s->transformed_y_cl, s->transformed_u_cl, s->transformed_v_cl,
                 s->net_input);
+#endif
   float *net_input_buf = (float *)clEnqueueMapBuffer(q, s->net_input, CL_TRUE,
                                             CL_MAP_READ, 0, s->net_input_size,
                                             0, NULL, NULL, &err);
@@ -53,7 +91,22 @@ float *model_input_prepare(ModelInput* s, cl_command_queue q,
   return net_input_buf;
 }
 
+float *model_input_prepare_cpu(ModelInput* s,
+                               const uint8_t* yuv, int width, int height,
+                               mat3 transform) {
+  assert(s->cpu);
+  transform_load_cpu(&s->transform_cpu, yuv, width, height,
+                     s->net_input_cpu, s->transformed_width, s->transformed_height,
+                     transform);
+  return s->net_input_cpu;
+}
+
 void model_input_free(ModelInput* s) {
+  if (s->cpu) {
+    transform_cpu_destroy(&s->transform_cpu);
+    free(s->net_input_cpu);
+    return;
+  }
   transform_destroy(&s->transform);
   loadyuv_destroy(&s->loadyuv);
 }
@@ -108,8 +161,8 @@ static cereal_ModelData_PathData_ptr path_to_cereal(struct capn_segment *cs, con
   return ret;
 }
 
-void model_publish(void* sock, uint32_t frame_id,
-                   const mat3 transform, const ModelData data) {
+ssize_t model_serialize(uint8_t* buf, size_t buf_size, uint64_t log_mono_time,
+                        uint32_t frame_id, const mat3 transform, const ModelData data) {
   struct capn rc;
   capn_init_malloc(&rc);
   struct capn_segment *cs = capn_root(&rc).seg;
@@ -149,7 +202,7 @@ void model_publish(void* sock, uint32_t frame_id,
 
   cereal_Event_ptr eventp = cereal_new_Event(cs);
   struct cereal_Event event = {
-    .logMonoTime = nanos_since_boot(),
+    .logMonoTime = log_mono_time,
     .valid = true,
     .which = cereal_Event_model,
     .model = modelp,
@@ -157,10 +210,16 @@ void model_publish(void* sock, uint32_t frame_id,
   cereal_write_Event(&event, eventp);
 
   capn_setp(capn_root(&rc), 0, eventp.p);
+  ssize_t rs = capn_write_mem(&rc, buf, buf_size, 0);
+
+  capn_free(&rc);
+  return rs;
+}
+
+void model_publish(void* sock, uint32_t frame_id,
+                   const mat3 transform, const ModelData data) {
   uint8_t buf[4096];
-  ssize_t rs = capn_write_mem(&rc, buf, sizeof(buf), 0);
+  ssize_t rs = model_serialize(buf, sizeof(buf), nanos_since_boot(), frame_id, transform, data);
 
   zmq_send(sock, buf, rs, ZMQ_DONTWAIT);
-
-  capn_free(&rc);
 }
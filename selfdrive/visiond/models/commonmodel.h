@@ -2,11 +2,13 @@
 #define COMMONMODEL_H
 
 #include <CL/cl.h>
+#include <sys/types.h>
 
 #include "common/mat.h"
 #include "common/modeldata.h"
 #include "transforms/transform.h"
 #include "transforms/loadyuv.h"
+#include "transforms/transform_cpu.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -27,15 +29,28 @@ typedef struct ModelInput {
   LoadYUVState loadyuv;
   cl_mem net_input;
   size_t net_input_size;
+
+  // transform and load on the cpu, without a context or with MODEL_INPUT_CPU set
+  bool cpu;
+  TransformCpu transform_cpu;
+  float *net_input_cpu;
 } ModelInput;
 
+// context can be NULL on hosts without OpenCL, the input is then prepared on the cpu
 void model_input_init(ModelInput* s, int width, int height,
                       cl_device_id device_id, cl_context context);
 float *model_input_prepare(ModelInput* s, cl_command_queue q,
                            cl_mem yuv_cl, int width, int height,
                            mat3 transform);
+// yuv is a host YUV420 frame, only valid when s->cpu is set
+float *model_input_prepare_cpu(ModelInput* s,
+                               const uint8_t* yuv, int width, int height,
+                               mat3 transform);
 void model_input_free(ModelInput* s);
 
+// model event as an unpacked capnp message, returns the size written to buf
+ssize_t model_serialize(uint8_t* buf, size_t buf_size, uint64_t log_mono_time,
+                        uint32_t frame_id, const mat3 transform, const ModelData data);
 void model_publish(void* sock, uint32_t frame_id,
                    const mat3 transform, const ModelData data);
 
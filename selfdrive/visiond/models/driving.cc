@@ -52,16 +52,11 @@ void model_init(ModelState* s, cl_device_id device_id, cl_context context, int t
   }
 }
 
+static ModelData model_eval_input(ModelState* s, float *net_input_buf);
+
 ModelData model_eval_frame(ModelState* s, cl_command_queue q,
                            cl_mem yuv_cl, int width, int height,
                            mat3 transform, void* sock) {
-  struct {
-    float *path;
-    float *left_lane;
-    float *right_lane;
-    float *lead;
-  } net_outputs = {NULL};
-
   //for (int i = 0; i < OUTPUT_SIZE + TEMPORAL_SIZE; i++) { printf("%f ", s->output[i]); } printf("\n");
 
   float *net_input_buf = model_input_prepare(&s->in, q, yuv_cl, width, height, transform);
@@ -72,6 +67,24 @@ ModelData model_eval_frame(ModelState* s, cl_command_queue q,
   //fclose(f);
   //sleep(1);
   //printf("done \n");
+  return model_eval_input(s, net_input_buf);
+}
+
+ModelData model_eval_frame_cpu(ModelState* s,
+                               const uint8_t* yuv, int width, int height,
+                               mat3 transform, void* sock) {
+  float *net_input_buf = model_input_prepare_cpu(&s->in, yuv, width, height, transform);
+  return model_eval_input(s, net_input_buf);
+}
+
+static ModelData model_eval_input(ModelState* s, float *net_input_buf) {
+  struct {
+    float *path;
+    float *left_lane;
+    float *right_lane;
+    float *lead;
+  } net_outputs = {NULL};
+
   s->m->execute(net_input_buf);
 
   // net outputs
@@ -22,6 +22,10 @@ void model_init(ModelState* s, cl_device_id device_id,
 ModelData model_eval_frame(ModelState* s, cl_command_queue q,
                            cl_mem yuv_cl, int width, int height,
                            mat3 transform, void* sock);
+// for hosts without OpenCL, model_init with a NULL context
+ModelData model_eval_frame_cpu(ModelState* s,
+                               const uint8_t* yuv, int width, int height,
+                               mat3 transform, void* sock);
 void model_free(ModelState* s);
 void poly_fit(float *in_pts, float *in_stds, float *out);
 
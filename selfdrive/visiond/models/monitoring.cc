@@ -7,7 +7,7 @@
 
 void monitoring_init(MonitoringState* s, cl_device_id device_id, cl_context context) {
   model_input_init(&s->in, MODEL_WIDTH, MODEL_HEIGHT, device_id, context);
-  s->m = new SNPEModel("../../models/monitoring_model.dlc", (float*)&s->output, OUTPUT_SIZE);
+  s->m = new DefaultRunModel("../../models/monitoring_model.dlc", (float*)&s->output, OUTPUT_SIZE);
 }
 
 MonitoringResult monitoring_eval_frame(MonitoringState* s, cl_command_queue q,
@@ -3,38 +3,17 @@
 #include "posenet.h"
 
 void posenet_init(PosenetState *s) {
-  s->input = (float*)malloc(2*200*532*sizeof(float));
+  posenet_frames_init(&s->frames);
+  s->input = (float*)malloc(POSENET_INPUT_SIZE*sizeof(float));
   s->m = new DefaultRunModel("../../models/posenet.dlc", s->output, sizeof(s->output)/sizeof(float));
 }
 
 void posenet_push(PosenetState *s, uint8_t *yuv_ptr_y, int yuv_width) {
-  // move second frame to first frame
-  memmove(&s->input[0], &s->input[1], sizeof(float)*(200*532*2 - 1));
-
-  // fill posenet input
-  float a;
-  // posenet uses a half resolution cropped frame
-  // with upper left corner: [50, 237] and
-  // bottom right corner: [1114, 637]
-  // So the resulting crop is 532 X 200
-  for (int y=237; y<637; y+=2) {
-    int yy = (y-237)/2;
-    for (int x = 50; x < 1114; x+=2) {
-      int xx = (x-50)/2;
-      a = 0;
-      a += yuv_ptr_y[yuv_width*(y+0) + (x+1)];
-      a += yuv_ptr_y[yuv_width*(y+1) + (x+1)];
-      a += yuv_ptr_y[yuv_width*(y+0) + (x+0)];
-      a += yuv_ptr_y[yuv_width*(y+1) + (x+0)];
-      // The posenet takes a normalized image input
-      // like the driving model so [0,255] is remapped
-      // to [-1,1]
-      s->input[(yy*532+xx)*2 + 1] = (a/512.0 - 1.0);
-    }
-  }
+  posenet_frames_push(&s->frames, yuv_ptr_y, yuv_width);
 }
 
 void posenet_eval(PosenetState *s) {
+  posenet_frames_assemble(&s->frames, s->input);
   s->m->execute(s->input);
 
   // fix stddevs
@@ -54,5 +33,6 @@ void posenet_eval(PosenetState *s) {
 void posenet_free(PosenetState *s) {
   delete s->m;
   free(s->input);
+  posenet_frames_free(&s->frames);
 }
 
@@ -3,6 +3,7 @@
 
 #include <stdint.h>
 #include "runners/run.h"
+#include "posenet_frames.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -10,6 +11,7 @@ extern "C" {
 
 typedef struct PosenetState {
   float output[12];
+  PosenetFrames frames;
   float *input;
   RunModel *m;
 } PosenetState;
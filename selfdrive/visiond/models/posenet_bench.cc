@@ -0,0 +1,94 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <time.h>
+
+#include "posenet_frames.h"
+
+#define WIDTH 1164
+#define HEIGHT 874
+#define ITERS 500
+
+static inline double millis_since_boot() {
+  struct timespec t;
+  clock_gettime(CLOCK_BOOTTIME, &t);
+  return t.tv_sec * 1000.0 + t.tv_nsec * 1e-6;
+}
+
+// the old posenet_push: shift the whole input and downsample with scalar loads
+static void legacy_push(float *input, const uint8_t *yuv_ptr_y, int yuv_width) {
+  memmove(&input[0], &input[1], sizeof(float)*(POSENET_INPUT_SIZE - 1));
+
+  float a;
+  for (int y=237; y<637; y+=2) {
+    int yy = (y-237)/2;
+    for (int x = 50; x < 1114; x+=2) {
+      int xx = (x-50)/2;
+      a = 0;
+      a += yuv_ptr_y[yuv_width*(y+0) + (x+1)];
+      a += yuv_ptr_y[yuv_width*(y+1) + (x+1)];
+      a += yuv_ptr_y[yuv_width*(y+0) + (x+0)];
+      a += yuv_ptr_y[yuv_width*(y+1) + (x+0)];
+      input[(yy*532+xx)*2 + 1] = (a/512.0 - 1.0);
+    }
+  }
+}
+
+int main(int argc, char** argv) {
+  srand(1337);
+
+  const int frame_count = 8;
+  uint8_t *frames = new uint8_t[frame_count * WIDTH * HEIGHT];
+  for (int i = 0; i < frame_count * WIDTH * HEIGHT; i++) {
+    frames[i] = (uint8_t)rand();
+  }
+
+  float *legacy_input = (float*)calloc(POSENET_INPUT_SIZE, sizeof(float));
+  float *input = (float*)calloc(POSENET_INPUT_SIZE, sizeof(float));
+  PosenetFrames pf;
+  posenet_frames_init(&pf);
+
+  // the legacy input and the assembled ring have to agree after every push
+  int mismatched = 0;
+  for (int i = 0; i < frame_count; i++) {
+    const uint8_t *y = &frames[i * WIDTH * HEIGHT];
+    legacy_push(legacy_input, y, WIDTH);
+    posenet_frames_push(&pf, y, WIDTH);
+    posenet_frames_assemble(&pf, input);
+    if (i > 0 && memcmp(legacy_input, input, POSENET_INPUT_SIZE * sizeof(float)) != 0) {
+      mismatched++;
+    }
+  }
+  printf("Matched: %d, Mismatched: %d\n", frame_count - 1 - mismatched, mismatched);
+
+  double t1 = millis_since_boot();
+  for (int i = 0; i < ITERS; i++) {
+    legacy_push(legacy_input, &frames[(i % frame_count) * WIDTH * HEIGHT], WIDTH);
+  }
+  double t2 = millis_since_boot();
+  for (int i = 0; i < ITERS; i++) {
+    posenet_frames_push(&pf, &frames[(i % frame_count) * WIDTH * HEIGHT], WIDTH);
+  }
+  double t3 = millis_since_boot();
+  for (int i = 0; i < ITERS; i++) {
+    posenet_frames_assemble(&pf, input);
+  }
+  double t4 = millis_since_boot();
+
+  const double legacy_ms = (t2 - t1) / ITERS;
+  const double push_ms = (t3 - t2) / ITERS;
+  const double assemble_ms = (t4 - t3) / ITERS;
+  printf("legacy push: %.3fms/frame\n", legacy_ms);
+  printf("ring push: %.3fms/frame, assemble: %.3fms/eval\n", push_ms, assemble_ms);
+  // posenet evals every 5 frames
+  printf("amortized: %.3fms/frame (%.1fx)\n", push_ms + assemble_ms / 5,
+         legacy_ms / (push_ms + assemble_ms / 5));
+
+  posenet_frames_free(&pf);
+  free(input);
+  free(legacy_input);
+  delete[] frames;
+
+  return mismatched == 0 ? 0 : -1;
+}
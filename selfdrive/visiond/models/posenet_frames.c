@@ -0,0 +1,94 @@
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define POSENET_NEON
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define POSENET_SSE2
+#endif
+
+#include "posenet_frames.h"
+
+// the net takes a normalized image input like the driving
+// model, so the 4 pixel sum in [0,1020] is remapped to [-1,1]
+static inline float normalize_sum(int a) {
+  return a * (1.0f / 512.0f) - 1.0f;
+}
+
+static void downsample_row(const uint8_t *row0, const uint8_t *row1, float *out) {
+  int xx = 0;
+#if defined(POSENET_NEON)
+  const float32x4_t scale = vdupq_n_f32(1.0f / 512.0f);
+  const float32x4_t one = vdupq_n_f32(1.0f);
+  for (; xx + 8 <= POSENET_FRAME_WIDTH; xx += 8) {
+    // pairwise add neighbouring columns, then the two rows
+    uint16x8_t sum = vaddq_u16(vpaddlq_u8(vld1q_u8(&row0[xx*2])),
+                               vpaddlq_u8(vld1q_u8(&row1[xx*2])));
+    float32x4_t lo = vcvtq_f32_u32(vmovl_u16(vget_low_u16(sum)));
+    float32x4_t hi = vcvtq_f32_u32(vmovl_u16(vget_high_u16(sum)));
+    vst1q_f32(&out[xx], vsubq_f32(vmulq_f32(lo, scale), one));
+    vst1q_f32(&out[xx+4], vsubq_f32(vmulq_f32(hi, scale), one));
+  }
+#elif defined(POSENET_SSE2)
+  const __m128i mask = _mm_set1_epi16(0x00ff);
+  const __m128i zero = _mm_setzero_si128();
+  const __m128 scale = _mm_set1_ps(1.0f / 512.0f);
+  const __m128 one = _mm_set1_ps(1.0f);
+  for (; xx + 8 <= POSENET_FRAME_WIDTH; xx += 8) {
+    __m128i r0 = _mm_loadu_si128((const __m128i*)&row0[xx*2]);
+    __m128i r1 = _mm_loadu_si128((const __m128i*)&row1[xx*2]);
+    // even + odd columns as 16 bit lanes, then the two rows
+    __m128i sum = _mm_add_epi16(
+      _mm_add_epi16(_mm_and_si128(r0, mask), _mm_srli_epi16(r0, 8)),
+      _mm_add_epi16(_mm_and_si128(r1, mask), _mm_srli_epi16(r1, 8)));
+    __m128 lo = _mm_cvtepi32_ps(_mm_unpacklo_epi16(sum, zero));
+    __m128 hi = _mm_cvtepi32_ps(_mm_unpackhi_epi16(sum, zero));
+    _mm_storeu_ps(&out[xx], _mm_sub_ps(_mm_mul_ps(lo, scale), one));
+    _mm_storeu_ps(&out[xx+4], _mm_sub_ps(_mm_mul_ps(hi, scale), one));
+  }
+#endif
+  for (; xx < POSENET_FRAME_WIDTH; xx++) {
+    int a = row0[xx*2] + row0[xx*2+1] + row1[xx*2] + row1[xx*2+1];
+    out[xx] = normalize_sum(a);
+  }
+}
+
+void posenet_downsample(const uint8_t *yuv_ptr_y, int yuv_width, float *out) {
+  for (int yy = 0; yy < POSENET_FRAME_HEIGHT; yy++) {
+    const uint8_t *row0 = &yuv_ptr_y[yuv_width*(POSENET_CROP_Y + yy*2) + POSENET_CROP_X];
+    downsample_row(row0, row0 + yuv_width, &out[yy*POSENET_FRAME_WIDTH]);
+  }
+}
+
+void posenet_frames_init(PosenetFrames *s) {
+  memset(s, 0, sizeof(*s));
+  for (int i = 0; i < POSENET_FRAME_COUNT; i++) {
+    s->slots[i] = (float*)calloc(POSENET_FRAME_SIZE, sizeof(float));
+    assert(s->slots[i]);
+  }
+}
+
+void posenet_frames_push(PosenetFrames *s, const uint8_t *yuv_ptr_y, int yuv_width) {
+  float *slot = s->slots[s->count % POSENET_FRAME_COUNT];
+  posenet_downsample(yuv_ptr_y, yuv_width, slot);
+  s->count++;
+}
+
+void posenet_frames_assemble(const PosenetFrames *s, float *input) {
+  // the net input is channel interleaved: [y][x][frame]
+  const float *prev = s->slots[(s->count + POSENET_FRAME_COUNT - 2) % POSENET_FRAME_COUNT];
+  const float *cur = s->slots[(s->count + POSENET_FRAME_COUNT - 1) % POSENET_FRAME_COUNT];
+  for (int i = 0; i < POSENET_FRAME_SIZE; i++) {
+    input[i*2 + 0] = prev[i];
+    input[i*2 + 1] = cur[i];
+  }
+}
+
+void posenet_frames_free(PosenetFrames *s) {
+  for (int i = 0; i < POSENET_FRAME_COUNT; i++) {
+    free(s->slots[i]);
+  }
+}
@@ -0,0 +1,44 @@
+#ifndef POSENET_FRAMES_H
+#define POSENET_FRAMES_H
+
+#include <stdint.h>
+
+// posenet uses a half resolution cropped frame
+// with upper left corner: [50, 237] and
+// bottom right corner: [1114, 637]
+// So the resulting crop is 532 X 200
+#define POSENET_CROP_X 50
+#define POSENET_CROP_Y 237
+#define POSENET_FRAME_WIDTH 532
+#define POSENET_FRAME_HEIGHT 200
+#define POSENET_FRAME_SIZE (POSENET_FRAME_WIDTH*POSENET_FRAME_HEIGHT)
+
+// the net looks at the previous and the current frame
+#define POSENET_FRAME_COUNT 2
+#define POSENET_INPUT_SIZE (POSENET_FRAME_COUNT*POSENET_FRAME_SIZE)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Ring of downsampled, normalized frames. Pushing only touches one slot,
+// the interleaved net input is built on demand by posenet_frames_assemble.
+typedef struct PosenetFrames {
+  float *slots[POSENET_FRAME_COUNT];
+  uint64_t count;
+} PosenetFrames;
+
+void posenet_frames_init(PosenetFrames *s);
+void posenet_frames_push(PosenetFrames *s, const uint8_t *yuv_ptr_y, int yuv_width);
+// writes POSENET_INPUT_SIZE floats, oldest frame in channel 0
+void posenet_frames_assemble(const PosenetFrames *s, float *input);
+void posenet_frames_free(PosenetFrames *s);
+
+// 2x2 box downsample of the posenet crop, remapped from [0,255] to [-1,1]
+void posenet_downsample(const uint8_t *yuv_ptr_y, int yuv_width, float *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
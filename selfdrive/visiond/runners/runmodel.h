@@ -3,6 +3,7 @@
 
 class RunModel {
 public:
+  virtual ~RunModel() {}
   virtual void addRecurrent(float *state, int state_size) {}
   virtual void execute(float *net_input_buf) {}
 };
@@ -0,0 +1,181 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <cassert>
+#include <cmath>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <unistd.h>
+
+#include "common/util.h"
+#include "common/timing.h"
+#include "runners/run.h"
+#include "models/posenet_frames.h"
+
+// Latency benchmark and regression test for the DefaultRunModel backend.
+// Every model is fed the same pseudo random inputs for a few steps (so the
+// recurrent state of the driving model goes around) and the last output is
+// compared to <model>.ref next to the model. A missing .ref is a failure.
+//
+// The references come from SNPEModel on the device, the runner the models
+// ship with. Other backends are only ever checked against them.
+//
+// usage: runmodel_test [--update] [--threads N] [--iters N]
+//   --update (QCOM only) writes the .ref files from SNPEModel
+
+struct ModelSpec {
+  const char *name;
+  const char *path;
+  size_t input_size;
+  size_t output_size;
+  size_t recurrent_size;
+};
+
+// sizes as in models/driving.cc (MEDMODEL, TEMPORAL), posenet.cc and monitoring.cc
+static const ModelSpec models[] = {
+  {"driving", "../../models/driving_model.dlc", 512*256*3/2, (200 + 2*201 + 26) + 512, 512},
+  {"posenet", "../../models/posenet.dlc", POSENET_INPUT_SIZE, 12, 0},
+  {"monitoring", "../../models/monitoring_model.dlc", 320*160*3/2, 8, 0},
+};
+
+#define REGRESSION_STEPS 3
+
+// relative to the magnitude of the reference
+#ifdef QCOM
+// the snpe gpu runtime against its own output
+#define MAXE 1e-4f
+#else
+// the snpe gpu runtime keeps activations in fp16 (2^-11 relative), a few
+// roundings of that through the layers stay well below 1e-2
+#define MAXE 1e-2f
+#endif
+
+static void fill_input(float *buf, size_t len, uint32_t seed) {
+  // small lcg, the inputs have to be the same on every host
+  uint32_t x = seed;
+  for (size_t i = 0; i < len; i++) {
+    x = x * 1664525u + 1013904223u;
+    buf[i] = (x >> 8) * (2.0f / (1 << 24)) - 1.0f;
+  }
+}
+
+static std::string ref_path(const ModelSpec &spec) {
+  std::string path = spec.path;
+  path.replace(path.rfind(".dlc"), 4, ".ref");
+  return path;
+}
+
+static bool model_available(const ModelSpec &spec) {
+#ifdef QCOM
+  return access(spec.path, R_OK) == 0;
+#else
+  std::string pb = spec.path;
+  pb.replace(pb.rfind(".dlc"), 4, ".pb");
+  return access(pb.c_str(), R_OK) == 0;
+#endif
+}
+
+// returns false on a regression
+static bool run_model(const ModelSpec &spec, int iters, bool update) {
+  std::vector<float> input(spec.input_size);
+  std::vector<float> output(spec.output_size, 0.0f);
+
+  RunModel *m = new DefaultRunModel(spec.path, output.data(), spec.output_size);
+  if (spec.recurrent_size > 0) {
+    // the recurrent state is the tail of the output, like driving.cc
+    m->addRecurrent(&output[spec.output_size - spec.recurrent_size], spec.recurrent_size);
+  }
+
+  for (int step = 0; step < REGRESSION_STEPS; step++) {
+    fill_input(input.data(), input.size(), 1337 + step);
+    m->execute(input.data());
+  }
+
+  bool ok = true;
+  const std::string ref = ref_path(spec);
+  if (update) {
+    FILE *f = fopen(ref.c_str(), "wb");
+    assert(f);
+    fwrite(output.data(), sizeof(float), output.size(), f);
+    fclose(f);
+    printf("%s: wrote %s\n", spec.name, ref.c_str());
+  } else {
+    size_t ref_size = 0;
+    float *ref_output = (float *)read_file(ref.c_str(), &ref_size);
+    if (!ref_output) {
+      printf("%s: no reference output at %s\n", spec.name, ref.c_str());
+      ok = false;
+    } else if (ref_size != output.size() * sizeof(float)) {
+      printf("%s: reference has %zu bytes, expected %zu\n", spec.name, ref_size, output.size() * sizeof(float));
+      ok = false;
+    } else {
+      float max_e = 0;
+      size_t max_i = 0;
+      for (size_t i = 0; i < output.size(); i++) {
+        const float e = fabsf(output[i] - ref_output[i]) / std::max(1.0f, fabsf(ref_output[i]));
+        if (e > max_e) {
+          max_e = e;
+          max_i = i;
+        }
+      }
+      ok = max_e <= MAXE;
+      printf("%s: max relative error %g at %zu (%f vs %f) %s\n", spec.name, max_e, max_i,
+             output[max_i], ref_output[max_i], ok ? "OK" : "REGRESSED");
+    }
+    free(ref_output);
+  }
+
+  // latency, the first run after loading is kept out
+  std::vector<double> times(iters);
+  fill_input(input.data(), input.size(), 42);
+  m->execute(input.data());
+  for (int i = 0; i < iters; i++) {
+    double t1 = millis_since_boot();
+    m->execute(input.data());
+    times[i] = millis_since_boot() - t1;
+  }
+  std::sort(times.begin(), times.end());
+  double sum = 0;
+  for (double t : times) sum += t;
+  printf("%s: mean %.2fms, p50 %.2fms, p90 %.2fms, max %.2fms over %d runs\n", spec.name,
+         sum / iters, times[iters / 2], times[iters * 9 / 10], times[iters - 1], iters);
+
+  delete m;
+  return ok;
+}
+
+int main(int argc, char** argv) {
+  bool update = false;
+  int iters = 50;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--update") == 0) {
+#ifdef QCOM
+      update = true;
+#else
+      printf("--update only runs on the device, the references come from SNPEModel\n");
+      return -1;
+#endif
+    } else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+      // picked up by TFModel
+      setenv("RUNMODEL_THREADS", argv[++i], 1);
+    } else if (strcmp(argv[i], "--iters") == 0 && i + 1 < argc) {
+      iters = std::max(1, atoi(argv[++i]));
+    } else {
+      printf("usage: %s [--update] [--threads N] [--iters N]\n", argv[0]);
+      return -1;
+    }
+  }
+
+  int failed = 0;
+  for (size_t i = 0; i < ARRAYSIZE(models); i++) {
+    if (!model_available(models[i])) {
+      printf("%s: model not found, skipping\n", models[i].name);
+      continue;
+    }
+    if (!run_model(models[i], iters, update)) failed++;
+  }
+
+  return failed == 0 ? 0 : -1;
+}
@@ -0,0 +1,186 @@
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <stdlib.h>
+#include <string>
+
+#include "common/util.h"
+#include "tfmodel.h"
+
+// Tensor names per model. The snpe containers keep the names of the tensors
+// they were converted from, the frozen graph next to them has the same ones.
+struct ModelOps {
+  const char *model;
+  const char *input;
+  const char *recurrent;
+  const char *output;
+};
+
+static const ModelOps model_ops[] = {
+  // read from models/monitoring_model.dlc
+  {"monitoring_model", "lambda/div", NULL, "descs/BiasAdd"},
+};
+
+// driving_model.dlc and posenet.dlc aren't in the tree to read the names from
+static const ModelOps default_ops = {NULL, "input_imgs", "rnn_state", "outputs"};
+
+static const ModelOps &find_model_ops(const std::string &path) {
+  const size_t slash = path.rfind('/');
+  const std::string base = path.substr(slash == std::string::npos ? 0 : slash + 1);
+  for (const ModelOps &ops : model_ops) {
+    if (base == std::string(ops.model) + ".pb") return ops;
+  }
+  return default_ops;
+}
+
+// the tensors wrap buffers owned by the caller
+static void noop_deallocator(void* data, size_t len, void* arg) {}
+
+// serialized ConfigProto with intra_op_parallelism_threads (field 2) and
+// inter_op_parallelism_threads (field 5) set, both varints
+static std::string thread_config(int num_threads) {
+  std::string config;
+  const uint8_t tags[] = {(2 << 3) | 0, (5 << 3) | 0};
+  for (uint8_t tag : tags) {
+    config.push_back(tag);
+    uint32_t v = num_threads;
+    do {
+      uint8_t b = v & 0x7f;
+      v >>= 7;
+      config.push_back(v ? (b | 0x80) : b);
+    } while (v);
+  }
+  return config;
+}
+
+TFModel::TFModel(const char *path, float *_output, size_t _output_size, int num_threads) {
+  output = _output;
+  output_size = _output_size;
+
+  // callers name the snpe container, the frozen graph sits next to it
+  std::string pb_path = path;
+  const size_t ext = pb_path.rfind(".dlc");
+  if (ext != std::string::npos) pb_path.replace(ext, 4, ".pb");
+
+  size_t model_size;
+  void *model_data = read_file(pb_path.c_str(), &model_size);
+  if (!model_data) {
+    fprintf(stderr, "can't read %s\n", pb_path.c_str());
+    exit(EXIT_FAILURE);
+  }
+  printf("loaded model %s with size: %zu\n", pb_path.c_str(), model_size);
+
+  status = TF_NewStatus();
+  graph = TF_NewGraph();
+
+  TF_Buffer *graph_def = TF_NewBufferFromString(model_data, model_size);
+  free(model_data);
+  TF_ImportGraphDefOptions *import_opts = TF_NewImportGraphDefOptions();
+  TF_GraphImportGraphDef(graph, graph_def, import_opts, status);
+  TF_DeleteImportGraphDefOptions(import_opts);
+  TF_DeleteBuffer(graph_def);
+  checkStatus("importing graph");
+
+  const ModelOps &ops = find_model_ops(pb_path);
+  recurrent_op = ops.recurrent;
+  output_op = findOp(ops.output);
+  // the image buffer comes with every execute
+  addInput(ops.input, NULL, 0);
+  printf("model: %s -> %s\n", ops.input, ops.output);
+
+  TF_SessionOptions *session_opts = TF_NewSessionOptions();
+  if (num_threads <= 0) {
+    const char *env_threads = getenv("RUNMODEL_THREADS");
+    num_threads = env_threads ? atoi(env_threads) : 0;
+  }
+  if (num_threads > 0) {
+    const std::string config = thread_config(num_threads);
+    TF_SetConfig(session_opts, config.data(), config.size(), status);
+    checkStatus("setting thread count");
+  }
+  session = TF_NewSession(graph, session_opts, status);
+  TF_DeleteSessionOptions(session_opts);
+  checkStatus("creating session");
+}
+
+TFModel::~TFModel() {
+  if (session) {
+    TF_CloseSession(session, status);
+    TF_DeleteSession(session, status);
+  }
+  if (graph) TF_DeleteGraph(graph);
+  if (status) TF_DeleteStatus(status);
+}
+
+void TFModel::checkStatus(const char *what) {
+  if (TF_GetCode(status) != TF_OK) {
+    fprintf(stderr, "tfmodel: %s: %s\n", what, TF_Message(status));
+    exit(EXIT_FAILURE);
+  }
+}
+
+TF_Output TFModel::findOp(const char *name) {
+  TF_Operation *op = TF_GraphOperationByName(graph, name);
+  if (!op) {
+    fprintf(stderr, "tfmodel: no op %s in the graph\n", name);
+    exit(EXIT_FAILURE);
+  }
+  return {op, 0};
+}
+
+void TFModel::addInput(const char *name, float *buf, size_t size) {
+  Input in;
+  in.op = findOp(name);
+  const int ndims = TF_GraphGetTensorNumDims(graph, in.op, status);
+  checkStatus("reading input shape");
+  in.dims.resize(ndims);
+  TF_GraphGetTensorShape(graph, in.op, in.dims.data(), ndims, status);
+  checkStatus("reading input shape");
+  in.size = 1;
+  for (int64_t &d : in.dims) {
+    // unknown batch dimension
+    if (d < 0) d = 1;
+    in.size *= d;
+  }
+  assert(buf == NULL || in.size == size);
+  in.buf = buf;
+  inputs.push_back(in);
+}
+
+void TFModel::addRecurrent(float *state, int state_size) {
+  if (!recurrent_op) {
+    fprintf(stderr, "tfmodel: the model has no recurrent input\n");
+    exit(EXIT_FAILURE);
+  }
+  addInput(recurrent_op, state, state_size);
+  printf("adding recurrent: %s\n", recurrent_op);
+}
+
+void TFModel::execute(float *net_input_buf) {
+  inputs[0].buf = net_input_buf;
+
+  std::vector<TF_Output> ops(inputs.size());
+  std::vector<TF_Tensor*> values(inputs.size());
+  for (size_t i = 0; i < inputs.size(); i++) {
+    const Input &in = inputs[i];
+    assert(in.buf);
+    ops[i] = in.op;
+    values[i] = TF_NewTensor(TF_FLOAT, in.dims.data(), in.dims.size(),
+                             in.buf, in.size * sizeof(float), noop_deallocator, NULL);
+    assert(values[i]);
+  }
+
+  TF_Tensor *out = NULL;
+  TF_SessionRun(session, NULL,
+                ops.data(), values.data(), inputs.size(),
+                &output_op, &out, 1,
+                NULL, 0, NULL, status);
+  for (size_t i = 0; i < inputs.size(); i++) {
+    TF_DeleteTensor(values[i]);
+  }
+  checkStatus("running model");
+
+  assert(TF_TensorByteSize(out) == output_size * sizeof(float));
+  memcpy(output, TF_TensorData(out), output_size * sizeof(float));
+  TF_DeleteTensor(out);
+}
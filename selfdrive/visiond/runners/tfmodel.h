@@ -0,0 +1,48 @@
+#ifndef TFMODEL_H
+#define TFMODEL_H
+
+#include <stdlib.h>
+#include <vector>
+
+#include "tensorflow/c/c_api.h"
+
+#include "runmodel.h"
+
+// Runs a frozen TensorFlow graph on the cpu through the TF C API.
+// The graph is loaded from the .pb next to the .dlc the caller names.
+// Inputs and the output are bound by the tensor names the snpe container
+// of the same model uses (see tfmodel.cc), a graph without one of them
+// fails to load instead of being fed the wrong buffer.
+class TFModel : public RunModel {
+public:
+  // num_threads 0 uses RUNMODEL_THREADS if set, else the TF default
+  TFModel(const char *path, float *output, size_t output_size, int num_threads = 0);
+  ~TFModel();
+  void addRecurrent(float *state, int state_size);
+  void execute(float *net_input_buf);
+private:
+  struct Input {
+    TF_Output op;
+    std::vector<int64_t> dims;
+    float *buf;
+    size_t size;
+  };
+
+  TF_Output findOp(const char *name);
+  void addInput(const char *name, float *buf, size_t size);
+  void checkStatus(const char *what);
+
+  TF_Graph *graph = NULL;
+  TF_Session *session = NULL;
+  TF_Status *status = NULL;
+
+  // the image first, then the inputs in the order they were added
+  std::vector<Input> inputs;
+
+  const char *recurrent_op;
+  TF_Output output_op;
+  float *output;
+  size_t output_size;
+};
+
+#endif
@@ -0,0 +1,254 @@
+#include <assert.h>
+#include <math.h>
+#include <string.h>
+
+#include "scheduler.h"
+
+void sched_init(Scheduler *s, float budget_ms) {
+  memset(s, 0, sizeof(*s));
+  pthread_mutex_init(&s->lock, NULL);
+  s->budget_ms = budget_ms;
+  // until the frames have been measured
+  s->interval_ms = budget_ms;
+}
+
+int sched_add_task(Scheduler *s, const char *name, int period, int phase,
+                   bool critical, int max_defer, float max_wait_ms, float cost_ms) {
+  assert(s->num_tasks < SCHED_MAX_TASKS);
+  assert(period > 0 && phase >= 0 && phase < period);
+
+  pthread_mutex_lock(&s->lock);
+  const int idx = s->num_tasks++;
+  SchedTask *t = &s->tasks[idx];
+  memset(t, 0, sizeof(*t));
+  t->name = name;
+  t->period = period;
+  t->critical = critical;
+  t->max_defer = max_defer;
+  t->max_wait_ms = max_wait_ms;
+  t->cost_ms = cost_ms;
+  // due once the count reaches period on opportunity phase
+  t->since_run = period - 1 - phase;
+  pthread_mutex_unlock(&s->lock);
+  return idx;
+}
+
+void sched_set_max_skip(Scheduler *s, int task, int max_skip) {
+  assert(task >= 0 && task < s->num_tasks);
+  assert(!s->tasks[task].critical && max_skip >= 0);
+  pthread_mutex_lock(&s->lock);
+  s->tasks[task].max_skip = max_skip;
+  pthread_mutex_unlock(&s->lock);
+}
+
+// critical work of the current window that hasn't finished, assuming the
+// running tasks take their estimated cost
+static float critical_remaining(const Scheduler *s, double now) {
+  float remaining = 0;
+  for (int i = 0; i < s->num_tasks; i++) {
+    const SchedTask *t = &s->tasks[i];
+    if (!t->critical || !t->pending) continue;
+    if (t->started > 0) {
+      // past its estimate it's taken to be about done
+      const float left = t->cost_ms - (float)(now - t->started);
+      remaining += left > 1 ? left : 1;
+    } else {
+      remaining += t->cost_ms;
+    }
+  }
+  return remaining;
+}
+
+// critical work the next rear frame will bring
+static float critical_next(const Scheduler *s) {
+  float next = 0;
+  for (int i = 0; i < s->num_tasks; i++) {
+    const SchedTask *t = &s->tasks[i];
+    if (t->critical && t->since_run + 1 >= t->period) next += t->cost_ms;
+  }
+  return next;
+}
+
+// work of the tasks that are out of drops, the others leave room for it
+static float owed(const Scheduler *s, const SchedTask *except) {
+  float owed = 0;
+  for (int i = 0; i < s->num_tasks; i++) {
+    const SchedTask *t = &s->tasks[i];
+    if (t != except && t->max_skip > 0 && t->skipped_for >= t->max_skip && !t->pending) {
+      owed += t->cost_ms;
+    }
+  }
+  return owed;
+}
+
+void sched_frame_begin(Scheduler *s, double now) {
+  pthread_mutex_lock(&s->lock);
+  if (s->frames > 0) {
+    const float dt = (float)(now - s->frame_start);
+    // a stall isn't the frame rate
+    if (dt > 0 && dt < 4 * s->interval_ms) {
+      s->interval_ms += (dt - s->interval_ms) / 8;
+    }
+  }
+  s->frame_start = now;
+  s->frames++;
+  s->frame_overran = false;
+
+  for (int i = 0; i < s->num_tasks; i++) {
+    SchedTask *t = &s->tasks[i];
+    if (!t->critical) continue;
+    // a reservation the last frame didn't use is gone
+    t->pending = false;
+    t->started = 0;
+    t->since_run++;
+    if (t->since_run >= t->period) {
+      t->pending = true;
+      t->since_run = 0;
+    }
+  }
+  pthread_mutex_unlock(&s->lock);
+}
+
+bool sched_should_run(Scheduler *s, int task, double now) {
+  assert(task >= 0 && task < s->num_tasks);
+  pthread_mutex_lock(&s->lock);
+  SchedTask *t = &s->tasks[task];
+  bool run = false;
+
+  if (t->critical) {
+    run = t->pending && t->started == 0;
+    if (run) t->started = now;
+  } else if (!t->pending) {
+    if (!t->waiting) t->since_run++;
+    if (t->since_run >= t->period) {
+      // this run has to leave room for what's left of the current frame's
+      // critical path and for all of the next one's
+      double next_start = s->frame_start + s->interval_ms;
+      if (next_start < now) next_start = now;
+      const double next_limit = next_start + s->budget_ms - critical_next(s);
+
+      const float remaining = critical_remaining(s, now);
+      double limit = next_limit;
+      if (remaining > 0 && s->frame_start + s->budget_ms < limit) {
+        limit = s->frame_start + s->budget_ms;
+      }
+
+      if (!t->waiting) t->wait_start = now;
+      const double retry_at = now + remaining;
+      const float claimed = s->claimed_ms + owed(s, t);
+
+      if (now + remaining + claimed + t->cost_ms <= limit) {
+        run = true;
+      } else if (remaining > 0 && retry_at - t->wait_start <= t->max_wait_ms &&
+                 retry_at + claimed + t->cost_ms <= next_limit) {
+        // it fits right behind the critical path
+        t->waiting = true;
+        t->retry_at = retry_at;
+      } else if (t->deferred_for >= t->max_defer && t->max_skip > 0 && t->skipped_for >= t->max_skip) {
+        // out of drops, it has to run on this one. It goes right behind the
+        // critical path of this frame, or of the next one if that's done
+        if (remaining > 0) {
+          t->waiting = true;
+          t->retry_at = retry_at;
+        } else if (!t->waiting) {
+          t->waiting = true;
+          t->retry_at = next_start + critical_next(s);
+        } else {
+          run = true;
+          t->forced++;
+        }
+      } else if (t->deferred_for >= t->max_defer) {
+        t->skips++;
+        t->skipped_for++;
+        t->since_run = 0;
+        t->deferred_for = 0;
+        t->waiting = false;
+      } else {
+        t->deferrals++;
+        t->deferred_for++;
+        t->waiting = false;
+      }
+
+      if (run) {
+        t->pending = true;
+        t->started = now;
+        t->since_run = 0;
+        t->deferred_for = 0;
+        t->skipped_for = 0;
+        t->waiting = false;
+        s->claimed_ms += t->cost_ms;
+      }
+    }
+  }
+
+  pthread_mutex_unlock(&s->lock);
+  return run;
+}
+
+static void release(Scheduler *s, SchedTask *t) {
+  if (!t->critical) {
+    s->claimed_ms -= t->cost_ms;
+    if (s->claimed_ms < 0) s->claimed_ms = 0;
+  }
+  t->pending = false;
+  t->started = 0;
+}
+
+double sched_retry_at(Scheduler *s, int task) {
+  assert(task >= 0 && task < s->num_tasks);
+  pthread_mutex_lock(&s->lock);
+  const SchedTask *t = &s->tasks[task];
+  const double retry_at = t->waiting ? t->retry_at : 0;
+  pthread_mutex_unlock(&s->lock);
+  return retry_at;
+}
+
+void sched_done(Scheduler *s, int task, double start, double end) {
+  assert(task >= 0 && task < s->num_tasks);
+  pthread_mutex_lock(&s->lock);
+  SchedTask *t = &s->tasks[task];
+  // a critical task whose window already ended has no reservation left
+  if (t->pending) release(s, t);
+
+  const float elapsed = (float)(end - start);
+  t->runs++;
+  t->last_ms = elapsed;
+  if (elapsed > t->max_ms) t->max_ms = elapsed;
+  // mean and mean deviation as for tcp round trip times, the estimate
+  // covers most of the jitter
+  if (t->runs == 1) {
+    t->mean_ms = elapsed;
+    t->dev_ms = elapsed / 4;
+  } else {
+    const float err = elapsed - t->mean_ms;
+    t->mean_ms += err / 8;
+    t->dev_ms += (fabsf(err) - t->dev_ms) / 4;
+  }
+  t->cost_ms = t->mean_ms + 3 * t->dev_ms;
+
+  t->latency_ms = (float)(end - s->frame_start);
+  if (t->critical && t->latency_ms > s->budget_ms && !s->frame_overran) {
+    s->frame_overran = true;
+    s->overruns++;
+  }
+  pthread_mutex_unlock(&s->lock);
+}
+
+void sched_cancel(Scheduler *s, int task) {
+  assert(task >= 0 && task < s->num_tasks);
+  pthread_mutex_lock(&s->lock);
+  SchedTask *t = &s->tasks[task];
+  if (t->pending) release(s, t);
+  pthread_mutex_unlock(&s->lock);
+}
+
+void sched_stats(Scheduler *s, SchedStats *out) {
+  pthread_mutex_lock(&s->lock);
+  out->budget_ms = s->budget_ms;
+  out->interval_ms = s->interval_ms;
+  out->frames = s->frames;
+  out->overruns = s->overruns;
+  out->num_tasks = s->num_tasks;
+  memcpy(out->tasks, s->tasks, s->num_tasks * sizeof(SchedTask));
+  pthread_mutex_unlock(&s->lock);
+}
@@ -0,0 +1,121 @@
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <pthread.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SCHED_MAX_TASKS 8
+
+// Everything visiond runs on the gpu/dsp shares one accelerator. The rear
+// frame is the clock: every rear frame starts a window, and the critical
+// tasks (camera processing and the driving model) have to finish within
+// budget_ms of its start, for this frame and the next one. The other tasks
+// are offered a slot every time their period comes around and only get it
+// if their measured cost still fits around the critical path. A task that
+// would fit right after the critical path can wait up to max_wait_ms for it
+// within the same opportunity; otherwise it's deferred to its next
+// opportunity, and dropped after max_defer of those. A task with a minimum
+// rate runs anyway once it has been dropped max_skip times in a row.
+//
+// Times are milliseconds on the millis_since_boot clock, passed in by the
+// caller so the policy can be driven by a simulated clock in tests.
+typedef struct SchedTask {
+  const char *name;
+  int period;
+  bool critical;
+  int max_defer;
+  float max_wait_ms;
+  // drops in a row before it runs regardless, 0 for no minimum rate
+  int max_skip;
+
+  // opportunities since the last run, and how long the current due run waited
+  int since_run;
+  int deferred_for;
+  int skipped_for;
+  // waiting for the critical path within the current opportunity
+  bool waiting;
+  double wait_start, retry_at;
+  // critical: due in the current window. others: holding a claim
+  bool pending;
+  double started;
+
+  // cost estimate, from the mean and the deviation of the measured runs
+  float cost_ms;
+  float mean_ms, dev_ms;
+  // the last and worst measured runs
+  float last_ms, max_ms;
+  // last completion relative to the start of its rear frame
+  float latency_ms;
+
+  uint64_t runs;
+  uint64_t deferrals;
+  uint64_t skips;
+  // runs past the budget for the minimum rate
+  uint64_t forced;
+} SchedTask;
+
+typedef struct Scheduler {
+  pthread_mutex_t lock;
+
+  float budget_ms;
+  // rear frame interval, measured
+  float interval_ms;
+
+  double frame_start;
+  uint64_t frames;
+  // frames where a critical task finished past the budget
+  uint64_t overruns;
+  bool frame_overran;
+
+  // estimated non critical work claimed and not done yet
+  float claimed_ms;
+
+  int num_tasks;
+  SchedTask tasks[SCHED_MAX_TASKS];
+} Scheduler;
+
+typedef struct SchedStats {
+  float budget_ms;
+  float interval_ms;
+  uint64_t frames;
+  uint64_t overruns;
+  int num_tasks;
+  SchedTask tasks[SCHED_MAX_TASKS];
+} SchedStats;
+
+void sched_init(Scheduler *s, float budget_ms);
+
+// returns the task index. The first run is on opportunity phase (0 based),
+// then every period. cost_ms is the estimate until the task has been measured.
+int sched_add_task(Scheduler *s, const char *name, int period, int phase,
+                   bool critical, int max_defer, float max_wait_ms, float cost_ms);
+
+// gives a non critical task a minimum rate, see max_skip
+void sched_set_max_skip(Scheduler *s, int task, int max_skip);
+
+// a rear frame arrived, reserves the critical tasks that are due on it
+void sched_frame_begin(Scheduler *s, double now);
+
+// one opportunity for the task, true if it should run now. A true must be
+// followed by sched_done, or sched_cancel if the caller ends up not running it.
+bool sched_should_run(Scheduler *s, int task, double now);
+
+// after a false from sched_should_run: when to ask again for the same
+// opportunity, or 0 if the task has to wait for its next one
+double sched_retry_at(Scheduler *s, int task);
+
+void sched_done(Scheduler *s, int task, double start, double end);
+void sched_cancel(Scheduler *s, int task);
+
+void sched_stats(Scheduler *s, SchedStats *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
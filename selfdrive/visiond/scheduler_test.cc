@@ -0,0 +1,340 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <cassert>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+
+#include "scheduler.h"
+
+// Runs the scheduler against a simulated accelerator with synthetic task
+// costs, next to the fixed cadences visiond used to have, and reports the
+// driving model latency and how much of the low priority work got through.
+//
+// The accelerator is a single fifo: the processing thread queues camera,
+// driving, posenet and AE one after the other for every 20Hz rear frame, and the monitoring thread queues a model run for every 10Hz front
+// frame, which drifts against the rear frames.
+
+#define BUDGET_MS 50.0
+#define REAR_INTERVAL_MS 50.0
+#define FRONT_INTERVAL_MS 100.7
+#define FRONT_OFFSET_MS 20.0
+#define FRAMES (20 * 60 * 10)
+
+#define CAMERA_MS 5.0
+#define POSENET_MS 12.0
+#define MONITORING_MS 15.0
+#define AE_MS 1.0
+
+// the front frame is still good this much later
+#define MONITORING_WAIT_MS 40.0
+// driver monitoring never drops two front frames in a row
+#define MONITORING_MAX_SKIP 1
+
+enum {
+  TASK_CAMERA,
+  TASK_DRIVING,
+  TASK_POSENET,
+  TASK_AE,
+  TASK_MONITORING,
+  TASK_COUNT,
+};
+
+// the fixed cadences from visiond
+static bool naive_due(int task, int cnt) {
+  switch (task) {
+  case TASK_POSENET: return cnt % 5 == 0;
+  case TASK_AE: return cnt % 3 == 0;
+  default: return true;
+  }
+}
+
+static const double task_cost[TASK_COUNT] = {
+  CAMERA_MS, 0, POSENET_MS, AE_MS, MONITORING_MS,
+};
+
+struct SimResult {
+  int overruns;
+  double max_latency;
+  double mean_latency;
+  uint64_t runs[TASK_COUNT];
+  uint64_t due[TASK_COUNT];
+  // most front frames in a row without a monitoring run
+  int max_monitoring_gap;
+};
+
+static void add_tasks(Scheduler *s) {
+  // same table as visiond
+  int idx;
+  idx = sched_add_task(s, "camera", 1, 0, true, 0, 0, CAMERA_MS);
+  assert(idx == TASK_CAMERA);
+  idx = sched_add_task(s, "driving", 1, 0, true, 0, 0, 25.0);
+  assert(idx == TASK_DRIVING);
+  idx = sched_add_task(s, "posenet", 5, 0, false, 2, 0, 10.0);
+  assert(idx == TASK_POSENET);
+  idx = sched_add_task(s, "ae", 3, 0, false, 2, 0, 1.0);
+  assert(idx == TASK_AE);
+  idx = sched_add_task(s, "monitoring", 1, 0, false, 0, MONITORING_WAIT_MS, 15.0);
+  assert(idx == TASK_MONITORING);
+  sched_set_max_skip(s, TASK_MONITORING, MONITORING_MAX_SKIP);
+}
+
+struct Completion {
+  int task;
+  double start, end;
+};
+
+static SimResult simulate(bool scheduled, Scheduler *s) {
+  SimResult res = {};
+  uint32_t lcg = 1337;
+  double gpu_free = 0;
+  // runs are only reported done once the clock gets to their end
+  std::vector<Completion> completions;
+
+  // rear thread: frame, step, when it can issue the next step
+  int frame = 0, step = 0;
+  double frame_arrival = 1000.0, rear_next = frame_arrival;
+  double latency_sum = 0;
+  // front thread
+  int front_frame = 0, monitoring_gap = 0;
+  double front_next = 1000.0 + FRONT_OFFSET_MS;
+
+  while (frame < FRAMES) {
+    const double now = std::min(front_next, rear_next);
+    for (size_t i = 0; i < completions.size(); ) {
+      if (completions[i].end <= now) {
+        if (scheduled) sched_done(s, completions[i].task, completions[i].start, completions[i].end);
+        completions.erase(completions.begin() + i);
+      } else {
+        i++;
+      }
+    }
+
+    if (front_next < rear_next) {
+      const bool run = scheduled ? sched_should_run(s, TASK_MONITORING, now) : true;
+      const double retry_at = scheduled && !run ? sched_retry_at(s, TASK_MONITORING) : 0;
+      if (retry_at > 0) {
+        // same frame, later
+        front_next = retry_at;
+        continue;
+      }
+      res.due[TASK_MONITORING]++;
+      if (run) {
+        const double start = std::max(now, gpu_free);
+        gpu_free = start + MONITORING_MS;
+        res.runs[TASK_MONITORING]++;
+        completions.push_back({TASK_MONITORING, start, gpu_free});
+        monitoring_gap = 0;
+      } else {
+        res.max_monitoring_gap = std::max(res.max_monitoring_gap, ++monitoring_gap);
+      }
+      front_frame++;
+      front_next = 1000.0 + FRONT_OFFSET_MS + front_frame * FRONT_INTERVAL_MS;
+      continue;
+    }
+
+    const int task = TASK_CAMERA + step;
+    if (task == TASK_CAMERA && scheduled) {
+      sched_frame_begin(s, frame_arrival);
+    }
+
+    double cost = task_cost[task];
+    if (task == TASK_DRIVING) {
+      // 20 to 32ms
+      lcg = lcg * 1664525u + 1013904223u;
+      cost = 20.0 + (lcg >> 8) % 1200 / 100.0;
+    }
+
+    bool run;
+    if (scheduled) {
+      run = sched_should_run(s, task, now);
+    } else {
+      run = naive_due(task, frame);
+    }
+    if (naive_due(task, frame)) res.due[task]++;
+
+    double end = now;
+    if (run) {
+      const double start = std::max(now, gpu_free);
+      end = gpu_free = start + cost;
+      res.runs[task]++;
+      completions.push_back({task, start, end});
+    }
+
+    if (task == TASK_DRIVING) {
+      const double latency = end - frame_arrival;
+      latency_sum += latency;
+      res.max_latency = std::max(res.max_latency, latency);
+      if (latency > BUDGET_MS) res.overruns++;
+    }
+
+    // the processing thread waits for each step
+    rear_next = end;
+    if (++step == TASK_MONITORING) {
+      step = 0;
+      frame++;
+      frame_arrival = 1000.0 + frame * REAR_INTERVAL_MS;
+      rear_next = std::max(rear_next, frame_arrival);
+    }
+  }
+  res.mean_latency = latency_sum / FRAMES;
+  return res;
+}
+
+static void print_result(const char *name, const SimResult &res) {
+  printf("%s: driving latency mean %.1fms max %.1fms, %d of %d frames over %.0fms\n",
+         name, res.mean_latency, res.max_latency, res.overruns, FRAMES, BUDGET_MS);
+  const char *names[TASK_COUNT] = {"camera", "driving", "posenet", "ae", "monitoring"};
+  for (int i = TASK_POSENET; i < TASK_COUNT; i++) {
+    printf("  %-10s %6llu of %6llu (%.0f%%)\n", names[i], (unsigned long long)res.runs[i],
+           (unsigned long long)res.due[i], 100.0 * res.runs[i] / res.due[i]);
+  }
+}
+
+static int test_cadence() {
+  // with nothing else going on every task runs on its own cadence
+  Scheduler s;
+  sched_init(&s, BUDGET_MS);
+  add_tasks(&s);
+
+  int failed = 0;
+  double now = 1000.0;
+  for (int cnt = 0; cnt < 300; cnt++, now += REAR_INTERVAL_MS) {
+    sched_frame_begin(&s, now);
+    for (int task = TASK_CAMERA; task < TASK_MONITORING; task++) {
+      const bool run = sched_should_run(&s, task, now + 1);
+      if (run != naive_due(task, cnt)) {
+        printf("cadence: %s frame %d run %d\n", s.tasks[task].name, cnt, run);
+        failed++;
+      }
+      if (run) sched_done(&s, task, now + 1, now + 1.5);
+    }
+  }
+  return failed;
+}
+
+#define CHECK(cond) do { \
+    if (!(cond)) { \
+      printf("%s:%d: %s failed\n", __FILE__, __LINE__, #cond); \
+      failed++; \
+    } \
+  } while (0)
+
+static int test_defer() {
+  Scheduler s;
+  sched_init(&s, BUDGET_MS);
+  add_tasks(&s);
+  int failed = 0;
+
+  // settle the estimates: camera 6ms, driving 30ms
+  double f = 1000.0;
+  for (int i = 0; i < 20; i++, f += REAR_INTERVAL_MS) {
+    sched_frame_begin(&s, f);
+    sched_should_run(&s, TASK_CAMERA, f);
+    sched_done(&s, TASK_CAMERA, f, f + 6);
+    sched_should_run(&s, TASK_DRIVING, f + 6);
+    sched_done(&s, TASK_DRIVING, f + 6, f + 36);
+  }
+
+  // after the critical path monitoring fits, posenet behind it doesn't
+  sched_frame_begin(&s, f);
+  sched_should_run(&s, TASK_CAMERA, f);
+  sched_done(&s, TASK_CAMERA, f, f + 6);
+  sched_should_run(&s, TASK_DRIVING, f + 6);
+  sched_done(&s, TASK_DRIVING, f + 6, f + 36);
+  CHECK(sched_should_run(&s, TASK_MONITORING, f + 36));
+  CHECK(!sched_should_run(&s, TASK_POSENET, f + 42));
+  sched_done(&s, TASK_MONITORING, f + 36, f + 51);
+
+  // ahead of the driving model monitoring waits for it to finish, and
+  // posenet is deferred again
+  f += REAR_INTERVAL_MS;
+  sched_frame_begin(&s, f);
+  sched_should_run(&s, TASK_CAMERA, f);
+  CHECK(!sched_should_run(&s, TASK_MONITORING, f + 3));
+  CHECK(fabs(sched_retry_at(&s, TASK_MONITORING) - (f + 36)) < 0.5);
+  sched_done(&s, TASK_CAMERA, f, f + 6);
+  sched_should_run(&s, TASK_DRIVING, f + 6);
+  sched_done(&s, TASK_DRIVING, f + 6, f + 36);
+  CHECK(sched_should_run(&s, TASK_MONITORING, f + 36));
+  CHECK(!sched_should_run(&s, TASK_POSENET, f + 41));
+  sched_done(&s, TASK_MONITORING, f + 36, f + 51);
+
+  // with the driving model running long, monitoring gives up after
+  // max_wait_ms and posenet after max_defer
+  f += REAR_INTERVAL_MS;
+  sched_frame_begin(&s, f);
+  sched_should_run(&s, TASK_CAMERA, f);
+  CHECK(!sched_should_run(&s, TASK_MONITORING, f + 1));
+  sched_done(&s, TASK_CAMERA, f, f + 6);
+  sched_should_run(&s, TASK_DRIVING, f + 6);
+  CHECK(!sched_should_run(&s, TASK_MONITORING, f + 35));
+  CHECK(sched_retry_at(&s, TASK_MONITORING) > 0);
+  CHECK(!sched_should_run(&s, TASK_MONITORING, f + 42));
+  CHECK(sched_retry_at(&s, TASK_MONITORING) == 0);
+  CHECK(!sched_should_run(&s, TASK_POSENET, f + 42));
+  sched_done(&s, TASK_DRIVING, f + 6, f + 43);
+
+  const SchedTask &posenet = s.tasks[TASK_POSENET];
+  const SchedTask &monitoring = s.tasks[TASK_MONITORING];
+  if (posenet.deferrals != 2 || posenet.skips != 1 || monitoring.skips != 1 || monitoring.runs != 2) {
+    printf("defer: posenet deferrals %llu skips %llu, monitoring runs %llu skips %llu\n",
+           (unsigned long long)posenet.deferrals, (unsigned long long)posenet.skips,
+           (unsigned long long)monitoring.runs, (unsigned long long)monitoring.skips);
+    failed++;
+  }
+
+  // a cancelled claim is released
+  Scheduler idle;
+  sched_init(&idle, BUDGET_MS);
+  add_tasks(&idle);
+  CHECK(sched_should_run(&idle, TASK_MONITORING, 1000.0));
+  CHECK(idle.claimed_ms > 0);
+  sched_cancel(&idle, TASK_MONITORING);
+  CHECK(idle.claimed_ms == 0);
+
+  if (failed) printf("defer: %d checks failed\n", failed);
+  return failed;
+}
+
+int main() {
+  int failed = test_cadence() + test_defer();
+
+  SimResult naive = simulate(false, NULL);
+  print_result("fixed cadence", naive);
+
+  Scheduler s;
+  sched_init(&s, BUDGET_MS);
+  add_tasks(&s);
+  SimResult scheduled = simulate(true, &s);
+  print_result("scheduled", scheduled);
+
+  SchedStats stats;
+  sched_stats(&s, &stats);
+  for (int i = 0; i < stats.num_tasks; i++) {
+    const SchedTask &t = stats.tasks[i];
+    printf("  %-10s cost %5.1fms max %5.1fms, %llu runs, %llu deferred, %llu skipped, %llu forced\n", t.name,
+           t.cost_ms, t.max_ms, (unsigned long long)t.runs,
+           (unsigned long long)t.deferrals, (unsigned long long)t.skips, (unsigned long long)t.forced);
+  }
+
+  // the budget holds, and the low priority work still gets most of its slots
+  if (scheduled.overruns > 0) {
+    printf("scheduled: %d overruns\n", scheduled.overruns);
+    failed++;
+  }
+  if (scheduled.runs[TASK_POSENET] < scheduled.due[TASK_POSENET] * 9 / 10) {
+    printf("scheduled: posenet starved\n");
+    failed++;
+  }
+  if (scheduled.runs[TASK_MONITORING] < scheduled.due[TASK_MONITORING] / 2 ||
+      scheduled.max_monitoring_gap > MONITORING_MAX_SKIP) {
+    printf("scheduled: monitoring starved, %d front frames in a row dropped\n", scheduled.max_monitoring_gap);
+    failed++;
+  }
+
+  printf("%s\n", failed == 0 ? "OK" : "FAILED");
+  return failed == 0 ? 0 : -1;
+}
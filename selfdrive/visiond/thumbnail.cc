@@ -0,0 +1,195 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cassert>
+
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
+#include <czmq.h>
+#include <capnp/serialize.h>
+#include <jpeglib.h>
+
+#include "common/util.h"
+#include "common/timing.h"
+#include "common/swaglog.h"
+
+#include "cereal/gen/cpp/log.capnp.h"
+
+#include "thumbnail.h"
+
+// libjpeg-turbo can take bgr directly, plain libjpeg needs rgb
+#ifdef JCS_EXTENSIONS
+#define THUMBNAIL_COLOR_SPACE JCS_EXT_BGR
+#define THUMBNAIL_SWAP_RB 0
+#else
+#define THUMBNAIL_COLOR_SPACE JCS_RGB
+#define THUMBNAIL_SWAP_RB 1
+#endif
+
+#define THUMBNAIL_NICE 10
+
+static void downscale_row(const uint8_t *row0, const uint8_t *row1, uint8_t *out, int width) {
+  int x = 0;
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+  for (; x + 8 <= width; x += 8) {
+    // deinterleave 16 input pixels, sum column pairs and rows per channel
+    uint8x16x3_t p0 = vld3q_u8(&row0[x*6]);
+    uint8x16x3_t p1 = vld3q_u8(&row1[x*6]);
+    uint8x8x3_t o;
+    for (int k = 0; k < 3; k++) {
+      uint16x8_t sum = vaddq_u16(vpaddlq_u8(p0.val[k]), vpaddlq_u8(p1.val[k]));
+      o.val[THUMBNAIL_SWAP_RB ? 2 - k : k] = vshrn_n_u16(sum, 2);
+    }
+    vst3_u8(&out[x*3], o);
+  }
+#endif
+  for (; x < width; x++) {
+    for (int k = 0; k < 3; k++) {
+      uint16_t dat = 0;
+      dat += row0[x*6 + k];
+      dat += row0[x*6 + 3 + k];
+      dat += row1[x*6 + k];
+      dat += row1[x*6 + 3 + k];
+      out[x*3 + (THUMBNAIL_SWAP_RB ? 2 - k : k)] = dat / 4;
+    }
+  }
+}
+
+void thumbnail_init(ThumbnailState *s, int rgb_width, int rgb_height, void *sock_raw) {
+  memset(s, 0, sizeof(*s));
+  s->width = rgb_width / 2;
+  s->height = rgb_height / 2;
+  s->sock_raw = sock_raw;
+
+  pthread_mutex_init(&s->lock, NULL);
+  pthread_cond_init(&s->cv, NULL);
+
+  for (int i = 0; i < 2; i++) {
+    s->bufs[i] = (uint8_t*)malloc(s->width * s->height * 3);
+    assert(s->bufs[i]);
+  }
+  s->pending_idx = -1;
+  s->encoding_idx = -1;
+}
+
+void thumbnail_push(ThumbnailState *s, const uint8_t *bgr_ptr, int rgb_stride,
+                    const FrameMetadata *frame_data) {
+  pthread_mutex_lock(&s->lock);
+  const int idx = s->encoding_idx == 0 ? 1 : 0;
+  if (s->pending_idx == idx) {
+    // the worker didn't get to it yet, drop it in favor of this frame
+    s->pending_idx = -1;
+  }
+  pthread_mutex_unlock(&s->lock);
+
+  uint8_t *buf = s->bufs[idx];
+  for (int i = 0; i < s->height; i++) {
+    const uint8_t *row0 = &bgr_ptr[rgb_stride * (i*2)];
+    downscale_row(row0, row0 + rgb_stride, &buf[s->width * 3 * i], s->width);
+  }
+
+  pthread_mutex_lock(&s->lock);
+  s->metas[idx] = *frame_data;
+  s->pending_idx = idx;
+  pthread_cond_signal(&s->cv);
+  pthread_mutex_unlock(&s->lock);
+}
+
+static void thumbnail_send(ThumbnailState *s, const FrameMetadata *frame_data,
+                           const uint8_t *thumbnail_buffer, uint64_t thumbnail_len) {
+  capnp::MallocMessageBuilder msg;
+  cereal::Event::Builder event = msg.initRoot<cereal::Event>();
+  event.setLogMonoTime(nanos_since_boot());
+
+  auto thumbnaild = event.initThumbnail();
+  thumbnaild.setFrameId(frame_data->frame_id);
+  thumbnaild.setTimestampEof(frame_data->timestamp_eof);
+  thumbnaild.setThumbnail(kj::arrayPtr(thumbnail_buffer, thumbnail_len));
+
+  auto words = capnp::messageToFlatArray(msg);
+  auto bytes = words.asBytes();
+  zmq_send(s->sock_raw, bytes.begin(), bytes.size(), ZMQ_DONTWAIT);
+}
+
+void* thumbnail_thread(void *arg) {
+  ThumbnailState *s = (ThumbnailState*)arg;
+
+  set_thread_name("thumbnail");
+
+  int err = setpriority(PRIO_PROCESS, syscall(SYS_gettid), THUMBNAIL_NICE);
+  LOG("thumbnail setpriority returns %d", err);
+
+  struct jpeg_compress_struct cinfo;
+  struct jpeg_error_mgr jerr;
+  cinfo.err = jpeg_std_error(&jerr);
+  jpeg_create_compress(&cinfo);
+
+  while (true) {
+    pthread_mutex_lock(&s->lock);
+    while (s->pending_idx < 0 && !s->stopped) {
+      pthread_cond_wait(&s->cv, &s->lock);
+    }
+    if (s->stopped) {
+      pthread_mutex_unlock(&s->lock);
+      break;
+    }
+    const int idx = s->pending_idx;
+    const FrameMetadata frame_data = s->metas[idx];
+    s->pending_idx = -1;
+    s->encoding_idx = idx;
+    pthread_mutex_unlock(&s->lock);
+
+    uint8_t* thumbnail_buffer = NULL;
+    unsigned long thumbnail_len = 0;
+    jpeg_mem_dest(&cinfo, &thumbnail_buffer, &thumbnail_len);
+
+    cinfo.image_width = s->width;
+    cinfo.image_height = s->height;
+    cinfo.input_components = 3;
+    cinfo.in_color_space = THUMBNAIL_COLOR_SPACE;
+
+    jpeg_set_defaults(&cinfo);
+    jpeg_set_quality(&cinfo, 50, true);
+    cinfo.dct_method = JDCT_IFAST;
+    jpeg_start_compress(&cinfo, true);
+
+    JSAMPROW row_pointer[1];
+    while (cinfo.next_scanline < cinfo.image_height) {
+      row_pointer[0] = &s->bufs[idx][cinfo.next_scanline * s->width * 3];
+      jpeg_write_scanlines(&cinfo, row_pointer, 1);
+    }
+    jpeg_finish_compress(&cinfo);
+
+    pthread_mutex_lock(&s->lock);
+    s->encoding_idx = -1;
+    pthread_mutex_unlock(&s->lock);
+
+    thumbnail_send(s, &frame_data, thumbnail_buffer, thumbnail_len);
+    free(thumbnail_buffer);
+  }
+
+  jpeg_destroy_compress(&cinfo);
+
+  return NULL;
+}
+
+void thumbnail_stop(ThumbnailState *s) {
+  pthread_mutex_lock(&s->lock);
+  s->stopped = true;
+  pthread_cond_signal(&s->cv);
+  pthread_mutex_unlock(&s->lock);
+}
+
+void thumbnail_free(ThumbnailState *s) {
+  for (int i = 0; i < 2; i++) {
+    free(s->bufs[i]);
+  }
+  pthread_mutex_destroy(&s->lock);
+  pthread_cond_destroy(&s->cv);
+}
@@ -0,0 +1,41 @@
+#ifndef THUMBNAIL_H
+#define THUMBNAIL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <pthread.h>
+
+#include "cameras/camera_common.h"
+
+// Thumbnails are downscaled on the processing thread and handed to a low
+// priority worker through a single "latest frame" slot, so the jpeg
+// compression never runs on the model path. If the worker is still busy
+// the older pending frame is simply replaced.
+typedef struct ThumbnailState {
+  int width, height;
+
+  pthread_mutex_t lock;
+  pthread_cond_t cv;
+  bool stopped;
+
+  // two buffers: one can be encoding while the other is being filled
+  uint8_t *bufs[2];
+  FrameMetadata metas[2];
+  int pending_idx;
+  int encoding_idx;
+
+  void *sock_raw;
+} ThumbnailState;
+
+void thumbnail_init(ThumbnailState *s, int rgb_width, int rgb_height, void *sock_raw);
+
+// 2x2 box downscale of the bgr frame into the free slot and wake the worker
+void thumbnail_push(ThumbnailState *s, const uint8_t *bgr_ptr, int rgb_stride,
+                    const FrameMetadata *frame_data);
+
+void* thumbnail_thread(void *arg);
+
+void thumbnail_stop(ThumbnailState *s);
+void thumbnail_free(ThumbnailState *s);
+
+#endif
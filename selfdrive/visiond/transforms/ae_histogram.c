@@ -0,0 +1,122 @@
+#include <string.h>
+#include <assert.h>
+
+#include "clutil.h"
+
+#include "ae_histogram.h"
+
+#define AE_GROUPS_PER_CU 4
+
+void ae_histogram_init(AEHistogramState* s, cl_context ctx, cl_device_id device_id, int channels) {
+  int err = 0;
+  memset(s, 0, sizeof(*s));
+  assert(channels == 1 || channels == 3);
+  s->channels = channels;
+
+  char args[1024];
+  snprintf(args, sizeof(args),
+           "-cl-fast-relaxed-math -cl-denorms-are-zero "
+           "-DCHANNELS=%d",
+           channels);
+  cl_program prg = CLU_LOAD_FROM_FILE(ctx, device_id, "transforms/ae_histogram.cl", args);
+
+  s->krnl = clCreateKernel(prg, "ae_histogram", &err);
+  assert(err == 0);
+  // done with this
+  err = clReleaseProgram(prg);
+  assert(err == 0);
+
+  s->hist_cl = clCreateBuffer(ctx, CL_MEM_READ_WRITE, AE_HISTOGRAM_BINS * sizeof(uint32_t), NULL, &err);
+  assert(err == 0);
+
+  // one bin per work item if the device allows it, a few groups per compute unit
+  size_t max_local_size = 0;
+  err = clGetKernelWorkGroupInfo(s->krnl, device_id, CL_KERNEL_WORK_GROUP_SIZE,
+                                 sizeof(max_local_size), &max_local_size, NULL);
+  assert(err == 0);
+  cl_uint compute_units = 0;
+  err = clGetDeviceInfo(device_id, CL_DEVICE_MAX_COMPUTE_UNITS,
+                        sizeof(compute_units), &compute_units, NULL);
+  assert(err == 0);
+
+  s->local_work_size = max_local_size < AE_HISTOGRAM_BINS ? max_local_size : AE_HISTOGRAM_BINS;
+  s->work_size = s->local_work_size * AE_GROUPS_PER_CU * (compute_units > 0 ? compute_units : 1);
+}
+
+void ae_histogram_destroy(AEHistogramState* s) {
+  int err = 0;
+  err = clReleaseKernel(s->krnl);
+  assert(err == 0);
+  err = clReleaseMemObject(s->hist_cl);
+  assert(err == 0);
+}
+
+void ae_histogram_queue(AEHistogramState* s, cl_command_queue q,
+                        cl_mem img_cl, int stride, AERegion region,
+                        uint32_t hist[AE_HISTOGRAM_BINS]) {
+  int err = 0;
+  const cl_uint zero = 0;
+  err = clEnqueueFillBuffer(q, s->hist_cl, &zero, sizeof(zero), 0,
+                            AE_HISTOGRAM_BINS * sizeof(uint32_t), 0, NULL, NULL);
+  assert(err == 0);
+
+  const cl_int cols = (region.width + region.x_step - 1) / region.x_step;
+  err = clSetKernelArg(s->krnl, 0, sizeof(cl_mem), &img_cl);
+  assert(err == 0);
+  err = clSetKernelArg(s->krnl, 1, sizeof(cl_int), &stride);
+  assert(err == 0);
+  err = clSetKernelArg(s->krnl, 2, sizeof(cl_int), &region.x);
+  assert(err == 0);
+  err = clSetKernelArg(s->krnl, 3, sizeof(cl_int), &region.y);
+  assert(err == 0);
+  err = clSetKernelArg(s->krnl, 4, sizeof(cl_int), &cols);
+  assert(err == 0);
+  err = clSetKernelArg(s->krnl, 5, sizeof(cl_int), &region.height);
+  assert(err == 0);
+  err = clSetKernelArg(s->krnl, 6, sizeof(cl_int), &region.x_step);
+  assert(err == 0);
+  err = clSetKernelArg(s->krnl, 7, sizeof(cl_mem), &s->hist_cl);
+  assert(err == 0);
+
+  err = clEnqueueNDRangeKernel(q, s->krnl, 1, NULL,
+                               &s->work_size, &s->local_work_size, 0, 0, NULL);
+  assert(err == 0);
+
+  // only the 1kb histogram comes back, not the frame
+  err = clEnqueueReadBuffer(q, s->hist_cl, CL_TRUE, 0,
+                            AE_HISTOGRAM_BINS * sizeof(uint32_t), hist, 0, NULL, NULL);
+  assert(err == 0);
+}
+
+void ae_histogram_cpu(const uint8_t* img, int stride, int channels, AERegion region,
+                      uint32_t hist[AE_HISTOGRAM_BINS]) {
+  memset(hist, 0, AE_HISTOGRAM_BINS * sizeof(uint32_t));
+  for (int y = region.y; y < region.y + region.height; y++) {
+    for (int x = region.x; x < region.x + region.width; x += region.x_step) {
+      const uint8_t* pix = &img[y * stride + x * channels];
+      if (channels == 3) {
+        unsigned int lum = (unsigned int)pix[0] + pix[1] + pix[2];
+        lum /= 3;
+        hist[lum < 255 ? lum : 255]++;
+      } else {
+        hist[pix[0]]++;
+      }
+    }
+  }
+}
+
+unsigned int ae_region_count(AERegion region) {
+  return region.height * ((region.width + region.x_step - 1) / region.x_step);
+}
+
+int ae_histogram_median(const uint32_t hist[AE_HISTOGRAM_BINS], unsigned int total) {
+  unsigned int lum_cur = 0;
+  int lum_med = 0;
+  for (lum_med = 0; lum_med < AE_HISTOGRAM_BINS; lum_med++) {
+    lum_cur += hist[lum_med];
+    if (lum_cur >= total / 2) {
+      break;
+    }
+  }
+  return lum_med;
+}
@@ -0,0 +1,46 @@
+// Luminance histogram over a metering region, for auto exposure.
+// Every work group bins into local memory and merges into the global
+// histogram once at the end, so global atomics are 256 per group.
+
+#define HIST_BINS 256
+
+inline uint pixel_lum(__global const uchar *img, int offset) {
+#if CHANNELS == 3
+  // bgr, same as the average the cpu path used
+  const uint lum = (uint)img[offset] + img[offset + 1] + img[offset + 2];
+  return min(lum / 3, 255u);
+#else
+  return img[offset];
+#endif
+}
+
+__kernel void ae_histogram(__global const uchar *img,
+                           int stride,
+                           int x_start, int y_start,
+                           int cols, int rows, int x_step,
+                           __global uint *hist)
+{
+  __local uint local_hist[HIST_BINS];
+
+  const int lid = get_local_id(0);
+  for (int i = lid; i < HIST_BINS; i += get_local_size(0)) {
+    local_hist[i] = 0;
+  }
+  barrier(CLK_LOCAL_MEM_FENCE);
+
+  // grid stride loop over the (possibly column subsampled) region
+  const int total = cols * rows;
+  for (int p = get_global_id(0); p < total; p += get_global_size(0)) {
+    const int y = y_start + p / cols;
+    const int x = x_start + (p % cols) * x_step;
+    atomic_inc(&local_hist[pixel_lum(img, y * stride + x * CHANNELS)]);
+  }
+  barrier(CLK_LOCAL_MEM_FENCE);
+
+  for (int i = lid; i < HIST_BINS; i += get_local_size(0)) {
+    const uint c = local_hist[i];
+    if (c != 0) {
+      atomic_add(&hist[i], c);
+    }
+  }
+}
@@ -0,0 +1,57 @@
+#ifndef AE_HISTOGRAM_H
+#define AE_HISTOGRAM_H
+
+#include <inttypes.h>
+#include <stdbool.h>
+
+#ifdef __APPLE__
+#include <OpenCL/cl.h>
+#else
+#include <CL/cl.h>
+#endif
+
+#define AE_HISTOGRAM_BINS 256
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// metering region in pixels, only every x_step'th column is sampled
+typedef struct {
+  int x, y;
+  int width, height;
+  int x_step;
+} AERegion;
+
+typedef struct {
+  int channels;
+  cl_kernel krnl;
+  cl_mem hist_cl;
+  size_t work_size, local_work_size;
+} AEHistogramState;
+
+// channels is 1 for a Y plane or 3 for a bgr image
+void ae_histogram_init(AEHistogramState* s, cl_context ctx, cl_device_id device_id, int channels);
+
+void ae_histogram_destroy(AEHistogramState* s);
+
+// bins the region of img_cl on the device and reads the histogram back into hist
+void ae_histogram_queue(AEHistogramState* s, cl_command_queue q,
+                        cl_mem img_cl, int stride, AERegion region,
+                        uint32_t hist[AE_HISTOGRAM_BINS]);
+
+// reference implementation, the device histogram must match it exactly
+void ae_histogram_cpu(const uint8_t* img, int stride, int channels, AERegion region,
+                      uint32_t hist[AE_HISTOGRAM_BINS]);
+
+// number of pixels binned for a region
+unsigned int ae_region_count(AERegion region);
+
+// first bin at which half of the samples are covered
+int ae_histogram_median(const uint32_t hist[AE_HISTOGRAM_BINS], unsigned int total);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // AE_HISTOGRAM_H
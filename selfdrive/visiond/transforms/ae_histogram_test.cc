@@ -0,0 +1,113 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <cassert>
+
+#include <CL/cl.h>
+
+#include "clutil.h"
+#include "ae_histogram.h"
+
+// Checks the device histogram against the cpu reference bit for bit.
+// Runs on any OpenCL 1.2 device, e.g. POCL on a headless box.
+
+void cl_init(cl_device_id &device_id, cl_context &context) {
+  int err;
+  cl_platform_id platform_id = NULL;
+  cl_uint num_devices;
+  cl_uint num_platforms;
+
+  err = clGetPlatformIDs(1, &platform_id, &num_platforms);
+  err = clGetDeviceIDs(platform_id, CL_DEVICE_TYPE_DEFAULT, 1,
+                       &device_id, &num_devices);
+  cl_print_info(platform_id, device_id);
+  context = clCreateContext(NULL, 1, &device_id, NULL, NULL, &err);
+}
+
+static AERegion random_region(int width, int height) {
+  AERegion r;
+  r.x = rand() % (width - 1);
+  r.y = rand() % (height - 1);
+  r.width = 1 + rand() % (width - r.x);
+  r.height = 1 + rand() % (height - r.y);
+  r.x_step = 1 + rand() % 3;
+  return r;
+}
+
+static int run_channels(cl_context context, cl_device_id device_id, cl_command_queue q,
+                        int channels, int width, int height) {
+  int err;
+  const int stride = width * channels;
+  const size_t size = stride * height;
+
+  AEHistogramState ae;
+  ae_histogram_init(&ae, context, device_id, channels);
+
+  uint8_t *img = new uint8_t[size];
+  cl_mem img_cl = clCreateBuffer(context, CL_MEM_READ_ONLY, size, NULL, &err);
+  assert(err == 0);
+
+  int mismatched = 0;
+  for (int i = 0; i < 50; i++) {
+    // mix in flat images so single bins get hammered by the atomics
+    const bool flat = (i % 10) == 0;
+    const uint8_t flat_val = rand();
+    for (size_t j = 0; j < size; j++) {
+      img[j] = flat ? flat_val : (uint8_t)rand();
+    }
+    clEnqueueWriteBuffer(q, img_cl, CL_TRUE, 0, size, img, 0, NULL, NULL);
+
+    // the visiond regions first, then random ones
+    AERegion region = random_region(width, height);
+    if (i == 0) {
+      region = channels == 1 ? (AERegion){290, 282 + 40, 560, 314, 1}
+                             : (AERegion){width * 2 / 3, height / 3, width - width * 2 / 3, height - height / 3, 2};
+    }
+
+    uint32_t cpu_hist[AE_HISTOGRAM_BINS], cl_hist[AE_HISTOGRAM_BINS];
+    ae_histogram_cpu(img, stride, channels, region, cpu_hist);
+    ae_histogram_queue(&ae, q, img_cl, stride, region, cl_hist);
+
+    uint64_t total = 0;
+    for (int b = 0; b < AE_HISTOGRAM_BINS; b++) total += cl_hist[b];
+
+    if (memcmp(cpu_hist, cl_hist, sizeof(cpu_hist)) != 0 || total != ae_region_count(region)) {
+      printf("mismatch channels %d region %d,%d %dx%d step %d\n", channels,
+             region.x, region.y, region.width, region.height, region.x_step);
+      mismatched++;
+    } else if (ae_histogram_median(cpu_hist, ae_region_count(region)) !=
+               ae_histogram_median(cl_hist, ae_region_count(region))) {
+      mismatched++;
+    }
+  }
+  printf("channels %d: Matched: %d, Mismatched: %d\n", channels, 50 - mismatched, mismatched);
+
+  clReleaseMemObject(img_cl);
+  delete[] img;
+  ae_histogram_destroy(&ae);
+  return mismatched;
+}
+
+int main(int argc, char** argv) {
+  srand(1337);
+
+  clu_init();
+  cl_device_id device_id;
+  cl_context context;
+  cl_init(device_id, context);
+
+  int err;
+  cl_command_queue q = clCreateCommandQueue(context, device_id, 0, &err);
+  assert(err == 0);
+
+  int mismatched = 0;
+  // rear Y plane and front bgr sizes
+  mismatched += run_channels(context, device_id, q, 1, 1164, 874);
+  mismatched += run_channels(context, device_id, q, 3, 816, 612);
+
+  clReleaseCommandQueue(q);
+  clReleaseContext(context);
+
+  return mismatched == 0 ? 0 : -1;
+}
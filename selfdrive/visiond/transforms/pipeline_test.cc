@@ -0,0 +1,263 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <cassert>
+#include <cmath>
+
+#include <CL/cl.h>
+
+#include "common/util.h"
+#include "clutil.h"
+#include "rgb_to_yuv.h"
+#include "transform.h"
+#include "loadyuv.h"
+
+// Compares the fused camera pipeline (debayer10_yuv + warpPerspectiveLoad)
+// against the multi kernel chain visiond runs by default
+// (debayer10 -> rgb_to_yuv -> warpPerspective -> loadys/loaduv),
+// and reports per stage device time from the profiling events.
+
+// imx298, non HDR
+#define FRAME_WIDTH 2328
+#define FRAME_HEIGHT 1748
+#define FRAME_STRIDE 2912
+#define BAYER_FLIP 0
+
+#define RGB_WIDTH (FRAME_WIDTH / 2)
+#define RGB_HEIGHT (FRAME_HEIGHT / 2)
+#define RGB_STRIDE (RGB_WIDTH * 3)
+
+#define MODEL_WIDTH 320
+#define MODEL_HEIGHT 160
+
+// the kernels are built with -cl-fast-relaxed-math, allow off by one
+#define MAXE 1
+
+#define ITERS 20
+
+void cl_init(cl_device_id &device_id, cl_context &context) {
+  int err;
+  cl_platform_id platform_id = NULL;
+  cl_uint num_devices;
+  cl_uint num_platforms;
+
+  err = clGetPlatformIDs(1, &platform_id, &num_platforms);
+  err = clGetDeviceIDs(platform_id, CL_DEVICE_TYPE_DEFAULT, 1,
+                       &device_id, &num_devices);
+  cl_print_info(platform_id, device_id);
+  context = clCreateContext(NULL, 1, &device_id, NULL, NULL, &err);
+}
+
+struct StageTimer {
+  cl_command_queue q;
+  cl_event start;
+
+  void begin() {
+    int err = clEnqueueMarkerWithWaitList(q, 0, NULL, &start);
+    assert(err == 0);
+  }
+
+  // device time between the two markers
+  double end() {
+    cl_event stop;
+    int err = clEnqueueMarkerWithWaitList(q, 0, NULL, &stop);
+    assert(err == 0);
+    clWaitForEvents(1, &stop);
+    cl_ulong t_start = 0, t_end = 0;
+    clGetEventProfilingInfo(start, CL_PROFILING_COMMAND_END, sizeof(t_start), &t_start, NULL);
+    clGetEventProfilingInfo(stop, CL_PROFILING_COMMAND_START, sizeof(t_end), &t_end, NULL);
+    clReleaseEvent(start);
+    clReleaseEvent(stop);
+    return (t_end - t_start) * 1e-6;
+  }
+};
+
+static int max_error_u8(const uint8_t *a, const uint8_t *b, size_t len) {
+  int max_e = 0;
+  for (size_t i = 0; i < len; i++) {
+    int e = std::abs((int)a[i] - (int)b[i]);
+    if (e > max_e) max_e = e;
+  }
+  return max_e;
+}
+
+static float max_error_f(const float *a, const float *b, size_t len) {
+  float max_e = 0;
+  for (size_t i = 0; i < len; i++) {
+    float e = fabsf(a[i] - b[i]);
+    if (e > max_e) max_e = e;
+  }
+  return max_e;
+}
+
+static void read_buffer(cl_command_queue q, cl_mem buf, size_t size, void *dst) {
+  int err = clEnqueueReadBuffer(q, buf, CL_TRUE, 0, size, dst, 0, NULL, NULL);
+  assert(err == 0);
+}
+
+int main(int argc, char** argv) {
+  srand(1337);
+
+  clu_init();
+  cl_device_id device_id;
+  cl_context context;
+  cl_init(device_id, context);
+
+  int err;
+  cl_command_queue q = clCreateCommandQueue(context, device_id, CL_QUEUE_PROFILING_ENABLE, &err);
+  assert(err == 0);
+
+  char args[4096];
+  snprintf(args, sizeof(args),
+           "-cl-fast-relaxed-math -cl-denorms-are-zero "
+           "-DFRAME_WIDTH=%d -DFRAME_HEIGHT=%d -DFRAME_STRIDE=%d "
+           "-DRGB_WIDTH=%d -DRGB_HEIGHT=%d -DRGB_STRIDE=%d "
+           "-DBAYER_FLIP=%d -DHDR=%d",
+           FRAME_WIDTH, FRAME_HEIGHT, FRAME_STRIDE,
+           RGB_WIDTH, RGB_HEIGHT, RGB_STRIDE,
+           BAYER_FLIP, 0);
+  cl_program prg_debayer = CLU_LOAD_FROM_FILE(context, device_id, "cameras/debayer.cl", args);
+  cl_kernel krnl_debayer = clCreateKernel(prg_debayer, "debayer10", &err);
+  assert(err == 0);
+  cl_kernel krnl_debayer_yuv = clCreateKernel(prg_debayer, "debayer10_yuv", &err);
+  assert(err == 0);
+
+  RGBToYUVState rgb_to_yuv;
+  rgb_to_yuv_init(&rgb_to_yuv, context, device_id, RGB_WIDTH, RGB_HEIGHT, RGB_STRIDE);
+  Transform transform;
+  transform_init(&transform, context, device_id);
+  LoadYUVState loadyuv;
+  loadyuv_init(&loadyuv, context, device_id, MODEL_WIDTH, MODEL_HEIGHT);
+
+  const size_t frame_size = FRAME_STRIDE * FRAME_HEIGHT;
+  const size_t rgb_size = RGB_STRIDE * RGB_HEIGHT;
+  const size_t yuv_size = RGB_WIDTH * RGB_HEIGHT * 3 / 2;
+  const size_t net_input_size = MODEL_WIDTH * MODEL_HEIGHT * 3 / 2 * sizeof(float);
+  const size_t uv_out_size = (MODEL_WIDTH / 2) * (MODEL_HEIGHT / 2);
+
+  cl_mem frame_cl = clCreateBuffer(context, CL_MEM_READ_ONLY, frame_size, NULL, &err);
+  cl_mem rgb_cl[2], yuv_cl[2], net_input_cl[2];
+  for (int i = 0; i < 2; i++) {
+    rgb_cl[i] = clCreateBuffer(context, CL_MEM_READ_WRITE, rgb_size, NULL, &err);
+    yuv_cl[i] = clCreateBuffer(context, CL_MEM_READ_WRITE, yuv_size, NULL, &err);
+    net_input_cl[i] = clCreateBuffer(context, CL_MEM_READ_WRITE, net_input_size, NULL, &err);
+  }
+  cl_mem transformed_y_cl = clCreateBuffer(context, CL_MEM_READ_WRITE, MODEL_WIDTH * MODEL_HEIGHT, NULL, &err);
+  cl_mem transformed_u_cl = clCreateBuffer(context, CL_MEM_READ_WRITE, uv_out_size, NULL, &err);
+  cl_mem transformed_v_cl = clCreateBuffer(context, CL_MEM_READ_WRITE, uv_out_size, NULL, &err);
+
+  uint8_t *frame = new uint8_t[frame_size];
+  uint8_t *rgb[2] = {new uint8_t[rgb_size], new uint8_t[rgb_size]};
+  uint8_t *yuv[2] = {new uint8_t[yuv_size], new uint8_t[yuv_size]};
+  float *net_input[2] = {new float[net_input_size / sizeof(float)], new float[net_input_size / sizeof(float)]};
+
+  StageTimer timer = {q};
+  double t_debayer = 0, t_rgb_to_yuv = 0, t_transform = 0, t_loadyuv = 0;
+  double t_fused_yuv = 0, t_fused_load = 0;
+  int mismatched = 0;
+
+  for (int i = 0; i < ITERS; i++) {
+    for (size_t j = 0; j < frame_size; j++) {
+      frame[j] = (uint8_t)rand();
+    }
+    clEnqueueWriteBuffer(q, frame_cl, CL_TRUE, 0, frame_size, frame, 0, NULL, NULL);
+
+    // model frame roughly centered in the road camera, with some perspective
+    const float scale = 2.0f + (rand() % 100) / 100.0f;
+    mat3 projection = {{
+      scale, 0.05f * (rand() % 3 - 1), 240.0f + rand() % 50,
+      0.0f, scale, 250.0f + rand() % 50,
+      0.0f, 0.0001f * (rand() % 5), 1.0f,
+    }};
+    const float digital_gain = 1.0f + (rand() % 4) * 0.25f;
+
+    // multi kernel chain
+    timer.begin();
+    clSetKernelArg(krnl_debayer, 0, sizeof(cl_mem), &frame_cl);
+    clSetKernelArg(krnl_debayer, 1, sizeof(cl_mem), &rgb_cl[0]);
+    clSetKernelArg(krnl_debayer, 2, sizeof(float), &digital_gain);
+    const size_t debayer_work_size = RGB_HEIGHT;
+    err = clEnqueueNDRangeKernel(q, krnl_debayer, 1, NULL, &debayer_work_size, NULL, 0, 0, NULL);
+    assert(err == 0);
+    t_debayer += timer.end();
+
+    timer.begin();
+    rgb_to_yuv_queue(&rgb_to_yuv, q, rgb_cl[0], yuv_cl[0]);
+    t_rgb_to_yuv += timer.end();
+
+    timer.begin();
+    transform_queue(&transform, q, yuv_cl[0], RGB_WIDTH, RGB_HEIGHT,
+                    transformed_y_cl, transformed_u_cl, transformed_v_cl,
+                    MODEL_WIDTH, MODEL_HEIGHT, projection);
+    t_transform += timer.end();
+
+    timer.begin();
+    loadyuv_queue(&loadyuv, q, transformed_y_cl, transformed_u_cl, transformed_v_cl, net_input_cl[0]);
+    t_loadyuv += timer.end();
+
+    // fused
+    timer.begin();
+    clSetKernelArg(krnl_debayer_yuv, 0, sizeof(cl_mem), &frame_cl);
+    clSetKernelArg(krnl_debayer_yuv, 1, sizeof(cl_mem), &rgb_cl[1]);
+    clSetKernelArg(krnl_debayer_yuv, 2, sizeof(cl_mem), &yuv_cl[1]);
+    clSetKernelArg(krnl_debayer_yuv, 3, sizeof(float), &digital_gain);
+    const size_t fused_work_size[2] = {ALIGN(RGB_WIDTH, 16), ALIGN(RGB_HEIGHT, 8)};
+    const size_t fused_local_work_size[2] = {16, 8};
+    err = clEnqueueNDRangeKernel(q, krnl_debayer_yuv, 2, NULL, fused_work_size, fused_local_work_size, 0, 0, NULL);
+    assert(err == 0);
+    t_fused_yuv += timer.end();
+
+    // warp the chain's yuv, so the second stage is checked on identical input
+    timer.begin();
+    transform_load_queue(&transform, q, yuv_cl[0], RGB_WIDTH, RGB_HEIGHT,
+                         net_input_cl[1], MODEL_WIDTH, MODEL_HEIGHT, projection);
+    t_fused_load += timer.end();
+
+    for (int k = 0; k < 2; k++) {
+      read_buffer(q, rgb_cl[k], rgb_size, rgb[k]);
+      read_buffer(q, yuv_cl[k], yuv_size, yuv[k]);
+      read_buffer(q, net_input_cl[k], net_input_size, net_input[k]);
+    }
+
+    const int rgb_e = max_error_u8(rgb[0], rgb[1], rgb_size);
+    const int yuv_e = max_error_u8(yuv[0], yuv[1], yuv_size);
+    const float net_e = max_error_f(net_input[0], net_input[1], net_input_size / sizeof(float));
+    if (rgb_e > MAXE || yuv_e > MAXE || net_e != 0.0f) {
+      printf("frame %d: max error rgb %d, yuv %d, net input %f\n", i, rgb_e, yuv_e, net_e);
+      mismatched++;
+    }
+  }
+
+  printf("Matched: %d, Mismatched: %d\n", ITERS - mismatched, mismatched);
+  printf("chain: debayer %.3fms, rgb_to_yuv %.3fms, transform %.3fms, loadyuv %.3fms | total %.3fms\n",
+         t_debayer / ITERS, t_rgb_to_yuv / ITERS, t_transform / ITERS, t_loadyuv / ITERS,
+         (t_debayer + t_rgb_to_yuv + t_transform + t_loadyuv) / ITERS);
+  printf("fused: debayer_yuv %.3fms, transform_load %.3fms | total %.3fms\n",
+         t_fused_yuv / ITERS, t_fused_load / ITERS, (t_fused_yuv + t_fused_load) / ITERS);
+
+  for (int k = 0; k < 2; k++) {
+    delete[] rgb[k];
+    delete[] yuv[k];
+    delete[] net_input[k];
+    clReleaseMemObject(rgb_cl[k]);
+    clReleaseMemObject(yuv_cl[k]);
+    clReleaseMemObject(net_input_cl[k]);
+  }
+  delete[] frame;
+  clReleaseMemObject(frame_cl);
+  clReleaseMemObject(transformed_y_cl);
+  clReleaseMemObject(transformed_u_cl);
+  clReleaseMemObject(transformed_v_cl);
+
+  loadyuv_destroy(&loadyuv);
+  transform_destroy(&transform);
+  rgb_to_yuv_destroy(&rgb_to_yuv);
+  clReleaseKernel(krnl_debayer);
+  clReleaseKernel(krnl_debayer_yuv);
+  clReleaseProgram(prg_debayer);
+  clReleaseCommandQueue(q);
+  clReleaseContext(context);
+
+  return mismatched == 0 ? 0 : -1;
+}
@@ -13,6 +13,8 @@ void transform_init(Transform* s, cl_context ctx, cl_device_id device_id) {
 
   s->krnl = clCreateKernel(prg, "warpPerspective", &err);
   assert(err == 0);
+  s->load_krnl = clCreateKernel(prg, "warpPerspectiveLoad", &err);
+  assert(err == 0);
 
   // done with this
   err = clReleaseProgram(prg);
@@ -35,6 +37,8 @@ void transform_destroy(Transform* s) {
 
   err = clReleaseKernel(s->krnl);
   assert(err == 0);
+  err = clReleaseKernel(s->load_krnl);
+  assert(err == 0);
 }
 
 void transform_queue(Transform* s,
@@ -147,3 +151,42 @@ void transform_queue(Transform* s,
                               (const size_t*)&work_size_uv, NULL, 0, 0, NULL);
   assert(err == 0);
 }
+
+void transform_load_queue(Transform* s,
+                          cl_command_queue q,
+                          cl_mem in_yuv, int in_width, int in_height,
+                          cl_mem out, int out_width, int out_height,
+                          mat3 projection) {
+  int err = 0;
+
+  mat3 projection_y = projection;
+  mat3 projection_uv = transform_scale_buffer(projection, 0.5);
+
+  err = clEnqueueWriteBuffer(q, s->m_y_cl, CL_TRUE, 0, 3*3*sizeof(float), (void*)projection_y.v, 0, NULL, NULL);
+  assert(err == 0);
+  err = clEnqueueWriteBuffer(q, s->m_uv_cl, CL_TRUE, 0, 3*3*sizeof(float), (void*)projection_uv.v, 0, NULL, NULL);
+  assert(err == 0);
+
+  err = clSetKernelArg(s->load_krnl, 0, sizeof(cl_mem), &in_yuv);
+  assert(err == 0);
+  err = clSetKernelArg(s->load_krnl, 1, sizeof(cl_int), &in_width);
+  assert(err == 0);
+  err = clSetKernelArg(s->load_krnl, 2, sizeof(cl_int), &in_height);
+  assert(err == 0);
+  err = clSetKernelArg(s->load_krnl, 3, sizeof(cl_mem), &out);
+  assert(err == 0);
+  err = clSetKernelArg(s->load_krnl, 4, sizeof(cl_int), &out_width);
+  assert(err == 0);
+  err = clSetKernelArg(s->load_krnl, 5, sizeof(cl_int), &out_height);
+  assert(err == 0);
+  err = clSetKernelArg(s->load_krnl, 6, sizeof(cl_mem), &s->m_y_cl);
+  assert(err == 0);
+  err = clSetKernelArg(s->load_krnl, 7, sizeof(cl_mem), &s->m_uv_cl);
+  assert(err == 0);
+
+  // one work item per uv pixel
+  const size_t work_size[2] = {out_width/2, out_height/2};
+  err = clEnqueueNDRangeKernel(q, s->load_krnl, 2, NULL,
+                              (const size_t*)&work_size, NULL, 0, 0, NULL);
+  assert(err == 0);
+}
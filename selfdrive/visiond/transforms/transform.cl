@@ -5,6 +5,43 @@
 #define INTER_REMAP_COEF_BITS 15
 #define INTER_REMAP_COEF_SCALE (1 << INTER_REMAP_COEF_BITS)
 
+inline uchar warp_sample(__global const uchar * src,
+                         int src_step, int src_offset, int src_rows, int src_cols,
+                         __constant float * M, int dx, int dy)
+{
+    float X0 = M[0] * dx + M[1] * dy + M[2];
+    float Y0 = M[3] * dx + M[4] * dy + M[5];
+    float W = M[6] * dx + M[7] * dy + M[8];
+    W = W != 0.0f ? INTER_TAB_SIZE / W : 0.0f;
+    int X = rint(X0 * W), Y = rint(Y0 * W);
+
+    short sx = convert_short_sat(X >> INTER_BITS);
+    short sy = convert_short_sat(Y >> INTER_BITS);
+    short ay = (short)(Y & (INTER_TAB_SIZE - 1));
+    short ax = (short)(X & (INTER_TAB_SIZE - 1));
+
+    int v0 = (sx >= 0 && sx < src_cols && sy >= 0 && sy < src_rows) ?
+        convert_int(src[mad24(sy, src_step, src_offset + sx)]) : 0;
+    int v1 = (sx+1 >= 0 && sx+1 < src_cols && sy >= 0 && sy < src_rows) ?
+        convert_int(src[mad24(sy, src_step, src_offset + (sx+1))]) : 0;
+    int v2 = (sx >= 0 && sx < src_cols && sy+1 >= 0 && sy+1 < src_rows) ?
+        convert_int(src[mad24(sy+1, src_step, src_offset + sx)]) : 0;
+    int v3 = (sx+1 >= 0 && sx+1 < src_cols && sy+1 >= 0 && sy+1 < src_rows) ?
+        convert_int(src[mad24(sy+1, src_step, src_offset + (sx+1))]) : 0;
+
+    float taby = 1.f/INTER_TAB_SIZE*ay;
+    float tabx = 1.f/INTER_TAB_SIZE*ax;
+
+    int itab0 = convert_short_sat_rte( (1.0f-taby)*(1.0f-tabx) * INTER_REMAP_COEF_SCALE );
+    int itab1 = convert_short_sat_rte( (1.0f-taby)*tabx * INTER_REMAP_COEF_SCALE );
+    int itab2 = convert_short_sat_rte( taby*(1.0f-tabx) * INTER_REMAP_COEF_SCALE );
+    int itab3 = convert_short_sat_rte( taby*tabx * INTER_REMAP_COEF_SCALE );
+
+    int val = v0 * itab0 +  v1 * itab1 + v2 * itab2 + v3 * itab3;
+
+    return convert_uchar_sat((val + (1 << (INTER_REMAP_COEF_BITS-1))) >> INTER_REMAP_COEF_BITS);
+}
+
 __kernel void warpPerspective(__global const uchar * src,
                               int src_step, int src_offset, int src_rows, int src_cols,
                               __global uchar * dst,
@@ -16,39 +53,47 @@ __kernel void warpPerspective(__global const uchar * src,
 
     if (dx < dst_cols && dy < dst_rows)
     {
-        float X0 = M[0] * dx + M[1] * dy + M[2];
-        float Y0 = M[3] * dx + M[4] * dy + M[5];
-        float W = M[6] * dx + M[7] * dy + M[8];
-        W = W != 0.0f ? INTER_TAB_SIZE / W : 0.0f;
-        int X = rint(X0 * W), Y = rint(Y0 * W);
-
-        short sx = convert_short_sat(X >> INTER_BITS);
-        short sy = convert_short_sat(Y >> INTER_BITS);
-        short ay = (short)(Y & (INTER_TAB_SIZE - 1));
-        short ax = (short)(X & (INTER_TAB_SIZE - 1));
-
-        int v0 = (sx >= 0 && sx < src_cols && sy >= 0 && sy < src_rows) ?
-            convert_int(src[mad24(sy, src_step, src_offset + sx)]) : 0;
-        int v1 = (sx+1 >= 0 && sx+1 < src_cols && sy >= 0 && sy < src_rows) ?
-            convert_int(src[mad24(sy, src_step, src_offset + (sx+1))]) : 0;
-        int v2 = (sx >= 0 && sx < src_cols && sy+1 >= 0 && sy+1 < src_rows) ?
-            convert_int(src[mad24(sy+1, src_step, src_offset + sx)]) : 0;
-        int v3 = (sx+1 >= 0 && sx+1 < src_cols && sy+1 >= 0 && sy+1 < src_rows) ?
-            convert_int(src[mad24(sy+1, src_step, src_offset + (sx+1))]) : 0;
-
-        float taby = 1.f/INTER_TAB_SIZE*ay;
-        float tabx = 1.f/INTER_TAB_SIZE*ax;
-
         int dst_index = mad24(dy, dst_step, dst_offset + dx);
+        dst[dst_index] = warp_sample(src, src_step, src_offset, src_rows, src_cols, M, dx, dy);
+    }
+}
 
-        int itab0 = convert_short_sat_rte( (1.0f-taby)*(1.0f-tabx) * INTER_REMAP_COEF_SCALE );
-        int itab1 = convert_short_sat_rte( (1.0f-taby)*tabx * INTER_REMAP_COEF_SCALE );
-        int itab2 = convert_short_sat_rte( taby*(1.0f-tabx) * INTER_REMAP_COEF_SCALE );
-        int itab3 = convert_short_sat_rte( taby*tabx * INTER_REMAP_COEF_SCALE );
+// warpPerspective of all three planes fused with loadys/loaduv.
+// One work item per 2x2 output luma block, writes the normalized floats
+// straight into the net input layout: 4 subsampled Y planes, U, V.
+__kernel void warpPerspectiveLoad(__global const uchar * src,
+                                  int src_cols, int src_rows,
+                                  __global float * out,
+                                  int dst_cols, int dst_rows,
+                                  __constant float * M_y,
+                                  __constant float * M_uv)
+{
+    const int x = get_global_id(0);
+    const int y = get_global_id(1);
+    const int uv_cols = dst_cols / 2;
+    const int uv_rows = dst_rows / 2;
+    if (x >= uv_cols || y >= uv_rows) return;
 
-        int val = v0 * itab0 +  v1 * itab1 + v2 * itab2 + v3 * itab3;
+    const int uv_size = uv_cols * uv_rows;
+    const int src_uv_cols = src_cols / 2;
+    const int src_uv_rows = src_rows / 2;
+    const int src_u_offset = src_cols * src_rows;
+    const int src_v_offset = src_u_offset + src_uv_cols * src_uv_rows;
+    const int oi = mad24(y, uv_cols, x);
 
-        uchar pix = convert_uchar_sat((val + (1 << (INTER_REMAP_COEF_BITS-1))) >> INTER_REMAP_COEF_BITS);
-        dst[dst_index] = pix;
+    // y = (x - 128) / 128
+    // 02
+    // 13
+    #pragma unroll
+    for (int i = 0; i < 4; i++) {
+        const int dx = x * 2 + (i >> 1);
+        const int dy = y * 2 + (i & 1);
+        const uchar v = warp_sample(src, src_cols, 0, src_rows, src_cols, M_y, dx, dy);
+        out[i * uv_size + oi] = (convert_float(v) - 128.f) * 0.0078125f;
     }
+
+    const uchar u = warp_sample(src, src_uv_cols, src_u_offset, src_uv_rows, src_uv_cols, M_uv, x, y);
+    const uchar v = warp_sample(src, src_uv_cols, src_v_offset, src_uv_rows, src_uv_cols, M_uv, x, y);
+    out[4 * uv_size + oi] = (convert_float(u) - 128.f) * 0.0078125f;
+    out[5 * uv_size + oi] = (convert_float(v) - 128.f) * 0.0078125f;
 }
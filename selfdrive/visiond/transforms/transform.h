@@ -18,6 +18,7 @@ extern "C" {
 
 typedef struct {
   cl_kernel krnl;
+  cl_kernel load_krnl;
   cl_mem m_y_cl, m_uv_cl;
 } Transform;
 
@@ -31,6 +32,12 @@ void transform_queue(Transform* s, cl_command_queue q,
                      int out_width, int out_height,
                      mat3 projection);
 
+// transform_queue and loadyuv_queue in a single pass, out is the float net input
+void transform_load_queue(Transform* s, cl_command_queue q,
+                          cl_mem yuv, int in_width, int in_height,
+                          cl_mem out, int out_width, int out_height,
+                          mat3 projection);
+
 #ifdef __cplusplus
 }
 #endif
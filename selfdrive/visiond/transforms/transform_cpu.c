@@ -0,0 +1,403 @@
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <assert.h>
+#include <pthread.h>
+
+#if (defined(__ARM_NEON) || defined(__ARM_NEON__)) && defined(__aarch64__)
+#include <arm_neon.h>
+#define TRANSFORM_NEON
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define TRANSFORM_SSE2
+#endif
+
+#include "transform_cpu.h"
+
+// same fixed point layout as transform.cl
+#define INTER_BITS 5
+#define INTER_TAB_SIZE (1 << INTER_BITS)
+
+#define INTER_REMAP_COEF_BITS 15
+#define INTER_REMAP_COEF_SCALE (1 << INTER_REMAP_COEF_BITS)
+
+// widest output row a single call handles, the driving model is 512 wide
+#define MAX_ROW_WIDTH 2048
+
+static inline int sat_short(int v) {
+  return v < -32768 ? -32768 : (v > 32767 ? 32767 : v);
+}
+
+static inline int sat_short_rte(float v) {
+  return sat_short((int)rintf(v));
+}
+
+// Sample position and bilinear weights of one output pixel. The scalar and
+// vector versions give the same bits only when every product is rounded on its
+// own, so this file is built with -ffp-contract=off (the pragma is for clang).
+// transform.cl may still contract into mads, see MAXE in transform_cpu_test.
+#pragma STDC FP_CONTRACT OFF
+static inline void warp_coord(const float *M, int dx, int dy,
+                              int *sx, int *sy, int itab[4]) {
+  const float fx = dx, fy = dy;
+  float X0 = M[0] * fx;
+  X0 += M[1] * fy;
+  X0 += M[2];
+  float Y0 = M[3] * fx;
+  Y0 += M[4] * fy;
+  Y0 += M[5];
+  float W = M[6] * fx;
+  W += M[7] * fy;
+  W += M[8];
+  W = W != 0.0f ? INTER_TAB_SIZE / W : 0.0f;
+  const int X = (int)rintf(X0 * W), Y = (int)rintf(Y0 * W);
+
+  *sx = sat_short(X >> INTER_BITS);
+  *sy = sat_short(Y >> INTER_BITS);
+  const float taby = 1.f/INTER_TAB_SIZE * (Y & (INTER_TAB_SIZE - 1));
+  const float tabx = 1.f/INTER_TAB_SIZE * (X & (INTER_TAB_SIZE - 1));
+
+  itab[0] = sat_short_rte((1.0f-taby)*(1.0f-tabx) * INTER_REMAP_COEF_SCALE);
+  itab[1] = sat_short_rte((1.0f-taby)*tabx * INTER_REMAP_COEF_SCALE);
+  itab[2] = sat_short_rte(taby*(1.0f-tabx) * INTER_REMAP_COEF_SCALE);
+  itab[3] = sat_short_rte(taby*tabx * INTER_REMAP_COEF_SCALE);
+}
+
+#if defined(TRANSFORM_SSE2)
+// 4 consecutive output pixels starting at dx, _mm_cvtps_epi32 rounds to
+// nearest even like rintf
+static inline void warp_coord4(const float *M, int dx, int dy,
+                               int sx[4], int sy[4], int itab[4][4]) {
+  const __m128 fx = _mm_add_ps(_mm_set1_ps((float)dx), _mm_set_ps(3.f, 2.f, 1.f, 0.f));
+  const float fy = dy;
+  __m128 X0 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(M[0]), fx), _mm_set1_ps(M[1] * fy)), _mm_set1_ps(M[2]));
+  __m128 Y0 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(M[3]), fx), _mm_set1_ps(M[4] * fy)), _mm_set1_ps(M[5]));
+  __m128 W = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(M[6]), fx), _mm_set1_ps(M[7] * fy)), _mm_set1_ps(M[8]));
+  const __m128 nonzero = _mm_cmpneq_ps(W, _mm_setzero_ps());
+  W = _mm_and_ps(_mm_div_ps(_mm_set1_ps((float)INTER_TAB_SIZE), W), nonzero);
+
+  const __m128i X = _mm_cvtps_epi32(_mm_mul_ps(X0, W));
+  const __m128i Y = _mm_cvtps_epi32(_mm_mul_ps(Y0, W));
+
+  // saturate to short and widen back
+  const __m128i sxy = _mm_packs_epi32(_mm_srai_epi32(X, INTER_BITS), _mm_srai_epi32(Y, INTER_BITS));
+  _mm_storeu_si128((__m128i*)sx, _mm_srai_epi32(_mm_unpacklo_epi16(sxy, sxy), 16));
+  _mm_storeu_si128((__m128i*)sy, _mm_srai_epi32(_mm_unpackhi_epi16(sxy, sxy), 16));
+
+  const __m128i mask = _mm_set1_epi32(INTER_TAB_SIZE - 1);
+  const __m128 inv = _mm_set1_ps(1.f/INTER_TAB_SIZE);
+  const __m128 taby = _mm_mul_ps(inv, _mm_cvtepi32_ps(_mm_and_si128(Y, mask)));
+  const __m128 tabx = _mm_mul_ps(inv, _mm_cvtepi32_ps(_mm_and_si128(X, mask)));
+  const __m128 one = _mm_set1_ps(1.0f);
+  const __m128 scale = _mm_set1_ps((float)INTER_REMAP_COEF_SCALE);
+  const __m128 ity = _mm_sub_ps(one, taby);
+  const __m128 itx = _mm_sub_ps(one, tabx);
+
+  // weights are in [0, 32768], only 32768 itself saturates
+  const __m128i w[4] = {
+    _mm_cvtps_epi32(_mm_mul_ps(_mm_mul_ps(ity, itx), scale)),
+    _mm_cvtps_epi32(_mm_mul_ps(_mm_mul_ps(ity, tabx), scale)),
+    _mm_cvtps_epi32(_mm_mul_ps(_mm_mul_ps(taby, itx), scale)),
+    _mm_cvtps_epi32(_mm_mul_ps(_mm_mul_ps(taby, tabx), scale)),
+  };
+  const __m128i wmax = _mm_set1_epi32(32767);
+  for (int k = 0; k < 4; k++) {
+    const __m128i over = _mm_cmpgt_epi32(w[k], wmax);
+    int tmp[4];
+    _mm_storeu_si128((__m128i*)tmp, _mm_or_si128(_mm_andnot_si128(over, w[k]), _mm_and_si128(over, wmax)));
+    for (int i = 0; i < 4; i++) itab[i][k] = tmp[i];
+  }
+}
+#elif defined(TRANSFORM_NEON)
+static inline void warp_coord4(const float *M, int dx, int dy,
+                               int sx[4], int sy[4], int itab[4][4]) {
+  const float lanes[4] = {0.f, 1.f, 2.f, 3.f};
+  const float32x4_t fx = vaddq_f32(vdupq_n_f32((float)dx), vld1q_f32(lanes));
+  const float fy = dy;
+  // vmulq + vaddq, not vmlaq, which may be fused
+  float32x4_t X0 = vaddq_f32(vaddq_f32(vmulq_n_f32(fx, M[0]), vdupq_n_f32(M[1] * fy)), vdupq_n_f32(M[2]));
+  float32x4_t Y0 = vaddq_f32(vaddq_f32(vmulq_n_f32(fx, M[3]), vdupq_n_f32(M[4] * fy)), vdupq_n_f32(M[5]));
+  float32x4_t W = vaddq_f32(vaddq_f32(vmulq_n_f32(fx, M[6]), vdupq_n_f32(M[7] * fy)), vdupq_n_f32(M[8]));
+  const uint32x4_t zero = vceqq_f32(W, vdupq_n_f32(0.0f));
+  W = vdivq_f32(vdupq_n_f32((float)INTER_TAB_SIZE), W);
+  W = vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(W), zero));
+
+  const int32x4_t X = vcvtnq_s32_f32(vmulq_f32(X0, W));
+  const int32x4_t Y = vcvtnq_s32_f32(vmulq_f32(Y0, W));
+
+  vst1q_s32(sx, vmovl_s16(vqmovn_s32(vshrq_n_s32(X, INTER_BITS))));
+  vst1q_s32(sy, vmovl_s16(vqmovn_s32(vshrq_n_s32(Y, INTER_BITS))));
+
+  const int32x4_t mask = vdupq_n_s32(INTER_TAB_SIZE - 1);
+  const float32x4_t taby = vmulq_n_f32(vcvtq_f32_s32(vandq_s32(Y, mask)), 1.f/INTER_TAB_SIZE);
+  const float32x4_t tabx = vmulq_n_f32(vcvtq_f32_s32(vandq_s32(X, mask)), 1.f/INTER_TAB_SIZE);
+  const float32x4_t ity = vsubq_f32(vdupq_n_f32(1.0f), taby);
+  const float32x4_t itx = vsubq_f32(vdupq_n_f32(1.0f), tabx);
+
+  const int32x4_t wmax = vdupq_n_s32(32767);
+  int32x4_t w[4] = {
+    vcvtnq_s32_f32(vmulq_n_f32(vmulq_f32(ity, itx), INTER_REMAP_COEF_SCALE)),
+    vcvtnq_s32_f32(vmulq_n_f32(vmulq_f32(ity, tabx), INTER_REMAP_COEF_SCALE)),
+    vcvtnq_s32_f32(vmulq_n_f32(vmulq_f32(taby, itx), INTER_REMAP_COEF_SCALE)),
+    vcvtnq_s32_f32(vmulq_n_f32(vmulq_f32(taby, tabx), INTER_REMAP_COEF_SCALE)),
+  };
+  for (int k = 0; k < 4; k++) {
+    int tmp[4];
+    vst1q_s32(tmp, vminq_s32(w[k], wmax));
+    for (int i = 0; i < 4; i++) itab[i][k] = tmp[i];
+  }
+}
+#endif
+
+static inline uint8_t warp_blend(const uint8_t *src, int src_step, int src_rows, int src_cols,
+                                 int sx, int sy, const int itab[4]) {
+  int v0, v1, v2, v3;
+  if (sx >= 0 && sx + 1 < src_cols && sy >= 0 && sy + 1 < src_rows) {
+    const uint8_t *p = &src[sy * src_step + sx];
+    v0 = p[0];
+    v1 = p[1];
+    v2 = p[src_step];
+    v3 = p[src_step + 1];
+  } else {
+    // outside pixels read as 0, like the kernel
+    const bool x0 = sx >= 0 && sx < src_cols, x1 = sx+1 >= 0 && sx+1 < src_cols;
+    const bool y0 = sy >= 0 && sy < src_rows, y1 = sy+1 >= 0 && sy+1 < src_rows;
+    v0 = (x0 && y0) ? src[sy * src_step + sx] : 0;
+    v1 = (x1 && y0) ? src[sy * src_step + sx + 1] : 0;
+    v2 = (x0 && y1) ? src[(sy + 1) * src_step + sx] : 0;
+    v3 = (x1 && y1) ? src[(sy + 1) * src_step + sx + 1] : 0;
+  }
+  const int val = v0 * itab[0] + v1 * itab[1] + v2 * itab[2] + v3 * itab[3];
+  const int r = (val + (1 << (INTER_REMAP_COEF_BITS-1))) >> INTER_REMAP_COEF_BITS;
+  return r < 0 ? 0 : (r > 255 ? 255 : r);
+}
+
+static void warp_row(const uint8_t *src, int src_step, int src_rows, int src_cols,
+                     const float *M, int dy, uint8_t *dst, int dst_cols) {
+  int dx = 0;
+#if defined(TRANSFORM_SSE2) || defined(TRANSFORM_NEON)
+  for (; dx + 4 <= dst_cols; dx += 4) {
+    int sx[4], sy[4], itab[4][4];
+    warp_coord4(M, dx, dy, sx, sy, itab);
+    for (int i = 0; i < 4; i++) {
+      dst[dx + i] = warp_blend(src, src_step, src_rows, src_cols, sx[i], sy[i], itab[i]);
+    }
+  }
+#endif
+  for (; dx < dst_cols; dx++) {
+    int sx, sy, itab[4];
+    warp_coord(M, dx, dy, &sx, &sy, itab);
+    dst[dx] = warp_blend(src, src_step, src_rows, src_cols, sx, sy, itab);
+  }
+}
+
+void warp_perspective_cpu(const uint8_t* src, int src_step, int src_rows, int src_cols,
+                          uint8_t* dst, int dst_cols,
+                          const float M[9], int row_start, int row_end) {
+  for (int dy = row_start; dy < row_end; dy++) {
+    warp_row(src, src_step, src_rows, src_cols, M, dy, &dst[dy * dst_cols], dst_cols);
+  }
+}
+
+// y = (x - 128) / 128
+static inline float normalize(uint8_t v) {
+  return ((float)v - 128.f) * 0.0078125f;
+}
+
+static void load_row(const uint8_t *in, int len, float *out) {
+  int x = 0;
+#if defined(TRANSFORM_NEON)
+  const float32x4_t offset = vdupq_n_f32(128.f);
+  for (; x + 8 <= len; x += 8) {
+    const uint16x8_t v = vmovl_u8(vld1_u8(&in[x]));
+    const float32x4_t lo = vcvtq_f32_u32(vmovl_u16(vget_low_u16(v)));
+    const float32x4_t hi = vcvtq_f32_u32(vmovl_u16(vget_high_u16(v)));
+    vst1q_f32(&out[x], vmulq_n_f32(vsubq_f32(lo, offset), 0.0078125f));
+    vst1q_f32(&out[x+4], vmulq_n_f32(vsubq_f32(hi, offset), 0.0078125f));
+  }
+#elif defined(TRANSFORM_SSE2)
+  const __m128i zero = _mm_setzero_si128();
+  const __m128 offset = _mm_set1_ps(128.f);
+  const __m128 scale = _mm_set1_ps(0.0078125f);
+  for (; x + 8 <= len; x += 8) {
+    const __m128i v = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)&in[x]), zero);
+    const __m128 lo = _mm_cvtepi32_ps(_mm_unpacklo_epi16(v, zero));
+    const __m128 hi = _mm_cvtepi32_ps(_mm_unpackhi_epi16(v, zero));
+    _mm_storeu_ps(&out[x], _mm_mul_ps(_mm_sub_ps(lo, offset), scale));
+    _mm_storeu_ps(&out[x+4], _mm_mul_ps(_mm_sub_ps(hi, offset), scale));
+  }
+#endif
+  for (; x < len; x++) {
+    out[x] = normalize(in[x]);
+  }
+}
+
+// even columns to out_even, odd columns to out_odd
+static void load_row_split(const uint8_t *in, int len, float *out_even, float *out_odd) {
+  int x = 0;
+#if defined(TRANSFORM_NEON)
+  const float32x4_t offset = vdupq_n_f32(128.f);
+  for (; x + 16 <= len; x += 16) {
+    const uint8x8x2_t v = vld2_u8(&in[x]);
+    for (int k = 0; k < 2; k++) {
+      float *out = k == 0 ? out_even : out_odd;
+      const uint16x8_t w = vmovl_u8(v.val[k]);
+      const float32x4_t lo = vcvtq_f32_u32(vmovl_u16(vget_low_u16(w)));
+      const float32x4_t hi = vcvtq_f32_u32(vmovl_u16(vget_high_u16(w)));
+      vst1q_f32(&out[x/2], vmulq_n_f32(vsubq_f32(lo, offset), 0.0078125f));
+      vst1q_f32(&out[x/2+4], vmulq_n_f32(vsubq_f32(hi, offset), 0.0078125f));
+    }
+  }
+#elif defined(TRANSFORM_SSE2)
+  const __m128i mask = _mm_set1_epi16(0x00ff);
+  const __m128i zero = _mm_setzero_si128();
+  const __m128 offset = _mm_set1_ps(128.f);
+  const __m128 scale = _mm_set1_ps(0.0078125f);
+  for (; x + 16 <= len; x += 16) {
+    const __m128i v = _mm_loadu_si128((const __m128i*)&in[x]);
+    const __m128i w[2] = {_mm_and_si128(v, mask), _mm_srli_epi16(v, 8)};
+    for (int k = 0; k < 2; k++) {
+      float *out = k == 0 ? out_even : out_odd;
+      const __m128 lo = _mm_cvtepi32_ps(_mm_unpacklo_epi16(w[k], zero));
+      const __m128 hi = _mm_cvtepi32_ps(_mm_unpackhi_epi16(w[k], zero));
+      _mm_storeu_ps(&out[x/2], _mm_mul_ps(_mm_sub_ps(lo, offset), scale));
+      _mm_storeu_ps(&out[x/2+4], _mm_mul_ps(_mm_sub_ps(hi, offset), scale));
+    }
+  }
+#endif
+  for (; x + 1 < len; x += 2) {
+    out_even[x/2] = normalize(in[x]);
+    out_odd[x/2] = normalize(in[x+1]);
+  }
+}
+
+static void transform_load_rows(const TransformCpuJob *j) {
+  const int in_uv_width = j->in_width / 2;
+  const int in_uv_height = j->in_height / 2;
+  const uint8_t *in_u = j->yuv + j->in_width * j->in_height;
+  const uint8_t *in_v = in_u + in_uv_width * in_uv_height;
+
+  const int uv_cols = j->out_width / 2;
+  const int uv_size = uv_cols * (j->out_height / 2);
+
+  uint8_t row[MAX_ROW_WIDTH];
+  for (int y = j->row_start; y < j->row_end; y++) {
+    const int oi = y * uv_cols;
+
+    // luma row 2y+p, even columns go to plane p, odd columns to plane p+2
+    // 02
+    // 13
+    for (int p = 0; p < 2; p++) {
+      warp_row(j->yuv, j->in_width, j->in_height, j->in_width,
+               j->projection_y.v, y * 2 + p, row, j->out_width);
+      load_row_split(row, j->out_width, &j->out[p * uv_size + oi], &j->out[(p + 2) * uv_size + oi]);
+    }
+
+    warp_row(in_u, in_uv_width, in_uv_height, in_uv_width,
+             j->projection_uv.v, y, row, uv_cols);
+    load_row(row, uv_cols, &j->out[4 * uv_size + oi]);
+    warp_row(in_v, in_uv_width, in_uv_height, in_uv_width,
+             j->projection_uv.v, y, row, uv_cols);
+    load_row(row, uv_cols, &j->out[5 * uv_size + oi]);
+  }
+}
+
+static void* transform_cpu_thread(void *arg) {
+  TransformCpuWorker *w = (TransformCpuWorker*)arg;
+  TransformCpu *s = w->pool;
+
+  // from the generation of init, a frame may be posted before this starts
+  int seen = 0;
+  pthread_mutex_lock(&s->lock);
+  while (true) {
+    while (s->generation == seen && !s->exit) {
+      pthread_cond_wait(&s->start_cv, &s->lock);
+    }
+    if (s->exit) break;
+    seen = s->generation;
+    const bool has_job = w->idx < s->num_jobs;
+    pthread_mutex_unlock(&s->lock);
+
+    if (has_job) {
+      transform_load_rows(&s->jobs[w->idx]);
+    }
+
+    pthread_mutex_lock(&s->lock);
+    if (--s->pending == 0) {
+      pthread_cond_signal(&s->done_cv);
+    }
+  }
+  pthread_mutex_unlock(&s->lock);
+  return NULL;
+}
+
+void transform_cpu_init(TransformCpu* s, int num_threads) {
+  assert(num_threads >= 1);
+  if (num_threads > TRANSFORM_CPU_MAX_THREADS) num_threads = TRANSFORM_CPU_MAX_THREADS;
+
+  memset(s, 0, sizeof(*s));
+  s->num_threads = num_threads;
+  pthread_mutex_init(&s->lock, NULL);
+  pthread_cond_init(&s->start_cv, NULL);
+  pthread_cond_init(&s->done_cv, NULL);
+
+  // worker 0 is the calling thread
+  for (int i = 1; i < num_threads; i++) {
+    s->workers[i].pool = s;
+    s->workers[i].idx = i;
+    int err = pthread_create(&s->workers[i].thread, NULL, transform_cpu_thread, &s->workers[i]);
+    assert(err == 0);
+  }
+}
+
+void transform_cpu_destroy(TransformCpu* s) {
+  pthread_mutex_lock(&s->lock);
+  s->exit = true;
+  pthread_cond_broadcast(&s->start_cv);
+  pthread_mutex_unlock(&s->lock);
+  for (int i = 1; i < s->num_threads; i++) {
+    int err = pthread_join(s->workers[i].thread, NULL);
+    assert(err == 0);
+  }
+  pthread_cond_destroy(&s->start_cv);
+  pthread_cond_destroy(&s->done_cv);
+  pthread_mutex_destroy(&s->lock);
+}
+
+void transform_load_cpu(TransformCpu* s, const uint8_t* yuv, int in_width, int in_height,
+                        float* out, int out_width, int out_height,
+                        mat3 projection) {
+  assert(out_width <= MAX_ROW_WIDTH);
+
+  const int uv_rows = out_height / 2;
+  const int num_jobs = s->num_threads < uv_rows ? s->num_threads : uv_rows;
+  if (num_jobs < 1) return;
+
+  pthread_mutex_lock(&s->lock);
+  for (int i = 0; i < num_jobs; i++) {
+    s->jobs[i] = (TransformCpuJob){
+      .yuv = yuv,
+      .in_width = in_width, .in_height = in_height,
+      .out = out,
+      .out_width = out_width, .out_height = out_height,
+      .projection_y = projection,
+      // in and out uv is half the size of y.
+      .projection_uv = transform_scale_buffer(projection, 0.5),
+      .row_start = uv_rows * i / num_jobs,
+      .row_end = uv_rows * (i + 1) / num_jobs,
+    };
+  }
+  s->num_jobs = num_jobs;
+  s->pending = s->num_threads - 1;
+  s->generation++;
+  pthread_cond_broadcast(&s->start_cv);
+  pthread_mutex_unlock(&s->lock);
+
+  transform_load_rows(&s->jobs[0]);
+
+  pthread_mutex_lock(&s->lock);
+  while (s->pending > 0) {
+    pthread_cond_wait(&s->done_cv, &s->lock);
+  }
+  pthread_mutex_unlock(&s->lock);
+}
@@ -0,0 +1,66 @@
+#ifndef TRANSFORM_CPU_H
+#define TRANSFORM_CPU_H
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <pthread.h>
+
+#include "common/mat.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TRANSFORM_CPU_MAX_THREADS 16
+
+typedef struct TransformCpuJob {
+  const uint8_t *yuv;
+  int in_width, in_height;
+  float *out;
+  int out_width, out_height;
+  mat3 projection_y, projection_uv;
+  int row_start, row_end;  // in uv rows
+} TransformCpuJob;
+
+struct TransformCpu;
+typedef struct TransformCpuWorker {
+  struct TransformCpu *pool;
+  int idx;
+  pthread_t thread;
+} TransformCpuWorker;
+
+// The threads that transform_load_cpu splits output rows over, started once
+// and woken for every frame. The calling thread takes the first block.
+typedef struct TransformCpu {
+  int num_threads;
+  TransformCpuWorker workers[TRANSFORM_CPU_MAX_THREADS];
+
+  pthread_mutex_t lock;
+  pthread_cond_t start_cv, done_cv;
+  // bumped for every frame, workers run jobs[idx] when it changes
+  int generation;
+  int num_jobs, pending;
+  bool exit;
+  TransformCpuJob jobs[TRANSFORM_CPU_MAX_THREADS];
+} TransformCpu;
+
+void transform_cpu_init(TransformCpu* s, int num_threads);
+void transform_cpu_destroy(TransformCpu* s);
+
+// CPU version of transform_queue + loadyuv_queue for hosts without an OpenCL
+// device. Same sampling as transform.cl and the same float layout as the net
+// input built by loadyuv.cl: 4 subsampled Y planes, U, V.
+void transform_load_cpu(TransformCpu* s, const uint8_t* yuv, int in_width, int in_height,
+                        float* out, int out_width, int out_height,
+                        mat3 projection);
+
+// warpPerspective of a single plane into dst, rows [row_start, row_end)
+void warp_perspective_cpu(const uint8_t* src, int src_step, int src_rows, int src_cols,
+                          uint8_t* dst, int dst_cols,
+                          const float M[9], int row_start, int row_end);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // TRANSFORM_CPU_H
@@ -0,0 +1,183 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <cassert>
+#include <cmath>
+
+#include <CL/cl.h>
+
+#include "common/util.h"
+#include "common/timing.h"
+#include "clutil.h"
+#include "transform.h"
+#include "loadyuv.h"
+#include "transform_cpu.h"
+
+// Compares transform_load_cpu against transform_queue + loadyuv_queue and
+// reports the cpu throughput per thread count. Without an OpenCL platform
+// only the cpu numbers are printed.
+
+// rear camera yuv, driving model input (MEDMODEL)
+#define IN_WIDTH 1164
+#define IN_HEIGHT 874
+#define MODEL_WIDTH 512
+#define MODEL_HEIGHT 256
+
+// the cl kernel may contract the coordinate math into fmas, which moves a
+// rounding boundary now and then: allow one step of the 8 bit input
+#define MAXE 0.0078125f
+
+#define ITERS 20
+
+static bool cl_init(cl_device_id &device_id, cl_context &context) {
+  int err;
+  cl_platform_id platform_id = NULL;
+  cl_uint num_devices;
+  cl_uint num_platforms = 0;
+
+  err = clGetPlatformIDs(1, &platform_id, &num_platforms);
+  if (err != 0 || num_platforms == 0) return false;
+  err = clGetDeviceIDs(platform_id, CL_DEVICE_TYPE_DEFAULT, 1,
+                       &device_id, &num_devices);
+  if (err != 0) return false;
+  cl_print_info(platform_id, device_id);
+  context = clCreateContext(NULL, 1, &device_id, NULL, NULL, &err);
+  return err == 0;
+}
+
+static mat3 random_projection() {
+  // model frame roughly centered in the road camera, with some perspective
+  const float scale = 1.5f + (rand() % 100) / 100.0f;
+  mat3 projection = {{
+    scale, 0.05f * (rand() % 3 - 1), 100.0f + rand() % 50,
+    0.0f, scale, 150.0f + rand() % 50,
+    0.0f, 0.0001f * (rand() % 5), 1.0f,
+  }};
+  return projection;
+}
+
+int main(int argc, char** argv) {
+  srand(1337);
+
+  const size_t yuv_size = IN_WIDTH * IN_HEIGHT * 3 / 2;
+  const size_t net_input_len = MODEL_WIDTH * MODEL_HEIGHT * 3 / 2;
+  const size_t net_input_size = net_input_len * sizeof(float);
+  const size_t uv_out_size = (MODEL_WIDTH / 2) * (MODEL_HEIGHT / 2);
+
+  uint8_t *yuv = new uint8_t[yuv_size];
+  float *net_input_cl = new float[net_input_len];
+  float *net_input_cpu = new float[net_input_len];
+  float *net_input_ref = new float[net_input_len];
+
+  // cpu only: thread count must not change the result
+  int mismatched = 0;
+  const int thread_counts[] = {1, 2, 4, 8};
+  double t_cpu[ARRAYSIZE(thread_counts)] = {0};
+  TransformCpu pools[ARRAYSIZE(thread_counts)];
+  for (int k = 0; k < ARRAYSIZE(thread_counts); k++) {
+    transform_cpu_init(&pools[k], thread_counts[k]);
+  }
+  for (int i = 0; i < ITERS; i++) {
+    for (size_t j = 0; j < yuv_size; j++) {
+      yuv[j] = (uint8_t)rand();
+    }
+    const mat3 projection = random_projection();
+    transform_load_cpu(&pools[0], yuv, IN_WIDTH, IN_HEIGHT, net_input_ref, MODEL_WIDTH, MODEL_HEIGHT, projection);
+    for (int k = 0; k < ARRAYSIZE(thread_counts); k++) {
+      double t1 = millis_since_boot();
+      transform_load_cpu(&pools[k], yuv, IN_WIDTH, IN_HEIGHT, net_input_cpu, MODEL_WIDTH, MODEL_HEIGHT, projection);
+      t_cpu[k] += millis_since_boot() - t1;
+      if (memcmp(net_input_cpu, net_input_ref, net_input_size) != 0) {
+        printf("frame %d: %d threads differ from 1 thread\n", i, thread_counts[k]);
+        mismatched++;
+      }
+    }
+  }
+  for (int k = 0; k < ARRAYSIZE(thread_counts); k++) {
+    printf("cpu %d threads: %.3fms, %.1f frames/s\n", thread_counts[k],
+           t_cpu[k] / ITERS, 1000.0 * ITERS / t_cpu[k]);
+  }
+
+  clu_init();
+  cl_device_id device_id;
+  cl_context context;
+  if (!cl_init(device_id, context)) {
+    printf("no OpenCL device, skipping the comparison\n");
+    for (int k = 0; k < ARRAYSIZE(thread_counts); k++) {
+      transform_cpu_destroy(&pools[k]);
+    }
+    return mismatched == 0 ? 0 : -1;
+  }
+
+  int err;
+  cl_command_queue q = clCreateCommandQueue(context, device_id, 0, &err);
+  assert(err == 0);
+
+  Transform transform;
+  transform_init(&transform, context, device_id);
+  LoadYUVState loadyuv;
+  loadyuv_init(&loadyuv, context, device_id, MODEL_WIDTH, MODEL_HEIGHT);
+
+  cl_mem yuv_cl = clCreateBuffer(context, CL_MEM_READ_ONLY, yuv_size, NULL, &err);
+  cl_mem out_cl = clCreateBuffer(context, CL_MEM_READ_WRITE, net_input_size, NULL, &err);
+  cl_mem transformed_y_cl = clCreateBuffer(context, CL_MEM_READ_WRITE, MODEL_WIDTH * MODEL_HEIGHT, NULL, &err);
+  cl_mem transformed_u_cl = clCreateBuffer(context, CL_MEM_READ_WRITE, uv_out_size, NULL, &err);
+  cl_mem transformed_v_cl = clCreateBuffer(context, CL_MEM_READ_WRITE, uv_out_size, NULL, &err);
+
+  double t_cl = 0;
+  for (int i = 0; i < ITERS; i++) {
+    for (size_t j = 0; j < yuv_size; j++) {
+      yuv[j] = (uint8_t)rand();
+    }
+    const mat3 projection = random_projection();
+
+    clEnqueueWriteBuffer(q, yuv_cl, CL_TRUE, 0, yuv_size, yuv, 0, NULL, NULL);
+    double t1 = millis_since_boot();
+    transform_queue(&transform, q, yuv_cl, IN_WIDTH, IN_HEIGHT,
+                    transformed_y_cl, transformed_u_cl, transformed_v_cl,
+                    MODEL_WIDTH, MODEL_HEIGHT, projection);
+    loadyuv_queue(&loadyuv, q, transformed_y_cl, transformed_u_cl, transformed_v_cl, out_cl);
+    clFinish(q);
+    t_cl += millis_since_boot() - t1;
+    clEnqueueReadBuffer(q, out_cl, CL_TRUE, 0, net_input_size, net_input_cl, 0, NULL, NULL);
+
+    transform_load_cpu(&pools[2], yuv, IN_WIDTH, IN_HEIGHT, net_input_cpu, MODEL_WIDTH, MODEL_HEIGHT, projection);
+
+    float max_e = 0;
+    int diff_count = 0;
+    for (size_t j = 0; j < net_input_len; j++) {
+      float e = fabsf(net_input_cl[j] - net_input_cpu[j]);
+      if (e > 0) diff_count++;
+      if (e > max_e) max_e = e;
+    }
+    if (max_e > MAXE) {
+      printf("frame %d: max error %f, %d values differ\n", i, max_e, diff_count);
+      mismatched++;
+    } else if (diff_count > 0) {
+      printf("frame %d: %d values off by one step\n", i, diff_count);
+    }
+  }
+
+  printf("Matched: %d, Mismatched: %d\n", ITERS - mismatched, mismatched);
+  printf("cl transform + loadyuv: %.3fms\n", t_cl / ITERS);
+
+  delete[] yuv;
+  delete[] net_input_cl;
+  delete[] net_input_cpu;
+  delete[] net_input_ref;
+  clReleaseMemObject(yuv_cl);
+  clReleaseMemObject(out_cl);
+  clReleaseMemObject(transformed_y_cl);
+  clReleaseMemObject(transformed_u_cl);
+  clReleaseMemObject(transformed_v_cl);
+  loadyuv_destroy(&loadyuv);
+  transform_destroy(&transform);
+  for (int k = 0; k < ARRAYSIZE(thread_counts); k++) {
+    transform_cpu_destroy(&pools[k]);
+  }
+  clReleaseCommandQueue(q);
+  clReleaseContext(context);
+
+  return mismatched == 0 ? 0 : -1;
+}
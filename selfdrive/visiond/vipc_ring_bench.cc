@@ -0,0 +1,252 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <cassert>
+#include <vector>
+#include <algorithm>
+
+#include <unistd.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+
+#include "common/timing.h"
+#include "common/visionipc.h"
+#include "common/vipc_ring.h"
+
+// Frame delivery latency from a synthetic publisher to 1, 3 and 6 reader
+// processes, through the shared memory ring and through the socket
+// protocol (an acquire packet per frame and client, and a release back).
+// Latency is from publishing a frame to the reader having it.
+//
+// usage: vipc_ring_bench [frames] [hz]
+
+#define MAX_CLIENTS 6
+#define NUM_BUFS 16
+// frames the publisher keeps readable, like visiond for a tbuffer stream
+#define RETAIN 2
+
+struct Results {
+  uint64_t count[MAX_CLIENTS];
+  uint64_t dropped[MAX_CLIENTS];
+  // delivery latency in us, per client
+  float latency[];
+};
+
+static Results* results_alloc(int frames) {
+  size_t size = sizeof(Results) + sizeof(float) * MAX_CLIENTS * frames;
+  void* p = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  assert(p != MAP_FAILED);
+  return (Results*)p;
+}
+
+static void record(Results* res, int frames, int client, uint64_t ts) {
+  const uint64_t n = res->count[client];
+  if (n < (uint64_t)frames) {
+    res->latency[client * frames + n] = (nanos_since_boot() - ts) / 1000.0f;
+    res->count[client]++;
+  }
+}
+
+static void sleep_until(uint64_t t) {
+  const uint64_t now = nanos_since_boot();
+  if (t > now) usleep((t - now) / 1000);
+}
+
+static void ring_reader(VIPCRing* ring, Results* res, int frames, int client) {
+  int reader = vipc_ring_attach(ring);
+  assert(reader >= 0);
+
+  uint64_t seq = 0;
+  int last_idx = -1;
+  while (true) {
+    VIPCBufExtra extra;
+    uint64_t dropped = 0;
+    int idx = vipc_ring_acquire(ring, reader, false, &seq, -1, &extra, &dropped);
+    if (idx == VIPC_RING_STOPPED) break;
+    assert(idx >= 0);
+    record(res, frames, client, extra.timestamp_eof);
+    res->dropped[client] += dropped;
+    if (last_idx >= 0) vipc_ring_release(ring, reader, last_idx);
+    last_idx = idx;
+  }
+  vipc_ring_detach(ring, reader);
+}
+
+static void run_ring(Results* res, int num_clients, int frames, int hz) {
+  int fd;
+  VIPCRing* ring = vipc_ring_create(NUM_BUFS, &fd);
+  assert(ring);
+
+  std::vector<pid_t> pids;
+  for (int c = 0; c < num_clients; c++) {
+    pid_t pid = fork();
+    assert(pid >= 0);
+    if (pid == 0) {
+      VIPCRing* r = vipc_ring_map(fd);
+      assert(r);
+      ring_reader(r, res, frames, c);
+      _exit(0);
+    }
+    pids.push_back(pid);
+  }
+  // let the readers attach
+  usleep(100 * 1000);
+
+  std::vector<int> held;
+  const uint64_t interval = 1000000000ULL / hz;
+  uint64_t next = nanos_since_boot();
+  for (int f = 0; f < frames; f++) {
+    next += interval;
+    sleep_until(next);
+
+    std::vector<int> keep;
+    for (size_t i = 0; i < held.size(); i++) {
+      if (i + RETAIN < held.size() && vipc_ring_retire(ring, held[i])) continue;
+      keep.push_back(held[i]);
+    }
+    held.swap(keep);
+
+    int idx = 0;
+    while (idx < NUM_BUFS && std::find(held.begin(), held.end(), idx) != held.end()) idx++;
+    assert(idx < NUM_BUFS);
+
+    VIPCBufExtra extra = {0};
+    extra.frame_id = f;
+    extra.timestamp_eof = nanos_since_boot();
+    vipc_ring_publish(ring, idx, &extra);
+    held.push_back(idx);
+  }
+
+  // the last frames get a moment to go through
+  usleep(100 * 1000);
+  vipc_ring_stop(ring);
+  for (pid_t pid : pids) waitpid(pid, NULL, 0);
+  vipc_ring_destroy(ring, fd);
+}
+
+static void socket_reader(int fd, Results* res, int frames, int client) {
+  int last_idx = -1;
+  while (true) {
+    VisionPacket p;
+    if (vipc_recv(fd, &p) <= 0 || p.type != VIPC_STREAM_ACQUIRE) break;
+    record(res, frames, client, p.d.stream_acq.extra.timestamp_eof);
+    if (last_idx >= 0) {
+      VisionPacket rep = {0};
+      rep.type = VIPC_STREAM_RELEASE;
+      rep.d.stream_rel.idx = last_idx;
+      vipc_send(fd, &rep);
+    }
+    last_idx = p.d.stream_acq.idx;
+  }
+  close(fd);
+}
+
+static void run_socket(Results* res, int num_clients, int frames, int hz) {
+  int fds[MAX_CLIENTS];
+  std::vector<pid_t> pids;
+  for (int c = 0; c < num_clients; c++) {
+    int sv[2];
+    int err = socketpair(AF_UNIX, SOCK_SEQPACKET, 0, sv);
+    assert(err == 0);
+    pid_t pid = fork();
+    assert(pid >= 0);
+    if (pid == 0) {
+      close(sv[0]);
+      socket_reader(sv[1], res, frames, c);
+      _exit(0);
+    }
+    close(sv[1]);
+    fds[c] = sv[0];
+    pids.push_back(pid);
+  }
+
+  // as visiond, at most two frames outstanding per client
+  int outstanding[MAX_CLIENTS] = {0};
+  const uint64_t interval = 1000000000ULL / hz;
+  uint64_t next = nanos_since_boot();
+  for (int f = 0; f < frames; f++) {
+    next += interval;
+
+    // releases until the frame is due
+    while (true) {
+      const uint64_t now = nanos_since_boot();
+      if (now >= next) break;
+      struct pollfd polls[MAX_CLIENTS];
+      for (int c = 0; c < num_clients; c++) {
+        polls[c] = {fds[c], POLLIN, 0};
+      }
+      int ret = poll(polls, num_clients, (int)((next - now) / 1000000));
+      if (ret <= 0) continue;
+      for (int c = 0; c < num_clients; c++) {
+        if (!(polls[c].revents & POLLIN)) continue;
+        VisionPacket p;
+        if (vipc_recv(fds[c], &p) > 0 && p.type == VIPC_STREAM_RELEASE) outstanding[c]--;
+      }
+    }
+
+    const uint64_t ts = nanos_since_boot();
+    for (int c = 0; c < num_clients; c++) {
+      if (outstanding[c] >= 2) {
+        res->dropped[c]++;
+        continue;
+      }
+      VisionPacket p = {0};
+      p.type = VIPC_STREAM_ACQUIRE;
+      p.d.stream_acq.idx = f % NUM_BUFS;
+      p.d.stream_acq.extra.frame_id = f;
+      p.d.stream_acq.extra.timestamp_eof = ts;
+      vipc_send(fds[c], &p);
+      outstanding[c]++;
+    }
+  }
+
+  usleep(100 * 1000);
+  for (int c = 0; c < num_clients; c++) close(fds[c]);
+  for (pid_t pid : pids) waitpid(pid, NULL, 0);
+}
+
+static void report(const char* name, const Results* res, int num_clients, int frames) {
+  std::vector<float> all;
+  uint64_t dropped = 0;
+  for (int c = 0; c < num_clients; c++) {
+    all.insert(all.end(), &res->latency[c * frames], &res->latency[c * frames + res->count[c]]);
+    dropped += res->dropped[c];
+  }
+  std::sort(all.begin(), all.end());
+  const size_t n = all.size();
+  if (n == 0) {
+    printf("%-6s %d clients: no frames delivered\n", name, num_clients);
+    return;
+  }
+  printf("%-6s %d clients: p50 %7.1fus  p90 %7.1fus  p99 %7.1fus  max %8.1fus  delivered %zu/%d dropped %llu\n",
+         name, num_clients, all[n / 2], all[n * 9 / 10], all[n * 99 / 100], all[n - 1],
+         n, frames * num_clients, (unsigned long long)dropped);
+}
+
+int main(int argc, char** argv) {
+  const int frames = argc > 1 ? atoi(argv[1]) : 1000;
+  const int hz = argc > 2 ? atoi(argv[2]) : 100;
+  assert(frames > 0 && hz > 0);
+
+  // a reader that went away shows up as a failed send, not a signal
+  signal(SIGPIPE, SIG_IGN);
+
+  const int client_counts[] = {1, 3, 6};
+  for (int num_clients : client_counts) {
+    Results* res = results_alloc(frames);
+    run_ring(res, num_clients, frames, hz);
+    report("ring", res, num_clients, frames);
+    munmap(res, sizeof(Results) + sizeof(float) * MAX_CLIENTS * frames);
+
+    res = results_alloc(frames);
+    run_socket(res, num_clients, frames, hz);
+    report("socket", res, num_clients, frames);
+    munmap(res, sizeof(Results) + sizeof(float) * MAX_CLIENTS * frames);
+  }
+
+  return 0;
+}
@@ -24,7 +24,6 @@
 #include <libyuv.h>
 #include <czmq.h>
 #include <capnp/serialize.h>
-#include <jpeglib.h>
 
 #include "common/version.h"
 #include "common/util.h"
@@ -32,12 +31,15 @@
 #include "common/mat.h"
 #include "common/swaglog.h"
 #include "common/visionipc.h"
+#include "common/vipc_ring.h"
 #include "common/visionbuf.h"
 #include "common/visionimg.h"
 #include "common/buffering.h"
 
 #include "clutil.h"
 #include "bufs.h"
+#include "thumbnail.h"
+#include "scheduler.h"
 
 #ifdef QCOM
 #include "cameras/camera_qcom.h"
@@ -51,6 +53,7 @@
 #include "models/posenet.h"
 
 #include "transforms/rgb_to_yuv.h"
+#include "transforms/ae_histogram.h"
 
 #include "cereal/gen/cpp/log.capnp.h"
 
@@ -68,6 +71,14 @@
 #define YUV_COUNT 40
 #define MAX_CLIENTS 5
 
+// frames of a pool stream the ring keeps readable for queue readers, well
+// below the YUV_COUNT / 2 ring_thread holds at most
+#define RING_RETAIN VIPC_RING_RETAIN
+static_assert(RING_RETAIN < YUV_COUNT / 2, "the ring can't retain more than it holds");
+
+// a rear frame has to be through the driving model within this
+#define SCHED_BUDGET_MS 50.0
+
 #ifdef __APPLE__
 typedef void (*sighandler_t) (int);
 #endif
@@ -91,10 +102,20 @@ namespace {
 		bool subscribed;
 		int bufs_outstanding;
 		bool tb;
+		bool ring;
 		TBuffer* tbuffer;
 		PoolQueue* queue;
 	};
 
+	struct VisionRingState {
+		VisionState* s;
+		VisionStreamType type;
+		VIPCRing* ring;
+		int fd;
+		pthread_t thread_handle;
+		bool running;
+	};
+
 	struct VisionState {
 
 		int frame_width, frame_height;
@@ -111,6 +132,7 @@ namespace {
 		cl_program prg_debayer_front;
 		cl_kernel krnl_debayer_rear;
 		cl_kernel krnl_debayer_front;
+		cl_kernel krnl_debayer_yuv_rear;
 
 		// processing
 		TBuffer ui_tb;
@@ -139,6 +161,9 @@ namespace {
 		int yuv_front_width, yuv_front_height;
 		RGBToYUVState front_rgb_to_yuv_state;
 
+		AEHistogramState rear_ae_state;
+		AEHistogramState front_ae_state;
+
 		size_t rgb_buf_size;
 		int rgb_width, rgb_height, rgb_stride;
 		VisionBuf rgb_bufs[UI_BUF_COUNT];
@@ -158,6 +183,8 @@ namespace {
 
 		PosenetState posenet;
 
+		Scheduler sched;
+
 		// Protected by transform_lock.
 		bool run_model;
 		mat3 cur_transform;
@@ -182,10 +209,14 @@ namespace {
 
 		zsock_t* thumbnail_sock;
 		void* thumbnail_sock_raw;
+		ThumbnailState thumbnail;
 
 		pthread_mutex_t clients_lock;
 		VisionClientState clients[MAX_CLIENTS];
+		// Protected by clients_lock.
+		VisionRingState rings[VISION_STREAM_MAX];
 
+		double start_ms;
 	};
 
 	void hexdump(uint8_t* d, int l) {
@@ -209,6 +240,65 @@ namespace {
 		return 0;
 	}
 
+	// everything that runs on the gpu/dsp, in the order added to the scheduler
+	enum {
+		SCHED_CAMERA,
+		SCHED_DRIVING,
+		SCHED_POSENET,
+		SCHED_REAR_AE,
+		SCHED_MONITORING,
+	};
+
+	void sched_setup(Scheduler* sched) {
+		sched_init(sched, SCHED_BUDGET_MS);
+		// name, period, phase, critical, max defer, max wait, initial cost
+		sched_add_task(sched, "camera", 1, 0, true, 0, 0, 5.0);
+		sched_add_task(sched, "driving", 1, 0, true, 0, 0, 30.0);
+		sched_add_task(sched, "posenet", 5, 0, false, 2, 0, 10.0);
+		sched_add_task(sched, "rearAE", 3, 0, false, 2, 0, 1.0);
+		// a front frame is only worth a few rear frames of waiting, but
+		// monitoring never drops more than every other one
+		sched_add_task(sched, "monitoring", 1, 0, false, 0, 40.0, 10.0);
+		sched_set_max_skip(sched, SCHED_MONITORING, 1);
+		assert(sched->num_tasks == SCHED_MONITORING + 1);
+	}
+
+	void publish_timings(VisionState* s, void* sock) {
+		SchedStats stats;
+		sched_stats(&s->sched, &stats);
+
+		capnp::MallocMessageBuilder msg;
+		cereal::Event::Builder event = msg.initRoot<cereal::Event>();
+		event.setLogMonoTime(nanos_since_boot());
+
+		auto timings = event.initVisiondTimings();
+		timings.setBudgetMs(stats.budget_ms);
+		timings.setFrameIntervalMs(stats.interval_ms);
+		timings.setFrames(stats.frames);
+		timings.setOverruns(stats.overruns);
+		auto tasks = timings.initTasks(stats.num_tasks);
+		for (int i = 0; i < stats.num_tasks; i++) {
+			const SchedTask& st = stats.tasks[i];
+			auto task = tasks[i];
+			task.setName(st.name);
+			task.setPeriod(st.period);
+			task.setCritical(st.critical);
+			task.setRuns(st.runs);
+			task.setDeferrals(st.deferrals);
+			task.setSkips(st.skips);
+			task.setForced(st.forced);
+			task.setCostEstimateMs(st.cost_ms);
+			task.setMeanMs(st.mean_ms);
+			task.setLastMs(st.last_ms);
+			task.setMaxMs(st.max_ms);
+			task.setLatencyMs(st.latency_ms);
+		}
+
+		auto words = capnp::messageToFlatArray(msg);
+		auto bytes = words.asBytes();
+		zmq_send(sock, bytes.begin(), bytes.size(), ZMQ_DONTWAIT);
+	}
+
 	////////// cl stuff
 
 	cl_program build_debayer_program(VisionState* s,
@@ -230,6 +320,26 @@ namespace {
 		return CLU_LOAD_FROM_FILE(s->context, s->device_id, "cameras/debayer.cl", args);
 	}
 
+	// HDR sensors run debayer10 with one work item per output row, the others
+	// debayer10_tiled with 16x8 work groups of 4 pixels per work item
+	const char* debayer_kernel_name(bool hdr) {
+		return hdr ? "debayer10" : "debayer10_tiled";
+	}
+
+	cl_int debayer_enqueue(cl_command_queue q, cl_kernel krnl, bool hdr,
+		int rgb_width, int rgb_height, cl_event* event) {
+		if (hdr) {
+			const size_t debayer_work_size = rgb_height; // doesn't divide evenly, is this okay?
+			const size_t debayer_local_work_size = 128;
+			return clEnqueueNDRangeKernel(q, krnl, 1, NULL,
+				&debayer_work_size, &debayer_local_work_size, 0, 0, event);
+		}
+		const size_t debayer_work_size[2] = { (size_t)ALIGN(rgb_width, 64) / 4, (size_t)ALIGN(rgb_height, 8) };
+		const size_t debayer_local_work_size[2] = { 16, 8 };
+		return clEnqueueNDRangeKernel(q, krnl, 2, NULL,
+			debayer_work_size, debayer_local_work_size, 0, 0, event);
+	}
+
 	void cl_init(VisionState* s) {
 		int err;
 		cl_platform_id platform_id = NULL;
@@ -352,8 +462,16 @@ namespace {
 				s->cameras.rear.ci.frame_stride,
 				s->rgb_width, s->rgb_height, s->rgb_stride,
 				s->cameras.rear.ci.bayer_flip, s->cameras.rear.ci.hdr);
-			s->krnl_debayer_rear = clCreateKernel(s->prg_debayer_rear, "debayer10", &err);
+			s->krnl_debayer_rear = clCreateKernel(s->prg_debayer_rear,
+				debayer_kernel_name(s->cameras.rear.ci.hdr), &err);
 			assert(err == 0);
+#ifdef FUSED_PIPELINE
+			// HDR decompression is sequential along a row, those sensors keep the two kernel path
+			if (!s->cameras.rear.ci.hdr) {
+				s->krnl_debayer_yuv_rear = clCreateKernel(s->prg_debayer_rear, "debayer10_yuv", &err);
+				assert(err == 0);
+			}
+#endif
 		}
 
 		if (s->cameras.front.ci.bayer) {
@@ -362,12 +480,16 @@ namespace {
 				s->rgb_front_width, s->rgb_front_height, s->rgb_front_stride,
 				s->cameras.front.ci.bayer_flip, s->cameras.front.ci.hdr);
 
-			s->krnl_debayer_front = clCreateKernel(s->prg_debayer_front, "debayer10", &err);
+			s->krnl_debayer_front = clCreateKernel(s->prg_debayer_front,
+				debayer_kernel_name(s->cameras.front.ci.hdr), &err);
 			assert(err == 0);
 		}
 
 		rgb_to_yuv_init(&s->rgb_to_yuv_state, s->context, s->device_id, s->yuv_width, s->yuv_height, s->rgb_stride);
 		rgb_to_yuv_init(&s->front_rgb_to_yuv_state, s->context, s->device_id, s->yuv_front_width, s->yuv_front_height, s->rgb_front_stride);
+
+		ae_histogram_init(&s->rear_ae_state, s->context, s->device_id, 1);
+		ae_histogram_init(&s->front_ae_state, s->context, s->device_id, 3);
 	}
 
 	void free_buffers(VisionState* s) {
@@ -393,6 +515,152 @@ namespace {
 		for (int i = 0; i < YUV_COUNT; i++) {
 			visionbuf_free(&s->yuv_ion[i]);
 		}
+
+		ae_histogram_destroy(&s->rear_ae_state);
+		ae_histogram_destroy(&s->front_ae_state);
+	}
+
+	// Publishes one stream to its shared memory ring for every ring
+	// subscriber. The thread is a single consumer of the stream on their
+	// behalf and keeps a buffer until it's out of the retained window and no
+	// reader has it pinned.
+	void* ring_thread(void* arg) {
+		VisionRingState* rs = (VisionRingState*)arg;
+		VisionState* s = rs->s;
+
+		set_thread_name("visionring");
+
+		TBuffer* tb = NULL;
+		PoolQueue* queue = NULL;
+		FrameMetadata* metas = NULL;
+		if (rs->type == VISION_STREAM_RGB_BACK) {
+			tb = &s->ui_tb;
+		}
+		else if (rs->type == VISION_STREAM_RGB_FRONT) {
+			tb = &s->ui_front_tb;
+		}
+		else if (rs->type == VISION_STREAM_YUV) {
+			queue = pool_get_queue(&s->yuv_pool);
+			metas = s->yuv_metas;
+		}
+		else if (rs->type == VISION_STREAM_YUV_FRONT) {
+			queue = pool_get_queue(&s->yuv_front_pool);
+			metas = s->yuv_front_metas;
+		}
+		else {
+			assert(false);
+		}
+
+		// a tbuffer needs two buffers to itself
+		const int retain = tb ? 1 : RING_RETAIN;
+		const int max_held = tb ? UI_BUF_COUNT - 2 : YUV_COUNT / 2;
+
+		// oldest first
+		int held[YUV_COUNT];
+		int num_held = 0;
+
+		for (int cnt = 0; !do_exit; cnt++) {
+			// before retiring, so a pin dropped after a failed retire wakes the wait below
+			const uint32_t release_seq = vipc_ring_release_seq(rs->ring);
+
+			// retire what's out of the window, a pinned buffer is tried again
+			// on the next frame
+			int keep = 0;
+			for (int i = 0; i < num_held; i++) {
+				if (i < num_held - retain && vipc_ring_retire(rs->ring, held[i])) {
+					if (tb) {
+						tbuffer_release(tb, held[i]);
+					}
+					else {
+						poolq_release(queue, held[i]);
+					}
+				}
+				else {
+					held[keep++] = held[i];
+				}
+			}
+			num_held = keep;
+
+			if (cnt % 20 == 0) {
+				vipc_ring_reap(rs->ring);
+			}
+
+			if (num_held >= max_held) {
+				// slow readers, frames are dropped upstream meanwhile. A reader
+				// that died with pins is reaped first, that counts as a release
+				vipc_ring_reap(rs->ring);
+				vipc_ring_wait_release(rs->ring, release_seq, 100);  // do_exit is checked at least that often
+				continue;
+			}
+
+			int idx = tb ? tbuffer_acquire(tb) : poolq_pop(queue);
+			if (idx < 0) {
+				break;
+			}
+
+			// a full pool evicts buffers that are still held, the frame we had is
+			// gone. While a reader still has it pinned the slot can't take the new
+			// frame: it stays held to be retired again, and the new one is skipped
+			bool skip = false;
+			for (int i = 0; i < num_held; i++) {
+				if (held[i] != idx) continue;
+				// we have two references to the buffer now
+				poolq_release(queue, idx);
+				if (vipc_ring_retire(rs->ring, idx)) {
+					memmove(&held[i], &held[i + 1], (num_held - i - 1) * sizeof(held[0]));
+					num_held--;
+				}
+				else {
+					skip = true;
+				}
+				break;
+			}
+			if (skip) {
+				continue;
+			}
+
+			VIPCBufExtra extra = {0};
+			if (metas) {
+				extra.frame_id = metas[idx].frame_id;
+				extra.timestamp_eof = metas[idx].timestamp_eof;
+			}
+			vipc_ring_publish(rs->ring, idx, &extra);
+			held[num_held++] = idx;
+		}
+
+		vipc_ring_stop(rs->ring);
+		for (int i = 0; i < num_held; i++) {
+			if (tb) {
+				tbuffer_release(tb, held[i]);
+			}
+			else {
+				poolq_release(queue, held[i]);
+			}
+		}
+		if (queue) {
+			pool_release_queue(queue);
+		}
+
+		return NULL;
+	}
+
+	// the ring of a stream, started with its first ring subscriber
+	VisionRingState* get_ring(VisionState* s, VisionStreamType type) {
+		pthread_mutex_lock(&s->clients_lock);
+		VisionRingState* rs = &s->rings[type];
+		if (!rs->running) {
+			const int num_bufs = (type == VISION_STREAM_RGB_BACK || type == VISION_STREAM_RGB_FRONT) ? UI_BUF_COUNT : YUV_COUNT;
+			rs->ring = vipc_ring_create(num_bufs, &rs->fd);
+			if (rs->ring) {
+				rs->s = s;
+				rs->type = type;
+				rs->running = true;
+				int err = pthread_create(&rs->thread_handle, NULL, ring_thread, rs);
+				assert(err == 0);
+			}
+		}
+		pthread_mutex_unlock(&s->clients_lock);
+		return rs->running ? rs : NULL;
 	}
 
 	void* visionserver_client_thread(void* arg) {
@@ -421,7 +689,7 @@ namespace {
 			int poll_to_stream[2 + VISION_STREAM_MAX] = { 0 };
 			int num_polls = 2;
 			for (int i = 0; i < VISION_STREAM_MAX; i++) {
-				if (!streams[i].subscribed) continue;
+				if (!streams[i].subscribed || streams[i].ring) continue;
 				polls[num_polls].events = ZMQ_POLLIN;
 				if (streams[i].bufs_outstanding >= 2) {
 					continue;
@@ -460,6 +728,12 @@ namespace {
 					VisionClientStreamState* stream = &streams[stream_type];
 					stream->tb = p.d.stream_sub.tbuffer;
 
+					VisionRingState* ring = NULL;
+					if (p.d.stream_sub.ring) {
+						ring = get_ring(s, stream_type);
+					}
+					stream->ring = ring != NULL;
+
 					VisionStreamBufs* stream_bufs = &rep.d.stream_bufs;
 					if (stream_type == VISION_STREAM_RGB_BACK) {
 						stream_bufs->width = s->rgb_width;
@@ -505,7 +779,7 @@ namespace {
 						if (stream->tb) {
 							stream->tbuffer = s->yuv_tb;
 						}
-						else {
+						else if (!stream->ring) {
 							stream->queue = pool_get_queue(&s->yuv_pool);
 						}
 					}
@@ -521,7 +795,7 @@ namespace {
 						if (stream->tb) {
 							assert(false);
 						}
-						else {
+						else if (!stream->ring) {
 							stream->queue = pool_get_queue(&s->yuv_front_pool);
 						}
 					}
@@ -536,6 +810,10 @@ namespace {
 						  .transformed_height = s->model.in.transformed_height,
 						};
 					}
+					if (stream->ring) {
+						rep.fds[rep.num_fds++] = ring->fd;
+						stream_bufs->ring = true;
+					}
 					vipc_send(fd, &rep);
 					streams[stream_type].subscribed = true;
 				}
@@ -600,7 +878,8 @@ namespace {
 		LOG("client end fd %d\n", fd);
 
 		for (int i = 0; i < VISION_STREAM_MAX; i++) {
-			if (!streams[i].subscribed) continue;
+			// the ring thread holds the buffers of ring subscriptions
+			if (!streams[i].subscribed || streams[i].ring) continue;
 			if (streams[i].tb) {
 				tbuffer_release_all(streams[i].tbuffer);
 			}
@@ -703,6 +982,18 @@ namespace {
 			}
 		}
 
+		for (int i = 0; i < VISION_STREAM_MAX; i++) {
+			pthread_mutex_lock(&s->clients_lock);
+			VisionRingState* rs = &s->rings[i];
+			bool running = rs->running;
+			pthread_mutex_unlock(&s->clients_lock);
+			if (running) {
+				err = pthread_join(rs->thread_handle, NULL);
+				assert(err == 0);
+				vipc_ring_destroy(rs->ring, rs->fd);
+			}
+		}
+
 		close(sock);
 		zsock_destroy(&terminate);
 
@@ -729,11 +1020,17 @@ namespace {
 
 			FrameMetadata frame_data = s->yuv_front_metas[buf_idx];
 
-			// only process every frame
-			if ((frame_data.frame_id % 1) == 0) {
-
-				double t1 = millis_since_boot();
+			// wait for the driving model if that's enough for it to fit, else drop the frame
+			double t1 = millis_since_boot();
+			bool run = sched_should_run(&s->sched, SCHED_MONITORING, t1);
+			double retry_at;
+			while (!run && !do_exit && (retry_at = sched_retry_at(&s->sched, SCHED_MONITORING)) > 0) {
+				if (retry_at > t1) usleep((retry_at - t1) * 1000);
+				t1 = millis_since_boot();
+				run = sched_should_run(&s->sched, SCHED_MONITORING, t1);
+			}
 
+			if (run) {
 				MonitoringResult res = monitoring_eval_frame(&s->monitoring, q,
 					s->yuv_front_cl[buf_idx], s->yuv_front_width, s->yuv_front_height);
 
@@ -757,6 +1054,7 @@ namespace {
 				}
 
 				double t2 = millis_since_boot();
+				sched_done(&s->sched, SCHED_MONITORING, t1, t2);
 
 				//LOGD("monitoring process: %.2fms, from last %.2fms", t2-t1, t1-last);
 				last = t1;
@@ -797,10 +1095,8 @@ namespace {
 			assert(err == 0);
 
 			cl_event debayer_event;
-			const size_t debayer_work_size = s->rgb_front_height;
-			const size_t debayer_local_work_size = 128;
-			err = clEnqueueNDRangeKernel(q, s->krnl_debayer_front, 1, NULL,
-				&debayer_work_size, &debayer_local_work_size, 0, 0, &debayer_event);
+			err = debayer_enqueue(q, s->krnl_debayer_front, s->cameras.front.ci.hdr,
+				s->rgb_front_width, s->rgb_front_height, &debayer_event);
 			assert(err == 0);
 			clWaitForEvents(1, &debayer_event);
 			clReleaseEvent(debayer_event);
@@ -810,41 +1106,35 @@ namespace {
 			visionbuf_sync(&s->rgb_front_bufs[ui_idx], VISIONBUF_SYNC_FROM_DEVICE);
 
 			// auto exposure
-			const uint8_t* bgr_front_ptr = (const uint8_t*)s->rgb_front_bufs[ui_idx].addr;
 #ifndef DEBUG_DRIVER_MONITOR
 			if (cnt % 3 == 0)
 #endif
 			{
-				// for driver autoexposure, use bottom right corner
-				const int y_start = s->rgb_front_height / 3;
-				const int y_end = s->rgb_front_height;
-				const int x_start = s->rgb_front_width * 2 / 3;
-				const int x_end = s->rgb_front_width;
-
-				uint32_t lum_binning[256] = { 0, };
-				for (int y = y_start; y < y_end; ++y) {
-					for (int x = x_start; x < x_end; x += 2) { // every 2nd col
-						const uint8_t* pix = &bgr_front_ptr[y * s->rgb_front_stride + x * 3];
-						unsigned int lum = (unsigned int)pix[0] + pix[1] + pix[2];
-#ifdef DEBUG_DRIVER_MONITOR
-						uint8_t* pix_rw = (uint8_t*)pix;
+				// for driver autoexposure, use bottom right corner, every 2nd col
+				const AERegion region = {
+					.x = s->rgb_front_width * 2 / 3,
+					.y = s->rgb_front_height / 3,
+					.width = s->rgb_front_width - s->rgb_front_width * 2 / 3,
+					.height = s->rgb_front_height - s->rgb_front_height / 3,
+					.x_step = 2,
+				};
+
+				uint32_t lum_binning[AE_HISTOGRAM_BINS];
+				ae_histogram_queue(&s->front_ae_state, q, s->rgb_front_bufs_cl[ui_idx], s->rgb_front_stride,
+					region, lum_binning);
+				const int lum_med = ae_histogram_median(lum_binning, ae_region_count(region));
 
-						// set all the autoexposure pixels to pure green (pixel format is bgr)
+#ifdef DEBUG_DRIVER_MONITOR
+				// set all the autoexposure pixels to pure green (pixel format is bgr)
+				uint8_t* bgr_front_ptr = (uint8_t*)s->rgb_front_bufs[ui_idx].addr;
+				for (int y = region.y; y < region.y + region.height; ++y) {
+					for (int x = region.x; x < region.x + region.width; x += region.x_step) {
+						uint8_t* pix_rw = &bgr_front_ptr[y * s->rgb_front_stride + x * 3];
 						pix_rw[0] = pix_rw[2] = 0;
 						pix_rw[1] = 0xff;
-#endif
-						lum_binning[std::min(lum / 3, 255u)]++;
-					}
-				}
-				const unsigned int lum_total = (y_end - y_start) * (x_end - x_start) / 2;
-				unsigned int lum_cur = 0;
-				int lum_med = 0;
-				for (lum_med = 0; lum_med < 256; lum_med++) {
-					lum_cur += lum_binning[lum_med];
-					if (lum_cur >= lum_total / 2) {
-						break;
 					}
 				}
+#endif
 				camera_autoexposure(&s->cameras.front, lum_med / 256.0);
 			}
 
@@ -894,6 +1184,19 @@ namespace {
 		assert(model_sock);
 		void* model_sock_raw = zsock_resolve(model_sock);
 
+		zsock_t* timings_sock = zsock_new_pub("@tcp://*:8072");
+		assert(timings_sock);
+		void* timings_sock_raw = zsock_resolve(timings_sock);
+
+#ifndef QCOM
+		// frames with the image inlined, for subscribers that can't map the
+		// yuv buffers. Only built while someone is subscribed.
+		zsock_t* frame_inline_sock = zsock_new_xpub("@tcp://*:8073");
+		assert(frame_inline_sock);
+		void* frame_inline_sock_raw = zsock_resolve(frame_inline_sock);
+		bool frame_inline_subscribed = false;
+#endif
+
 #ifdef SEND_NET_INPUT
 		zsock_t* img_sock = zsock_new_pub("@tcp://*:9000");
 		assert(img_sock);
@@ -908,6 +1211,7 @@ namespace {
 
 		// init the net
 		LOG("processing start!");
+		bool model_output_seen = false;
 
 		for (int cnt = 0; !do_exit; cnt++) {
 			int buf_idx = tbuffer_acquire(&s->cameras.rear.camera_tb);
@@ -917,6 +1221,9 @@ namespace {
 			}
 
 			double t1 = millis_since_boot();
+			sched_frame_begin(&s->sched, t1);
+			// critical, always due
+			sched_should_run(&s->sched, SCHED_CAMERA, t1);
 
 			FrameMetadata frame_data = s->cameras.rear.camera_bufs_metadata[buf_idx];
 			uint32_t frame_id = frame_data.frame_id;
@@ -924,13 +1231,39 @@ namespace {
 			if (frame_id == -1) {
 				LOGE("no frame data? wtf");
 				tbuffer_release(&s->cameras.rear.camera_tb, buf_idx);
+				sched_cancel(&s->sched, SCHED_CAMERA);
+				sched_cancel(&s->sched, SCHED_DRIVING);
 				continue;
 			}
 
 			int ui_idx = tbuffer_select(&s->ui_tb);
 			int rgb_idx = ui_idx;
 
+			int yuv_idx = pool_select(&s->yuv_pool);
+			cl_mem yuv_cl = s->yuv_cl[yuv_idx];
+
 			cl_event debayer_event;
+#ifdef FUSED_PIPELINE
+			const bool fused = s->krnl_debayer_yuv_rear != NULL;
+			if (fused) {
+				// debayer straight into the rgb and yuv buffers
+				err = clSetKernelArg(s->krnl_debayer_yuv_rear, 0, sizeof(cl_mem), &s->camera_bufs_cl[buf_idx]);
+				cl_check_error(err);
+				err = clSetKernelArg(s->krnl_debayer_yuv_rear, 1, sizeof(cl_mem), &s->rgb_bufs_cl[rgb_idx]);
+				cl_check_error(err);
+				err = clSetKernelArg(s->krnl_debayer_yuv_rear, 2, sizeof(cl_mem), &yuv_cl);
+				cl_check_error(err);
+				err = clSetKernelArg(s->krnl_debayer_yuv_rear, 3, sizeof(float), &s->cameras.rear.digital_gain);
+				assert(err == 0);
+
+				const size_t debayer_work_size[2] = { (size_t)ALIGN(s->rgb_width, 16), (size_t)ALIGN(s->rgb_height, 8) };
+				const size_t debayer_local_work_size[2] = { 16, 8 };
+				err = clEnqueueNDRangeKernel(q, s->krnl_debayer_yuv_rear, 2, NULL,
+					debayer_work_size, debayer_local_work_size, 0, 0, &debayer_event);
+				assert(err == 0);
+			}
+			else
+#endif
 			if (s->cameras.rear.ci.bayer) {
 				err = clSetKernelArg(s->krnl_debayer_rear, 0, sizeof(cl_mem), &s->camera_bufs_cl[buf_idx]);
 				cl_check_error(err);
@@ -939,10 +1272,8 @@ namespace {
 				err = clSetKernelArg(s->krnl_debayer_rear, 2, sizeof(float), &s->cameras.rear.digital_gain);
 				assert(err == 0);
 
-				const size_t debayer_work_size = s->rgb_height; // doesn't divide evenly, is this okay?
-				const size_t debayer_local_work_size = 128;
-				err = clEnqueueNDRangeKernel(q, s->krnl_debayer_rear, 1, NULL,
-					&debayer_work_size, &debayer_local_work_size, 0, 0, &debayer_event);
+				err = debayer_enqueue(q, s->krnl_debayer_rear, s->cameras.rear.ci.hdr,
+					s->rgb_width, s->rgb_height, &debayer_event);
 				assert(err == 0);
 			}
 			else {
@@ -973,18 +1304,19 @@ namespace {
 
 			double yt1 = millis_since_boot();
 
-			int yuv_idx = pool_select(&s->yuv_pool);
-
 			s->yuv_metas[yuv_idx] = frame_data;
 
 			uint8_t* yuv_ptr_y = s->yuv_bufs[yuv_idx].y;
 			uint8_t* yuv_ptr_u = s->yuv_bufs[yuv_idx].u;
 			uint8_t* yuv_ptr_v = s->yuv_bufs[yuv_idx].v;
-			cl_mem yuv_cl = s->yuv_cl[yuv_idx];
+#ifdef FUSED_PIPELINE
+			if (!fused)
+#endif
 			rgb_to_yuv_queue(&s->rgb_to_yuv_state, q, s->rgb_bufs_cl[rgb_idx], yuv_cl);
 			visionbuf_sync(&s->yuv_ion[yuv_idx], VISIONBUF_SYNC_FROM_DEVICE);
 
 			double yt2 = millis_since_boot();
+			sched_done(&s->sched, SCHED_CAMERA, t1, yt2);
 			// keep another reference around till were done processing
 			pool_acquire(&s->yuv_pool, yuv_idx);
 
@@ -1001,16 +1333,27 @@ namespace {
 				mat3 model_transform = matmul3(s->yuv_transform, transform);
 
 				mt1 = millis_since_boot();
+				sched_should_run(&s->sched, SCHED_DRIVING, mt1);
 				s->model_bufs[ui_idx] =
 					model_eval_frame(&s->model, q, yuv_cl, s->yuv_width, s->yuv_height,
 						model_transform, img_sock_raw);
 				mt2 = millis_since_boot();
+				sched_done(&s->sched, SCHED_DRIVING, mt1, mt2);
 
 				model_publish(model_sock_raw, frame_id, model_transform, s->model_bufs[ui_idx]);
+
+				if (!model_output_seen) {
+					LOG("first model output %.1f ms after start", mt2 - s->start_ms);
+					model_output_seen = true;
+				}
+			}
+			else {
+				// no room to keep for it this frame
+				sched_cancel(&s->sched, SCHED_DRIVING);
 			}
 
 
-			// send frame event
+			// send frame event, the image stays in the yuv buffer
 			{
 				capnp::MallocMessageBuilder msg;
 				cereal::Event::Builder event = msg.initRoot<cereal::Event>();
@@ -1028,10 +1371,10 @@ namespace {
 				framed.setLensErr(frame_data.lens_err);
 				framed.setLensTruePos(frame_data.lens_true_pos);
 
-
-#ifndef QCOM
-				framed.setImage(kj::arrayPtr((const uint8_t*)s->yuv_ion[yuv_idx].addr, s->yuv_buf_size));
-#endif
+				auto image_ref = framed.initImageRef();
+				image_ref.setStream(VISION_STREAM_YUV);
+				image_ref.setBufIdx(yuv_idx);
+				image_ref.setBufLen(s->yuv_buf_size);
 
 				kj::ArrayPtr<const float> transform_vs(&s->yuv_transform.v[0], 9);
 				framed.setTransform(transform_vs);
@@ -1041,6 +1384,20 @@ namespace {
 					auto bytes = words.asBytes();
 					zmq_send(s->recorder_sock_raw, bytes.begin(), bytes.size(), ZMQ_DONTWAIT);
 				}
+
+#ifndef QCOM
+				// xpub passes on the first subscription and the last unsubscription
+				uint8_t sub;
+				while (zmq_recv(frame_inline_sock_raw, &sub, 1, ZMQ_DONTWAIT) >= 1) {
+					frame_inline_subscribed = sub == 1;
+				}
+				if (frame_inline_subscribed) {
+					framed.setImage(kj::arrayPtr((const uint8_t*)s->yuv_ion[yuv_idx].addr, s->yuv_buf_size));
+					auto words = capnp::messageToFlatArray(msg);
+					auto bytes = words.asBytes();
+					zmq_send(frame_inline_sock_raw, bytes.begin(), bytes.size(), ZMQ_DONTWAIT);
+				}
+#endif
 			}
 			// push the frame to the posenet
 			// TODO: This doesn't always have to run
@@ -1049,8 +1406,8 @@ namespace {
 			posenet_push(&s->posenet, yuv_ptr_y, s->yuv_width);
 			pt2 = millis_since_boot();
 
-			// posenet runs every 5
-			if (cnt % 5 == 0) {
+			// posenet runs every 5, if there's room
+			if (sched_should_run(&s->sched, SCHED_POSENET, pt2)) {
 				posenet_eval(&s->posenet);
 
 				// send posenet event
@@ -1074,104 +1431,46 @@ namespace {
 					zmq_send(s->posenet_sock_raw, bytes.begin(), bytes.size(), ZMQ_DONTWAIT);
 				}
 				pt3 = millis_since_boot();
+				sched_done(&s->sched, SCHED_POSENET, pt2, pt3);
 				LOGD("pre: %.2fms | posenet: %.2fms", (pt2 - pt1), (pt3 - pt1));
 			}
 
-			// one thumbnail per 5 seconds (instead of %5 == 0 posenet)
+			// one thumbnail per 5 seconds (instead of %5 == 0 posenet), the
+			// worker compresses it on the cpu so it isn't scheduled
 			if (cnt % 100 == 3) {
-				uint8_t* thumbnail_buffer = NULL;
-				uint64_t thumbnail_len = 0;
-
-				unsigned char* row = (unsigned char*)malloc(s->rgb_width / 2 * 3);
-				mt1 = millis_since_boot();
-
-				struct jpeg_compress_struct cinfo;
-				struct jpeg_error_mgr jerr;
-
-				cinfo.err = jpeg_std_error(&jerr);
-				jpeg_create_compress(&cinfo);
-				jpeg_mem_dest(&cinfo, &thumbnail_buffer, &thumbnail_len);
-
-				cinfo.image_width = s->rgb_width / 2;
-				cinfo.image_height = s->rgb_height / 2;
-				cinfo.input_components = 3;
-				cinfo.in_color_space = JCS_RGB;
-
-				jpeg_set_defaults(&cinfo);
-				jpeg_set_quality(&cinfo, 50, true);
-				jpeg_start_compress(&cinfo, true);
-
-				JSAMPROW row_pointer[1];
-				for (int i = 0; i < s->rgb_height; i += 2) {
-					for (int j = 0; j < s->rgb_width * 3; j += 6) {
-						for (int k = 0; k < 3; k++) {
-							uint16_t dat = 0;
-							dat += bgr_ptr[s->rgb_stride * i + j + k];
-							dat += bgr_ptr[s->rgb_stride * i + j + 3 + k];
-							dat += bgr_ptr[s->rgb_stride * (i + 1) + j + k];
-							dat += bgr_ptr[s->rgb_stride * (i + 1) + j + 3 + k];
-							row[(j / 2) + (2 - k)] = dat / 4;
-						}
-					}
-					row_pointer[0] = row;
-					jpeg_write_scanlines(&cinfo, row_pointer, 1);
-				}
-				free(row);
-				jpeg_finish_compress(&cinfo);
-
-				mt2 = millis_since_boot();
-				//printf("jpeg produced %lu bytes in %f\n", thumbnail_len, mt2-mt1);
-
-				capnp::MallocMessageBuilder msg;
-				cereal::Event::Builder event = msg.initRoot<cereal::Event>();
-				event.setLogMonoTime(nanos_since_boot());
-
-				auto thumbnaild = event.initThumbnail();
-				thumbnaild.setFrameId(frame_data.frame_id);
-				thumbnaild.setTimestampEof(frame_data.timestamp_eof);
-				thumbnaild.setThumbnail(kj::arrayPtr((const uint8_t*)thumbnail_buffer, thumbnail_len));
-
-				auto words = capnp::messageToFlatArray(msg);
-				auto bytes = words.asBytes();
-				zmq_send(s->thumbnail_sock_raw, bytes.begin(), bytes.size(), ZMQ_DONTWAIT);
-
-				free(thumbnail_buffer);
+				thumbnail_push(&s->thumbnail, bgr_ptr, s->rgb_stride, &frame_data);
 			}
 
 			tbuffer_dispatch(&s->ui_tb, ui_idx);
 
 			// auto exposure over big box
-			const int exposure_x = 290;
-			const int exposure_y = 282 + 40;
-			const int exposure_height = 314;
-			const int exposure_width = 560;
-			if (cnt % 3 == 0) {
-				// find median box luminance for AE
-				uint32_t lum_binning[256] = { 0, };
-				for (int y = 0; y < exposure_height; y++) {
-					for (int x = 0; x < exposure_width; x++) {
-						uint8_t lum = yuv_ptr_y[((exposure_y + y) * s->yuv_width) + exposure_x + x];
-						lum_binning[lum]++;
-					}
-				}
-				const unsigned int lum_total = exposure_height * exposure_width;
-				unsigned int lum_cur = 0;
-				int lum_med = 0;
-				for (lum_med = 0; lum_med < 256; lum_med++) {
-					// shouldn't be any values less than 16 - yuv footroom
-					lum_cur += lum_binning[lum_med];
-					if (lum_cur >= lum_total / 2) {
-						break;
-					}
-				}
-				// double avg = (double)acc / (big_box_width * big_box_height) - 16;
-				// printf("avg %d\n", lum_med);
+			double at1 = millis_since_boot();
+			if (sched_should_run(&s->sched, SCHED_REAR_AE, at1)) {
+				const AERegion region = {
+					.x = 290,
+					.y = 282 + 40,
+					.width = 560,
+					.height = 314,
+					.x_step = 1,
+				};
+
+				// find median box luminance for AE, binned on the device next to rgb_to_yuv
+				// shouldn't be any values less than 16 - yuv footroom
+				uint32_t lum_binning[AE_HISTOGRAM_BINS];
+				ae_histogram_queue(&s->rear_ae_state, q, yuv_cl, s->yuv_width, region, lum_binning);
+				const int lum_med = ae_histogram_median(lum_binning, ae_region_count(region));
 
 				camera_autoexposure(&s->cameras.rear, lum_med / 256.0);
+				sched_done(&s->sched, SCHED_REAR_AE, at1, millis_since_boot());
 			}
 
 			pool_release(&s->yuv_pool, yuv_idx);
 
+			// once a second
+			if (cnt % 20 == 0) {
+				publish_timings(s, timings_sock_raw);
+			}
+
 			// if (cnt%40 == 0) {
 			//   FILE* of = fopen("/sdcard/tmp.yuv", "wb");
 			//   fwrite(transformed_ptr_y, 1, s->transformed_width*s->transformed_height, of);
@@ -1191,6 +1490,10 @@ namespace {
 #endif
 
 		zsock_destroy(&model_sock);
+		zsock_destroy(&timings_sock);
+#ifndef QCOM
+		zsock_destroy(&frame_inline_sock);
+#endif
 
 		return NULL;
 	}
@@ -1262,6 +1565,21 @@ namespace {
 		do_exit = 1;
 	}
 
+	// Loading the models runs next to building the camera pipeline's kernels.
+	// Both only share the cl context, which is thread safe.
+	void* model_init_thread(void* arg) {
+		VisionState* s = (VisionState*)arg;
+		set_thread_name("modelinit");
+
+		double t1 = millis_since_boot();
+		model_init(&s->model, s->device_id, s->context, true);
+		monitoring_init(&s->monitoring, s->device_id, s->context);
+		posenet_init(&s->posenet);
+		LOG("models loaded in %.1f ms", millis_since_boot() - t1);
+
+		return NULL;
+	}
+
 	void party(VisionState* s, bool nomodel) {
 		int err;
 
@@ -1296,6 +1614,11 @@ namespace {
 			live_thread, s);
 		assert(err == 0);
 
+		pthread_t thumbnail_thread_handle;
+		err = pthread_create(&thumbnail_thread_handle, NULL,
+			thumbnail_thread, &s->thumbnail);
+		assert(err == 0);
+
 		// priority for cameras
 		err = set_realtime_priority(1);
 		LOG("setpriority returns %d", err);
@@ -1329,6 +1652,11 @@ namespace {
 		err = pthread_join(live_thread_handle, NULL);
 		assert(err == 0);
 
+		thumbnail_stop(&s->thumbnail);
+		LOG("joining thumbnail_thread");
+		err = pthread_join(thumbnail_thread_handle, NULL);
+		assert(err == 0);
+
 		zsock_destroy(&s->terminate_pub);
 	}
 
@@ -1358,13 +1686,16 @@ int main(int argc, char** argv) {
 
 	VisionState state = { 0 };
 	VisionState* s = &state;
+	s->start_ms = millis_since_boot();
 
 	clu_init();
 	cl_init(s);
 
-	model_init(&s->model, s->device_id, s->context, true);
-	monitoring_init(&s->monitoring, s->device_id, s->context);
-	posenet_init(&s->posenet);
+	pthread_t model_init_thread_handle;
+	err = pthread_create(&model_init_thread_handle, NULL, model_init_thread, s);
+	assert(err == 0);
+
+	sched_setup(&s->sched);
 
 	// s->zctx = zctx_shadow_zmq_ctx(zsys_init());
 
@@ -1379,13 +1710,19 @@ int main(int argc, char** argv) {
 	s->run_model = false;
 	pthread_mutex_init(&s->transform_lock, NULL);
 
+	double t1 = millis_since_boot();
 	init_buffers(s);
+	LOG("buffers and kernels ready in %.1f ms", millis_since_boot() - t1);
 
-#ifdef QCOM
+	err = pthread_join(model_init_thread_handle, NULL);
+	assert(err == 0);
+	LOG("init done %.1f ms after start", millis_since_boot() - s->start_ms);
+
+	// frame events carry an imageRef into the yuv ring, loggerd takes the rear
+	// frames from there on every platform
 	s->recorder_sock = zsock_new_pub("@tcp://*:8002");
 	assert(s->recorder_sock);
 	s->recorder_sock_raw = zsock_resolve(s->recorder_sock);
-#endif
 
 	s->monitoring_sock = zsock_new_pub("@tcp://*:8063");
 	assert(s->monitoring_sock);
@@ -1398,13 +1735,14 @@ int main(int argc, char** argv) {
 	s->thumbnail_sock = zsock_new_pub("@tcp://*:8069");
 	assert(s->thumbnail_sock);
 	s->thumbnail_sock_raw = zsock_resolve(s->thumbnail_sock);
+	thumbnail_init(&s->thumbnail, s->rgb_width, s->rgb_height, s->thumbnail_sock_raw);
 
-	cameras_open(&s->cameras, &s->camera_bufs[0], &s->focus_bufs[0], &s->stats_bufs[0], &s->front_camera_bufs[0]);
-
-	if (test_run) {
-		do_exit = true;
+	// everything is compiled and in the kernel cache by now, which is all a
+	// test run is for
+	if (!test_run) {
+		cameras_open(&s->cameras, &s->camera_bufs[0], &s->focus_bufs[0], &s->stats_bufs[0], &s->front_camera_bufs[0]);
+		party(s, no_model);
 	}
-	party(s, no_model);
 
 	zsock_destroy(&s->recorder_sock);
 	zsock_destroy(&s->monitoring_sock);
@@ -1414,6 +1752,7 @@ int main(int argc, char** argv) {
 
 	model_free(&s->model);
 	monitoring_free(&s->monitoring);
+	thumbnail_free(&s->thumbnail);
 	free_buffers(s);
 
 	cl_free(s);